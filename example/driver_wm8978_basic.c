@@ -38,6 +38,54 @@
 
 static wm8978_handle_t gs_handle;        /**< wm8978 handle */
 
+/**
+ * @brief     basic example ramp a gain stage
+ * @param[in] stage ramped gain stage
+ * @param[in] reg target register volume
+ * @return    status code
+ *            - 0 success
+ *            - 1 ramp failed
+ * @note      none
+ */
+static uint8_t a_wm8978_basic_ramp(wm8978_ramp_stage_t stage, uint8_t reg)
+{
+    uint8_t res;
+    wm8978_bool_t done;
+    wm8978_ramp_t ramp;
+    
+    /* init the ramp */
+    res = wm8978_ramp_init(&gs_handle, &ramp, WM8978_BASIC_DEFAULT_VOLUME_RAMP_MS,
+                           WM8978_BASIC_DEFAULT_VOLUME_RAMP_MAX_WRITES);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* add the stage */
+    res = wm8978_ramp_add(&gs_handle, &ramp, stage, reg);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* run the ramp */
+    done = WM8978_BOOL_FALSE;
+    while (done == WM8978_BOOL_FALSE)
+    {
+        res = wm8978_ramp_tick(&gs_handle, &ramp, WM8978_BASIC_DEFAULT_VOLUME_RAMP_TICK_MS, &done);
+        if (res != 0)
+        {
+            return 1;
+        }
+        if (done == WM8978_BOOL_FALSE)
+        {
+            wm8978_interface_delay_ms(WM8978_BASIC_DEFAULT_VOLUME_RAMP_TICK_MS);
+        }
+    }
+    
+    return 0;
+}
+
 /**
  * @brief     basic example init
  * @param[in] mode basic mode
@@ -2816,15 +2864,8 @@ uint8_t wm8978_basic_set_dac_volume(float db)
         return 1;
     }
     
-    /* set dac left volume */
-    res = wm8978_set_dac_left_volume(&gs_handle, WM8978_BOOL_TRUE, reg);
-    if (res != 0)
-    {
-        return 1;
-    }
-    
-    /* set dac right volume */
-    res = wm8978_set_dac_right_volume(&gs_handle, WM8978_BOOL_TRUE, reg);
+    /* ramp dac volume */
+    res = a_wm8978_basic_ramp(WM8978_RAMP_STAGE_DAC, reg);
     if (res != 0)
     {
         return 1;
@@ -2844,15 +2885,8 @@ uint8_t wm8978_basic_set_dac_mute(void)
 {
     uint8_t res;
     
-    /* set dac left volume */
-    res = wm8978_set_dac_left_volume(&gs_handle, WM8978_BOOL_TRUE, 0x00);
-    if (res != 0)
-    {
-        return 1;
-    }
-    
-    /* set dac right volume */
-    res = wm8978_set_dac_right_volume(&gs_handle, WM8978_BOOL_TRUE, 0x00);
+    /* ramp dac volume */
+    res = a_wm8978_basic_ramp(WM8978_RAMP_STAGE_DAC, 0x00);
     if (res != 0)
     {
         return 1;
@@ -2874,22 +2908,15 @@ uint8_t wm8978_basic_set_adc_volume(float db)
     uint8_t res;
     uint8_t reg;
     
-    /* set default adc volume */
+    /* convert volume */
     res = wm8978_volume_convert_to_register(&gs_handle, db, &reg);
     if (res != 0)
     {
         return 1;
     }
     
-    /* set adc left volume */
-    res = wm8978_set_adc_left_volume(&gs_handle, WM8978_BOOL_TRUE, reg);
-    if (res != 0)
-    {
-        return 1;
-    }
-    
-    /* set adc right volume */
-    res = wm8978_set_adc_right_volume(&gs_handle, WM8978_BOOL_TRUE, reg);
+    /* ramp adc volume */
+    res = a_wm8978_basic_ramp(WM8978_RAMP_STAGE_ADC, reg);
     if (res != 0)
     {
         return 1;
@@ -186,6 +186,9 @@ extern "C"{
 #define WM8978_BASIC_DEFAULT_LOUT2_RIGHT_SPEAKER_OUTPUT_VOLUME                            0                                            /**< 0db */
 #define WM8978_BASIC_DEFAULT_LOUT1_LEFT_HEADPHONE_OUTPUT_VOLUME                           0                                            /**< 0db */
 #define WM8978_BASIC_DEFAULT_LOUT1_RIGHT_HEADPHONE_OUTPUT_VOLUME                          0                                            /**< 0db */
+#define WM8978_BASIC_DEFAULT_VOLUME_RAMP_MS                                               50                                           /**< 50ms */
+#define WM8978_BASIC_DEFAULT_VOLUME_RAMP_TICK_MS                                          2                                            /**< 2ms */
+#define WM8978_BASIC_DEFAULT_VOLUME_RAMP_MAX_WRITES                                       2                                            /**< 2 writes per tick */
 
 /**
  * @brief wm8978 basic mode enumeration definition
@@ -52,9 +52,10 @@ extern "C"{
  * @return     status code
  *             - 0 success
  *             - 1 audio init failed
- * @note       none
+ * @note       for the write type a non zero *size is the pre allocation hint,
+ *             the file is expanded to it, contiguously where the card allows
  */
-uint8_t wav_audio_init(uint8_t type, char *name, uint32_t *size);
+uint8_t wav_audio_init(uint8_t type, char *name, uint64_t *size);
 
 /**
  * @brief  interface audio deinit
@@ -75,7 +76,7 @@ uint8_t wav_audio_deinit(void);
  *             - 1 audio read failed
  * @note       none
  */
-uint8_t wav_audio_read(uint32_t addr, uint16_t size, uint8_t *buffer);
+uint8_t wav_audio_read(uint64_t addr, uint16_t size, uint8_t *buffer);
 
 /**
  * @brief     interface audio write
@@ -87,7 +88,17 @@ uint8_t wav_audio_read(uint32_t addr, uint16_t size, uint8_t *buffer);
  *            - 1 audio write failed
  * @note      none
  */
-uint8_t wav_audio_write(uint32_t addr, uint16_t size, uint8_t *buffer);
+uint8_t wav_audio_write(uint64_t addr, uint16_t size, uint8_t *buffer);
+
+/**
+ * @brief     interface audio truncate
+ * @param[in] size file length to keep
+ * @return    status code
+ *            - 0 success
+ *            - 1 audio truncate failed
+ * @note      none
+ */
+uint8_t wav_audio_truncate(uint64_t size);
 
 /**
  * @brief     interface iis bus init
@@ -162,6 +173,17 @@ uint8_t wav_iis_set_freq(uint32_t freq);
  */
 uint8_t wav_iis_write(uint16_t *buf, uint16_t len);
 
+/**
+ * @brief     interface iis bus write once
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t wav_iis_write_once(uint16_t *buf, uint16_t len);
+
 /**
  * @brief      interface iis bus read
  * @param[out] *buf pointer to a data buffer
@@ -173,6 +195,57 @@ uint8_t wav_iis_write(uint16_t *buf, uint16_t len);
  */
 uint8_t wav_iis_read(uint16_t *buf, uint16_t len);
 
+/**
+ * @brief      interface iis get the rx dma remaining count
+ * @param[out] *remain pointer to a remaining count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       the count is in half words
+ */
+uint8_t wav_iis_get_remain(uint16_t *remain);
+
+/**
+ * @brief      interface iis get the tx dma remaining count
+ * @param[out] *remain pointer to a remaining count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       the count is in half words
+ */
+uint8_t wav_iis_get_tx_remain(uint16_t *remain);
+
+/**
+ * @brief      interface iis transmit and receive
+ * @param[in]  *tx pointer to a transmit buffer
+ * @param[out] *rx pointer to a receive buffer
+ * @param[in]  len buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 1 transmit receive failed
+ * @note       none
+ */
+uint8_t wav_iis_transmit_receive(uint16_t *tx, uint16_t *rx, uint16_t len);
+
+/**
+ * @brief      interface get the audio buffer
+ * @param[out] **buf pointer to a buffer address
+ * @param[out] *size pointer to a buffer size
+ * @param[out] *segment pointer to a segment number
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       the buffer is placed in dma capable sram and shared by all wav handles
+ */
+uint8_t wav_buffer_get(uint8_t **buf, uint32_t *size, uint8_t *segment);
+
+/**
+ * @brief  interface get the timestamp
+ * @return timestamp in us
+ * @note   none
+ */
+uint32_t wav_timestamp_us(void);
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
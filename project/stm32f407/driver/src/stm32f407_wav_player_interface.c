@@ -46,6 +46,19 @@
 FATFS g_fs;        /**< fatfs handle */
 FIL g_file;        /**< fs handle */
 
+/**
+ * @brief audio buffer definition
+ * @note  ccm ram can't be accessed by the dma, so keep it in sram
+ */
+static uint32_t gs_buffer[WAV_BUFFER_SIZE / 4];        /**< audio buffer */
+
+/**
+ * @brief timestamp var definition
+ */
+static uint8_t gs_timestamp_inited = 0;        /**< timestamp inited flag */
+static uint32_t gs_timestamp_cycle = 0;        /**< last cycle counter */
+static uint32_t gs_timestamp_us = 0;           /**< timestamp in us */
+
 /**
  * @brief      interface audio init
  * @param[in]  type open type, 0 is read and 1 is write.
@@ -54,9 +67,10 @@ FIL g_file;        /**< fs handle */
  * @return     status code
  *             - 0 success
  *             - 1 audio init failed
- * @note       none
+ * @note       for the write type a non zero *size is the pre allocation hint,
+ *             the file is expanded to it, contiguously where the card allows
  */
-uint8_t wav_audio_init(uint8_t type, char *name, uint32_t *size)
+uint8_t wav_audio_init(uint8_t type, char *name, uint64_t *size)
 {
     FRESULT res;
     
@@ -80,6 +94,27 @@ uint8_t wav_audio_init(uint8_t type, char *name, uint32_t *size)
         {
             return 1;
         }
+        if (*size != 0)
+        {
+            res = f_expand(&g_file, *size, 1);
+            if (res != FR_OK)
+            {
+                res = f_lseek(&g_file, *size);
+                if ((res != FR_OK) || (f_size(&g_file) != *size))
+                {
+                    (void)f_close(&g_file);
+                    
+                    return 1;
+                }
+                res = f_lseek(&g_file, 0);
+                if (res != FR_OK)
+                {
+                    (void)f_close(&g_file);
+                    
+                    return 1;
+                }
+            }
+        }
     }
     *size = f_size(&g_file);
     
@@ -121,7 +156,7 @@ uint8_t wav_audio_deinit(void)
  *             - 1 audio read failed
  * @note       none
  */
-uint8_t wav_audio_read(uint32_t addr, uint16_t size, uint8_t *buffer)
+uint8_t wav_audio_read(uint64_t addr, uint16_t size, uint8_t *buffer)
 {
     FRESULT res;
     UINT bw;
@@ -148,9 +183,9 @@ uint8_t wav_audio_read(uint32_t addr, uint16_t size, uint8_t *buffer)
  * @return    status code
  *            - 0 success
  *            - 1 audio write failed
- * @note      none
+ * @note      a write at address 0 is the wav header and is synced to the card
  */
-uint8_t wav_audio_write(uint32_t addr, uint16_t size, uint8_t *buffer)
+uint8_t wav_audio_write(uint64_t addr, uint16_t size, uint8_t *buffer)
 {
     FRESULT res;
     UINT bw;
@@ -165,6 +200,40 @@ uint8_t wav_audio_write(uint32_t addr, uint16_t size, uint8_t *buffer)
     {
         return 1;
     }
+    if (addr == 0)
+    {
+        res = f_sync(&g_file);
+        if (res != FR_OK)
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     interface audio truncate
+ * @param[in] size file length to keep
+ * @return    status code
+ *            - 0 success
+ *            - 1 audio truncate failed
+ * @note      none
+ */
+uint8_t wav_audio_truncate(uint64_t size)
+{
+    FRESULT res;
+    
+    res = f_lseek(&g_file, size);
+    if (res != FR_OK)
+    {
+        return 1;
+    }
+    res = f_truncate(&g_file);
+    if (res != FR_OK)
+    {
+        return 1;
+    }
     
     return 0;
 }
@@ -268,6 +337,20 @@ uint8_t wav_iis_write(uint16_t *buf, uint16_t len)
     return iis_write(buf, len);
 }
 
+/**
+ * @brief     interface iis bus write once
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t wav_iis_write_once(uint16_t *buf, uint16_t len)
+{
+    return iis_write_once(buf, len);
+}
+
 /**
  * @brief      interface iis bus read
  * @param[out] *buf pointer to a data buffer
@@ -282,6 +365,101 @@ uint8_t wav_iis_read(uint16_t *buf, uint16_t len)
     return iis_read(buf, len);
 }
 
+/**
+ * @brief      interface iis get the rx dma remaining count
+ * @param[out] *remain pointer to a remaining count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       the count is in half words
+ */
+uint8_t wav_iis_get_remain(uint16_t *remain)
+{
+    return iis_get_rx_remain(remain);
+}
+
+/**
+ * @brief      interface iis get the tx dma remaining count
+ * @param[out] *remain pointer to a remaining count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       the count is in half words
+ */
+uint8_t wav_iis_get_tx_remain(uint16_t *remain)
+{
+    return iis_get_tx_remain(remain);
+}
+
+/**
+ * @brief      interface iis transmit and receive
+ * @param[in]  *tx pointer to a transmit buffer
+ * @param[out] *rx pointer to a receive buffer
+ * @param[in]  len buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 1 transmit receive failed
+ * @note       none
+ */
+uint8_t wav_iis_transmit_receive(uint16_t *tx, uint16_t *rx, uint16_t len)
+{
+    return iis_transmit_receive(tx, rx, len);
+}
+
+/**
+ * @brief      interface get the audio buffer
+ * @param[out] **buf pointer to a buffer address
+ * @param[out] *size pointer to a buffer size
+ * @param[out] *segment pointer to a segment number
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       the buffer is placed in dma capable sram and shared by all wav handles
+ */
+uint8_t wav_buffer_get(uint8_t **buf, uint32_t *size, uint8_t *segment)
+{
+    *buf = (uint8_t *)gs_buffer;
+    *size = sizeof(gs_buffer);
+    *segment = WAV_BUFFER_SEGMENT;
+    
+    return 0;
+}
+
+/**
+ * @brief  interface get the timestamp
+ * @return timestamp in us
+ * @note   the dwt cycle counter wraps every 25s at 168MHz,
+ *         so it is folded into a 32 bits us counter on every call
+ */
+uint32_t wav_timestamp_us(void)
+{
+    uint32_t primask;
+    uint32_t cycle;
+    uint32_t mhz;
+    uint32_t diff;
+    uint32_t res;
+    
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (gs_timestamp_inited == 0)
+    {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+        gs_timestamp_cycle = 0;
+        gs_timestamp_inited = 1;
+    }
+    mhz = SystemCoreClock / 1000000;
+    cycle = DWT->CYCCNT;
+    diff = cycle - gs_timestamp_cycle;
+    gs_timestamp_us += diff / mhz;
+    gs_timestamp_cycle = cycle - (diff % mhz);
+    res = gs_timestamp_us;
+    __set_PRIMASK(primask);
+    
+    return res;
+}
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
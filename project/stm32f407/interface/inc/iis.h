@@ -87,6 +87,26 @@ uint8_t iis_deinit(void);
  */
 uint8_t iis_stop(void);
 
+/**
+ * @brief      iis bus get the rx dma remaining count
+ * @param[out] *remain pointer to a remaining count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       the count is in half words and stays valid after iis_stop
+ */
+uint8_t iis_get_rx_remain(uint16_t *remain);
+
+/**
+ * @brief      iis bus get the tx dma remaining count
+ * @param[out] *remain pointer to a remaining count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       the count is in half words of the running transfer
+ */
+uint8_t iis_get_tx_remain(uint16_t *remain);
+
 /**
  * @brief  iis bus pause
  * @return status code
@@ -127,6 +147,17 @@ uint8_t iis_set_freq(uint32_t freq);
  */
 uint8_t iis_write(uint16_t *buf, uint16_t len);
 
+/**
+ * @brief     iis bus write once
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the dma stops after one pass, the half and complete callbacks still fire
+ */
+uint8_t iis_write_once(uint16_t *buf, uint16_t len);
+
 /**
  * @brief      iis bus read
  * @param[out] *buf pointer to a data buffer
@@ -134,10 +165,23 @@ uint8_t iis_write(uint16_t *buf, uint16_t len);
  * @return     status code
  *             - 0 success
  *             - 1 read failed
- * @note       none
+ * @note       the full duplex transmit side repeats one zero half word, so len is
+ *             only limited by the 65535 half words of one dma transfer
  */
 uint8_t iis_read(uint16_t *buf, uint16_t len);
 
+/**
+ * @brief      iis bus transmit and receive
+ * @param[in]  *tx pointer to a transmit buffer
+ * @param[out] *rx pointer to a receive buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 transmit receive failed
+ * @note       none
+ */
+uint8_t iis_transmit_receive(uint16_t *tx, uint16_t *rx, uint16_t len);
+
 /**
  * @brief  iis get handle
  * @return pointer to an iis handle
@@ -47,7 +47,32 @@ const uint32_t gc_iis_pllr[8] = {5, 4, 4, 4, 4, 6, 3, 1};
 I2S_HandleTypeDef g_iis_handle;               /**< iis handle */
 DMA_HandleTypeDef g_iis_tx_dma_handle;        /**< iis tx dma handle */
 DMA_HandleTypeDef g_iis_rx_dma_handle;        /**< iis rx dma handle */
-static uint16_t gs_buf[1024 * 16];            /**< inner buffer */
+static uint16_t gs_dummy = 0;                /**< dummy transmit half word */
+
+/**
+ * @brief     set the tx dma memory increment and mode
+ * @param[in] inc DMA_MINC_ENABLE or DMA_MINC_DISABLE
+ * @param[in] mode DMA_CIRCULAR or DMA_NORMAL
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      the dma must be stopped
+ */
+static uint8_t a_iis_tx_dma_config(uint32_t inc, uint32_t mode)
+{
+    if ((g_iis_handle.hdmatx->Init.MemInc == inc) && (g_iis_handle.hdmatx->Init.Mode == mode))
+    {
+        return 0;
+    }
+    g_iis_handle.hdmatx->Init.MemInc = inc;
+    g_iis_handle.hdmatx->Init.Mode = mode;
+    if (HAL_DMA_Init(g_iis_handle.hdmatx) != HAL_OK)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
 
 /**
  * @brief     iis bus init
@@ -157,6 +182,33 @@ uint8_t iis_deinit(void)
  */
 uint8_t iis_write(uint16_t *buf, uint16_t len)
 {
+    if (a_iis_tx_dma_config(DMA_MINC_ENABLE, DMA_CIRCULAR) != 0)
+    {
+        return 1;
+    }
+    if (HAL_I2S_Transmit_DMA(&g_iis_handle, buf, len) != HAL_OK)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     iis bus write once
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the dma stops after one pass, the half and complete callbacks still fire
+ */
+uint8_t iis_write_once(uint16_t *buf, uint16_t len)
+{
+    if (a_iis_tx_dma_config(DMA_MINC_ENABLE, DMA_NORMAL) != 0)
+    {
+        return 1;
+    }
     if (HAL_I2S_Transmit_DMA(&g_iis_handle, buf, len) != HAL_OK)
     {
         return 1;
@@ -172,16 +224,41 @@ uint8_t iis_write(uint16_t *buf, uint16_t len)
  * @return     status code
  *             - 0 success
  *             - 1 read failed
- * @note       none
+ * @note       the full duplex transmit side repeats one zero half word, so len is
+ *             only limited by the 65535 half words of one dma transfer
  */
 uint8_t iis_read(uint16_t *buf, uint16_t len)
 {
-    if (len > 16 * 1024)
+    if (a_iis_tx_dma_config(DMA_MINC_DISABLE, DMA_CIRCULAR) != 0)
+    {
+        return 1;
+    }
+    
+    if (HAL_I2SEx_TransmitReceive_DMA(&g_iis_handle, &gs_dummy, buf, len) != HAL_OK)
     {
         return 1;
     }
     
-    if (HAL_I2SEx_TransmitReceive_DMA(&g_iis_handle, gs_buf, buf,len) != HAL_OK)
+    return 0;
+}
+
+/**
+ * @brief      iis bus transmit and receive
+ * @param[in]  *tx pointer to a transmit buffer
+ * @param[out] *rx pointer to a receive buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 transmit receive failed
+ * @note       none
+ */
+uint8_t iis_transmit_receive(uint16_t *tx, uint16_t *rx, uint16_t len)
+{
+    if (a_iis_tx_dma_config(DMA_MINC_ENABLE, DMA_CIRCULAR) != 0)
+    {
+        return 1;
+    }
+    if (HAL_I2SEx_TransmitReceive_DMA(&g_iis_handle, tx, rx, len) != HAL_OK)
     {
         return 1;
     }
@@ -206,6 +283,44 @@ uint8_t iis_stop(void)
     return 0;
 }
 
+/**
+ * @brief      iis bus get the rx dma remaining count
+ * @param[out] *remain pointer to a remaining count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       the count is in half words and stays valid after iis_stop
+ */
+uint8_t iis_get_rx_remain(uint16_t *remain)
+{
+    if (g_iis_handle.hdmarx == NULL)
+    {
+        return 1;
+    }
+    *remain = (uint16_t)__HAL_DMA_GET_COUNTER(g_iis_handle.hdmarx);
+    
+    return 0;
+}
+
+/**
+ * @brief      iis bus get the tx dma remaining count
+ * @param[out] *remain pointer to a remaining count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       the count is in half words of the running transfer
+ */
+uint8_t iis_get_tx_remain(uint16_t *remain)
+{
+    if (g_iis_handle.hdmatx == NULL)
+    {
+        return 1;
+    }
+    *remain = (uint16_t)__HAL_DMA_GET_COUNTER(g_iis_handle.hdmatx);
+    
+    return 0;
+}
+
 /**
  * @brief  iis bus pause
  * @return status code
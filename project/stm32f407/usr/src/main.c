@@ -36,6 +36,7 @@
 
 #include "driver_wm8978_play_test.h"
 #include "driver_wm8978_record_test.h"
+#include "driver_wm8978_latency_test.h"
 #include "driver_wm8978_basic.h"
 #include "shell.h"
 #include "clock.h"
@@ -78,6 +79,7 @@ void HAL_I2S_TxCpltCallback(I2S_HandleTypeDef *hi2s)
 void HAL_I2SEx_TxRxHalfCpltCallback(I2S_HandleTypeDef *hi2s)
 {
     wm8978_record_file_fill(0);
+    wm8978_latency_buffer_fill(0);
 }
 
 /**
@@ -88,6 +90,7 @@ void HAL_I2SEx_TxRxHalfCpltCallback(I2S_HandleTypeDef *hi2s)
 void HAL_I2SEx_TxRxCpltCallback(I2S_HandleTypeDef *hi2s)
 {
     wm8978_record_file_fill(1);
+    wm8978_latency_buffer_fill(1);
 }
 
 /**
@@ -264,9 +267,48 @@ uint8_t wm8978(uint8_t argc, char **argv)
         
         return 0;
     }
+    else if (strcmp("t_stream", type) == 0)
+    {
+        if (wm8978_play_stream_test(time) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_source", type) == 0)
+    {
+        if (wm8978_play_source_test() != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_cache", type) == 0)
+    {
+        if (wm8978_play_cache_test() != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_latency", type) == 0)
+    {
+        if (wm8978_latency_test() != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
     else if (strcmp("e_play", type) == 0)
     {
         uint8_t res;
+        uint8_t *buf;
+        uint32_t size;
+        uint8_t segment;
         wm8978_companding_t companding = WM8978_COMPANDING_LINEAR;
         wm8978_channel_t channel = WM8978_CHANNEL_STEREO;
         wm8978_word_length_t length = WM8978_WORD_LENGTH_16_BITS;
@@ -284,9 +326,11 @@ uint8_t wm8978(uint8_t argc, char **argv)
         WAV_LINK_IIS_RESUME(wm8978_play_get_handle(), wav_iis_resume);
         WAV_LINK_IIS_SET_FREQ(wm8978_play_get_handle(), wav_iis_set_freq);
         WAV_LINK_IIS_WRITE(wm8978_play_get_handle(), wav_iis_write);
+        WAV_LINK_IIS_WRITE_ONCE(wm8978_play_get_handle(), wav_iis_write_once);
         WAV_LINK_IIS_READ(wm8978_play_get_handle(), wav_iis_read);
         WAV_LINK_DELAY_MS(wm8978_play_get_handle(), wav_delay_ms);
         WAV_LINK_DEBUG_PRINT(wm8978_play_get_handle(), wav_debug_print);
+        WAV_LINK_TIMESTAMP_US(wm8978_play_get_handle(), wav_timestamp_us);
         
         /* start play */
         wm8978_interface_debug_print("wm8978: start play.\n");
@@ -310,6 +354,26 @@ uint8_t wm8978(uint8_t argc, char **argv)
             return 1;
         }
         
+        /* set buffer */
+        res = wav_buffer_get(&buf, &size, &segment);
+        if (res != 0)
+        {
+            wm8978_interface_debug_print("wm8978: wav buffer get failed.\n");
+            (void)wav_deinit(wm8978_play_get_handle());
+            (void)wm8978_basic_deinit();
+            
+            return 1;
+        }
+        res = wav_set_buffer(wm8978_play_get_handle(), buf, size, segment);
+        if (res != 0)
+        {
+            wm8978_interface_debug_print("wm8978: wav set buffer failed.\n");
+            (void)wav_deinit(wm8978_play_get_handle());
+            (void)wm8978_basic_deinit();
+            
+            return 1;
+        }
+        
         /* wav player init */
         res = wav_player_init(wm8978_play_get_handle(), path);
         if (res != 0)
@@ -429,7 +493,7 @@ uint8_t wm8978(uint8_t argc, char **argv)
             }
             
             wav_delay_ms(1000);
-            wav_debug_print("wav: playing %d/%d.\n", wm8978_play_get_handle()->pos, wm8978_play_get_handle()->size);
+            wav_debug_print("wav: playing %dKB/%dKB.\n", (uint32_t)(wm8978_play_get_handle()->pos / 1024), (uint32_t)(wm8978_play_get_handle()->size / 1024));
             
             /* read uart */
             g_len = uart_read(g_buf, 256);
@@ -483,6 +547,9 @@ uint8_t wm8978(uint8_t argc, char **argv)
     else if (strcmp("e_record", type) == 0)
     {
         uint8_t res;
+        uint8_t *buf;
+        uint32_t size;
+        uint8_t segment;
         uint32_t timeout;
         wm8978_companding_t companding = WM8978_COMPANDING_LINEAR;
         wm8978_channel_t channel = WM8978_CHANNEL_STEREO;
@@ -494,6 +561,7 @@ uint8_t wm8978(uint8_t argc, char **argv)
         WAV_LINK_AUDIO_DEINIT(wm8978_record_get_handle(), wav_audio_deinit);
         WAV_LINK_AUDIO_READ(wm8978_record_get_handle(), wav_audio_read);
         WAV_LINK_AUDIO_WRITE(wm8978_record_get_handle(), wav_audio_write);
+        WAV_LINK_AUDIO_TRUNCATE(wm8978_record_get_handle(), wav_audio_truncate);
         WAV_LINK_IIS_INIT(wm8978_record_get_handle(), wav_iis_init);
         WAV_LINK_IIS_DEINIT(wm8978_record_get_handle(), wav_iis_deinit);
         WAV_LINK_IIS_STOP(wm8978_record_get_handle(), wav_iis_stop);
@@ -504,6 +572,8 @@ uint8_t wm8978(uint8_t argc, char **argv)
         WAV_LINK_IIS_READ(wm8978_record_get_handle(), wav_iis_read);
         WAV_LINK_DELAY_MS(wm8978_record_get_handle(), wav_delay_ms);
         WAV_LINK_DEBUG_PRINT(wm8978_record_get_handle(), wav_debug_print);
+        WAV_LINK_TIMESTAMP_US(wm8978_record_get_handle(), wav_timestamp_us);
+        WAV_LINK_IIS_GET_REMAIN(wm8978_record_get_handle(), wav_iis_get_remain);
         
         /* start record test */
         wm8978_interface_debug_print("wm8978: start record test.\n");
@@ -527,6 +597,26 @@ uint8_t wm8978(uint8_t argc, char **argv)
             return 1;
         }
         
+        /* set buffer */
+        res = wav_buffer_get(&buf, &size, &segment);
+        if (res != 0)
+        {
+            wm8978_interface_debug_print("wm8978: wav buffer get failed.\n");
+            (void)wav_deinit(wm8978_record_get_handle());
+            (void)wm8978_basic_deinit();
+            
+            return 1;
+        }
+        res = wav_set_buffer(wm8978_record_get_handle(), buf, size, segment);
+        if (res != 0)
+        {
+            wm8978_interface_debug_print("wm8978: wav set buffer failed.\n");
+            (void)wav_deinit(wm8978_record_get_handle());
+            (void)wm8978_basic_deinit();
+            
+            return 1;
+        }
+        
         /* config */
         res = wm8978_basic_config(companding, channel, length);
         if (res != 0)
@@ -551,6 +641,17 @@ uint8_t wm8978(uint8_t argc, char **argv)
             return 1;
         }
         
+        /* pre allocate the record file */
+        res = wav_record_set_preallocate(wm8978_record_get_handle(), time + 1);
+        if (res != 0)
+        {
+            wm8978_interface_debug_print("wm8978: wav set preallocate failed.\n");
+            (void)wav_deinit(wm8978_record_get_handle());
+            (void)wm8978_basic_deinit();
+            
+            return 1;
+        }
+        
         /* record start */
         res = wav_record_start(wm8978_record_get_handle(), 22050, path);
         if (res != 0)
@@ -570,7 +671,7 @@ uint8_t wm8978(uint8_t argc, char **argv)
         {
             wav_delay_ms(1000);
             timeout--;
-            wav_debug_print("wav: record %d bytes time %d/%ds.\n", wm8978_record_get_handle()->pos, time - timeout, time);
+            wav_debug_print("wav: record %dKB time %d/%ds.\n", (uint32_t)(wm8978_record_get_handle()->pos / 1024), time - timeout, time);
             
             /* read uart */
             g_len = uart_read(g_buf, 256);
@@ -658,6 +759,34 @@ uint8_t wm8978(uint8_t argc, char **argv)
         
         return 0;
     }
+    else if (strcmp("e_health", type) == 0)
+    {
+        wav_health_t health;
+        wav_handle_t *handle;
+        
+        /* get the running stream */
+        handle = wm8978_play_get_handle();
+        if (handle->status == 0)
+        {
+            handle = wm8978_record_get_handle();
+        }
+        
+        /* get health */
+        if (wav_get_health(handle, &health) != 0)
+        {
+            wm8978_interface_debug_print("wm8978: no stream is running.\n");
+            
+            return 1;
+        }
+        
+        /* output */
+        wm8978_interface_debug_print("wm8978: fill %d underrun %d overrun %d late %d.\n", 
+                                     health.fill, health.underrun, health.overrun, health.late);
+        wm8978_interface_debug_print("wm8978: max fill %dus min slack %dus.\n", 
+                                     health.max_fill_us, health.min_slack_us);
+        
+        return 0;
+    }
     else if (strcmp("e_mute", type) == 0)
     {
         /* set dac mute */
@@ -680,23 +809,28 @@ uint8_t wm8978(uint8_t argc, char **argv)
         wm8978_interface_debug_print("  wm8978 (-p | --port)\n");
         wm8978_interface_debug_print("  wm8978 (-t play | --test=play) [--file=<path>]\n");
         wm8978_interface_debug_print("  wm8978 (-t record | --test=record) [--file=<path>] [--time=<second>]\n");
+        wm8978_interface_debug_print("  wm8978 (-t stream | --test=stream) [--time=<second>]\n");
+        wm8978_interface_debug_print("  wm8978 (-t source | --test=source)\n");
+        wm8978_interface_debug_print("  wm8978 (-t cache | --test=cache)\n");
+        wm8978_interface_debug_print("  wm8978 (-t latency | --test=latency)\n");
         wm8978_interface_debug_print("  wm8978 (-e play | --example=play) [--file=<path>]\n");
         wm8978_interface_debug_print("  wm8978 (-e record | --example=record) [--file=<path>] [--time=<second>]\n");
         wm8978_interface_debug_print("  wm8978 (-e volume | --example=volume) [--volume=<vol>]\n");
         wm8978_interface_debug_print("  wm8978 (-e microphone | --example=microphone) [--volume=<vol>]\n");
         wm8978_interface_debug_print("  wm8978 (-e mute | --example=mute)\n");
+        wm8978_interface_debug_print("  wm8978 (-e health | --example=health)\n");
         wm8978_interface_debug_print("\n");
         wm8978_interface_debug_print("Options:\n");
-        wm8978_interface_debug_print("  -e <play | record | volume | microphone | mute>, --example=<play | record | volume | microphone | mute>\n");
+        wm8978_interface_debug_print("  -e <play | record | volume | microphone | mute | health>, --example=<play | record | volume | microphone | mute | health>\n");
         wm8978_interface_debug_print("                          Run the driver example.\n");
         wm8978_interface_debug_print("      --file=<path>       Set the wav file path.([default: test.wav])\n");
         wm8978_interface_debug_print("  -h, --help              Show the help.\n");
         wm8978_interface_debug_print("  -i, --information       Show the chip information.\n");
         wm8978_interface_debug_print("      --volume=<vol>      Set the volume.([default: -10.0])\n");
         wm8978_interface_debug_print("  -p, --port              Display the pin connections of the current board.\n");
-        wm8978_interface_debug_print("  -t <play | record>, --test=<play | record>\n");
+        wm8978_interface_debug_print("  -t <play | record | stream | source | cache | latency>, --test=<play | record | stream | source | cache | latency>\n");
         wm8978_interface_debug_print("                          Run the driver test.\n");
-        wm8978_interface_debug_print("      --time=<second>     Set the record time.([default: 60]).\n");
+        wm8978_interface_debug_print("      --time=<second>     Set the record or stream time.([default: 60]).\n");
         
         return 0;
     }
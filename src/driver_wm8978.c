@@ -124,6 +124,213 @@ static const uint16_t gsc_wm8978_init_reg[58] =
     0X0001, 0X0001
 }; 
 
+/**
+ * @brief wm8978 field descriptor structure definition
+ */
+typedef struct wm8978_field_desc_s
+{
+    uint8_t reg;          /**< register address */
+    uint8_t shift;        /**< field lsb position */
+    uint8_t width;        /**< field width in bits */
+    uint16_t max;         /**< max valid field value */
+} wm8978_field_desc_t;
+
+/**
+ * @brief field descriptor table, indexed by wm8978_field_t
+ */
+static const wm8978_field_desc_t gsc_wm8978_field[184] =
+{
+    {WM8978_REG_POWER_MANAGE_1, 8, 1, 0x001},               /* dc buffer */
+    {WM8978_REG_POWER_MANAGE_1, 7, 1, 0x001},               /* out4 mixer */
+    {WM8978_REG_POWER_MANAGE_1, 6, 1, 0x001},               /* out3 mixer */
+    {WM8978_REG_POWER_MANAGE_1, 5, 1, 0x001},               /* pll */
+    {WM8978_REG_POWER_MANAGE_1, 4, 1, 0x001},               /* microphone bias */
+    {WM8978_REG_POWER_MANAGE_1, 3, 1, 0x001},               /* analogue amplifier bias */
+    {WM8978_REG_POWER_MANAGE_1, 2, 1, 0x001},               /* unused input output tie off buffer */
+    {WM8978_REG_POWER_MANAGE_1, 0, 2, 0x003},               /* reference impedance */
+    {WM8978_REG_POWER_MANAGE_2, 8, 1, 0x001},               /* right out1 */
+    {WM8978_REG_POWER_MANAGE_2, 7, 1, 0x001},               /* left out1 */
+    {WM8978_REG_POWER_MANAGE_2, 6, 1, 0x001},               /* sleep */
+    {WM8978_REG_POWER_MANAGE_2, 5, 1, 0x001},               /* right channel input boost */
+    {WM8978_REG_POWER_MANAGE_2, 4, 1, 0x001},               /* left channel input boost */
+    {WM8978_REG_POWER_MANAGE_2, 3, 1, 0x001},               /* right channel input pga */
+    {WM8978_REG_POWER_MANAGE_2, 2, 1, 0x001},               /* left channel input pga */
+    {WM8978_REG_POWER_MANAGE_2, 1, 1, 0x001},               /* right channel adc */
+    {WM8978_REG_POWER_MANAGE_2, 0, 1, 0x001},               /* left channel adc */
+    {WM8978_REG_POWER_MANAGE_3, 8, 1, 0x001},               /* out4 */
+    {WM8978_REG_POWER_MANAGE_3, 7, 1, 0x001},               /* out3 */
+    {WM8978_REG_POWER_MANAGE_3, 6, 1, 0x001},               /* left out2 */
+    {WM8978_REG_POWER_MANAGE_3, 5, 1, 0x001},               /* right out2 */
+    {WM8978_REG_POWER_MANAGE_3, 3, 1, 0x001},               /* right output channel mixer */
+    {WM8978_REG_POWER_MANAGE_3, 2, 1, 0x001},               /* left output channel mixer */
+    {WM8978_REG_POWER_MANAGE_3, 1, 1, 0x001},               /* right channel dac */
+    {WM8978_REG_POWER_MANAGE_3, 0, 1, 0x001},               /* left channel dac */
+    {WM8978_REG_AUDIO_INTERFACE, 8, 1, 0x001},              /* bclk polarity */
+    {WM8978_REG_AUDIO_INTERFACE, 7, 1, 0x001},              /* lrclk polarity */
+    {WM8978_REG_AUDIO_INTERFACE, 5, 2, 0x003},              /* word length */
+    {WM8978_REG_AUDIO_INTERFACE, 3, 2, 0x003},              /* data format */
+    {WM8978_REG_AUDIO_INTERFACE, 2, 1, 0x001},              /* dac appear */
+    {WM8978_REG_AUDIO_INTERFACE, 1, 1, 0x001},              /* adc appear */
+    {WM8978_REG_AUDIO_INTERFACE, 0, 1, 0x001},              /* channel */
+    {WM8978_REG_COMPANDING_CTRL, 5, 1, 0x001},              /* companding 8bit mode */
+    {WM8978_REG_COMPANDING_CTRL, 3, 2, 0x003},              /* dac companding */
+    {WM8978_REG_COMPANDING_CTRL, 1, 2, 0x003},              /* adc companding */
+    {WM8978_REG_COMPANDING_CTRL, 0, 1, 0x001},              /* loopback */
+    {WM8978_REG_CLOCK_GEN_CTRL, 8, 1, 0x001},               /* clksel */
+    {WM8978_REG_CLOCK_GEN_CTRL, 5, 3, 0x007},               /* mclk div */
+    {WM8978_REG_CLOCK_GEN_CTRL, 2, 3, 0x007},               /* bclk div */
+    {WM8978_REG_CLOCK_GEN_CTRL, 0, 1, 0x001},               /* clock mode */
+    {WM8978_REG_ADDITIONAL_CTRL, 1, 3, 0x007},              /* approximate sample rate */
+    {WM8978_REG_ADDITIONAL_CTRL, 0, 1, 0x001},              /* slow clock */
+    {WM8978_REG_GPIO, 4, 2, 0x003},                         /* pll div */
+    {WM8978_REG_GPIO, 3, 1, 0x001},                         /* gpio1 polarity */
+    {WM8978_REG_GPIO, 0, 3, 0x007},                         /* gpio1 select */
+    {WM8978_REG_JACK_DETECT_CONTROL, 8, 1, 0x001},          /* vmid 1 */
+    {WM8978_REG_JACK_DETECT_CONTROL, 7, 1, 0x001},          /* vmid 0 */
+    {WM8978_REG_JACK_DETECT_CONTROL, 6, 1, 0x001},          /* jack detection */
+    {WM8978_REG_JACK_DETECT_CONTROL, 4, 2, 0x003},          /* jack gpio */
+    {WM8978_REG_DAC_CONTROL, 6, 1, 0x001},                  /* soft mute */
+    {WM8978_REG_DAC_CONTROL, 3, 1, 0x001},                  /* dac oversample rate */
+    {WM8978_REG_DAC_CONTROL, 2, 1, 0x001},                  /* amute */
+    {WM8978_REG_DAC_CONTROL, 1, 1, 0x001},                  /* right dac output polarity */
+    {WM8978_REG_DAC_CONTROL, 0, 1, 0x001},                  /* left dac output polarity */
+    {WM8978_REG_LEFT_DAC_DIGITAL_VOL, 8, 1, 0x001},         /* dac left volume update */
+    {WM8978_REG_LEFT_DAC_DIGITAL_VOL, 0, 8, 0x0FF},         /* dac left volume */
+    {WM8978_REG_RIGHT_DAC_DIGITAL_VOL, 8, 1, 0x001},        /* dac right volume update */
+    {WM8978_REG_RIGHT_DAC_DIGITAL_VOL, 0, 8, 0x0FF},        /* dac right volume */
+    {WM8978_REG_JACK_DETECT_CONTROL2, 4, 4, 0x00F},         /* jack logic 1 */
+    {WM8978_REG_JACK_DETECT_CONTROL2, 0, 4, 0x00F},         /* jack logic 0 */
+    {WM8978_REG_ADC_CONTROL, 8, 1, 0x001},                  /* high pass filter */
+    {WM8978_REG_ADC_CONTROL, 7, 1, 0x001},                  /* chip mode */
+    {WM8978_REG_ADC_CONTROL, 4, 3, 0x007},                  /* high pass filter cut off */
+    {WM8978_REG_ADC_CONTROL, 3, 1, 0x001},                  /* adc oversample rate */
+    {WM8978_REG_ADC_CONTROL, 1, 1, 0x001},                  /* adc right channel polarity */
+    {WM8978_REG_ADC_CONTROL, 0, 1, 0x001},                  /* adc left channel polarity */
+    {WM8978_REG_LEFT_ADC_DIGITAL_VOL, 8, 1, 0x001},         /* adc left volume update */
+    {WM8978_REG_LEFT_ADC_DIGITAL_VOL, 0, 8, 0x0FF},         /* adc left volume */
+    {WM8978_REG_RIGHT_ADC_DIGITAL_VOL, 8, 1, 0x001},        /* adc right volume update */
+    {WM8978_REG_RIGHT_ADC_DIGITAL_VOL, 0, 8, 0x0FF},        /* adc right volume */
+    {WM8978_REG_EQ1, 8, 1, 0x001},                          /* equaliser apply */
+    {WM8978_REG_EQ1, 5, 2, 0x003},                          /* eq1 cut off */
+    {WM8978_REG_EQ1, 0, 5, 0x01F},                          /* eq1 gain */
+    {WM8978_REG_EQ2, 8, 1, 0x001},                          /* eq2 bandwidth */
+    {WM8978_REG_EQ2, 5, 2, 0x003},                          /* eq2 centre freq */
+    {WM8978_REG_EQ2, 0, 5, 0x01F},                          /* eq2 gain */
+    {WM8978_REG_EQ3, 8, 1, 0x001},                          /* eq3 bandwidth */
+    {WM8978_REG_EQ3, 5, 2, 0x003},                          /* eq3 centre freq */
+    {WM8978_REG_EQ3, 0, 5, 0x01F},                          /* eq3 gain */
+    {WM8978_REG_EQ4, 8, 1, 0x001},                          /* eq4 bandwidth */
+    {WM8978_REG_EQ4, 5, 2, 0x003},                          /* eq4 centre freq */
+    {WM8978_REG_EQ4, 0, 5, 0x01F},                          /* eq4 gain */
+    {WM8978_REG_EQ5, 5, 2, 0x003},                          /* eq5 cut off */
+    {WM8978_REG_EQ5, 0, 5, 0x01F},                          /* eq5 gain */
+    {WM8978_REG_DAC_LIMITER_1, 8, 1, 0x001},                /* dac digital limiter */
+    {WM8978_REG_DAC_LIMITER_1, 4, 4, 0x00F},                /* dac limiter decay */
+    {WM8978_REG_DAC_LIMITER_1, 0, 4, 0x00F},                /* dac limiter attack */
+    {WM8978_REG_DAC_LIMITER_2, 4, 3, 0x007},                /* dac limiter level */
+    {WM8978_REG_DAC_LIMITER_2, 0, 4, 0x00C},                /* dac limiter volume boost */
+    {WM8978_REG_NOTCH_FILTER_1, 7, 1, 0x001},               /* notch filter */
+    {WM8978_REG_NOTCH_FILTER_1, 8, 1, 0x001},               /* notch filter a0 coefficient bit13 - bit7 update */
+    {WM8978_REG_NOTCH_FILTER_1, 0, 7, 0x07F},               /* notch filter a0 coefficient bit13 - bit7 */
+    {WM8978_REG_NOTCH_FILTER_2, 8, 1, 0x001},               /* notch filter a0 coefficient bit6 - bit0 update */
+    {WM8978_REG_NOTCH_FILTER_2, 0, 7, 0x07F},               /* notch filter a0 coefficient bit6 - bit0 */
+    {WM8978_REG_NOTCH_FILTER_3, 8, 1, 0x001},               /* notch filter a1 coefficient bit13 - bit7 update */
+    {WM8978_REG_NOTCH_FILTER_3, 0, 7, 0x07F},               /* notch filter a1 coefficient bit13 - bit7 */
+    {WM8978_REG_NOTCH_FILTER_4, 8, 1, 0x001},               /* notch filter a1 coefficient bit6 - bit0 update */
+    {WM8978_REG_NOTCH_FILTER_4, 0, 7, 0x07F},               /* notch filter a1 coefficient bit6 - bit0 */
+    {WM8978_REG_ALC_CONTROL_1, 7, 2, 0x003},                /* alc */
+    {WM8978_REG_ALC_CONTROL_1, 3, 3, 0x007},                /* alc max gain */
+    {WM8978_REG_ALC_CONTROL_1, 0, 3, 0x007},                /* alc min gain */
+    {WM8978_REG_ALC_CONTROL_2, 4, 4, 0x00F},                /* alc hold time */
+    {WM8978_REG_ALC_CONTROL_2, 0, 4, 0x00F},                /* alc level */
+    {WM8978_REG_ALC_CONTROL_3, 8, 1, 0x001},                /* alc mode */
+    {WM8978_REG_ALC_CONTROL_3, 4, 4, 0x00F},                /* alc decay */
+    {WM8978_REG_ALC_CONTROL_3, 0, 4, 0x00F},                /* alc attack */
+    {WM8978_REG_NOISE_GATE, 3, 1, 0x001},                   /* alc noise gate */
+    {WM8978_REG_NOISE_GATE, 0, 3, 0x007},                   /* alc noise gate threshold */
+    {WM8978_REG_PLL_N, 4, 1, 0x001},                        /* mclk divide by 2 */
+    {WM8978_REG_PLL_N, 0, 4, 0x00F},                        /* plln */
+    {WM8978_REG_PLL_K3, 0, 9, 0x1FF},                       /* pll k3 */
+    {WM8978_REG_PLL_K2, 0, 9, 0x1FF},                       /* pll k2 */
+    {WM8978_REG_PLL_K1, 0, 6, 0x03F},                       /* pll k1 */
+    {WM8978_REG_3D_CONTROL, 0, 4, 0x00F},                   /* depth 3d */
+    {WM8978_REG_BEEP_CONTROL, 5, 1, 0x001},                 /* mute input to inv rout2 mixer */
+    {WM8978_REG_BEEP_CONTROL, 4, 1, 0x001},                 /* inv rout2 mixer */
+    {WM8978_REG_BEEP_CONTROL, 1, 3, 0x007},                 /* beep volume */
+    {WM8978_REG_BEEP_CONTROL, 0, 1, 0x001},                 /* beep */
+    {WM8978_REG_INPUT_CTRL, 8, 1, 0x001},                   /* microphone bias voltage */
+    {WM8978_REG_INPUT_CTRL, 6, 1, 0x001},                   /* right channel input pga positive */
+    {WM8978_REG_INPUT_CTRL, 5, 1, 0x001},                   /* right channel input pga negative */
+    {WM8978_REG_INPUT_CTRL, 4, 1, 0x001},                   /* right channel input pga amplifier positive */
+    {WM8978_REG_INPUT_CTRL, 2, 1, 0x001},                   /* left channel input pga positive */
+    {WM8978_REG_INPUT_CTRL, 1, 1, 0x001},                   /* left channel input pga negative */
+    {WM8978_REG_INPUT_CTRL, 0, 1, 0x001},                   /* left channel input pga amplifier positive */
+    {WM8978_REG_LEFT_INP_PGA_CTRL, 8, 1, 0x001},            /* left input pga update */
+    {WM8978_REG_LEFT_INP_PGA_CTRL, 7, 1, 0x001},            /* left channel input pga zero cross */
+    {WM8978_REG_LEFT_INP_PGA_CTRL, 6, 1, 0x001},            /* left channel input pga mute */
+    {WM8978_REG_LEFT_INP_PGA_CTRL, 0, 6, 0x03F},            /* left channel input pga volume */
+    {WM8978_REG_RIGHT_INP_PGA_CTRL, 8, 1, 0x001},           /* right input pga update */
+    {WM8978_REG_RIGHT_INP_PGA_CTRL, 7, 1, 0x001},           /* right channel input pga zero cross */
+    {WM8978_REG_RIGHT_INP_PGA_CTRL, 6, 1, 0x001},           /* right channel input pga mute */
+    {WM8978_REG_RIGHT_INP_PGA_CTRL, 0, 6, 0x03F},           /* right channel input pga volume */
+    {WM8978_REG_LEFT_ADC_BOOST_CTRL, 8, 1, 0x001},          /* left channel input pga boost */
+    {WM8978_REG_LEFT_ADC_BOOST_CTRL, 4, 3, 0x007},          /* left channel input boost stage */
+    {WM8978_REG_LEFT_ADC_BOOST_CTRL, 0, 3, 0x007},          /* auxiliary amplifier left channel input boost stage */
+    {WM8978_REG_RIGHT_ADC_BOOST_CTRL, 8, 1, 0x001},         /* right channel input pga boost */
+    {WM8978_REG_RIGHT_ADC_BOOST_CTRL, 4, 3, 0x007},         /* right channel input boost stage */
+    {WM8978_REG_RIGHT_ADC_BOOST_CTRL, 0, 3, 0x007},         /* auxiliary amplifier right channel input boost stage */
+    {WM8978_REG_OUTPUT_CTRL, 6, 1, 0x001},                  /* left dac output to right output mixer */
+    {WM8978_REG_OUTPUT_CTRL, 5, 1, 0x001},                  /* right dac output to left output mixer */
+    {WM8978_REG_OUTPUT_CTRL, 4, 1, 0x001},                  /* out4 boost */
+    {WM8978_REG_OUTPUT_CTRL, 3, 1, 0x001},                  /* out3 boost */
+    {WM8978_REG_OUTPUT_CTRL, 2, 1, 0x001},                  /* speaker boost */
+    {WM8978_REG_OUTPUT_CTRL, 1, 1, 0x001},                  /* thermal shutdown */
+    {WM8978_REG_OUTPUT_CTRL, 0, 1, 0x001},                  /* vref to analogue output resistance */
+    {WM8978_REG_LEFT_MIXER_CTRL, 6, 3, 0x007},              /* aux left channel input to left mixer volume */
+    {WM8978_REG_LEFT_MIXER_CTRL, 5, 1, 0x001},              /* left auxiliary input to left channel output mixer */
+    {WM8978_REG_LEFT_MIXER_CTRL, 2, 3, 0x007},              /* left bypass volume control to output channel mixer */
+    {WM8978_REG_LEFT_MIXER_CTRL, 1, 1, 0x001},              /* left bypass path to left output mixer */
+    {WM8978_REG_LEFT_MIXER_CTRL, 0, 1, 0x001},              /* left dac output to left output mixer */
+    {WM8978_REG_RIGHT_MIXER_CTRL, 6, 3, 0x007},             /* aux right channel input to right mixer volume */
+    {WM8978_REG_RIGHT_MIXER_CTRL, 5, 1, 0x001},             /* right auxiliary input to right channel output mixer */
+    {WM8978_REG_RIGHT_MIXER_CTRL, 2, 3, 0x007},             /* right bypass volume control to output channel mixer */
+    {WM8978_REG_RIGHT_MIXER_CTRL, 1, 1, 0x001},             /* right bypass path to right output mixer */
+    {WM8978_REG_RIGHT_MIXER_CTRL, 0, 1, 0x001},             /* right dac output to right output mixer */
+    {WM8978_REG_LOUT1_CTRL, 8, 1, 0x001},                   /* lout1 update */
+    {WM8978_REG_LOUT1_CTRL, 7, 1, 0x001},                   /* lout1 headphone volume zero cross */
+    {WM8978_REG_LOUT1_CTRL, 6, 1, 0x001},                   /* lout1 left headphone output mute */
+    {WM8978_REG_LOUT1_CTRL, 0, 6, 0x03F},                   /* lout1 left headphone output volume */
+    {WM8978_REG_ROUT1_CTRL, 8, 1, 0x001},                   /* rout1 update */
+    {WM8978_REG_ROUT1_CTRL, 7, 1, 0x001},                   /* rout1 headphone volume zero cross */
+    {WM8978_REG_ROUT1_CTRL, 6, 1, 0x001},                   /* rout1 right headphone output mute */
+    {WM8978_REG_ROUT1_CTRL, 0, 6, 0x03F},                   /* rout1 right headphone output volume */
+    {WM8978_REG_LOUT2_CTRL, 8, 1, 0x001},                   /* lout2 update */
+    {WM8978_REG_LOUT2_CTRL, 7, 1, 0x001},                   /* lout2 speaker volume zero cross */
+    {WM8978_REG_LOUT2_CTRL, 6, 1, 0x001},                   /* lout2 left speaker output mute */
+    {WM8978_REG_LOUT2_CTRL, 0, 6, 0x03F},                   /* lout2 left speaker output volume */
+    {WM8978_REG_ROUT2_CTRL, 8, 1, 0x001},                   /* rout2 update */
+    {WM8978_REG_ROUT2_CTRL, 7, 1, 0x001},                   /* rout2 speaker volume zero cross */
+    {WM8978_REG_ROUT2_CTRL, 6, 1, 0x001},                   /* rout2 right speaker output mute */
+    {WM8978_REG_ROUT2_CTRL, 0, 6, 0x03F},                   /* rout2 right speaker output volume */
+    {WM8978_REG_OUT3_MIXER_CTRL, 6, 1, 0x001},              /* out3 mute */
+    {WM8978_REG_OUT3_MIXER_CTRL, 3, 1, 0x001},              /* out4 mixer output to out3 */
+    {WM8978_REG_OUT3_MIXER_CTRL, 2, 1, 0x001},              /* left adc input to out3 */
+    {WM8978_REG_OUT3_MIXER_CTRL, 1, 1, 0x001},              /* left dac mixer to out3 */
+    {WM8978_REG_OUT3_MIXER_CTRL, 0, 1, 0x001},              /* left dac output to out3 */
+    {WM8978_REG_OUT4_MIXER_CTRL, 6, 1, 0x001},              /* out4 mute */
+    {WM8978_REG_OUT4_MIXER_CTRL, 5, 1, 0x001},              /* out4 attenuated by 6db */
+    {WM8978_REG_OUT4_MIXER_CTRL, 4, 1, 0x001},              /* left dac mixer to out4 */
+    {WM8978_REG_OUT4_MIXER_CTRL, 3, 1, 0x001},              /* left dac to out4 */
+    {WM8978_REG_OUT4_MIXER_CTRL, 2, 1, 0x001},              /* right adc input to out4 */
+    {WM8978_REG_OUT4_MIXER_CTRL, 1, 1, 0x001},              /* right dac mixer to out4 */
+    {WM8978_REG_OUT4_MIXER_CTRL, 0, 1, 0x001}               /* right dac output to out4 */
+};
+
+/**
+ * @brief field descriptor number definition
+ */
+#define WM8978_FIELD_NUM    (sizeof(gsc_wm8978_field) / sizeof(gsc_wm8978_field[0]))
+
 /**
  * @brief      read config
  * @param[in]  *handle pointer to a wm8978 handle structure
@@ -162,5906 +369,6710 @@ static uint8_t a_wm8978_iic_read(wm8978_handle_t *handle, uint8_t reg, uint16_t
  */
 static uint8_t a_wm8978_iic_write(wm8978_handle_t *handle, uint8_t reg, uint16_t config)
 {
+    uint8_t res;
     uint8_t buf[1];
-  
-    buf[0] = config & 0xFF;                                                              /* set LSB */
-    if (handle->iic_write(WM8978_ADDRESS, 
-                         (reg << 1) | ((config >> 8) & 0x01), (uint8_t *)buf, 1) != 0)   /* write data */
+    uint8_t cmd;
+    
+    buf[0] = config & 0xFF;                                                                        /* set LSB */
+    cmd = (uint8_t)((reg << 1) | ((config >> 8) & 0x01));                                          /* set reg and MSB */
+    if (handle->iic_write_ctx != NULL)                                                             /* use the ctx function */
+    {
+        res = handle->iic_write_ctx(handle->ctx, handle->iic_addr, cmd, (uint8_t *)buf, 1);        /* write data */
+    }
+    else
+    {
+        res = handle->iic_write(handle->iic_addr, cmd, (uint8_t *)buf, 1);                         /* write data */
+    }
+    if (res != 0)                                                                                  /* check result */
     {
-        return 1;                                                                        /* return error */
+        return 1;                                                                                  /* return error */
     }
-    handle->reg[reg] = config;                                                           /* save the config */
+    handle->reg[reg] = config;                                                                     /* save the config */
     
-    return 0;                                                                            /* success return 0 */
+    return 0;                                                                                      /* success return 0 */
 }
 
 /**
- * @brief     soft reset
+ * @brief     iic bus init
  * @param[in] *handle pointer to a wm8978 handle structure
  * @return    status code
  *            - 0 success
- *            - 1 soft reset failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
+ *            - 1 iic init failed
  * @note      none
  */
-uint8_t wm8978_soft_reset(wm8978_handle_t *handle)
+static uint8_t a_wm8978_iic_init(wm8978_handle_t *handle)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                      /* check handle */
-    {
-        return 2;                                                            /* return error */
-    }
-    if (handle->inited != 1)                                                 /* check handle initialization */
-    {
-        return 3;                                                            /* return error */
-    }
-    
-    conf = 0x0000;                                                           /* set any value */
-    res = a_wm8978_iic_write(handle, WM8978_REG_SOFTWARE_RESET, conf);       /* write config */
-    if (res != 0)                                                            /* check error */
+    if (handle->iic_init_ctx != NULL)                    /* use the ctx function */
     {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
+        return handle->iic_init_ctx(handle->ctx);        /* iic init */
     }
-    handle->delay_ms(100);                                                   /* delay 100ms */
     
-    return 0;                                                                /* success return 0 */
+    return handle->iic_init();                           /* iic init */
 }
 
 /**
- * @brief     enable or disable dc buffer
+ * @brief     iic bus deinit
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set dc buffer failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
+ *            - 1 iic deinit failed
  * @note      none
  */
-uint8_t wm8978_set_dc_buffer(wm8978_handle_t *handle, wm8978_bool_t enable)
+static uint8_t a_wm8978_iic_deinit(wm8978_handle_t *handle)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_POWER_MANAGE_1, &conf);        /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 8);                                                        /* clear config */
-    conf |= enable << 8;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_POWER_MANAGE_1, conf);        /* write config */
-    if (res != 0)                                                             /* check error */
+    if (handle->iic_deinit_ctx != NULL)                    /* use the ctx function */
     {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
+        return handle->iic_deinit_ctx(handle->ctx);        /* iic deinit */
     }
     
-    return 0;                                                                 /* success return 0 */
+    return handle->iic_deinit();                           /* iic deinit */
 }
 
 /**
- * @brief     enable or disable out4 mixer
+ * @brief     delay ms
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
- * @return    status code
- *            - 0 success
- *            - 1 set out4 mixer failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
+ * @param[in] ms time
  * @note      none
  */
-uint8_t wm8978_set_out4_mixer(wm8978_handle_t *handle, wm8978_bool_t enable)
+static void a_wm8978_delay_ms(wm8978_handle_t *handle, uint32_t ms)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
+    if (handle->delay_ms_ctx != NULL)                  /* use the ctx function */
     {
-        return 3;                                                             /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_POWER_MANAGE_1, &conf);        /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
+        handle->delay_ms_ctx(handle->ctx, ms);         /* delay ms */
     }
-    conf &= ~(1 << 7);                                                        /* clear config */
-    conf |= enable << 7;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_POWER_MANAGE_1, conf);        /* write config */
-    if (res != 0)                                                             /* check error */
+    else
     {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
+        handle->delay_ms(ms);                          /* delay ms */
     }
-    
-    return 0;                                                                 /* success return 0 */
 }
 
 /**
- * @brief     enable or disable out3 mixer
+ * @brief     check a field value list
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
+ * @param[in] *list pointer to a field value list
+ * @param[in] len list length
  * @return    status code
  *            - 0 success
- *            - 1 set out3 mixer failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
+ *            - 4 field or value is invalid
  * @note      none
  */
-uint8_t wm8978_set_out3_mixer(wm8978_handle_t *handle, wm8978_bool_t enable)
+static uint8_t a_wm8978_field_check(wm8978_handle_t *handle, const wm8978_field_value_t *list, uint8_t len)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    uint8_t i;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_POWER_MANAGE_1, &conf);        /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 6);                                                        /* clear config */
-    conf |= enable << 6;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_POWER_MANAGE_1, conf);        /* write config */
-    if (res != 0)                                                             /* check error */
+    for (i = 0; i < len; i++)                                                              /* check all fields */
     {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
+        if ((uint32_t)list[i].field >= WM8978_FIELD_NUM)                                   /* check field */
+        {
+            handle->debug_print("wm8978: field is invalid.\n");                            /* field is invalid */
+            
+            return 4;                                                                      /* return error */
+        }
+        if (list[i].value > gsc_wm8978_field[list[i].field].max)                           /* check value */
+        {
+            handle->debug_print("wm8978: field 0x%02X value > 0x%X.\n",
+                                list[i].field, gsc_wm8978_field[list[i].field].max);       /* value is over range */
+            
+            return 4;                                                                      /* return error */
+        }
     }
     
-    return 0;                                                                 /* success return 0 */
+    return 0;                                                                              /* success return 0 */
 }
 
 /**
- * @brief     enable or disable pll
+ * @brief     update bits of one register under the register lock
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
+ * @param[in] reg iic register address
+ * @param[in] mask changed bits
+ * @param[in] bits new bits
  * @return    status code
  *            - 0 success
- *            - 1 set pll failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ *            - 1 update failed
+ * @note      the shadow read, the bus write and the shadow update all happen
+ *            while the register is locked, so concurrent updates are never lost
  */
-uint8_t wm8978_set_pll(wm8978_handle_t *handle, wm8978_bool_t enable)
+static uint8_t a_wm8978_reg_update(wm8978_handle_t *handle, uint8_t reg, uint16_t mask, uint16_t bits)
 {
     uint8_t res;
     uint16_t conf;
     
-    if (handle == NULL)                                                       /* check handle */
+    if (handle->lock != NULL)                                                  /* check lock */
     {
-        return 2;                                                             /* return error */
+        handle->lock(handle->ctx, reg);                                        /* lock the register */
     }
-    if (handle->inited != 1)                                                  /* check handle initialization */
+    res = a_wm8978_iic_read(handle, reg, &conf);                               /* read config */
+    if (res != 0)                                                              /* check error */
     {
-        return 3;                                                             /* return error */
+        handle->debug_print("wm8978: read config failed.\n");                  /* read config failed */
     }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_POWER_MANAGE_1, &conf);        /* read config */
-    if (res != 0)                                                             /* check error */
+    else
     {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
+        conf = (uint16_t)((conf & ~mask) | (bits & mask));                     /* set config */
+        res = a_wm8978_iic_write(handle, reg, conf);                           /* write config */
+        if (res != 0)                                                          /* check error */
+        {
+            handle->debug_print("wm8978: write config failed.\n");             /* write config failed */
+        }
     }
-    conf &= ~(1 << 5);                                                        /* clear config */
-    conf |= enable << 5;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_POWER_MANAGE_1, conf);        /* write config */
-    if (res != 0)                                                             /* check error */
+    if (handle->unlock != NULL)                                                /* check unlock */
     {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
+        handle->unlock(handle->ctx, reg);                                      /* unlock the register */
     }
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                                /* return the result */
 }
 
 /**
- * @brief     enable or disable microphone bias
+ * @brief     write register fields
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
+ * @param[in] *list pointer to a field value list
+ * @param[in] len list length
  * @return    status code
  *            - 0 success
- *            - 1 set microphone bias failed
+ *            - 1 write failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 field or value is invalid
+ * @note      all values are checked before the first bus write and adjacent
+ *            fields of the same register are merged into a single write
  */
-uint8_t wm8978_set_microphone_bias(wm8978_handle_t *handle, wm8978_bool_t enable)
+static uint8_t a_wm8978_field_write(wm8978_handle_t *handle, const wm8978_field_value_t *list, uint8_t len)
 {
     uint8_t res;
-    uint16_t conf;
+    uint8_t i;
+    uint8_t reg;
+    uint16_t mask;
+    uint16_t bits;
+    const wm8978_field_desc_t *desc;
     
-    if (handle == NULL)                                                       /* check handle */
+    if (handle == NULL)                                                                  /* check handle */
     {
-        return 2;                                                             /* return error */
+        return 2;                                                                        /* return error */
     }
-    if (handle->inited != 1)                                                  /* check handle initialization */
+    if (handle->inited != 1)                                                             /* check handle initialization */
     {
-        return 3;                                                             /* return error */
+        return 3;                                                                        /* return error */
     }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_POWER_MANAGE_1, &conf);        /* read config */
-    if (res != 0)                                                             /* check error */
+    res = a_wm8978_field_check(handle, list, len);                                       /* check all fields */
+    if (res != 0)                                                                        /* check the result */
     {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
+        return res;                                                                      /* return error */
     }
-    conf &= ~(1 << 4);                                                        /* clear config */
-    conf |= enable << 4;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_POWER_MANAGE_1, conf);        /* write config */
-    if (res != 0)                                                             /* check error */
+    
+    i = 0;                                                                               /* init 0 */
+    while (i < len)                                                                      /* apply all fields */
     {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
+        reg = gsc_wm8978_field[list[i].field].reg;                                       /* set register */
+        mask = 0;                                                                        /* init 0 */
+        bits = 0;                                                                        /* init 0 */
+        while ((i < len) && (gsc_wm8978_field[list[i].field].reg == reg))                /* same register */
+        {
+            desc = &gsc_wm8978_field[list[i].field];                                     /* get descriptor */
+            mask |= (uint16_t)(((1U << desc->width) - 1) << desc->shift);                /* add mask */
+            bits |= (uint16_t)(list[i].value << desc->shift);                            /* add bits */
+            i++;                                                                         /* next field */
+        }
+        res = a_wm8978_reg_update(handle, reg, mask, bits);                              /* update the register */
+        if (res != 0)                                                                    /* check the result */
+        {
+            return 1;                                                                    /* return error */
+        }
     }
     
-    return 0;                                                                 /* success return 0 */
+    return 0;                                                                            /* success return 0 */
 }
 
 /**
- * @brief     enable or disable analogue amplifier bias
+ * @brief     set one register field
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
+ * @param[in] field register field
+ * @param[in] value field value
  * @return    status code
  *            - 0 success
- *            - 1 set analogue amplifier bias failed
+ *            - 1 write failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
+ *            - 4 field or value is invalid
  * @note      none
  */
-uint8_t wm8978_set_analogue_amplifier_bias(wm8978_handle_t *handle, wm8978_bool_t enable)
+static uint8_t a_wm8978_field_set(wm8978_handle_t *handle, wm8978_field_t field, uint16_t value)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    wm8978_field_value_t list;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_POWER_MANAGE_1, &conf);        /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 3);                                                        /* clear config */
-    conf |= enable << 3;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_POWER_MANAGE_1, conf);        /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    list.field = field;                                    /* set field */
+    list.value = value;                                    /* set value */
     
-    return 0;                                                                 /* success return 0 */
+    return a_wm8978_field_write(handle, &list, 1);         /* write field */
 }
 
 /**
- * @brief     enable or disable unused input output tie off buffer
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
- * @return    status code
- *            - 0 success
- *            - 1 set unused input output tie off buffer failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      get one register field
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  field register field
+ * @param[out] *value pointer to a field value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 field is invalid
+ * @note       the value is cleared on error
  */
-uint8_t wm8978_set_unused_input_output_tie_off_buffer(wm8978_handle_t *handle, wm8978_bool_t enable)
+static uint8_t a_wm8978_field_get(wm8978_handle_t *handle, wm8978_field_t field, uint16_t *value)
 {
     uint8_t res;
     uint16_t conf;
+    const wm8978_field_desc_t *desc;
     
-    if (handle == NULL)                                                       /* check handle */
+    *value = 0x0000;                                                     /* init 0 */
+    if (handle == NULL)                                                  /* check handle */
     {
-        return 2;                                                             /* return error */
+        return 2;                                                        /* return error */
     }
-    if (handle->inited != 1)                                                  /* check handle initialization */
+    if (handle->inited != 1)                                             /* check handle initialization */
     {
-        return 3;                                                             /* return error */
+        return 3;                                                        /* return error */
     }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_POWER_MANAGE_1, &conf);        /* read config */
-    if (res != 0)                                                             /* check error */
+    if ((uint32_t)field >= WM8978_FIELD_NUM)                             /* check field */
     {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
+        handle->debug_print("wm8978: field is invalid.\n");              /* field is invalid */
         
-        return 1;                                                             /* return error */
+        return 4;                                                        /* return error */
     }
-    conf &= ~(1 << 2);                                                        /* clear config */
-    conf |= enable << 2;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_POWER_MANAGE_1, conf);        /* write config */
-    if (res != 0)                                                             /* check error */
+    
+    desc = &gsc_wm8978_field[field];                                     /* get descriptor */
+    res = a_wm8978_iic_read(handle, desc->reg, &conf);                   /* read config */
+    if (res != 0)                                                        /* check error */
     {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
+        handle->debug_print("wm8978: read config failed.\n");            /* read config failed */
         
-        return 1;                                                             /* return error */
+        return 1;                                                        /* return error */
     }
+    *value = (conf >> desc->shift) & ((1U << desc->width) - 1);          /* get field */
     
-    return 0;                                                                 /* success return 0 */
+    return 0;                                                            /* success return 0 */
 }
 
 /**
- * @brief     set reference impedance
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] impedance set reference impedance 
- * @return    status code
- *            - 0 success
- *            - 1 set reference impedance failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief wm8978 ramp stage descriptor structure definition
  */
-uint8_t wm8978_set_reference_impedance(wm8978_handle_t *handle, wm8978_impedance_t impedance)
+typedef struct wm8978_ramp_desc_s
 {
-    uint8_t res;
-    uint16_t conf;
+    uint8_t volume[2];            /**< left and right volume field */
+    uint8_t update[2];            /**< left and right update field */
+    uint8_t zero_cross[2];        /**< left and right zero cross field */
+} wm8978_ramp_desc_t;
+
+/**
+ * @brief ramp stage without a zero cross field
+ */
+#define WM8978_RAMP_NO_FIELD    0xFF
+
+/**
+ * @brief ramp stage descriptor table, indexed by the stage bit position
+ */
+static const wm8978_ramp_desc_t gsc_wm8978_ramp[5] =
+{
+    {{WM8978_FIELD_DAC_LEFT_VOLUME, WM8978_FIELD_DAC_RIGHT_VOLUME},
+     {WM8978_FIELD_DAC_LEFT_VOLUME_UPDATE, WM8978_FIELD_DAC_RIGHT_VOLUME_UPDATE},
+     {WM8978_RAMP_NO_FIELD, WM8978_RAMP_NO_FIELD}},                                                         /* dac */
+    {{WM8978_FIELD_ADC_LEFT_VOLUME, WM8978_FIELD_ADC_RIGHT_VOLUME},
+     {WM8978_FIELD_ADC_LEFT_VOLUME_UPDATE, WM8978_FIELD_ADC_RIGHT_VOLUME_UPDATE},
+     {WM8978_RAMP_NO_FIELD, WM8978_RAMP_NO_FIELD}},                                                         /* adc */
+    {{WM8978_FIELD_LEFT_CHANNEL_INPUT_PGA_VOLUME, WM8978_FIELD_RIGHT_CHANNEL_INPUT_PGA_VOLUME},
+     {WM8978_FIELD_LEFT_INPUT_PGA_UPDATE, WM8978_FIELD_RIGHT_INPUT_PGA_UPDATE},
+     {WM8978_FIELD_LEFT_CHANNEL_INPUT_PGA_ZERO_CROSS, WM8978_FIELD_RIGHT_CHANNEL_INPUT_PGA_ZERO_CROSS}},     /* input pga */
+    {{WM8978_FIELD_LOUT1_LEFT_HEADPHONE_OUTPUT_VOLUME, WM8978_FIELD_ROUT1_RIGHT_HEADPHONE_OUTPUT_VOLUME},
+     {WM8978_FIELD_LOUT1_UPDATE, WM8978_FIELD_ROUT1_UPDATE},
+     {WM8978_FIELD_LOUT1_HEADPHONE_VOLUME_ZERO_CROSS, WM8978_FIELD_ROUT1_HEADPHONE_VOLUME_ZERO_CROSS}},     /* out1 */
+    {{WM8978_FIELD_LOUT2_LEFT_SPEAKER_OUTPUT_VOLUME, WM8978_FIELD_ROUT2_RIGHT_SPEAKER_OUTPUT_VOLUME},
+     {WM8978_FIELD_LOUT2_UPDATE, WM8978_FIELD_ROUT2_UPDATE},
+     {WM8978_FIELD_LOUT2_SPEAKER_VOLUME_ZERO_CROSS, WM8978_FIELD_ROUT2_SPEAKER_VOLUME_ZERO_CROSS}},         /* out2 */
+};
+
+/**
+ * @brief     get the ramp volume of one channel at the elapsed time
+ * @param[in] *ramp pointer to a wm8978 ramp structure
+ * @param[in] i stage index
+ * @param[in] ch channel index
+ * @return    volume step
+ * @note      the volume moves linearly in register steps, so linearly in db
+ */
+static uint8_t a_wm8978_ramp_step(const wm8978_ramp_t *ramp, uint8_t i, uint8_t ch)
+{
+    int32_t diff;
     
-    if (handle == NULL)                                                       /* check handle */
+    if (ramp->elapsed_ms >= ramp->duration_ms)                                   /* check the end */
     {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
+        return ramp->target[i];                                                  /* return target */
     }
+    diff = (int32_t)ramp->target[i] - (int32_t)ramp->start[i][ch];               /* get the distance */
+    diff = diff * (int32_t)ramp->elapsed_ms / (int32_t)ramp->duration_ms;        /* scale by the elapsed time */
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_POWER_MANAGE_1, &conf);        /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(3 << 0);                                                        /* clear config */
-    conf |= impedance << 0;                                                   /* set impedance */
-    res = a_wm8978_iic_write(handle, WM8978_REG_POWER_MANAGE_1, conf);        /* write config */
-    if (res != 0)                                                             /* check error */
+    return (uint8_t)((int32_t)ramp->start[i][ch] + diff);                        /* return step */
+}
+
+/**
+ * @brief eq band frequency table in hz, indexed by the band and the register value
+ */
+static const uint16_t gsc_wm8978_eq_freq[5][4] =
+{
+    {80, 105, 135, 175},              /* eq1 cut off */
+    {230, 300, 385, 500},             /* eq2 centre freq */
+    {650, 850, 1100, 1400},           /* eq3 centre freq */
+    {1800, 2400, 3200, 4100},         /* eq4 centre freq */
+    {5300, 6900, 9000, 11700},        /* eq5 cut off */
+};
+
+/**
+ * @brief eq band register mask table, eq1 bit 8 selects the equaliser path and is never touched
+ */
+static const uint16_t gsc_wm8978_eq_mask[5] =
+{
+    0x07F, 0x17F, 0x17F, 0x17F, 0x07F,
+};
+
+/**
+ * @brief cordic angle table, atan(2^-i) in 2^32 units of a full turn
+ */
+static const int32_t gsc_wm8978_cordic_atan[24] =
+{
+    536870912, 316933406, 167458907, 85004756, 42667331, 21354465, 10679838, 5340245,
+    2670163, 1335087, 667544, 333772, 166886, 83443, 41722, 20861,
+    10430, 5215, 2608, 1304, 652, 326, 163, 81,
+};
+
+/**
+ * @brief      get the cosine and sine of a phase in fixed point
+ * @param[in]  phase phase in 2^32 units of a full turn
+ * @param[out] *c pointer to a q30 cosine buffer
+ * @param[out] *s pointer to a q30 sine buffer
+ * @note       0 <= phase <= 0x40000000
+ */
+static void a_wm8978_cordic(uint32_t phase, int32_t *c, int32_t *s)
+{
+    uint8_t i;
+    int32_t x;
+    int32_t y;
+    int32_t z;
+    int32_t t;
+    
+    x = 652032874;                                 /* 1 / cordic gain in q30 */
+    y = 0;                                         /* init 0 */
+    z = (int32_t)phase;                            /* set phase */
+    for (i = 0; i < 24; i++)                       /* run all steps */
     {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
+        t = x;                                     /* save x */
+        if (z >= 0)                                /* rotate forward */
+        {
+            x -= y >> i;                           /* update x */
+            y += t >> i;                           /* update y */
+            z -= gsc_wm8978_cordic_atan[i];        /* update phase */
+        }
+        else                                       /* rotate backward */
+        {
+            x += y >> i;                           /* update x */
+            y -= t >> i;                           /* update y */
+            z += gsc_wm8978_cordic_atan[i];        /* update phase */
+        }
     }
-    
-    return 0;                                                                 /* success return 0 */
+    *c = x;                                        /* set cosine */
+    *s = y;                                        /* set sine */
 }
 
 /**
- * @brief     enable or disable right out1
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
- * @return    status code
- *            - 0 success
- *            - 1 set right out1 failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
+ * @brief     divide and round to the nearest integer
+ * @param[in] num numerator
+ * @param[in] den positive denominator
+ * @return    rounded quotient
  * @note      none
  */
-uint8_t wm8978_set_right_out1(wm8978_handle_t *handle, wm8978_bool_t enable)
+static int32_t a_wm8978_div_round(int64_t num, int64_t den)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
+    if (num >= 0)                                           /* check sign */
     {
-        return 2;                                                             /* return error */
+        return (int32_t)((num + den / 2) / den);            /* round up half */
     }
-    if (handle->inited != 1)                                                  /* check handle initialization */
+    else
     {
-        return 3;                                                             /* return error */
+        return (int32_t)(-((-num + den / 2) / den));        /* round down half */
     }
+}
+
+/**
+ * @brief mclk divider table in half steps, indexed by wm8978_mclk_div_t
+ */
+static const uint8_t gsc_wm8978_mclk_div2[8] =
+{
+    2, 3, 4, 6, 8, 12, 16, 24,
+};
+
+/**
+ * @brief approximate sample rate table in hz, indexed by wm8978_approximate_sample_t
+ */
+static const uint16_t gsc_wm8978_sample_rate[6] =
+{
+    48000, 32000, 24000, 16000, 12000, 8000,
+};
+
+/**
+ * @brief wm8978 clock table entry structure definition
+ */
+typedef struct wm8978_clock_entry_s
+{
+    uint32_t mclk_hz;                /**< mclk in hz */
+    uint32_t fs;                     /**< sample rate in hz */
+    wm8978_clock_plan_t plan;        /**< solved clock plan */
+} wm8978_clock_entry_t;
+
+/**
+ * @brief precomputed clock plans of the common mclk and sample rate pairs
+ */
+static const wm8978_clock_entry_t gsc_wm8978_clock[] =
+{
+    {11289600, 8000, {WM8978_CLKSEL_PLL_OUTPUT, WM8978_BOOL_FALSE, 8, 0xB51D9B, WM8978_MCLK_DIV_BY_12, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_8_KHZ, 0}},
+    {11289600, 11025, {WM8978_CLKSEL_MCLK, WM8978_BOOL_FALSE, 0, 0x000000, WM8978_MCLK_DIV_BY_4, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_12_KHZ, 0}},
+    {11289600, 12000, {WM8978_CLKSEL_PLL_OUTPUT, WM8978_BOOL_FALSE, 8, 0xB51D9B, WM8978_MCLK_DIV_BY_8, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_12_KHZ, 0}},
+    {11289600, 16000, {WM8978_CLKSEL_PLL_OUTPUT, WM8978_BOOL_FALSE, 8, 0xB51D9B, WM8978_MCLK_DIV_BY_6, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_16_KHZ, 0}},
+    {11289600, 22050, {WM8978_CLKSEL_MCLK, WM8978_BOOL_FALSE, 0, 0x000000, WM8978_MCLK_DIV_BY_2, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_24_KHZ, 0}},
+    {11289600, 24000, {WM8978_CLKSEL_PLL_OUTPUT, WM8978_BOOL_FALSE, 8, 0xB51D9B, WM8978_MCLK_DIV_BY_4, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_24_KHZ, 0}},
+    {11289600, 32000, {WM8978_CLKSEL_PLL_OUTPUT, WM8978_BOOL_FALSE, 8, 0xB51D9B, WM8978_MCLK_DIV_BY_3, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_32_KHZ, 0}},
+    {11289600, 44100, {WM8978_CLKSEL_MCLK, WM8978_BOOL_FALSE, 0, 0x000000, WM8978_MCLK_DIV_BY_1, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_48_KHZ, 0}},
+    {11289600, 48000, {WM8978_CLKSEL_PLL_OUTPUT, WM8978_BOOL_FALSE, 8, 0xB51D9B, WM8978_MCLK_DIV_BY_2, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_48_KHZ, 0}},
+    {12000000, 8000, {WM8978_CLKSEL_PLL_OUTPUT, WM8978_BOOL_FALSE, 8, 0x3126E9, WM8978_MCLK_DIV_BY_12, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_8_KHZ, -3}},
+    {12000000, 11025, {WM8978_CLKSEL_PLL_OUTPUT, WM8978_BOOL_FALSE, 7, 0x86C227, WM8978_MCLK_DIV_BY_8, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_12_KHZ, 3}},
+    {12000000, 12000, {WM8978_CLKSEL_PLL_OUTPUT, WM8978_BOOL_FALSE, 8, 0x3126E9, WM8978_MCLK_DIV_BY_8, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_12_KHZ, -3}},
+    {12000000, 16000, {WM8978_CLKSEL_PLL_OUTPUT, WM8978_BOOL_FALSE, 8, 0x3126E9, WM8978_MCLK_DIV_BY_6, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_16_KHZ, -3}},
+    {12000000, 22050, {WM8978_CLKSEL_PLL_OUTPUT, WM8978_BOOL_FALSE, 7, 0x86C227, WM8978_MCLK_DIV_BY_4, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_24_KHZ, 3}},
+    {12000000, 24000, {WM8978_CLKSEL_PLL_OUTPUT, WM8978_BOOL_FALSE, 8, 0x3126E9, WM8978_MCLK_DIV_BY_4, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_24_KHZ, -3}},
+    {12000000, 32000, {WM8978_CLKSEL_PLL_OUTPUT, WM8978_BOOL_FALSE, 8, 0x3126E9, WM8978_MCLK_DIV_BY_3, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_32_KHZ, -3}},
+    {12000000, 44100, {WM8978_CLKSEL_PLL_OUTPUT, WM8978_BOOL_FALSE, 7, 0x86C227, WM8978_MCLK_DIV_BY_2, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_48_KHZ, 3}},
+    {12000000, 48000, {WM8978_CLKSEL_PLL_OUTPUT, WM8978_BOOL_FALSE, 8, 0x3126E9, WM8978_MCLK_DIV_BY_2, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_48_KHZ, -3}},
+    {12288000, 8000, {WM8978_CLKSEL_MCLK, WM8978_BOOL_FALSE, 0, 0x000000, WM8978_MCLK_DIV_BY_6, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_8_KHZ, 0}},
+    {12288000, 11025, {WM8978_CLKSEL_PLL_OUTPUT, WM8978_BOOL_FALSE, 7, 0x59999A, WM8978_MCLK_DIV_BY_8, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_12_KHZ, 3}},
+    {12288000, 12000, {WM8978_CLKSEL_MCLK, WM8978_BOOL_FALSE, 0, 0x000000, WM8978_MCLK_DIV_BY_4, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_12_KHZ, 0}},
+    {12288000, 16000, {WM8978_CLKSEL_MCLK, WM8978_BOOL_FALSE, 0, 0x000000, WM8978_MCLK_DIV_BY_3, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_16_KHZ, 0}},
+    {12288000, 22050, {WM8978_CLKSEL_PLL_OUTPUT, WM8978_BOOL_FALSE, 7, 0x59999A, WM8978_MCLK_DIV_BY_4, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_24_KHZ, 3}},
+    {12288000, 24000, {WM8978_CLKSEL_MCLK, WM8978_BOOL_FALSE, 0, 0x000000, WM8978_MCLK_DIV_BY_2, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_24_KHZ, 0}},
+    {12288000, 32000, {WM8978_CLKSEL_MCLK, WM8978_BOOL_FALSE, 0, 0x000000, WM8978_MCLK_DIV_BY_1P5, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_32_KHZ, 0}},
+    {12288000, 44100, {WM8978_CLKSEL_PLL_OUTPUT, WM8978_BOOL_FALSE, 7, 0x59999A, WM8978_MCLK_DIV_BY_2, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_48_KHZ, 3}},
+    {12288000, 48000, {WM8978_CLKSEL_MCLK, WM8978_BOOL_FALSE, 0, 0x000000, WM8978_MCLK_DIV_BY_1, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_48_KHZ, 0}},
+    {24000000, 8000, {WM8978_CLKSEL_PLL_OUTPUT, WM8978_BOOL_TRUE, 8, 0x3126E9, WM8978_MCLK_DIV_BY_12, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_8_KHZ, -3}},
+    {24000000, 11025, {WM8978_CLKSEL_PLL_OUTPUT, WM8978_BOOL_TRUE, 7, 0x86C227, WM8978_MCLK_DIV_BY_8, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_12_KHZ, 3}},
+    {24000000, 12000, {WM8978_CLKSEL_PLL_OUTPUT, WM8978_BOOL_TRUE, 8, 0x3126E9, WM8978_MCLK_DIV_BY_8, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_12_KHZ, -3}},
+    {24000000, 16000, {WM8978_CLKSEL_PLL_OUTPUT, WM8978_BOOL_TRUE, 8, 0x3126E9, WM8978_MCLK_DIV_BY_6, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_16_KHZ, -3}},
+    {24000000, 22050, {WM8978_CLKSEL_PLL_OUTPUT, WM8978_BOOL_TRUE, 7, 0x86C227, WM8978_MCLK_DIV_BY_4, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_24_KHZ, 3}},
+    {24000000, 24000, {WM8978_CLKSEL_PLL_OUTPUT, WM8978_BOOL_TRUE, 8, 0x3126E9, WM8978_MCLK_DIV_BY_4, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_24_KHZ, -3}},
+    {24000000, 32000, {WM8978_CLKSEL_PLL_OUTPUT, WM8978_BOOL_TRUE, 8, 0x3126E9, WM8978_MCLK_DIV_BY_3, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_32_KHZ, -3}},
+    {24000000, 44100, {WM8978_CLKSEL_PLL_OUTPUT, WM8978_BOOL_TRUE, 7, 0x86C227, WM8978_MCLK_DIV_BY_2, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_48_KHZ, 3}},
+    {24000000, 48000, {WM8978_CLKSEL_PLL_OUTPUT, WM8978_BOOL_TRUE, 8, 0x3126E9, WM8978_MCLK_DIV_BY_2, WM8978_BCLK_DIV_BY_4, WM8978_APPROXIMATE_SAMPLE_48_KHZ, -3}},
+};
+
+/**
+ * @brief      search a clock plan
+ * @param[in]  mclk_hz mclk in hz
+ * @param[in]  fs sample rate in hz
+ * @param[out] *plan pointer to a wm8978 clock plan structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 no valid plan
+ * @note       mclk is used directly when it is an exact multiple of 256fs, otherwise
+ *             the pll runs at 90mhz - 100mhz with 5 < plln < 13 and the smallest error wins
+ */
+static uint8_t a_wm8978_clock_search(uint32_t mclk_hz, uint32_t fs, wm8978_clock_plan_t *plan)
+{
+    uint8_t i;
+    uint8_t pre;
+    uint32_t n;
+    uint64_t f2;
+    uint64_t r;
+    int64_t diff;
+    int32_t error;
+    uint32_t dist;
+    uint32_t best;
+    
+    plan->mclk_divide_by_2 = WM8978_BOOL_FALSE;                                            /* no prescaler */
+    plan->plln = 0;                                                                        /* init 0 */
+    plan->pll_freq = 0;                                                                    /* init 0 */
+    plan->bclk_div = WM8978_BCLK_DIV_BY_4;                                                 /* bclk is 64fs */
+    plan->error_ppb = 0;                                                                   /* init 0 */
+    best = 0xFFFFFFFFU;                                                                    /* init max */
+    for (i = 0; i < 6; i++)                                                                /* find the nearest filter rate */
+    {
+        dist = (fs > gsc_wm8978_sample_rate[i]) ? (fs - gsc_wm8978_sample_rate[i]) :
+                                                  (gsc_wm8978_sample_rate[i] - fs);        /* get distance */
+        if (dist < best)                                                                   /* check distance */
+        {
+            best = dist;                                                                   /* save best */
+            plan->sample_rate = (wm8978_approximate_sample_t)i;                            /* set sample rate */
+        }
+    }
+    for (i = 0; i < 8; i++)                                                                /* try mclk directly */
+    {
+        if ((uint64_t)mclk_hz * 2 == (uint64_t)fs * 256 * gsc_wm8978_mclk_div2[i])         /* mclk = 256fs * mclk div */
+        {
+            plan->clksel = WM8978_CLKSEL_MCLK;                                             /* use mclk */
+            plan->mclk_div = (wm8978_mclk_div_t)i;                                         /* set mclk div */
+            
+            return 0;                                                                      /* success return 0 */
+        }
+    }
+    plan->clksel = WM8978_CLKSEL_PLL_OUTPUT;                                               /* use pll */
+    best = 0xFFFFFFFFU;                                                                    /* init max */
+    for (pre = 0; pre < 2; pre++)                                                          /* try both prescalers */
+    {
+        for (i = 0; i < 8; i++)                                                            /* try all dividers */
+        {
+            f2 = (uint64_t)fs * 512 * gsc_wm8978_mclk_div2[i];                             /* f2 = 4 * mclk div * 256fs */
+            if ((f2 < 90000000ULL) || (f2 > 100000000ULL))                                 /* check pll range */
+            {
+                continue;                                                                  /* skip */
+            }
+            r = ((f2 << (24 + pre)) + mclk_hz / 2) / mclk_hz;                              /* ratio in q24 */
+            n = (uint32_t)(r >> 24);                                                       /* integer part */
+            if ((n <= 5) || (n >= 13))                                                     /* check integer part */
+            {
+                continue;                                                                  /* skip */
+            }
+            diff = (int64_t)((uint64_t)mclk_hz * r) - (int64_t)(f2 << (24 + pre));         /* frequency difference */
+            error = (int32_t)(diff * 1000000000LL / (int64_t)(f2 << (24 + pre)));          /* error in ppb */
+            dist = (uint32_t)((error < 0) ? -error : error);                               /* get absolute error */
+            if (dist < best)                                                               /* check error */
+            {
+                best = dist;                                                               /* save best */
+                plan->mclk_divide_by_2 = (wm8978_bool_t)pre;                               /* set prescaler */
+                plan->plln = (uint8_t)n;                                                   /* set plln */
+                plan->pll_freq = (uint32_t)(r & 0xFFFFFF);                                 /* set fractional part */
+                plan->mclk_div = (wm8978_mclk_div_t)i;                                     /* set mclk div */
+                plan->error_ppb = error;                                                   /* set error */
+            }
+        }
+    }
+    
+    return (best != 0xFFFFFFFFU) ? 0 : 1;                                                  /* return the result */
+}
+
+/**
+ * @brief alc hold time table in us, the hold time doubles with every step
+ */
+static const uint32_t gsc_wm8978_alc_hold_time_us[16] =
+{
+    0, 2667, 5333, 10667, 21333, 42667, 85333, 170667,
+    341333, 682667, 1365333, 2730667, 5461333, 10922667, 21845333, 43690667,
+};
+
+/**
+ * @brief     search the nearest alc hold time step
+ * @param[in] us alc hold time in us
+ * @return    alc hold time raw data
+ * @note      none
+ */
+static uint8_t a_wm8978_alc_hold_time_search(uint32_t us)
+{
+    uint8_t i;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_POWER_MANAGE_2, &conf);        /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 8);                                                        /* clear config */
-    conf |= enable << 8;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_POWER_MANAGE_2, conf);        /* write config */
-    if (res != 0)                                                             /* check error */
+    for (i = 0; i < 15; i++)                                                       /* check all steps */
     {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
+        if (us <= gsc_wm8978_alc_hold_time_us[i + 1])                              /* between step i and i + 1 */
+        {
+            if ((us - gsc_wm8978_alc_hold_time_us[i]) <
+                (gsc_wm8978_alc_hold_time_us[i + 1] - us))                         /* closer to step i */
+            {
+                return i;                                                          /* return step i */
+            }
+            
+            return (uint8_t)(i + 1);                                               /* return step i + 1 */
+        }
     }
     
-    return 0;                                                                 /* success return 0 */
+    return 15;                                                                     /* return the last step */
 }
 
 /**
- * @brief     enable or disable left out1
+ * @brief     soft reset
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set left out1 failed
+ *            - 1 soft reset failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_left_out1(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_soft_reset(wm8978_handle_t *handle)
 {
     uint8_t res;
     uint16_t conf;
     
-    if (handle == NULL)                                                       /* check handle */
+    if (handle == NULL)                                                      /* check handle */
     {
-        return 2;                                                             /* return error */
+        return 2;                                                            /* return error */
     }
-    if (handle->inited != 1)                                                  /* check handle initialization */
+    if (handle->inited != 1)                                                 /* check handle initialization */
     {
-        return 3;                                                             /* return error */
+        return 3;                                                            /* return error */
     }
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_POWER_MANAGE_2, &conf);        /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 7);                                                        /* clear config */
-    conf |= enable << 7;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_POWER_MANAGE_2, conf);        /* write config */
-    if (res != 0)                                                             /* check error */
+    conf = 0x0000;                                                           /* set any value */
+    res = a_wm8978_iic_write(handle, WM8978_REG_SOFTWARE_RESET, conf);       /* write config */
+    if (res != 0)                                                            /* check error */
     {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
+        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
         
-        return 1;                                                             /* return error */
+        return 1;                                                            /* return error */
     }
+    a_wm8978_delay_ms(handle, 100);                                          /* delay 100ms */
     
-    return 0;                                                                 /* success return 0 */
+    return 0;                                                                /* success return 0 */
 }
 
 /**
- * @brief     enable or disable sleep
+ * @brief     enable or disable dc buffer
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set sleep failed
+ *            - 1 set dc buffer failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_sleep(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_dc_buffer(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_DC_BUFFER, enable);        /* set field */
+}
+
+/**
+ * @brief      get dc buffer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get dc buffer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_dc_buffer(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_POWER_MANAGE_2, &conf);        /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 6);                                                        /* clear config */
-    conf |= enable << 6;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_POWER_MANAGE_2, conf);        /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_DC_BUFFER, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                        /* get bool */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                              /* return the result */
 }
 
 /**
- * @brief     enable or disable right channel input boost
+ * @brief     enable or disable out4 mixer
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set right channel input boost failed
+ *            - 1 set out4 mixer failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_right_channel_input_boost(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_out4_mixer(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_OUT4_MIXER, enable);        /* set field */
+}
+
+/**
+ * @brief      get out4 mixer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get out4 mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_out4_mixer(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_POWER_MANAGE_2, &conf);        /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 5);                                                        /* clear config */
-    conf |= enable << 5;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_POWER_MANAGE_2, conf);        /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_OUT4_MIXER, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                         /* get bool */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                               /* return the result */
 }
 
 /**
- * @brief     enable or disable left channel input boost
+ * @brief     enable or disable out3 mixer
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set left channel input boost failed
+ *            - 1 set out3 mixer failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_left_channel_input_boost(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_out3_mixer(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_OUT3_MIXER, enable);        /* set field */
+}
+
+/**
+ * @brief      get out3 mixer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get out3 mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_out3_mixer(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_POWER_MANAGE_2, &conf);        /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 4);                                                        /* clear config */
-    conf |= enable << 4;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_POWER_MANAGE_2, conf);        /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_OUT3_MIXER, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                         /* get bool */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                               /* return the result */
 }
 
 /**
- * @brief     enable or disable right channel input pga
+ * @brief     enable or disable pll
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set right channel input pga failed
+ *            - 1 set pll failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_right_channel_input_pga(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_pll(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_PLL, enable);        /* set field */
+}
+
+/**
+ * @brief      get pll status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get pll failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_pll(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_POWER_MANAGE_2, &conf);        /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 3);                                                        /* clear config */
-    conf |= enable << 3;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_POWER_MANAGE_2, conf);        /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_PLL, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                  /* get bool */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                        /* return the result */
 }
 
 /**
- * @brief     enable or disable left channel input pga
+ * @brief     enable or disable microphone bias
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set left channel input pga failed
+ *            - 1 set microphone bias failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_left_channel_input_pga(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_microphone_bias(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_MICROPHONE_BIAS, enable);        /* set field */
+}
+
+/**
+ * @brief      get microphone bias status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get microphone bias failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_microphone_bias(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_POWER_MANAGE_2, &conf);        /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 2);                                                        /* clear config */
-    conf |= enable << 2;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_POWER_MANAGE_2, conf);        /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_MICROPHONE_BIAS, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                              /* get bool */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                                    /* return the result */
 }
 
 /**
- * @brief     enable or disable right channel adc
+ * @brief     enable or disable analogue amplifier bias
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set right channel adc failed
+ *            - 1 set analogue amplifier bias failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_right_channel_adc(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_analogue_amplifier_bias(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_ANALOGUE_AMPLIFIER_BIAS, enable);        /* set field */
+}
+
+/**
+ * @brief      get analogue amplifier bias status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get analogue amplifier bias failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_analogue_amplifier_bias(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
+    uint16_t value;
     
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_POWER_MANAGE_2, &conf);        /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 1);                                                        /* clear config */
-    conf |= enable << 1;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_POWER_MANAGE_2, conf);        /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_ANALOGUE_AMPLIFIER_BIAS, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                      /* get bool */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                                            /* return the result */
 }
 
 /**
- * @brief     enable or disable left channel adc
+ * @brief     enable or disable unused input output tie off buffer
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set left channel adc failed
+ *            - 1 set unused input output tie off buffer failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_left_channel_adc(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_unused_input_output_tie_off_buffer(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_UNUSED_INPUT_OUTPUT_TIE_OFF_BUFFER, enable);        /* set field */
+}
+
+/**
+ * @brief      get unused input output tie off buffer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get unused input output tie off buffer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_unused_input_output_tie_off_buffer(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_POWER_MANAGE_2, &conf);        /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 0);                                                        /* clear config */
-    conf |= enable << 0;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_POWER_MANAGE_2, conf);        /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_UNUSED_INPUT_OUTPUT_TIE_OFF_BUFFER, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                                 /* get bool */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                                                       /* return the result */
 }
 
 /**
- * @brief     enable or disable out4
+ * @brief     set reference impedance
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
+ * @param[in] impedance set reference impedance 
  * @return    status code
  *            - 0 success
- *            - 1 set out4 failed
+ *            - 1 set reference impedance failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_out4(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_reference_impedance(wm8978_handle_t *handle, wm8978_impedance_t impedance)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_REFERENCE_IMPEDANCE, impedance);        /* set field */
+}
+
+/**
+ * @brief      get reference impedance
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *impedance pointer to a reference impedance buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get reference impedance failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_reference_impedance(wm8978_handle_t *handle, wm8978_impedance_t *impedance)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_POWER_MANAGE_3, &conf);        /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 8);                                                        /* clear config */
-    conf |= enable << 8;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_POWER_MANAGE_3, conf);        /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_REFERENCE_IMPEDANCE, &value);        /* get field */
+    *impedance = (wm8978_impedance_t)(value);                                          /* get impedance */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                                        /* return the result */
 }
 
 /**
- * @brief     enable or disable out3
+ * @brief     enable or disable right out1
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set out3 failed
+ *            - 1 set right out1 failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_out3(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_right_out1(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_RIGHT_OUT1, enable);        /* set field */
+}
+
+/**
+ * @brief      get right out1 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right out1 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_out1(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_POWER_MANAGE_3, &conf);        /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 7);                                                        /* clear config */
-    conf |= enable << 7;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_POWER_MANAGE_3, conf);        /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_RIGHT_OUT1, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                         /* get bool */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                               /* return the result */
 }
 
 /**
- * @brief     enable or disable left out2
+ * @brief     enable or disable left out1
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set left out2 failed
+ *            - 1 set left out1 failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_left_out2(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_left_out1(wm8978_handle_t *handle, wm8978_bool_t enable)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    return a_wm8978_field_set(handle, WM8978_FIELD_LEFT_OUT1, enable);        /* set field */
+}
+
+/**
+ * @brief      get left out1 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left out1 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_out1(wm8978_handle_t *handle, wm8978_bool_t *enable)
+{
+    uint8_t res;
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_POWER_MANAGE_3, &conf);        /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 6);                                                        /* clear config */
-    conf |= enable << 6;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_POWER_MANAGE_3, conf);        /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LEFT_OUT1, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                        /* get bool */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                              /* return the result */
 }
 
 /**
- * @brief     enable or disable right out2
+ * @brief     enable or disable sleep
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set right out2 failed
+ *            - 1 set sleep failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_right_out2(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_sleep(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_SLEEP, enable);        /* set field */
+}
+
+/**
+ * @brief      get sleep status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get sleep failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_sleep(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_POWER_MANAGE_3, &conf);        /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 5);                                                        /* clear config */
-    conf |= enable << 5;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_POWER_MANAGE_3, conf);        /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_SLEEP, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                    /* get bool */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                          /* return the result */
 }
 
 /**
- * @brief     enable or disable right output channel mixer
+ * @brief     enable or disable right channel input boost
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set right output channel mixer failed
+ *            - 1 set right channel input boost failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_right_output_channel_mixer(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_right_channel_input_boost(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_RIGHT_CHANNEL_INPUT_BOOST, enable);        /* set field */
+}
+
+/**
+ * @brief      get right channel input boost status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right channel input boost failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_channel_input_boost(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_POWER_MANAGE_3, &conf);        /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 3);                                                        /* clear config */
-    conf |= enable << 3;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_POWER_MANAGE_3, conf);        /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_RIGHT_CHANNEL_INPUT_BOOST, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                        /* get bool */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                                              /* return the result */
 }
 
 /**
- * @brief     enable or disable left output channel mixer
+ * @brief     enable or disable left channel input boost
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set left output channel mixer failed
+ *            - 1 set left channel input boost failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_left_output_channel_mixer(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_left_channel_input_boost(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LEFT_CHANNEL_INPUT_BOOST, enable);        /* set field */
+}
+
+/**
+ * @brief      get left channel input boost status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left channel input boost failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_channel_input_boost(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_POWER_MANAGE_3, &conf);        /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 2);                                                        /* clear config */
-    conf |= enable << 2;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_POWER_MANAGE_3, conf);        /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LEFT_CHANNEL_INPUT_BOOST, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                       /* get bool */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                                             /* return the result */
 }
 
 /**
- * @brief     enable or disable right channel dac
+ * @brief     enable or disable right channel input pga
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set right channel dac failed
+ *            - 1 set right channel input pga failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_right_channel_dac(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_right_channel_input_pga(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_RIGHT_CHANNEL_INPUT_PGA, enable);        /* set field */
+}
+
+/**
+ * @brief      get right channel input pga status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right channel input pga failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_channel_input_pga(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_POWER_MANAGE_3, &conf);        /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 1);                                                        /* clear config */
-    conf |= enable << 1;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_POWER_MANAGE_3, conf);        /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_RIGHT_CHANNEL_INPUT_PGA, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                      /* get bool */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                                            /* return the result */
 }
 
 /**
- * @brief     enable or disable left channel dac
+ * @brief     enable or disable left channel input pga
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set left channel dac failed
+ *            - 1 set left channel input pga failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_left_channel_dac(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_left_channel_input_pga(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LEFT_CHANNEL_INPUT_PGA, enable);        /* set field */
+}
+
+/**
+ * @brief      get left channel input pga status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left channel input pga failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_channel_input_pga(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_POWER_MANAGE_3, &conf);        /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 0);                                                        /* clear config */
-    conf |= enable << 0;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_POWER_MANAGE_3, conf);        /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LEFT_CHANNEL_INPUT_PGA, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                     /* get bool */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                                           /* return the result */
 }
 
 /**
- * @brief     set bclk polarity
+ * @brief     enable or disable right channel adc
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] polarity bclk polarity
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set bclk polarity failed
+ *            - 1 set right channel adc failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_bclk_polarity(wm8978_handle_t *handle, wm8978_polarity_t polarity)
+uint8_t wm8978_set_right_channel_adc(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_RIGHT_CHANNEL_ADC, enable);        /* set field */
+}
+
+/**
+ * @brief      get right channel adc status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right channel adc failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_channel_adc(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
+    uint16_t value;
     
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_AUDIO_INTERFACE, &conf);       /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 8);                                                        /* clear config */
-    conf |= polarity << 8;                                                    /* set polarity */
-    res = a_wm8978_iic_write(handle, WM8978_REG_AUDIO_INTERFACE, conf);       /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_RIGHT_CHANNEL_ADC, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                /* get bool */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                                      /* return the result */
 }
 
 /**
- * @brief     set lrclk polarity
+ * @brief     enable or disable left channel adc
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] polarity lrclk polarity
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set lrclk polarity failed
+ *            - 1 set left channel adc failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_lrclk_polarity(wm8978_handle_t *handle, wm8978_polarity_t polarity)
+uint8_t wm8978_set_left_channel_adc(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LEFT_CHANNEL_ADC, enable);        /* set field */
+}
+
+/**
+ * @brief      get left channel adc status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left channel adc failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_channel_adc(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_AUDIO_INTERFACE, &conf);       /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 7);                                                        /* clear config */
-    conf |= polarity << 7;                                                    /* set polarity */
-    res = a_wm8978_iic_write(handle, WM8978_REG_AUDIO_INTERFACE, conf);       /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LEFT_CHANNEL_ADC, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                               /* get bool */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                                     /* return the result */
 }
 
 /**
- * @brief     set word length
+ * @brief     enable or disable out4
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] word_length iis word length
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set word length failed
+ *            - 1 set out4 failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_word_length(wm8978_handle_t *handle, wm8978_word_length_t word_length)
+uint8_t wm8978_set_out4(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_OUT4, enable);        /* set field */
+}
+
+/**
+ * @brief      get out4 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get out4 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_out4(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_AUDIO_INTERFACE, &conf);       /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(3 << 5);                                                        /* clear config */
-    conf |= word_length << 5;                                                 /* set word length */
-    res = a_wm8978_iic_write(handle, WM8978_REG_AUDIO_INTERFACE, conf);       /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_OUT4, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                   /* get bool */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                         /* return the result */
 }
 
 /**
- * @brief     set data format
+ * @brief     enable or disable out3
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] format data format
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set data format failed
+ *            - 1 set out3 failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_data_format(wm8978_handle_t *handle, wm8978_data_format_t format)
+uint8_t wm8978_set_out3(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_OUT3, enable);        /* set field */
+}
+
+/**
+ * @brief      get out3 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get out3 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_out3(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_AUDIO_INTERFACE, &conf);       /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(3 << 3);                                                        /* clear config */
-    conf |= format << 3;                                                      /* set format */
-    res = a_wm8978_iic_write(handle, WM8978_REG_AUDIO_INTERFACE, conf);       /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_OUT3, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                   /* get bool */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                         /* return the result */
 }
 
 /**
- * @brief     set dac appear
+ * @brief     enable or disable left out2
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] appear dac appear side
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set dac appear failed
+ *            - 1 set left out2 failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_dac_appear(wm8978_handle_t *handle, wm8978_appear_t appear)
+uint8_t wm8978_set_left_out2(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LEFT_OUT2, enable);        /* set field */
+}
+
+/**
+ * @brief      get left out2 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left out2 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_out2(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_AUDIO_INTERFACE, &conf);       /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 2);                                                        /* clear config */
-    conf |= appear << 2;                                                      /* set appear */
-    res = a_wm8978_iic_write(handle, WM8978_REG_AUDIO_INTERFACE, conf);       /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LEFT_OUT2, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                        /* get bool */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                              /* return the result */
 }
 
 /**
- * @brief     set adc appear
+ * @brief     enable or disable right out2
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] appear adc appear side
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set adc appear failed
+ *            - 1 set right out2 failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_adc_appear(wm8978_handle_t *handle, wm8978_appear_t appear)
+uint8_t wm8978_set_right_out2(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_RIGHT_OUT2, enable);        /* set field */
+}
+
+/**
+ * @brief      get right out2 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right out2 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_out2(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_AUDIO_INTERFACE, &conf);       /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 1);                                                        /* clear config */
-    conf |= appear << 1;                                                      /* set appear */
-    res = a_wm8978_iic_write(handle, WM8978_REG_AUDIO_INTERFACE, conf);       /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_RIGHT_OUT2, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                         /* get bool */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                               /* return the result */
 }
 
 /**
- * @brief     set channel
+ * @brief     enable or disable right output channel mixer
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] channel audio channel
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set channel failed
+ *            - 1 set right output channel mixer failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_channel(wm8978_handle_t *handle, wm8978_channel_t channel)
+uint8_t wm8978_set_right_output_channel_mixer(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_RIGHT_OUTPUT_CHANNEL_MIXER, enable);        /* set field */
+}
+
+/**
+ * @brief      get right output channel mixer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right output channel mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_output_channel_mixer(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
+    uint16_t value;
     
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_RIGHT_OUTPUT_CHANNEL_MIXER, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                         /* get bool */
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_AUDIO_INTERFACE, &conf);       /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 0);                                                        /* clear config */
-    conf |= channel << 0;                                                     /* set channel */
-    res = a_wm8978_iic_write(handle, WM8978_REG_AUDIO_INTERFACE, conf);       /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    
-    return 0;                                                                 /* success return 0 */
+    return res;                                                                               /* return the result */
 }
 
 /**
- * @brief     enable or disable companding 8bit mode
+ * @brief     enable or disable left output channel mixer
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set companding 8bit mode failed
+ *            - 1 set left output channel mixer failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_companding_8bit_mode(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_left_output_channel_mixer(wm8978_handle_t *handle, wm8978_bool_t enable)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_COMPANDING_CTRL, &conf);       /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 5);                                                        /* clear config */
-    conf |= enable << 5;                                                      /* set channel */
-    res = a_wm8978_iic_write(handle, WM8978_REG_COMPANDING_CTRL, conf);       /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    
-    return 0;                                                                 /* success return 0 */
+    return a_wm8978_field_set(handle, WM8978_FIELD_LEFT_OUTPUT_CHANNEL_MIXER, enable);        /* set field */
 }
 
 /**
- * @brief     set dac companding
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] companding dac companding
- * @return    status code
- *            - 0 success
- *            - 1 set dac companding failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      get left output channel mixer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left output channel mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
  */
-uint8_t wm8978_set_dac_companding(wm8978_handle_t *handle, wm8978_companding_t companding)
+uint8_t wm8978_get_left_output_channel_mixer(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_COMPANDING_CTRL, &conf);       /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(3 << 3);                                                        /* clear config */
-    conf |= companding << 3;                                                  /* set companding */
-    res = a_wm8978_iic_write(handle, WM8978_REG_COMPANDING_CTRL, conf);       /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LEFT_OUTPUT_CHANNEL_MIXER, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                        /* get bool */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                                              /* return the result */
 }
 
 /**
- * @brief     set adc companding
+ * @brief     enable or disable right channel dac
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] companding adc companding
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set adc companding failed
+ *            - 1 set right channel dac failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_adc_companding(wm8978_handle_t *handle, wm8978_companding_t companding)
+uint8_t wm8978_set_right_channel_dac(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_RIGHT_CHANNEL_DAC, enable);        /* set field */
+}
+
+/**
+ * @brief      get right channel dac status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right channel dac failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_channel_dac(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_COMPANDING_CTRL, &conf);       /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(3 << 1);                                                        /* clear config */
-    conf |= companding << 1;                                                  /* set companding */
-    res = a_wm8978_iic_write(handle, WM8978_REG_COMPANDING_CTRL, conf);       /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_RIGHT_CHANNEL_DAC, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                /* get bool */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                                      /* return the result */
 }
 
 /**
- * @brief     enable or disable loopback
+ * @brief     enable or disable left channel dac
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set loopback failed
+ *            - 1 set left channel dac failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_loopback(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_left_channel_dac(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LEFT_CHANNEL_DAC, enable);        /* set field */
+}
+
+/**
+ * @brief      get left channel dac status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left channel dac failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_channel_dac(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
+    uint16_t value;
     
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_COMPANDING_CTRL, &conf);       /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 0);                                                        /* clear config */
-    conf |= enable << 0;                                                      /* set channel */
-    res = a_wm8978_iic_write(handle, WM8978_REG_COMPANDING_CTRL, conf);       /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LEFT_CHANNEL_DAC, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                               /* get bool */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                                     /* return the result */
 }
 
 /**
- * @brief     set clksel
+ * @brief     set bclk polarity
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] clksel set clksel
+ * @param[in] polarity bclk polarity
  * @return    status code
  *            - 0 success
- *            - 1 set clksel failed
+ *            - 1 set bclk polarity failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_clksel(wm8978_handle_t *handle, wm8978_clksel_t clksel)
+uint8_t wm8978_set_bclk_polarity(wm8978_handle_t *handle, wm8978_polarity_t polarity)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_BCLK_POLARITY, polarity);        /* set field */
+}
+
+/**
+ * @brief      get bclk polarity
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *polarity pointer to a bclk polarity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get bclk polarity failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_bclk_polarity(wm8978_handle_t *handle, wm8978_polarity_t *polarity)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                      /* check handle */
-    {
-        return 2;                                                            /* return error */
-    }
-    if (handle->inited != 1)                                                 /* check handle initialization */
-    {
-        return 3;                                                            /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_CLOCK_GEN_CTRL, &conf);       /* read config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
-    }
-    conf &= ~(1 << 8);                                                       /* clear config */
-    conf |= clksel << 8;                                                     /* set clk */
-    res = a_wm8978_iic_write(handle, WM8978_REG_CLOCK_GEN_CTRL, conf);       /* write config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_BCLK_POLARITY, &value);        /* get field */
+    *polarity = (wm8978_polarity_t)(value);                                      /* get polarity */
     
-    return 0;                                                                /* success return 0 */
+    return res;                                                                  /* return the result */
 }
 
 /**
- * @brief     set mclk div
+ * @brief     set lrclk polarity
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] d mclk div
+ * @param[in] polarity lrclk polarity
  * @return    status code
  *            - 0 success
- *            - 1 set mclk div failed
+ *            - 1 set lrclk polarity failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_mclk_div(wm8978_handle_t *handle, wm8978_mclk_div_t d)
+uint8_t wm8978_set_lrclk_polarity(wm8978_handle_t *handle, wm8978_polarity_t polarity)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LRCLK_POLARITY, polarity);        /* set field */
+}
+
+/**
+ * @brief      get lrclk polarity
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *polarity pointer to a lrclk polarity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get lrclk polarity failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_lrclk_polarity(wm8978_handle_t *handle, wm8978_polarity_t *polarity)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                      /* check handle */
-    {
-        return 2;                                                            /* return error */
-    }
-    if (handle->inited != 1)                                                 /* check handle initialization */
-    {
-        return 3;                                                            /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_CLOCK_GEN_CTRL, &conf);       /* read config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
-    }
-    conf &= ~(7 << 5);                                                       /* clear config */
-    conf |= d << 5;                                                          /* set div */
-    res = a_wm8978_iic_write(handle, WM8978_REG_CLOCK_GEN_CTRL, conf);       /* write config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LRCLK_POLARITY, &value);        /* get field */
+    *polarity = (wm8978_polarity_t)(value);                                       /* get polarity */
     
-    return 0;                                                                /* success return 0 */
+    return res;                                                                   /* return the result */
 }
 
 /**
- * @brief     set bclk div
+ * @brief     set word length
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] d bclk div
+ * @param[in] word_length iis word length
  * @return    status code
  *            - 0 success
- *            - 1 set bclk div failed
+ *            - 1 set word length failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_bclk_div(wm8978_handle_t *handle, wm8978_bclk_div_t d)
+uint8_t wm8978_set_word_length(wm8978_handle_t *handle, wm8978_word_length_t word_length)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_WORD_LENGTH, word_length);        /* set field */
+}
+
+/**
+ * @brief      get word length
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *word_length pointer to an iis word length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get word length failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_word_length(wm8978_handle_t *handle, wm8978_word_length_t *word_length)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                      /* check handle */
-    {
-        return 2;                                                            /* return error */
-    }
-    if (handle->inited != 1)                                                 /* check handle initialization */
-    {
-        return 3;                                                            /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_CLOCK_GEN_CTRL, &conf);       /* read config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
-    }
-    conf &= ~(7 << 2);                                                       /* clear config */
-    conf |= d << 2;                                                          /* set div */
-    res = a_wm8978_iic_write(handle, WM8978_REG_CLOCK_GEN_CTRL, conf);       /* write config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_WORD_LENGTH, &value);        /* get field */
+    *word_length = (wm8978_word_length_t)(value);                              /* get word length */
     
-    return 0;                                                                /* success return 0 */
+    return res;                                                                /* return the result */
 }
 
 /**
- * @brief     set clock mode
+ * @brief     set data format
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] mode clock mode
+ * @param[in] format data format
  * @return    status code
  *            - 0 success
- *            - 1 set clock mode failed
+ *            - 1 set data format failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_clock_mode(wm8978_handle_t *handle, wm8978_clock_mode_t mode)
+uint8_t wm8978_set_data_format(wm8978_handle_t *handle, wm8978_data_format_t format)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_DATA_FORMAT, format);        /* set field */
+}
+
+/**
+ * @brief      get data format
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *format pointer to a data format buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get data format failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_data_format(wm8978_handle_t *handle, wm8978_data_format_t *format)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                      /* check handle */
-    {
-        return 2;                                                            /* return error */
-    }
-    if (handle->inited != 1)                                                 /* check handle initialization */
-    {
-        return 3;                                                            /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_CLOCK_GEN_CTRL, &conf);       /* read config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
-    }
-    conf &= ~(1 << 0);                                                       /* clear config */
-    conf |= mode << 0;                                                       /* set mode */
-    res = a_wm8978_iic_write(handle, WM8978_REG_CLOCK_GEN_CTRL, conf);       /* write config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_DATA_FORMAT, &value);        /* get field */
+    *format = (wm8978_data_format_t)(value);                                   /* get format */
     
-    return 0;                                                                /* success return 0 */
+    return res;                                                                /* return the result */
 }
 
 /**
- * @brief     set approximate sample rate
+ * @brief     set dac appear
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] sample approximate sample rate
+ * @param[in] appear dac appear side
  * @return    status code
  *            - 0 success
- *            - 1 set approximate sample rate failed
+ *            - 1 set dac appear failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_approximate_sample_rate(wm8978_handle_t *handle, wm8978_approximate_sample_t sample)
+uint8_t wm8978_set_dac_appear(wm8978_handle_t *handle, wm8978_appear_t appear)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_DAC_APPEAR, appear);        /* set field */
+}
+
+/**
+ * @brief      get dac appear
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *appear pointer to a dac appear side buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get dac appear failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_dac_appear(wm8978_handle_t *handle, wm8978_appear_t *appear)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                      /* check handle */
-    {
-        return 2;                                                            /* return error */
-    }
-    if (handle->inited != 1)                                                 /* check handle initialization */
-    {
-        return 3;                                                            /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_ADDITIONAL_CTRL, &conf);      /* read config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
-    }
-    conf &= ~(7 << 1);                                                       /* clear config */
-    conf |= sample << 1;                                                     /* set sample */
-    res = a_wm8978_iic_write(handle, WM8978_REG_ADDITIONAL_CTRL, conf);      /* write config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_DAC_APPEAR, &value);        /* get field */
+    *appear = (wm8978_appear_t)(value);                                       /* get appear */
     
-    return 0;                                                                /* success return 0 */
+    return res;                                                               /* return the result */
 }
 
 /**
- * @brief     enable or disable slow clock
+ * @brief     set adc appear
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
+ * @param[in] appear adc appear side
  * @return    status code
  *            - 0 success
- *            - 1 set slow clock failed
+ *            - 1 set adc appear failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_slow_clock(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_adc_appear(wm8978_handle_t *handle, wm8978_appear_t appear)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_ADC_APPEAR, appear);        /* set field */
+}
+
+/**
+ * @brief      get adc appear
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *appear pointer to an adc appear side buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get adc appear failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_adc_appear(wm8978_handle_t *handle, wm8978_appear_t *appear)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                      /* check handle */
-    {
-        return 2;                                                            /* return error */
-    }
-    if (handle->inited != 1)                                                 /* check handle initialization */
-    {
-        return 3;                                                            /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_ADDITIONAL_CTRL, &conf);      /* read config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
-    }
-    conf &= ~(1 << 0);                                                       /* clear config */
-    conf |= enable << 0;                                                     /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_ADDITIONAL_CTRL, conf);      /* write config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_ADC_APPEAR, &value);        /* get field */
+    *appear = (wm8978_appear_t)(value);                                       /* get appear */
     
-    return 0;                                                                /* success return 0 */
+    return res;                                                               /* return the result */
 }
 
 /**
- * @brief     set pll div
+ * @brief     set channel
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] d pll div
+ * @param[in] channel audio channel
  * @return    status code
  *            - 0 success
- *            - 1 set pll div failed
+ *            - 1 set channel failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_pll_div(wm8978_handle_t *handle, wm8978_pll_div_t d)
+uint8_t wm8978_set_channel(wm8978_handle_t *handle, wm8978_channel_t channel)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_CHANNEL, channel);        /* set field */
+}
+
+/**
+ * @brief      get channel
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *channel pointer to an audio channel buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get channel failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_channel(wm8978_handle_t *handle, wm8978_channel_t *channel)
 {
     uint8_t res;
-    uint16_t conf;
+    uint16_t value;
     
-    if (handle == NULL)                                               /* check handle */
-    {
-        return 2;                                                     /* return error */
-    }
-    if (handle->inited != 1)                                          /* check handle initialization */
-    {
-        return 3;                                                     /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_GPIO, &conf);          /* read config */
-    if (res != 0)                                                     /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");         /* read config failed */
-        
-        return 1;                                                     /* return error */
-    }
-    conf &= ~(3 << 4);                                                /* clear config */
-    conf |= d << 4;                                                   /* set div */
-    res = a_wm8978_iic_write(handle, WM8978_REG_GPIO, conf);          /* write config */
-    if (res != 0)                                                     /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");        /* write config failed */
-        
-        return 1;                                                     /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_CHANNEL, &value);        /* get field */
+    *channel = (wm8978_channel_t)(value);                                  /* get channel */
     
-    return 0;                                                         /* success return 0 */
+    return res;                                                            /* return the result */
 }
 
 /**
- * @brief     set gpio1 polarity
+ * @brief     enable or disable companding 8bit mode
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] polarity gpio1 polarity
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set gpio1 polarity failed
+ *            - 1 set companding 8bit mode failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_gpio1_polarity(wm8978_handle_t *handle, wm8978_polarity_t polarity)
+uint8_t wm8978_set_companding_8bit_mode(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_COMPANDING_8BIT_MODE, enable);        /* set field */
+}
+
+/**
+ * @brief      get companding 8bit mode status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get companding 8bit mode failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_companding_8bit_mode(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                               /* check handle */
-    {
-        return 2;                                                     /* return error */
-    }
-    if (handle->inited != 1)                                          /* check handle initialization */
-    {
-        return 3;                                                     /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_GPIO, &conf);          /* read config */
-    if (res != 0)                                                     /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");         /* read config failed */
-        
-        return 1;                                                     /* return error */
-    }
-    conf &= ~(1 << 3);                                                /* clear config */
-    conf |= polarity << 3;                                            /* set polarity */
-    res = a_wm8978_iic_write(handle, WM8978_REG_GPIO, conf);          /* write config */
-    if (res != 0)                                                     /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");        /* write config failed */
-        
-        return 1;                                                     /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_COMPANDING_8BIT_MODE, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                   /* get bool */
     
-    return 0;                                                         /* success return 0 */
+    return res;                                                                         /* return the result */
 }
 
 /**
- * @brief     set gpio1 select
+ * @brief     set dac companding
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] sel gpio1 select
+ * @param[in] companding dac companding
  * @return    status code
  *            - 0 success
- *            - 1 set gpio1 select failed
+ *            - 1 set dac companding failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_gpio1_select(wm8978_handle_t *handle, wm8978_gpio1_sel_t sel)
+uint8_t wm8978_set_dac_companding(wm8978_handle_t *handle, wm8978_companding_t companding)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_DAC_COMPANDING, companding);        /* set field */
+}
+
+/**
+ * @brief      get dac companding
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *companding pointer to a dac companding buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get dac companding failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_dac_companding(wm8978_handle_t *handle, wm8978_companding_t *companding)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                               /* check handle */
-    {
-        return 2;                                                     /* return error */
-    }
-    if (handle->inited != 1)                                          /* check handle initialization */
-    {
-        return 3;                                                     /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_GPIO, &conf);          /* read config */
-    if (res != 0)                                                     /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");         /* read config failed */
-        
-        return 1;                                                     /* return error */
-    }
-    conf &= ~(7 << 0);                                                /* clear config */
-    conf |= sel << 0;                                                 /* set select */
-    res = a_wm8978_iic_write(handle, WM8978_REG_GPIO, conf);          /* write config */
-    if (res != 0)                                                     /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");        /* write config failed */
-        
-        return 1;                                                     /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_DAC_COMPANDING, &value);        /* get field */
+    *companding = (wm8978_companding_t)(value);                                   /* get companding */
     
-    return 0;                                                         /* success return 0 */
+    return res;                                                                   /* return the result */
 }
 
 /**
- * @brief     enable or disable vmid 1
+ * @brief     set adc companding
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
+ * @param[in] companding adc companding
  * @return    status code
  *            - 0 success
- *            - 1 set vmid 1 failed
+ *            - 1 set adc companding failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_vmid_1(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_adc_companding(wm8978_handle_t *handle, wm8978_companding_t companding)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_ADC_COMPANDING, companding);        /* set field */
+}
+
+/**
+ * @brief      get adc companding
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *companding pointer to an adc companding buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get adc companding failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_adc_companding(wm8978_handle_t *handle, wm8978_companding_t *companding)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                            /* check handle */
-    {
-        return 2;                                                                  /* return error */
-    }
-    if (handle->inited != 1)                                                       /* check handle initialization */
-    {
-        return 3;                                                                  /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_JACK_DETECT_CONTROL, &conf);        /* read config */
-    if (res != 0)                                                                  /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                      /* read config failed */
-        
-        return 1;                                                                  /* return error */
-    }
-    conf &= ~(1 << 8);                                                             /* clear config */
-    conf |= enable << 8;                                                           /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_JACK_DETECT_CONTROL, conf);        /* write config */
-    if (res != 0)                                                                  /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                     /* write config failed */
-        
-        return 1;                                                                  /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_ADC_COMPANDING, &value);        /* get field */
+    *companding = (wm8978_companding_t)(value);                                   /* get companding */
     
-    return 0;                                                                      /* success return 0 */
+    return res;                                                                   /* return the result */
 }
 
 /**
- * @brief     enable or disable vmid 0
+ * @brief     enable or disable loopback
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set vmid 0 failed
+ *            - 1 set loopback failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_vmid_0(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_loopback(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LOOPBACK, enable);        /* set field */
+}
+
+/**
+ * @brief      get loopback status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get loopback failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_loopback(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                            /* check handle */
-    {
-        return 2;                                                                  /* return error */
-    }
-    if (handle->inited != 1)                                                       /* check handle initialization */
-    {
-        return 3;                                                                  /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_JACK_DETECT_CONTROL, &conf);        /* read config */
-    if (res != 0)                                                                  /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                      /* read config failed */
-        
-        return 1;                                                                  /* return error */
-    }
-    conf &= ~(1 << 7);                                                             /* clear config */
-    conf |= enable << 7;                                                           /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_JACK_DETECT_CONTROL, conf);        /* write config */
-    if (res != 0)                                                                  /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                     /* write config failed */
-        
-        return 1;                                                                  /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LOOPBACK, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                       /* get bool */
     
-    return 0;                                                                      /* success return 0 */
+    return res;                                                             /* return the result */
 }
 
 /**
- * @brief     enable or disable jack detection
+ * @brief     set clksel
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
+ * @param[in] clksel set clksel
  * @return    status code
  *            - 0 success
- *            - 1 set jack detection failed
+ *            - 1 set clksel failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_jack_detection(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_clksel(wm8978_handle_t *handle, wm8978_clksel_t clksel)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_CLKSEL, clksel);        /* set field */
+}
+
+/**
+ * @brief      get clksel
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *clksel pointer to a clksel buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get clksel failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_clksel(wm8978_handle_t *handle, wm8978_clksel_t *clksel)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                            /* check handle */
-    {
-        return 2;                                                                  /* return error */
-    }
-    if (handle->inited != 1)                                                       /* check handle initialization */
-    {
-        return 3;                                                                  /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_JACK_DETECT_CONTROL, &conf);        /* read config */
-    if (res != 0)                                                                  /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                      /* read config failed */
-        
-        return 1;                                                                  /* return error */
-    }
-    conf &= ~(1 << 6);                                                             /* clear config */
-    conf |= enable << 6;                                                           /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_JACK_DETECT_CONTROL, conf);        /* write config */
-    if (res != 0)                                                                  /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                     /* write config failed */
-        
-        return 1;                                                                  /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_CLKSEL, &value);        /* get field */
+    *clksel = (wm8978_clksel_t)(value);                                   /* get clksel */
     
-    return 0;                                                                      /* success return 0 */
+    return res;                                                           /* return the result */
 }
 
 /**
- * @brief     set jack gpio
+ * @brief     set mclk div
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] sel jack gpio select
+ * @param[in] d mclk div
  * @return    status code
  *            - 0 success
- *            - 1 set jack gpio failed
+ *            - 1 set mclk div failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_jack_gpio(wm8978_handle_t *handle, wm8978_jack_sel_t sel)
+uint8_t wm8978_set_mclk_div(wm8978_handle_t *handle, wm8978_mclk_div_t d)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_MCLK_DIV, d);        /* set field */
+}
+
+/**
+ * @brief      get mclk div
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *d pointer to a mclk div buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get mclk div failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_mclk_div(wm8978_handle_t *handle, wm8978_mclk_div_t *d)
 {
     uint8_t res;
-    uint16_t conf;
+    uint16_t value;
     
-    if (handle == NULL)                                                            /* check handle */
-    {
-        return 2;                                                                  /* return error */
-    }
-    if (handle->inited != 1)                                                       /* check handle initialization */
-    {
-        return 3;                                                                  /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_JACK_DETECT_CONTROL, &conf);        /* read config */
-    if (res != 0)                                                                  /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                      /* read config failed */
-        
-        return 1;                                                                  /* return error */
-    }
-    conf &= ~(3 << 4);                                                             /* clear config */
-    conf |= sel << 4;                                                              /* set sel */
-    res = a_wm8978_iic_write(handle, WM8978_REG_JACK_DETECT_CONTROL, conf);        /* write config */
-    if (res != 0)                                                                  /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                     /* write config failed */
-        
-        return 1;                                                                  /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_MCLK_DIV, &value);        /* get field */
+    *d = (wm8978_mclk_div_t)(value);                                        /* get d */
     
-    return 0;                                                                      /* success return 0 */
+    return res;                                                             /* return the result */
 }
 
 /**
- * @brief     enable or disable soft mute
+ * @brief     set bclk div
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
+ * @param[in] d bclk div
  * @return    status code
  *            - 0 success
- *            - 1 set soft mute failed
+ *            - 1 set bclk div failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_soft_mute(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_bclk_div(wm8978_handle_t *handle, wm8978_bclk_div_t d)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_BCLK_DIV, d);        /* set field */
+}
+
+/**
+ * @brief      get bclk div
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *d pointer to a bclk div buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get bclk div failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_bclk_div(wm8978_handle_t *handle, wm8978_bclk_div_t *d)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                    /* check handle */
-    {
-        return 2;                                                          /* return error */
-    }
-    if (handle->inited != 1)                                               /* check handle initialization */
-    {
-        return 3;                                                          /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_DAC_CONTROL, &conf);        /* read config */
-    if (res != 0)                                                          /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");              /* read config failed */
-        
-        return 1;                                                          /* return error */
-    }
-    conf &= ~(1 << 6);                                                     /* clear config */
-    conf |= enable << 6;                                                   /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_DAC_CONTROL, conf);        /* write config */
-    if (res != 0)                                                          /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");             /* write config failed */
-        
-        return 1;                                                          /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_BCLK_DIV, &value);        /* get field */
+    *d = (wm8978_bclk_div_t)(value);                                        /* get d */
     
-    return 0;                                                              /* success return 0 */
+    return res;                                                             /* return the result */
 }
 
 /**
- * @brief     set dac oversample rate
+ * @brief     set clock mode
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] rate dac oversample rate
+ * @param[in] mode clock mode
  * @return    status code
  *            - 0 success
- *            - 1 set dac oversample rate failed
+ *            - 1 set clock mode failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_dac_oversample_rate(wm8978_handle_t *handle, wm8978_dac_oversample_rate_t rate)
+uint8_t wm8978_set_clock_mode(wm8978_handle_t *handle, wm8978_clock_mode_t mode)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_CLOCK_MODE, mode);        /* set field */
+}
+
+/**
+ * @brief      get clock mode
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *mode pointer to a clock mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get clock mode failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_clock_mode(wm8978_handle_t *handle, wm8978_clock_mode_t *mode)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                    /* check handle */
-    {
-        return 2;                                                          /* return error */
-    }
-    if (handle->inited != 1)                                               /* check handle initialization */
-    {
-        return 3;                                                          /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_DAC_CONTROL, &conf);        /* read config */
-    if (res != 0)                                                          /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");              /* read config failed */
-        
-        return 1;                                                          /* return error */
-    }
-    conf &= ~(1 << 3);                                                     /* clear config */
-    conf |= rate << 3;                                                     /* set rate */
-    res = a_wm8978_iic_write(handle, WM8978_REG_DAC_CONTROL, conf);        /* write config */
-    if (res != 0)                                                          /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");             /* write config failed */
-        
-        return 1;                                                          /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_CLOCK_MODE, &value);        /* get field */
+    *mode = (wm8978_clock_mode_t)(value);                                     /* get mode */
     
-    return 0;                                                              /* success return 0 */
+    return res;                                                               /* return the result */
 }
 
 /**
- * @brief     enable or disable amute
+ * @brief     set approximate sample rate
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
+ * @param[in] sample approximate sample rate
  * @return    status code
  *            - 0 success
- *            - 1 set amute failed
+ *            - 1 set approximate sample rate failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_amute(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_approximate_sample_rate(wm8978_handle_t *handle, wm8978_approximate_sample_t sample)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_APPROXIMATE_SAMPLE_RATE, sample);        /* set field */
+}
+
+/**
+ * @brief      get approximate sample rate
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *sample pointer to an approximate sample rate buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get approximate sample rate failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_approximate_sample_rate(wm8978_handle_t *handle, wm8978_approximate_sample_t *sample)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                    /* check handle */
-    {
-        return 2;                                                          /* return error */
-    }
-    if (handle->inited != 1)                                               /* check handle initialization */
-    {
-        return 3;                                                          /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_DAC_CONTROL, &conf);        /* read config */
-    if (res != 0)                                                          /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");              /* read config failed */
-        
-        return 1;                                                          /* return error */
-    }
-    conf &= ~(1 << 2);                                                     /* clear config */
-    conf |= enable << 2;                                                   /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_DAC_CONTROL, conf);        /* write config */
-    if (res != 0)                                                          /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");             /* write config failed */
-        
-        return 1;                                                          /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_APPROXIMATE_SAMPLE_RATE, &value);        /* get field */
+    *sample = (wm8978_approximate_sample_t)(value);                                        /* get sample */
     
-    return 0;                                                              /* success return 0 */
+    return res;                                                                            /* return the result */
 }
 
 /**
- * @brief     set right dac output polarity
+ * @brief     enable or disable slow clock
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] polarity right dac output polarity
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set right dac output polarity failed
+ *            - 1 set slow clock failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_right_dac_output_polarity(wm8978_handle_t *handle, wm8978_polarity_t polarity)
+uint8_t wm8978_set_slow_clock(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_SLOW_CLOCK, enable);        /* set field */
+}
+
+/**
+ * @brief      get slow clock status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get slow clock failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_slow_clock(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                    /* check handle */
-    {
-        return 2;                                                          /* return error */
-    }
-    if (handle->inited != 1)                                               /* check handle initialization */
-    {
-        return 3;                                                          /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_DAC_CONTROL, &conf);        /* read config */
-    if (res != 0)                                                          /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");              /* read config failed */
-        
-        return 1;                                                          /* return error */
-    }
-    conf &= ~(1 << 1);                                                     /* clear config */
-    conf |= polarity << 1;                                                 /* set polarity */
-    res = a_wm8978_iic_write(handle, WM8978_REG_DAC_CONTROL, conf);        /* write config */
-    if (res != 0)                                                          /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");             /* write config failed */
-        
-        return 1;                                                          /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_SLOW_CLOCK, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                         /* get bool */
     
-    return 0;                                                              /* success return 0 */
+    return res;                                                               /* return the result */
 }
 
 /**
- * @brief     set left dac output polarity
+ * @brief     set pll div
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] polarity left dac output polarity
+ * @param[in] d pll div
  * @return    status code
  *            - 0 success
- *            - 1 set left dac output polarity failed
+ *            - 1 set pll div failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_left_dac_output_polarity(wm8978_handle_t *handle, wm8978_polarity_t polarity)
+uint8_t wm8978_set_pll_div(wm8978_handle_t *handle, wm8978_pll_div_t d)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                    /* check handle */
-    {
-        return 2;                                                          /* return error */
-    }
-    if (handle->inited != 1)                                               /* check handle initialization */
-    {
-        return 3;                                                          /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_DAC_CONTROL, &conf);        /* read config */
-    if (res != 0)                                                          /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");              /* read config failed */
-        
-        return 1;                                                          /* return error */
-    }
-    conf &= ~(1 << 0);                                                     /* clear config */
-    conf |= polarity << 0;                                                 /* set polarity */
-    res = a_wm8978_iic_write(handle, WM8978_REG_DAC_CONTROL, conf);        /* write config */
-    if (res != 0)                                                          /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");             /* write config failed */
-        
-        return 1;                                                          /* return error */
-    }
+    return a_wm8978_field_set(handle, WM8978_FIELD_PLL_DIV, d);        /* set field */
+}
+
+/**
+ * @brief      get pll div
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *d pointer to a pll div buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get pll div failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_pll_div(wm8978_handle_t *handle, wm8978_pll_div_t *d)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_PLL_DIV, &value);        /* get field */
+    *d = (wm8978_pll_div_t)(value);                                        /* get d */
     
-    return 0;                                                              /* success return 0 */
+    return res;                                                            /* return the result */
 }
 
 /**
- * @brief     set dac left volume
+ * @brief     set gpio1 polarity
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value, update once flag
- * @param[in] volume set volume
+ * @param[in] polarity gpio1 polarity
  * @return    status code
  *            - 0 success
- *            - 1 set dac left volume failed
+ *            - 1 set gpio1 polarity failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_dac_left_volume(wm8978_handle_t *handle, wm8978_bool_t enable, uint8_t volume)
+uint8_t wm8978_set_gpio1_polarity(wm8978_handle_t *handle, wm8978_polarity_t polarity)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_GPIO1_POLARITY, polarity);        /* set field */
+}
+
+/**
+ * @brief      get gpio1 polarity
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *polarity pointer to a gpio1 polarity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get gpio1 polarity failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_gpio1_polarity(wm8978_handle_t *handle, wm8978_polarity_t *polarity)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                             /* check handle */
-    {
-        return 2;                                                                   /* return error */
-    }
-    if (handle->inited != 1)                                                        /* check handle initialization */
-    {
-        return 3;                                                                   /* return error */
-    }
+    uint16_t value;
     
-    conf = (enable << 8) | volume;                                                  /* set volume */
-    res = a_wm8978_iic_write(handle, WM8978_REG_LEFT_DAC_DIGITAL_VOL, conf);        /* write config */
-    if (res != 0)                                                                   /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                      /* write config failed */
-        
-        return 1;                                                                   /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_GPIO1_POLARITY, &value);        /* get field */
+    *polarity = (wm8978_polarity_t)(value);                                       /* get polarity */
     
-    return 0;                                                                       /* success return 0 */
+    return res;                                                                   /* return the result */
 }
 
 /**
- * @brief     set dac right volume
+ * @brief     set gpio1 select
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value, update once flag
- * @param[in] volume set volume
+ * @param[in] sel gpio1 select
  * @return    status code
  *            - 0 success
- *            - 1 set dac right volume failed
+ *            - 1 set gpio1 select failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_dac_right_volume(wm8978_handle_t *handle, wm8978_bool_t enable, uint8_t volume)
+uint8_t wm8978_set_gpio1_select(wm8978_handle_t *handle, wm8978_gpio1_sel_t sel)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_GPIO1_SELECT, sel);        /* set field */
+}
+
+/**
+ * @brief      get gpio1 select
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *sel pointer to a gpio1 select buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get gpio1 select failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_gpio1_select(wm8978_handle_t *handle, wm8978_gpio1_sel_t *sel)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                             /* check handle */
-    {
-        return 2;                                                                   /* return error */
-    }
-    if (handle->inited != 1)                                                        /* check handle initialization */
-    {
-        return 3;                                                                   /* return error */
-    }
+    uint16_t value;
     
-    conf = (enable << 8) | volume;                                                  /* set volume */
-    res = a_wm8978_iic_write(handle, WM8978_REG_RIGHT_DAC_DIGITAL_VOL, conf);       /* write config */
-    if (res != 0)                                                                   /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                      /* write config failed */
-        
-        return 1;                                                                   /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_GPIO1_SELECT, &value);        /* get field */
+    *sel = (wm8978_gpio1_sel_t)(value);                                         /* get sel */
     
-    return 0;                                                                       /* success return 0 */
+    return res;                                                                 /* return the result */
 }
 
 /**
- * @brief     set jack logic 1
+ * @brief     enable or disable vmid 1
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] jack jack operation
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set jack logic 1 failed
+ *            - 1 set vmid 1 failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_jack_logic_1(wm8978_handle_t *handle, wm8978_jack_t jack, wm8978_bool_t enable)
+uint8_t wm8978_set_vmid_1(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_VMID_1, enable);        /* set field */
+}
+
+/**
+ * @brief      get vmid 1 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get vmid 1 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_vmid_1(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                             /* check handle */
-    {
-        return 2;                                                                   /* return error */
-    }
-    if (handle->inited != 1)                                                        /* check handle initialization */
-    {
-        return 3;                                                                   /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_JACK_DETECT_CONTROL2, &conf);        /* read config */
-    if (res != 0)                                                                   /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                       /* read config failed */
-        
-        return 1;                                                                   /* return error */
-    }
-    if (enable != 0)                                                                /* if enable */
-    {
-        conf |= jack << 4;                                                          /* set 1 */
-    }
-    else
-    {
-        conf &= ~(jack << 4);                                                       /* set 0 */
-    }
-    res = a_wm8978_iic_write(handle, WM8978_REG_JACK_DETECT_CONTROL2, conf);        /* write config */
-    if (res != 0)                                                                   /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                      /* write config failed */
-        
-        return 1;                                                                   /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_VMID_1, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                     /* get bool */
     
-    return 0;                                                                       /* success return 0 */
+    return res;                                                           /* return the result */
 }
 
 /**
- * @brief     set jack logic 0
+ * @brief     enable or disable vmid 0
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] jack jack operation
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set jack logic 0 failed
+ *            - 1 set vmid 0 failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_jack_logic_0(wm8978_handle_t *handle, wm8978_jack_t jack, wm8978_bool_t enable)
+uint8_t wm8978_set_vmid_0(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_VMID_0, enable);        /* set field */
+}
+
+/**
+ * @brief      get vmid 0 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get vmid 0 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_vmid_0(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                             /* check handle */
-    {
-        return 2;                                                                   /* return error */
-    }
-    if (handle->inited != 1)                                                        /* check handle initialization */
-    {
-        return 3;                                                                   /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_JACK_DETECT_CONTROL2, &conf);        /* read config */
-    if (res != 0)                                                                   /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                       /* read config failed */
-        
-        return 1;                                                                   /* return error */
-    }
-    if (enable != 0)                                                                /* if enable */
-    {
-        conf |= jack << 0;                                                          /* set 1 */
-    }
-    else
-    {
-        conf &= ~(jack << 0);                                                       /* set 0 */
-    }
-    res = a_wm8978_iic_write(handle, WM8978_REG_JACK_DETECT_CONTROL2, conf);        /* write config */
-    if (res != 0)                                                                   /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                      /* write config failed */
-        
-        return 1;                                                                   /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_VMID_0, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                     /* get bool */
     
-    return 0;                                                                       /* success return 0 */
+    return res;                                                           /* return the result */
 }
 
 /**
- * @brief     enable or disable high pass filter
+ * @brief     enable or disable jack detection
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set high pass filter failed
+ *            - 1 set jack detection failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_high_pass_filter(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_jack_detection(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_JACK_DETECTION, enable);        /* set field */
+}
+
+/**
+ * @brief      get jack detection status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get jack detection failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_jack_detection(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                    /* check handle */
-    {
-        return 2;                                                          /* return error */
-    }
-    if (handle->inited != 1)                                               /* check handle initialization */
-    {
-        return 3;                                                          /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_ADC_CONTROL, &conf);        /* read config */
-    if (res != 0)                                                          /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");              /* read config failed */
-        
-        return 1;                                                          /* return error */
-    }
-    conf &= ~(1 << 8);                                                     /* clear config */
-    conf |= enable << 8;                                                   /* set enable */
-    res = a_wm8978_iic_write(handle, WM8978_REG_ADC_CONTROL, conf);        /* write config */
-    if (res != 0)                                                          /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");             /* write config failed */
-        
-        return 1;                                                          /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_JACK_DETECTION, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                             /* get bool */
     
-    return 0;                                                              /* success return 0 */
+    return res;                                                                   /* return the result */
 }
 
 /**
- * @brief     set chip mode
+ * @brief     set jack gpio
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] mode set mode
+ * @param[in] sel jack gpio select
  * @return    status code
  *            - 0 success
- *            - 1 set mode failed
+ *            - 1 set jack gpio failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_mode(wm8978_handle_t *handle, wm8978_mode_t mode)
+uint8_t wm8978_set_jack_gpio(wm8978_handle_t *handle, wm8978_jack_sel_t sel)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_JACK_GPIO, sel);        /* set field */
+}
+
+/**
+ * @brief      get jack gpio
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *sel pointer to a jack gpio select buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get jack gpio failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_jack_gpio(wm8978_handle_t *handle, wm8978_jack_sel_t *sel)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                    /* check handle */
-    {
-        return 2;                                                          /* return error */
-    }
-    if (handle->inited != 1)                                               /* check handle initialization */
-    {
-        return 3;                                                          /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_ADC_CONTROL, &conf);        /* read config */
-    if (res != 0)                                                          /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");              /* read config failed */
-        
-        return 1;                                                          /* return error */
-    }
-    conf &= ~(1 << 7);                                                     /* clear config */
-    conf |= mode << 7;                                                     /* set mode */
-    res = a_wm8978_iic_write(handle, WM8978_REG_ADC_CONTROL, conf);        /* write config */
-    if (res != 0)                                                          /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");             /* write config failed */
-        
-        return 1;                                                          /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_JACK_GPIO, &value);        /* get field */
+    *sel = (wm8978_jack_sel_t)(value);                                       /* get sel */
     
-    return 0;                                                              /* success return 0 */
+    return res;                                                              /* return the result */
 }
 
 /**
- * @brief     set high pass filter cut off
+ * @brief     enable or disable soft mute
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] cut high pass filter cut off
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set high pass filter cut off failed
+ *            - 1 set soft mute failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_high_pass_filter_cut_off(wm8978_handle_t *handle, wm8978_high_pass_filter_cut_off_t cut)
+uint8_t wm8978_set_soft_mute(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_SOFT_MUTE, enable);        /* set field */
+}
+
+/**
+ * @brief      get soft mute status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get soft mute failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_soft_mute(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                    /* check handle */
-    {
-        return 2;                                                          /* return error */
-    }
-    if (handle->inited != 1)                                               /* check handle initialization */
-    {
-        return 3;                                                          /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_ADC_CONTROL, &conf);        /* read config */
-    if (res != 0)                                                          /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");              /* read config failed */
-        
-        return 1;                                                          /* return error */
-    }
-    conf &= ~(7 << 4);                                                     /* clear config */
-    conf |= cut << 4;                                                      /* set cut off */
-    res = a_wm8978_iic_write(handle, WM8978_REG_ADC_CONTROL, conf);        /* write config */
-    if (res != 0)                                                          /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");             /* write config failed */
-        
-        return 1;                                                          /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_SOFT_MUTE, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                        /* get bool */
     
-    return 0;                                                              /* success return 0 */
+    return res;                                                              /* return the result */
 }
 
 /**
- * @brief     set adc oversample rate
+ * @brief     set dac oversample rate
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] rate adc oversample rate
+ * @param[in] rate dac oversample rate
  * @return    status code
  *            - 0 success
- *            - 1 set adc oversample rate failed
+ *            - 1 set dac oversample rate failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_adc_oversample_rate(wm8978_handle_t *handle, wm8978_adc_oversample_rate_t rate)
+uint8_t wm8978_set_dac_oversample_rate(wm8978_handle_t *handle, wm8978_dac_oversample_rate_t rate)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_DAC_OVERSAMPLE_RATE, rate);        /* set field */
+}
+
+/**
+ * @brief      get dac oversample rate
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *rate pointer to a dac oversample rate buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get dac oversample rate failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_dac_oversample_rate(wm8978_handle_t *handle, wm8978_dac_oversample_rate_t *rate)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                    /* check handle */
-    {
-        return 2;                                                          /* return error */
-    }
-    if (handle->inited != 1)                                               /* check handle initialization */
-    {
-        return 3;                                                          /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_ADC_CONTROL, &conf);        /* read config */
-    if (res != 0)                                                          /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");              /* read config failed */
-        
-        return 1;                                                          /* return error */
-    }
-    conf &= ~(1 << 3);                                                     /* clear config */
-    conf |= rate << 3;                                                     /* set rate */
-    res = a_wm8978_iic_write(handle, WM8978_REG_ADC_CONTROL, conf);        /* write config */
-    if (res != 0)                                                          /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");             /* write config failed */
-        
-        return 1;                                                          /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_DAC_OVERSAMPLE_RATE, &value);        /* get field */
+    *rate = (wm8978_dac_oversample_rate_t)(value);                                     /* get rate */
     
-    return 0;                                                              /* success return 0 */
+    return res;                                                                        /* return the result */
 }
 
 /**
- * @brief     set adc right channel polarity
+ * @brief     enable or disable amute
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] polarity adc polarity
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set adc right channel polarity failed
+ *            - 1 set amute failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_adc_right_channel_polarity(wm8978_handle_t *handle, wm8978_polarity_t polarity)
+uint8_t wm8978_set_amute(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_AMUTE, enable);        /* set field */
+}
+
+/**
+ * @brief      get amute status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get amute failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_amute(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
+    uint16_t value;
     
-    if (handle == NULL)                                                    /* check handle */
-    {
-        return 2;                                                          /* return error */
-    }
-    if (handle->inited != 1)                                               /* check handle initialization */
-    {
-        return 3;                                                          /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_ADC_CONTROL, &conf);        /* read config */
-    if (res != 0)                                                          /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");              /* read config failed */
-        
-        return 1;                                                          /* return error */
-    }
-    conf &= ~(1 << 1);                                                     /* clear config */
-    conf |= polarity << 1;                                                 /* set polarity */
-    res = a_wm8978_iic_write(handle, WM8978_REG_ADC_CONTROL, conf);        /* write config */
-    if (res != 0)                                                          /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");             /* write config failed */
-        
-        return 1;                                                          /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_AMUTE, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                    /* get bool */
     
-    return 0;                                                              /* success return 0 */
+    return res;                                                          /* return the result */
 }
 
 /**
- * @brief     set adc left channel polarity
+ * @brief     set right dac output polarity
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] polarity adc polarity
+ * @param[in] polarity right dac output polarity
  * @return    status code
  *            - 0 success
- *            - 1 set adc left channel polarity failed
+ *            - 1 set right dac output polarity failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_adc_left_channel_polarity(wm8978_handle_t *handle, wm8978_polarity_t polarity)
+uint8_t wm8978_set_right_dac_output_polarity(wm8978_handle_t *handle, wm8978_polarity_t polarity)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_RIGHT_DAC_OUTPUT_POLARITY, polarity);        /* set field */
+}
+
+/**
+ * @brief      get right dac output polarity
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *polarity pointer to a right dac output polarity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right dac output polarity failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_dac_output_polarity(wm8978_handle_t *handle, wm8978_polarity_t *polarity)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                    /* check handle */
-    {
-        return 2;                                                          /* return error */
-    }
-    if (handle->inited != 1)                                               /* check handle initialization */
-    {
-        return 3;                                                          /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_ADC_CONTROL, &conf);        /* read config */
-    if (res != 0)                                                          /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");              /* read config failed */
-        
-        return 1;                                                          /* return error */
-    }
-    conf &= ~(1 << 0);                                                     /* clear config */
-    conf |= polarity << 0;                                                 /* set polarity */
-    res = a_wm8978_iic_write(handle, WM8978_REG_ADC_CONTROL, conf);        /* write config */
-    if (res != 0)                                                          /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");             /* write config failed */
-        
-        return 1;                                                          /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_RIGHT_DAC_OUTPUT_POLARITY, &value);        /* get field */
+    *polarity = (wm8978_polarity_t)(value);                                                  /* get polarity */
     
-    return 0;                                                              /* success return 0 */
+    return res;                                                                              /* return the result */
 }
 
 /**
- * @brief     set adc left volume
+ * @brief     set left dac output polarity
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value, update once flag
- * @param[in] volume set volume
+ * @param[in] polarity left dac output polarity
  * @return    status code
  *            - 0 success
- *            - 1 set adc left volume failed
+ *            - 1 set left dac output polarity failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_adc_left_volume(wm8978_handle_t *handle, wm8978_bool_t enable, uint8_t volume)
+uint8_t wm8978_set_left_dac_output_polarity(wm8978_handle_t *handle, wm8978_polarity_t polarity)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LEFT_DAC_OUTPUT_POLARITY, polarity);        /* set field */
+}
+
+/**
+ * @brief      get left dac output polarity
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *polarity pointer to a left dac output polarity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left dac output polarity failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_dac_output_polarity(wm8978_handle_t *handle, wm8978_polarity_t *polarity)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                             /* check handle */
-    {
-        return 2;                                                                   /* return error */
-    }
-    if (handle->inited != 1)                                                        /* check handle initialization */
-    {
-        return 3;                                                                   /* return error */
-    }
+    uint16_t value;
     
-    conf = (enable << 8) | volume;                                                  /* set volume */
-    res = a_wm8978_iic_write(handle, WM8978_REG_LEFT_ADC_DIGITAL_VOL, conf);        /* write config */
-    if (res != 0)                                                                   /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                      /* write config failed */
-        
-        return 1;                                                                   /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LEFT_DAC_OUTPUT_POLARITY, &value);        /* get field */
+    *polarity = (wm8978_polarity_t)(value);                                                 /* get polarity */
     
-    return 0;                                                                       /* success return 0 */
+    return res;                                                                             /* return the result */
 }
 
 /**
- * @brief     set adc right volume
+ * @brief     set dac left volume
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value, update once flag
  * @param[in] volume set volume
  * @return    status code
  *            - 0 success
- *            - 1 set adc right volume failed
+ *            - 1 set dac left volume failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_adc_right_volume(wm8978_handle_t *handle, wm8978_bool_t enable, uint8_t volume)
+uint8_t wm8978_set_dac_left_volume(wm8978_handle_t *handle, wm8978_bool_t enable, uint8_t volume)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                             /* check handle */
-    {
-        return 2;                                                                   /* return error */
-    }
-    if (handle->inited != 1)                                                        /* check handle initialization */
-    {
-        return 3;                                                                   /* return error */
-    }
+    wm8978_field_value_t list[2];
     
-    conf = (enable << 8) | volume;                                                  /* set volume */
-    res = a_wm8978_iic_write(handle, WM8978_REG_RIGHT_ADC_DIGITAL_VOL, conf);       /* write config */
-    if (res != 0)                                                                   /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                      /* write config failed */
-        
-        return 1;                                                                   /* return error */
-    }
+    list[0].field = WM8978_FIELD_DAC_LEFT_VOLUME_UPDATE;        /* set field */
+    list[0].value = enable;                                     /* set value */
+    list[1].field = WM8978_FIELD_DAC_LEFT_VOLUME;               /* set field */
+    list[1].value = volume;                                     /* set value */
     
-    return 0;                                                                       /* success return 0 */
+    return a_wm8978_field_write(handle, list, 2);               /* write fields */
 }
 
 /**
- * @brief      convert the volume data to the register raw data
+ * @brief      get dac left volume
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  db volume db
- * @param[out] *reg pointer to a volume raw data buffer
+ * @param[out] *enable pointer to an update once flag buffer
+ * @param[out] *volume pointer to a volume buffer
  * @return     status code
  *             - 0 success
+ *             - 1 get dac left volume failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_volume_convert_to_register(wm8978_handle_t *handle, float db, uint8_t *reg)
+uint8_t wm8978_get_dac_left_volume(wm8978_handle_t *handle, wm8978_bool_t *enable, uint8_t *volume)
 {
-    if (handle == NULL)                                      /* check handle */
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_DAC_LEFT_VOLUME_UPDATE, &value);        /* get field */
+    if (res != 0)                                                                         /* check result */
     {
-        return 2;                                            /* return error */
+        return res;                                                                       /* return error */
     }
-    if (handle->inited != 1)                                 /* check handle initialization */
+    *enable = (wm8978_bool_t)(value);                                                     /* get bool */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_DAC_LEFT_VOLUME, &value);               /* get field */
+    if (res != 0)                                                                         /* check result */
     {
-        return 3;                                            /* return error */
+        return res;                                                                       /* return error */
     }
+    *volume = (uint8_t)(value);                                                           /* get volume */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief     set dac right volume
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] enable bool value, update once flag
+ * @param[in] volume set volume
+ * @return    status code
+ *            - 0 success
+ *            - 1 set dac right volume failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_dac_right_volume(wm8978_handle_t *handle, wm8978_bool_t enable, uint8_t volume)
+{
+    wm8978_field_value_t list[2];
     
-    *reg = (uint8_t)((uint8_t)(db + 127.0f) * 2 + 1);        /* convert */
+    list[0].field = WM8978_FIELD_DAC_RIGHT_VOLUME_UPDATE;        /* set field */
+    list[0].value = enable;                                      /* set value */
+    list[1].field = WM8978_FIELD_DAC_RIGHT_VOLUME;               /* set field */
+    list[1].value = volume;                                      /* set value */
     
-    return 0;                                                /* success return 0 */
+    return a_wm8978_field_write(handle, list, 2);                /* write fields */
 }
 
 /**
- * @brief      convert the volume register raw data to the real data
+ * @brief      get dac right volume
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  reg volume raw data
- * @param[out] *db pointer to a volume real data buffer
+ * @param[out] *enable pointer to an update once flag buffer
+ * @param[out] *volume pointer to a volume buffer
  * @return     status code
  *             - 0 success
+ *             - 1 get dac right volume failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_volume_convert_to_data(wm8978_handle_t *handle, uint8_t reg, float *db)
+uint8_t wm8978_get_dac_right_volume(wm8978_handle_t *handle, wm8978_bool_t *enable, uint8_t *volume)
 {
-    if (handle == NULL)                            /* check handle */
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_DAC_RIGHT_VOLUME_UPDATE, &value);        /* get field */
+    if (res != 0)                                                                          /* check result */
     {
-        return 2;                                  /* return error */
+        return res;                                                                        /* return error */
     }
-    if (handle->inited != 1)                       /* check handle initialization */
+    *enable = (wm8978_bool_t)(value);                                                      /* get bool */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_DAC_RIGHT_VOLUME, &value);               /* get field */
+    if (res != 0)                                                                          /* check result */
     {
-        return 3;                                  /* return error */
+        return res;                                                                        /* return error */
     }
+    *volume = (uint8_t)(value);                                                            /* get volume */
     
-    *db = -127.0f + (float)(reg - 1) * 0.5f;       /* convert */
-    
-    return 0;                                      /* success return 0 */
+    return 0;                                                                              /* success return 0 */
 }
 
 /**
- * @brief     set equaliser apply
+ * @brief     set jack logic 1
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] equaliser set equaliser
+ * @param[in] jack jack operation
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set equaliser apply failed
+ *            - 1 set jack logic 1 failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_equaliser_apply(wm8978_handle_t *handle, wm8978_equaliser_t equaliser)
+uint8_t wm8978_set_jack_logic_1(wm8978_handle_t *handle, wm8978_jack_t jack, wm8978_bool_t enable)
 {
-    uint8_t res;
-    uint16_t conf;
+    const wm8978_field_desc_t *desc;
+    uint16_t mask;
     
-    if (handle == NULL)                                            /* check handle */
+    if (handle == NULL)                                                                   /* check handle */
     {
-        return 2;                                                  /* return error */
+        return 2;                                                                         /* return error */
     }
-    if (handle->inited != 1)                                       /* check handle initialization */
+    if (handle->inited != 1)                                                              /* check handle initialization */
     {
-        return 3;                                                  /* return error */
+        return 3;                                                                         /* return error */
     }
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_EQ1, &conf);        /* read config */
-    if (res != 0)                                                  /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");      /* read config failed */
-        
-        return 1;                                                  /* return error */
-    }
-    conf &= ~(1 << 8);                                             /* clear config */
-    conf |= equaliser << 8;                                        /* set equaliser */
-    res = a_wm8978_iic_write(handle, WM8978_REG_EQ1, conf);        /* write config */
-    if (res != 0)                                                  /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");     /* write config failed */
-        
-        return 1;                                                  /* return error */
-    }
+    desc = &gsc_wm8978_field[WM8978_FIELD_JACK_LOGIC_1];                                  /* get descriptor */
+    mask = (uint16_t)((jack & 0x0F) << desc->shift);                                      /* set mask */
     
-    return 0;                                                      /* success return 0 */
+    return a_wm8978_reg_update(handle, desc->reg, mask, (enable != 0) ? mask : 0);        /* update the register */
 }
 
 /**
- * @brief     set eq1 cut off
+ * @brief      get jack logic 1
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  jack jack operation
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get jack logic 1 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_jack_logic_1(wm8978_handle_t *handle, wm8978_jack_t jack, wm8978_bool_t *enable)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_JACK_LOGIC_1, &value);        /* get field */
+    *enable = (wm8978_bool_t)(((value & jack) == jack) ? 1 : 0);                /* get bool */
+    
+    return res;                                                                 /* return the result */
+}
+
+/**
+ * @brief     set jack logic 0
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] cut_off cut off freq
+ * @param[in] jack jack operation
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set eq1 cut off failed
+ *            - 1 set jack logic 0 failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_eq1_cut_off(wm8978_handle_t *handle, wm8978_eq1_band_cut_off_t cut_off)
+uint8_t wm8978_set_jack_logic_0(wm8978_handle_t *handle, wm8978_jack_t jack, wm8978_bool_t enable)
 {
-    uint8_t res;
-    uint16_t conf;
+    const wm8978_field_desc_t *desc;
+    uint16_t mask;
     
-    if (handle == NULL)                                            /* check handle */
+    if (handle == NULL)                                                                   /* check handle */
     {
-        return 2;                                                  /* return error */
+        return 2;                                                                         /* return error */
     }
-    if (handle->inited != 1)                                       /* check handle initialization */
+    if (handle->inited != 1)                                                              /* check handle initialization */
     {
-        return 3;                                                  /* return error */
+        return 3;                                                                         /* return error */
     }
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_EQ1, &conf);        /* read config */
-    if (res != 0)                                                  /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");      /* read config failed */
-        
-        return 1;                                                  /* return error */
-    }
-    conf &= ~(3 << 5);                                             /* clear config */
-    conf |= cut_off << 5;                                          /* set cut off */
-    res = a_wm8978_iic_write(handle, WM8978_REG_EQ1, conf);        /* write config */
-    if (res != 0)                                                  /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");     /* write config failed */
-        
-        return 1;                                                  /* return error */
-    }
+    desc = &gsc_wm8978_field[WM8978_FIELD_JACK_LOGIC_0];                                  /* get descriptor */
+    mask = (uint16_t)((jack & 0x0F) << desc->shift);                                      /* set mask */
     
-    return 0;                                                      /* success return 0 */
+    return a_wm8978_reg_update(handle, desc->reg, mask, (enable != 0) ? mask : 0);        /* update the register */
 }
 
 /**
- * @brief     set eq1 gain
+ * @brief      get jack logic 0
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  jack jack operation
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get jack logic 0 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_jack_logic_0(wm8978_handle_t *handle, wm8978_jack_t jack, wm8978_bool_t *enable)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_JACK_LOGIC_0, &value);        /* get field */
+    *enable = (wm8978_bool_t)(((value & jack) == jack) ? 1 : 0);                /* get bool */
+    
+    return res;                                                                 /* return the result */
+}
+
+/**
+ * @brief     enable or disable high pass filter
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] gain eq1 gain
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set eq1 gain failed
+ *            - 1 set high pass filter failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 gain > 0x1F
  * @note      none
  */
-uint8_t wm8978_set_eq1_gain(wm8978_handle_t *handle, uint8_t gain)
+uint8_t wm8978_set_high_pass_filter(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_HIGH_PASS_FILTER, enable);        /* set field */
+}
+
+/**
+ * @brief      get high pass filter status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get high pass filter failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_high_pass_filter(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
+    uint16_t value;
     
-    if (handle == NULL)                                            /* check handle */
-    {
-        return 2;                                                  /* return error */
-    }
-    if (handle->inited != 1)                                       /* check handle initialization */
-    {
-        return 3;                                                  /* return error */
-    }
-    if (gain > 0x1F)                                               /* check gain */
-    {
-        handle->debug_print("wm8978: gain > 0x1F.\n");             /* gain > 0x1F */
-        
-        return 4;                                                  /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_EQ1, &conf);        /* read config */
-    if (res != 0)                                                  /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");      /* read config failed */
-        
-        return 1;                                                  /* return error */
-    }
-    conf &= ~(0x1F << 0);                                          /* clear config */
-    conf |= gain << 0;                                             /* set gain */
-    res = a_wm8978_iic_write(handle, WM8978_REG_EQ1, conf);        /* write config */
-    if (res != 0)                                                  /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");     /* write config failed */
-        
-        return 1;                                                  /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_HIGH_PASS_FILTER, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                               /* get bool */
     
-    return 0;                                                      /* success return 0 */
+    return res;                                                                     /* return the result */
 }
 
 /**
- * @brief     set eq2 bandwidth
+ * @brief     set chip mode
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] width set bandwidth
+ * @param[in] mode set mode
  * @return    status code
  *            - 0 success
- *            - 1 set eq2 bandwidth failed
+ *            - 1 set mode failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_eq2_bandwidth(wm8978_handle_t *handle, wm8978_eq_bandwidth_t width)
+uint8_t wm8978_set_mode(wm8978_handle_t *handle, wm8978_mode_t mode)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_MODE, mode);        /* set field */
+}
+
+/**
+ * @brief      get chip mode
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *mode pointer to a mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get chip mode failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_mode(wm8978_handle_t *handle, wm8978_mode_t *mode)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                            /* check handle */
-    {
-        return 2;                                                  /* return error */
-    }
-    if (handle->inited != 1)                                       /* check handle initialization */
-    {
-        return 3;                                                  /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_EQ2, &conf);        /* read config */
-    if (res != 0)                                                  /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");      /* read config failed */
-        
-        return 1;                                                  /* return error */
-    }
-    conf &= ~(1 << 8);                                             /* clear config */
-    conf |= width << 8;                                            /* set width */
-    res = a_wm8978_iic_write(handle, WM8978_REG_EQ2, conf);        /* write config */
-    if (res != 0)                                                  /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");     /* write config failed */
-        
-        return 1;                                                  /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_MODE, &value);        /* get field */
+    *mode = (wm8978_mode_t)(value);                                     /* get mode */
     
-    return 0;                                                      /* success return 0 */
+    return res;                                                         /* return the result */
 }
 
 /**
- * @brief     set eq2 centre freq
+ * @brief     set high pass filter cut off
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] freq centre freq
+ * @param[in] cut high pass filter cut off
  * @return    status code
  *            - 0 success
- *            - 1 set eq2 centre freq failed
+ *            - 1 set high pass filter cut off failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_eq2_centre_freq(wm8978_handle_t *handle, wm8978_eq2_band_centre_freq_t freq)
+uint8_t wm8978_set_high_pass_filter_cut_off(wm8978_handle_t *handle, wm8978_high_pass_filter_cut_off_t cut)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_HIGH_PASS_FILTER_CUT_OFF, cut);        /* set field */
+}
+
+/**
+ * @brief      get high pass filter cut off
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *cut pointer to a high pass filter cut off buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get high pass filter cut off failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_high_pass_filter_cut_off(wm8978_handle_t *handle, wm8978_high_pass_filter_cut_off_t *cut)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                            /* check handle */
-    {
-        return 2;                                                  /* return error */
-    }
-    if (handle->inited != 1)                                       /* check handle initialization */
-    {
-        return 3;                                                  /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_EQ2, &conf);        /* read config */
-    if (res != 0)                                                  /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");      /* read config failed */
-        
-        return 1;                                                  /* return error */
-    }
-    conf &= ~(3 << 5);                                             /* clear config */
-    conf |= freq << 5;                                             /* set freq */
-    res = a_wm8978_iic_write(handle, WM8978_REG_EQ2, conf);        /* write config */
-    if (res != 0)                                                  /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");     /* write config failed */
-        
-        return 1;                                                  /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_HIGH_PASS_FILTER_CUT_OFF, &value);        /* get field */
+    *cut = (wm8978_high_pass_filter_cut_off_t)(value);                                      /* get cut */
     
-    return 0;                                                      /* success return 0 */
+    return res;                                                                             /* return the result */
 }
 
 /**
- * @brief     set eq2 gain
+ * @brief     set adc oversample rate
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] gain eq2 gain
+ * @param[in] rate adc oversample rate
  * @return    status code
  *            - 0 success
- *            - 1 set eq2 gain failed
+ *            - 1 set adc oversample rate failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 gain > 0x1F
  * @note      none
  */
-uint8_t wm8978_set_eq2_gain(wm8978_handle_t *handle, uint8_t gain)
+uint8_t wm8978_set_adc_oversample_rate(wm8978_handle_t *handle, wm8978_adc_oversample_rate_t rate)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_ADC_OVERSAMPLE_RATE, rate);        /* set field */
+}
+
+/**
+ * @brief      get adc oversample rate
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *rate pointer to an adc oversample rate buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get adc oversample rate failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_adc_oversample_rate(wm8978_handle_t *handle, wm8978_adc_oversample_rate_t *rate)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                            /* check handle */
-    {
-        return 2;                                                  /* return error */
-    }
-    if (handle->inited != 1)                                       /* check handle initialization */
-    {
-        return 3;                                                  /* return error */
-    }
-    if (gain > 0x1F)                                               /* check gain */
-    {
-        handle->debug_print("wm8978: gain > 0x1F.\n");             /* gain > 0x1F */
-        
-        return 4;                                                  /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_EQ2, &conf);        /* read config */
-    if (res != 0)                                                  /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");      /* read config failed */
-        
-        return 1;                                                  /* return error */
-    }
-    conf &= ~(0x1F << 0);                                          /* clear config */
-    conf |= gain << 0;                                             /* set gain */
-    res = a_wm8978_iic_write(handle, WM8978_REG_EQ2, conf);        /* write config */
-    if (res != 0)                                                  /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");     /* write config failed */
-        
-        return 1;                                                  /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_ADC_OVERSAMPLE_RATE, &value);        /* get field */
+    *rate = (wm8978_adc_oversample_rate_t)(value);                                     /* get rate */
     
-    return 0;                                                      /* success return 0 */
+    return res;                                                                        /* return the result */
 }
 
 /**
- * @brief     set eq3 bandwidth
+ * @brief     set adc right channel polarity
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] width set bandwidth
+ * @param[in] polarity adc polarity
  * @return    status code
  *            - 0 success
- *            - 1 set eq3 bandwidth failed
+ *            - 1 set adc right channel polarity failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_eq3_bandwidth(wm8978_handle_t *handle, wm8978_eq_bandwidth_t width)
+uint8_t wm8978_set_adc_right_channel_polarity(wm8978_handle_t *handle, wm8978_polarity_t polarity)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_ADC_RIGHT_CHANNEL_POLARITY, polarity);        /* set field */
+}
+
+/**
+ * @brief      get adc right channel polarity
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *polarity pointer to an adc polarity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get adc right channel polarity failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_adc_right_channel_polarity(wm8978_handle_t *handle, wm8978_polarity_t *polarity)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                            /* check handle */
-    {
-        return 2;                                                  /* return error */
-    }
-    if (handle->inited != 1)                                       /* check handle initialization */
-    {
-        return 3;                                                  /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_EQ3, &conf);        /* read config */
-    if (res != 0)                                                  /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");      /* read config failed */
-        
-        return 1;                                                  /* return error */
-    }
-    conf &= ~(1 << 8);                                             /* clear config */
-    conf |= width << 8;                                            /* set width */
-    res = a_wm8978_iic_write(handle, WM8978_REG_EQ3, conf);        /* write config */
-    if (res != 0)                                                  /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");     /* write config failed */
-        
-        return 1;                                                  /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_ADC_RIGHT_CHANNEL_POLARITY, &value);        /* get field */
+    *polarity = (wm8978_polarity_t)(value);                                                   /* get polarity */
     
-    return 0;                                                      /* success return 0 */
+    return res;                                                                               /* return the result */
 }
 
 /**
- * @brief     set eq3 centre freq
+ * @brief     set adc left channel polarity
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] freq centre freq
+ * @param[in] polarity adc polarity
  * @return    status code
  *            - 0 success
- *            - 1 set eq3 centre freq failed
+ *            - 1 set adc left channel polarity failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_eq3_centre_freq(wm8978_handle_t *handle, wm8978_eq3_band_centre_freq_t freq)
+uint8_t wm8978_set_adc_left_channel_polarity(wm8978_handle_t *handle, wm8978_polarity_t polarity)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_ADC_LEFT_CHANNEL_POLARITY, polarity);        /* set field */
+}
+
+/**
+ * @brief      get adc left channel polarity
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *polarity pointer to an adc polarity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get adc left channel polarity failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_adc_left_channel_polarity(wm8978_handle_t *handle, wm8978_polarity_t *polarity)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                            /* check handle */
-    {
-        return 2;                                                  /* return error */
-    }
-    if (handle->inited != 1)                                       /* check handle initialization */
-    {
-        return 3;                                                  /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_EQ3, &conf);        /* read config */
-    if (res != 0)                                                  /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");      /* read config failed */
-        
-        return 1;                                                  /* return error */
-    }
-    conf &= ~(3 << 5);                                             /* clear config */
-    conf |= freq << 5;                                             /* set freq */
-    res = a_wm8978_iic_write(handle, WM8978_REG_EQ3, conf);        /* write config */
-    if (res != 0)                                                  /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");     /* write config failed */
-        
-        return 1;                                                  /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_ADC_LEFT_CHANNEL_POLARITY, &value);        /* get field */
+    *polarity = (wm8978_polarity_t)(value);                                                  /* get polarity */
     
-    return 0;                                                      /* success return 0 */
+    return res;                                                                              /* return the result */
 }
 
 /**
- * @brief     set eq3 gain
+ * @brief     set adc left volume
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] gain eq3 gain
+ * @param[in] enable bool value, update once flag
+ * @param[in] volume set volume
  * @return    status code
  *            - 0 success
- *            - 1 set eq3 gain failed
+ *            - 1 set adc left volume failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 gain > 0x1F
  * @note      none
  */
-uint8_t wm8978_set_eq3_gain(wm8978_handle_t *handle, uint8_t gain)
+uint8_t wm8978_set_adc_left_volume(wm8978_handle_t *handle, wm8978_bool_t enable, uint8_t volume)
 {
-    uint8_t res;
-    uint16_t conf;
+    wm8978_field_value_t list[2];
     
-    if (handle == NULL)                                            /* check handle */
-    {
-        return 2;                                                  /* return error */
-    }
-    if (handle->inited != 1)                                       /* check handle initialization */
-    {
-        return 3;                                                  /* return error */
-    }
-    if (gain > 0x1F)                                               /* check gain */
-    {
-        handle->debug_print("wm8978: gain > 0x1F.\n");             /* gain > 0x1F */
-        
-        return 4;                                                  /* return error */
-    }
+    list[0].field = WM8978_FIELD_ADC_LEFT_VOLUME_UPDATE;        /* set field */
+    list[0].value = enable;                                     /* set value */
+    list[1].field = WM8978_FIELD_ADC_LEFT_VOLUME;               /* set field */
+    list[1].value = volume;                                     /* set value */
+    
+    return a_wm8978_field_write(handle, list, 2);               /* write fields */
+}
+
+/**
+ * @brief      get adc left volume
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to an update once flag buffer
+ * @param[out] *volume pointer to a volume buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get adc left volume failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_adc_left_volume(wm8978_handle_t *handle, wm8978_bool_t *enable, uint8_t *volume)
+{
+    uint8_t res;
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_EQ3, &conf);        /* read config */
-    if (res != 0)                                                  /* check error */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_ADC_LEFT_VOLUME_UPDATE, &value);        /* get field */
+    if (res != 0)                                                                         /* check result */
     {
-        handle->debug_print("wm8978: read config failed.\n");      /* read config failed */
-        
-        return 1;                                                  /* return error */
+        return res;                                                                       /* return error */
     }
-    conf &= ~(0x1F << 0);                                          /* clear config */
-    conf |= gain << 0;                                             /* set gain */
-    res = a_wm8978_iic_write(handle, WM8978_REG_EQ3, conf);        /* write config */
-    if (res != 0)                                                  /* check error */
+    *enable = (wm8978_bool_t)(value);                                                     /* get bool */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_ADC_LEFT_VOLUME, &value);               /* get field */
+    if (res != 0)                                                                         /* check result */
     {
-        handle->debug_print("wm8978: write config failed.\n");     /* write config failed */
-        
-        return 1;                                                  /* return error */
+        return res;                                                                       /* return error */
     }
+    *volume = (uint8_t)(value);                                                           /* get volume */
     
-    return 0;                                                      /* success return 0 */
+    return 0;                                                                             /* success return 0 */
 }
 
 /**
- * @brief     set eq4 bandwidth
+ * @brief     set adc right volume
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] width set bandwidth
+ * @param[in] enable bool value, update once flag
+ * @param[in] volume set volume
  * @return    status code
  *            - 0 success
- *            - 1 set eq4 bandwidth failed
+ *            - 1 set adc right volume failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_eq4_bandwidth(wm8978_handle_t *handle, wm8978_eq_bandwidth_t width)
+uint8_t wm8978_set_adc_right_volume(wm8978_handle_t *handle, wm8978_bool_t enable, uint8_t volume)
 {
-    uint8_t res;
-    uint16_t conf;
+    wm8978_field_value_t list[2];
     
-    if (handle == NULL)                                            /* check handle */
-    {
-        return 2;                                                  /* return error */
-    }
-    if (handle->inited != 1)                                       /* check handle initialization */
-    {
-        return 3;                                                  /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_EQ4, &conf);        /* read config */
-    if (res != 0)                                                  /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");      /* read config failed */
-        
-        return 1;                                                  /* return error */
-    }
-    conf &= ~(1 << 8);                                             /* clear config */
-    conf |= width << 8;                                            /* set width */
-    res = a_wm8978_iic_write(handle, WM8978_REG_EQ4, conf);        /* write config */
-    if (res != 0)                                                  /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");     /* write config failed */
-        
-        return 1;                                                  /* return error */
-    }
+    list[0].field = WM8978_FIELD_ADC_RIGHT_VOLUME_UPDATE;        /* set field */
+    list[0].value = enable;                                      /* set value */
+    list[1].field = WM8978_FIELD_ADC_RIGHT_VOLUME;               /* set field */
+    list[1].value = volume;                                      /* set value */
     
-    return 0;                                                      /* success return 0 */
+    return a_wm8978_field_write(handle, list, 2);                /* write fields */
 }
 
 /**
- * @brief     set eq4 centre freq
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] freq centre freq
- * @return    status code
- *            - 0 success
- *            - 1 set eq4 centre freq failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      get adc right volume
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to an update once flag buffer
+ * @param[out] *volume pointer to a volume buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get adc right volume failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
  */
-uint8_t wm8978_set_eq4_centre_freq(wm8978_handle_t *handle, wm8978_eq4_band_centre_freq_t freq)
+uint8_t wm8978_get_adc_right_volume(wm8978_handle_t *handle, wm8978_bool_t *enable, uint8_t *volume)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                            /* check handle */
-    {
-        return 2;                                                  /* return error */
-    }
-    if (handle->inited != 1)                                       /* check handle initialization */
-    {
-        return 3;                                                  /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_EQ4, &conf);        /* read config */
-    if (res != 0)                                                  /* check error */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_ADC_RIGHT_VOLUME_UPDATE, &value);        /* get field */
+    if (res != 0)                                                                          /* check result */
     {
-        handle->debug_print("wm8978: read config failed.\n");      /* read config failed */
-        
-        return 1;                                                  /* return error */
+        return res;                                                                        /* return error */
     }
-    conf &= ~(3 << 5);                                             /* clear config */
-    conf |= freq << 5;                                             /* set freq */
-    res = a_wm8978_iic_write(handle, WM8978_REG_EQ4, conf);        /* write config */
-    if (res != 0)                                                  /* check error */
+    *enable = (wm8978_bool_t)(value);                                                      /* get bool */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_ADC_RIGHT_VOLUME, &value);               /* get field */
+    if (res != 0)                                                                          /* check result */
     {
-        handle->debug_print("wm8978: write config failed.\n");     /* write config failed */
-        
-        return 1;                                                  /* return error */
+        return res;                                                                        /* return error */
     }
+    *volume = (uint8_t)(value);                                                            /* get volume */
     
-    return 0;                                                      /* success return 0 */
+    return 0;                                                                              /* success return 0 */
 }
 
 /**
- * @brief     set eq4 gain
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] gain eq4 gain
- * @return    status code
- *            - 0 success
- *            - 1 set eq4 gain failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- *            - 4 gain > 0x1F
- * @note      none
+ * @brief      convert the volume data to the register raw data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  db volume db
+ * @param[out] *reg pointer to a volume raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
  */
-uint8_t wm8978_set_eq4_gain(wm8978_handle_t *handle, uint8_t gain)
+uint8_t wm8978_volume_convert_to_register(wm8978_handle_t *handle, float db, uint8_t *reg)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                            /* check handle */
-    {
-        return 2;                                                  /* return error */
-    }
-    if (handle->inited != 1)                                       /* check handle initialization */
+    if (handle == NULL)                                      /* check handle */
     {
-        return 3;                                                  /* return error */
+        return 2;                                            /* return error */
     }
-    if (gain > 0x1F)                                               /* check gain */
+    if (handle->inited != 1)                                 /* check handle initialization */
     {
-        handle->debug_print("wm8978: gain > 0x1F.\n");             /* gain > 0x1F */
-        
-        return 4;                                                  /* return error */
+        return 3;                                            /* return error */
     }
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_EQ4, &conf);        /* read config */
-    if (res != 0)                                                  /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");      /* read config failed */
-        
-        return 1;                                                  /* return error */
-    }
-    conf &= ~(0x1F << 0);                                          /* clear config */
-    conf |= gain << 0;                                             /* set gain */
-    res = a_wm8978_iic_write(handle, WM8978_REG_EQ4, conf);        /* write config */
-    if (res != 0)                                                  /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");     /* write config failed */
-        
-        return 1;                                                  /* return error */
-    }
+    *reg = (uint8_t)((db + 127.0f) * 2.0f + 0.5f) + 1;        /* convert with rounding */
     
-    return 0;                                                      /* success return 0 */
+    return 0;                                                /* success return 0 */
 }
 
 /**
- * @brief     set eq5 cut off
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] cut_off cut off freq
- * @return    status code
- *            - 0 success
- *            - 1 set eq5 cut off failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      convert the volume register raw data to the real data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  reg volume raw data
+ * @param[out] *db pointer to a volume real data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
  */
-uint8_t wm8978_set_eq5_cut_off(wm8978_handle_t *handle, wm8978_eq5_band_cut_off_t cut_off)
+uint8_t wm8978_volume_convert_to_data(wm8978_handle_t *handle, uint8_t reg, float *db)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                            /* check handle */
+    if (handle == NULL)                            /* check handle */
     {
-        return 2;                                                  /* return error */
+        return 2;                                  /* return error */
     }
-    if (handle->inited != 1)                                       /* check handle initialization */
+    if (handle->inited != 1)                       /* check handle initialization */
     {
-        return 3;                                                  /* return error */
+        return 3;                                  /* return error */
     }
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_EQ5, &conf);        /* read config */
-    if (res != 0)                                                  /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");      /* read config failed */
-        
-        return 1;                                                  /* return error */
-    }
-    conf &= ~(3 << 5);                                             /* clear config */
-    conf |= cut_off << 5;                                          /* set cut off */
-    res = a_wm8978_iic_write(handle, WM8978_REG_EQ5, conf);        /* write config */
-    if (res != 0)                                                  /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");     /* write config failed */
-        
-        return 1;                                                  /* return error */
-    }
+    *db = -127.0f + (float)(reg - 1) * 0.5f;       /* convert */
     
-    return 0;                                                      /* success return 0 */
+    return 0;                                      /* success return 0 */
 }
 
 /**
- * @brief     set eq5 gain
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] gain eq5 gain
- * @return    status code
- *            - 0 success
- *            - 1 set eq5 gain failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- *            - 4 gain > 0x1F
- * @note      none
+ * @brief      convert the volume in centi-db to the register raw data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  cdb volume in 0.01db
+ * @param[out] *reg pointer to a volume raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 cdb is over range
+ * @note       the step is 50 cdb, the result is rounded to the nearest step
  */
-uint8_t wm8978_set_eq5_gain(wm8978_handle_t *handle, uint8_t gain)
+uint8_t wm8978_volume_cdb_convert_to_register(wm8978_handle_t *handle, int16_t cdb, uint8_t *reg)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                            /* check handle */
+    if (handle == NULL)                                             /* check handle */
     {
-        return 2;                                                  /* return error */
+        return 2;                                                   /* return error */
     }
-    if (handle->inited != 1)                                       /* check handle initialization */
+    if (handle->inited != 1)                                        /* check handle initialization */
     {
-        return 3;                                                  /* return error */
+        return 3;                                                   /* return error */
     }
-    if (gain > 0x1F)                                               /* check gain */
+    if ((cdb < -12700) || (cdb > 0))                                /* check range */
     {
-        handle->debug_print("wm8978: gain > 0x1F.\n");             /* gain > 0x1F */
+        handle->debug_print("wm8978: cdb is over range.\n");        /* cdb is over range */
         
-        return 4;                                                  /* return error */
+        return 4;                                                   /* return error */
     }
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_EQ5, &conf);        /* read config */
-    if (res != 0)                                                  /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");      /* read config failed */
-        
-        return 1;                                                  /* return error */
-    }
-    conf &= ~(0x1F << 0);                                          /* clear config */
-    conf |= gain << 0;                                             /* set gain */
-    res = a_wm8978_iic_write(handle, WM8978_REG_EQ5, conf);        /* write config */
-    if (res != 0)                                                  /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");     /* write config failed */
-        
-        return 1;                                                  /* return error */
-    }
+    *reg = (uint8_t)((cdb + 12700 + 25) / 50 + 1);                  /* convert with rounding */
     
-    return 0;                                                      /* success return 0 */
+    return 0;                                                       /* success return 0 */
 }
 
 /**
- * @brief      convert the eq gain to the register raw data
+ * @brief      convert the volume register raw data to centi-db
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  db eq gain in db
- * @param[out] *reg pointer to an eq gain raw data buffer
+ * @param[in]  reg volume raw data
+ * @param[out] *cdb pointer to a volume buffer in 0.01db
  * @return     status code
  *             - 0 success
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_eq_gain_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
+uint8_t wm8978_volume_cdb_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int16_t *cdb)
 {
-    if (handle == NULL)                /* check handle */
+    if (handle == NULL)                                       /* check handle */
     {
-        return 2;                      /* return error */
+        return 2;                                             /* return error */
     }
-    if (handle->inited != 1)           /* check handle initialization */
+    if (handle->inited != 1)                                  /* check handle initialization */
     {
-        return 3;                      /* return error */
+        return 3;                                             /* return error */
     }
     
-    *reg = (uint8_t)(-db + 12);        /* convert */
+    *cdb = (int16_t)(((int16_t)reg - 1) * 50 - 12700);        /* convert */
     
-    return 0;                          /* success return 0 */
+    return 0;                                                 /* success return 0 */
 }
 
 /**
- * @brief      convert the eq gain register raw data to the real data
+ * @brief     set equaliser apply
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] equaliser set equaliser
+ * @return    status code
+ *            - 0 success
+ *            - 1 set equaliser apply failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_equaliser_apply(wm8978_handle_t *handle, wm8978_equaliser_t equaliser)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_EQUALISER_APPLY, equaliser);        /* set field */
+}
+
+/**
+ * @brief      get equaliser apply
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  reg volume raw data
- * @param[out] *db pointer to an eq gain real data buffer
+ * @param[out] *equaliser pointer to an equaliser buffer
  * @return     status code
  *             - 0 success
+ *             - 1 get equaliser apply failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_eq_gain_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
+uint8_t wm8978_get_equaliser_apply(wm8978_handle_t *handle, wm8978_equaliser_t *equaliser)
 {
-    if (handle == NULL)             /* check handle */
-    {
-        return 2;                   /* return error */
-    }
-    if (handle->inited != 1)        /* check handle initialization */
-    {
-        return 3;                   /* return error */
-    }
+    uint8_t res;
+    uint16_t value;
     
-    *db = (int8_t)(12 - reg);       /* convert */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_EQUALISER_APPLY, &value);        /* get field */
+    *equaliser = (wm8978_equaliser_t)(value);                                      /* get equaliser */
     
-    return 0;                       /* success return 0 */
+    return res;                                                                    /* return the result */
 }
 
 /**
- * @brief     enable or disable dac digital limiter
+ * @brief     set eq1 cut off
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
+ * @param[in] cut_off cut off freq
  * @return    status code
  *            - 0 success
- *            - 1 set dac digital limiter failed
+ *            - 1 set eq1 cut off failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_dac_digital_limiter(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_eq1_cut_off(wm8978_handle_t *handle, wm8978_eq1_band_cut_off_t cut_off)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_EQ1_CUT_OFF, cut_off);        /* set field */
+}
+
+/**
+ * @brief      get eq1 cut off
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *cut_off pointer to a cut off freq buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get eq1 cut off failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_eq1_cut_off(wm8978_handle_t *handle, wm8978_eq1_band_cut_off_t *cut_off)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                      /* check handle */
-    {
-        return 2;                                                            /* return error */
-    }
-    if (handle->inited != 1)                                                 /* check handle initialization */
-    {
-        return 3;                                                            /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_DAC_LIMITER_1, &conf);        /* read config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
-    }
-    conf &= ~(1 << 8);                                                       /* clear config */
-    conf |= enable << 8;                                                     /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_DAC_LIMITER_1, conf);        /* write config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_EQ1_CUT_OFF, &value);        /* get field */
+    *cut_off = (wm8978_eq1_band_cut_off_t)(value);                             /* get cut off */
     
-    return 0;                                                                /* success return 0 */
+    return res;                                                                /* return the result */
 }
 
 /**
- * @brief     set dac limiter decay
+ * @brief     set eq1 gain
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] decay dac limiter decay
+ * @param[in] gain eq1 gain
  * @return    status code
  *            - 0 success
- *            - 1 set dac limiter decay failed
+ *            - 1 set eq1 gain failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
+ *            - 4 gain > 0x1F
  * @note      none
  */
-uint8_t wm8978_set_dac_limiter_decay(wm8978_handle_t *handle, wm8978_dac_limiter_decay_t decay)
+uint8_t wm8978_set_eq1_gain(wm8978_handle_t *handle, uint8_t gain)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                      /* check handle */
-    {
-        return 2;                                                            /* return error */
-    }
-    if (handle->inited != 1)                                                 /* check handle initialization */
-    {
-        return 3;                                                            /* return error */
-    }
+    return a_wm8978_field_set(handle, WM8978_FIELD_EQ1_GAIN, gain);        /* set field */
+}
+
+/**
+ * @brief      get eq1 gain
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *gain pointer to an eq1 gain buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get eq1 gain failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_eq1_gain(wm8978_handle_t *handle, uint8_t *gain)
+{
+    uint8_t res;
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_DAC_LIMITER_1, &conf);        /* read config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
-    }
-    conf &= ~(0xF << 4);                                                     /* clear config */
-    conf |= decay << 4;                                                      /* set decay */
-    res = a_wm8978_iic_write(handle, WM8978_REG_DAC_LIMITER_1, conf);        /* write config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_EQ1_GAIN, &value);        /* get field */
+    *gain = (uint8_t)(value);                                               /* get gain */
     
-    return 0;                                                                /* success return 0 */
+    return res;                                                             /* return the result */
 }
 
 /**
- * @brief     set dac limiter attack
+ * @brief     set eq2 bandwidth
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] attack dac limiter attack
+ * @param[in] width set bandwidth
  * @return    status code
  *            - 0 success
- *            - 1 set dac limiter attack failed
+ *            - 1 set eq2 bandwidth failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_dac_limiter_attack(wm8978_handle_t *handle, wm8978_dac_limiter_attack_t attack)
+uint8_t wm8978_set_eq2_bandwidth(wm8978_handle_t *handle, wm8978_eq_bandwidth_t width)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_EQ2_BANDWIDTH, width);        /* set field */
+}
+
+/**
+ * @brief      get eq2 bandwidth
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *width pointer to a bandwidth buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get eq2 bandwidth failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_eq2_bandwidth(wm8978_handle_t *handle, wm8978_eq_bandwidth_t *width)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                      /* check handle */
-    {
-        return 2;                                                            /* return error */
-    }
-    if (handle->inited != 1)                                                 /* check handle initialization */
-    {
-        return 3;                                                            /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_DAC_LIMITER_1, &conf);        /* read config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
-    }
-    conf &= ~(0xF << 0);                                                     /* clear config */
-    conf |= attack << 0;                                                     /* set attack */
-    res = a_wm8978_iic_write(handle, WM8978_REG_DAC_LIMITER_1, conf);        /* write config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_EQ2_BANDWIDTH, &value);        /* get field */
+    *width = (wm8978_eq_bandwidth_t)(value);                                     /* get width */
     
-    return 0;                                                                /* success return 0 */
+    return res;                                                                  /* return the result */
 }
 
 /**
- * @brief     set dac limiter level
+ * @brief     set eq2 centre freq
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] level dac limiter level
+ * @param[in] freq centre freq
  * @return    status code
  *            - 0 success
- *            - 1 set dac limiter level failed
+ *            - 1 set eq2 centre freq failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_dac_limiter_level(wm8978_handle_t *handle, wm8978_dac_limiter_level_t level)
+uint8_t wm8978_set_eq2_centre_freq(wm8978_handle_t *handle, wm8978_eq2_band_centre_freq_t freq)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_EQ2_CENTRE_FREQ, freq);        /* set field */
+}
+
+/**
+ * @brief      get eq2 centre freq
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *freq pointer to a centre freq buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get eq2 centre freq failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_eq2_centre_freq(wm8978_handle_t *handle, wm8978_eq2_band_centre_freq_t *freq)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                      /* check handle */
-    {
-        return 2;                                                            /* return error */
-    }
-    if (handle->inited != 1)                                                 /* check handle initialization */
-    {
-        return 3;                                                            /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_DAC_LIMITER_2, &conf);        /* read config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
-    }
-    conf &= ~(7 << 4);                                                       /* clear config */
-    conf |= level << 4;                                                      /* set level */
-    res = a_wm8978_iic_write(handle, WM8978_REG_DAC_LIMITER_2, conf);        /* write config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_EQ2_CENTRE_FREQ, &value);        /* get field */
+    *freq = (wm8978_eq2_band_centre_freq_t)(value);                                /* get freq */
     
-    return 0;                                                                /* success return 0 */
+    return res;                                                                    /* return the result */
 }
 
 /**
- * @brief     set dac limiter volume boost
+ * @brief     set eq2 gain
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] db set db
+ * @param[in] gain eq2 gain
  * @return    status code
  *            - 0 success
- *            - 1 set dac limiter volume boost failed
+ *            - 1 set eq2 gain failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 db > 12
+ *            - 4 gain > 0x1F
  * @note      none
  */
-uint8_t wm8978_set_dac_limiter_volume_boost(wm8978_handle_t *handle, uint8_t db)
+uint8_t wm8978_set_eq2_gain(wm8978_handle_t *handle, uint8_t gain)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_EQ2_GAIN, gain);        /* set field */
+}
+
+/**
+ * @brief      get eq2 gain
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *gain pointer to an eq2 gain buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get eq2 gain failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_eq2_gain(wm8978_handle_t *handle, uint8_t *gain)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                      /* check handle */
-    {
-        return 2;                                                            /* return error */
-    }
-    if (handle->inited != 1)                                                 /* check handle initialization */
-    {
-        return 3;                                                            /* return error */
-    }
-    if (db > 12)                                                             /* check db */
-    {
-        handle->debug_print("wm8978: boost > 12.\n");                        /* boost > 12 */
-        
-        return 4;                                                            /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_DAC_LIMITER_2, &conf);        /* read config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
-    }
-    conf &= ~(0xF << 0);                                                     /* clear config */
-    conf |= db << 0;                                                         /* set db */
-    res = a_wm8978_iic_write(handle, WM8978_REG_DAC_LIMITER_2, conf);        /* write config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_EQ2_GAIN, &value);        /* get field */
+    *gain = (uint8_t)(value);                                               /* get gain */
     
-    return 0;                                                                /* success return 0 */
+    return res;                                                             /* return the result */
 }
 
 /**
- * @brief     enable or disable notch filter
+ * @brief     set eq3 bandwidth
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
+ * @param[in] width set bandwidth
  * @return    status code
  *            - 0 success
- *            - 1 set notch filter failed
+ *            - 1 set eq3 bandwidth failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_notch_filter(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_eq3_bandwidth(wm8978_handle_t *handle, wm8978_eq_bandwidth_t width)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_EQ3_BANDWIDTH, width);        /* set field */
+}
+
+/**
+ * @brief      get eq3 bandwidth
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *width pointer to a bandwidth buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get eq3 bandwidth failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_eq3_bandwidth(wm8978_handle_t *handle, wm8978_eq_bandwidth_t *width)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                      /* check handle */
-    {
-        return 2;                                                            /* return error */
-    }
-    if (handle->inited != 1)                                                 /* check handle initialization */
-    {
-        return 3;                                                            /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_NOTCH_FILTER_1, &conf);       /* read config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
-    }
-    conf &= ~(1 << 7);                                                       /* clear config */
-    conf |= enable << 7;                                                     /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_NOTCH_FILTER_1, conf);       /* write config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_EQ3_BANDWIDTH, &value);        /* get field */
+    *width = (wm8978_eq_bandwidth_t)(value);                                     /* get width */
     
-    return 0;                                                                /* success return 0 */
+    return res;                                                                  /* return the result */
 }
 
 /**
- * @brief     set notch filter a0 coefficient bit13 - bit7
+ * @brief     set eq3 centre freq
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] update_once bool value
- * @param[in] coefficient set coefficient
+ * @param[in] freq centre freq
  * @return    status code
  *            - 0 success
- *            - 1 set notch filter a0 coefficient failed
+ *            - 1 set eq3 centre freq failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 coefficient > 0x7F
  * @note      none
  */
-uint8_t wm8978_set_notch_filter_a0_coefficient_bit_13_7(wm8978_handle_t *handle, wm8978_bool_t update_once, uint8_t coefficient)
+uint8_t wm8978_set_eq3_centre_freq(wm8978_handle_t *handle, wm8978_eq3_band_centre_freq_t freq)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_EQ3_CENTRE_FREQ, freq);        /* set field */
+}
+
+/**
+ * @brief      get eq3 centre freq
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *freq pointer to a centre freq buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get eq3 centre freq failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_eq3_centre_freq(wm8978_handle_t *handle, wm8978_eq3_band_centre_freq_t *freq)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                      /* check handle */
-    {
-        return 2;                                                            /* return error */
-    }
-    if (handle->inited != 1)                                                 /* check handle initialization */
-    {
-        return 3;                                                            /* return error */
-    }
-    if (coefficient > 0x7F)                                                  /* check coefficient */
-    {
-        handle->debug_print("wm8978: coefficient > 0x7F.\n");                /* coefficient > 0x7F*/
-        
-        return 4;                                                            /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_NOTCH_FILTER_1, &conf);       /* read config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
-    }
-    conf &= ~(1 << 8);                                                       /* clear config */
-    conf |= update_once << 8;                                                /* set bool */
-    conf &= ~(0x7F << 0);                                                    /* clear config */
-    conf |= coefficient << 0;                                                /* set coefficient */
-    res = a_wm8978_iic_write(handle, WM8978_REG_NOTCH_FILTER_1, conf);       /* write config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_EQ3_CENTRE_FREQ, &value);        /* get field */
+    *freq = (wm8978_eq3_band_centre_freq_t)(value);                                /* get freq */
     
-    return 0;                                                                /* success return 0 */
+    return res;                                                                    /* return the result */
 }
 
 /**
- * @brief     set notch filter a0 coefficient bit6 - bit0
+ * @brief     set eq3 gain
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] update_once bool value
- * @param[in] coefficient set coefficient
+ * @param[in] gain eq3 gain
  * @return    status code
  *            - 0 success
- *            - 1 set notch filter a0 coefficient failed
+ *            - 1 set eq3 gain failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 coefficient > 0x7F
+ *            - 4 gain > 0x1F
  * @note      none
  */
-uint8_t wm8978_set_notch_filter_a0_coefficient_bit_6_0(wm8978_handle_t *handle, wm8978_bool_t update_once, uint8_t coefficient)
+uint8_t wm8978_set_eq3_gain(wm8978_handle_t *handle, uint8_t gain)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_EQ3_GAIN, gain);        /* set field */
+}
+
+/**
+ * @brief      get eq3 gain
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *gain pointer to an eq3 gain buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get eq3 gain failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_eq3_gain(wm8978_handle_t *handle, uint8_t *gain)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_EQ3_GAIN, &value);        /* get field */
+    *gain = (uint8_t)(value);                                               /* get gain */
+    
+    return res;                                                             /* return the result */
+}
+
+/**
+ * @brief     set eq4 bandwidth
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] width set bandwidth
+ * @return    status code
+ *            - 0 success
+ *            - 1 set eq4 bandwidth failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_eq4_bandwidth(wm8978_handle_t *handle, wm8978_eq_bandwidth_t width)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_EQ4_BANDWIDTH, width);        /* set field */
+}
+
+/**
+ * @brief      get eq4 bandwidth
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *width pointer to a bandwidth buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get eq4 bandwidth failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_eq4_bandwidth(wm8978_handle_t *handle, wm8978_eq_bandwidth_t *width)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_EQ4_BANDWIDTH, &value);        /* get field */
+    *width = (wm8978_eq_bandwidth_t)(value);                                     /* get width */
+    
+    return res;                                                                  /* return the result */
+}
+
+/**
+ * @brief     set eq4 centre freq
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] freq centre freq
+ * @return    status code
+ *            - 0 success
+ *            - 1 set eq4 centre freq failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_eq4_centre_freq(wm8978_handle_t *handle, wm8978_eq4_band_centre_freq_t freq)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_EQ4_CENTRE_FREQ, freq);        /* set field */
+}
+
+/**
+ * @brief      get eq4 centre freq
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *freq pointer to a centre freq buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get eq4 centre freq failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_eq4_centre_freq(wm8978_handle_t *handle, wm8978_eq4_band_centre_freq_t *freq)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_EQ4_CENTRE_FREQ, &value);        /* get field */
+    *freq = (wm8978_eq4_band_centre_freq_t)(value);                                /* get freq */
+    
+    return res;                                                                    /* return the result */
+}
+
+/**
+ * @brief     set eq4 gain
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] gain eq4 gain
+ * @return    status code
+ *            - 0 success
+ *            - 1 set eq4 gain failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 gain > 0x1F
+ * @note      none
+ */
+uint8_t wm8978_set_eq4_gain(wm8978_handle_t *handle, uint8_t gain)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_EQ4_GAIN, gain);        /* set field */
+}
+
+/**
+ * @brief      get eq4 gain
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *gain pointer to an eq4 gain buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get eq4 gain failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_eq4_gain(wm8978_handle_t *handle, uint8_t *gain)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_EQ4_GAIN, &value);        /* get field */
+    *gain = (uint8_t)(value);                                               /* get gain */
+    
+    return res;                                                             /* return the result */
+}
+
+/**
+ * @brief     set eq5 cut off
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] cut_off cut off freq
+ * @return    status code
+ *            - 0 success
+ *            - 1 set eq5 cut off failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_eq5_cut_off(wm8978_handle_t *handle, wm8978_eq5_band_cut_off_t cut_off)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_EQ5_CUT_OFF, cut_off);        /* set field */
+}
+
+/**
+ * @brief      get eq5 cut off
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *cut_off pointer to a cut off freq buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get eq5 cut off failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_eq5_cut_off(wm8978_handle_t *handle, wm8978_eq5_band_cut_off_t *cut_off)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_EQ5_CUT_OFF, &value);        /* get field */
+    *cut_off = (wm8978_eq5_band_cut_off_t)(value);                             /* get cut off */
+    
+    return res;                                                                /* return the result */
+}
+
+/**
+ * @brief     set eq5 gain
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] gain eq5 gain
+ * @return    status code
+ *            - 0 success
+ *            - 1 set eq5 gain failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 gain > 0x1F
+ * @note      none
+ */
+uint8_t wm8978_set_eq5_gain(wm8978_handle_t *handle, uint8_t gain)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_EQ5_GAIN, gain);        /* set field */
+}
+
+/**
+ * @brief      get eq5 gain
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *gain pointer to an eq5 gain buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get eq5 gain failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_eq5_gain(wm8978_handle_t *handle, uint8_t *gain)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_EQ5_GAIN, &value);        /* get field */
+    *gain = (uint8_t)(value);                                               /* get gain */
+    
+    return res;                                                             /* return the result */
+}
+
+/**
+ * @brief      convert the eq gain to the register raw data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  db eq gain in db
+ * @param[out] *reg pointer to an eq gain raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_eq_gain_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
+{
+    if (handle == NULL)                /* check handle */
+    {
+        return 2;                      /* return error */
+    }
+    if (handle->inited != 1)           /* check handle initialization */
+    {
+        return 3;                      /* return error */
+    }
+    
+    *reg = (uint8_t)(-db + 12);        /* convert */
+    
+    return 0;                          /* success return 0 */
+}
+
+/**
+ * @brief      convert the eq gain register raw data to the real data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  reg volume raw data
+ * @param[out] *db pointer to an eq gain real data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_eq_gain_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
+{
+    if (handle == NULL)             /* check handle */
+    {
+        return 2;                   /* return error */
+    }
+    if (handle->inited != 1)        /* check handle initialization */
+    {
+        return 3;                   /* return error */
+    }
+    
+    *db = (int8_t)(12 - reg);       /* convert */
+    
+    return 0;                       /* success return 0 */
+}
+
+/**
+ * @brief     enable or disable dac digital limiter
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set dac digital limiter failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_dac_digital_limiter(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_DAC_DIGITAL_LIMITER, enable);        /* set field */
+}
+
+/**
+ * @brief      get dac digital limiter status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get dac digital limiter failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_dac_digital_limiter(wm8978_handle_t *handle, wm8978_bool_t *enable)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_DAC_DIGITAL_LIMITER, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                  /* get bool */
+    
+    return res;                                                                        /* return the result */
+}
+
+/**
+ * @brief     set dac limiter decay
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] decay dac limiter decay
+ * @return    status code
+ *            - 0 success
+ *            - 1 set dac limiter decay failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_dac_limiter_decay(wm8978_handle_t *handle, wm8978_dac_limiter_decay_t decay)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_DAC_LIMITER_DECAY, decay);        /* set field */
+}
+
+/**
+ * @brief      get dac limiter decay
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *decay pointer to a dac limiter decay buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get dac limiter decay failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_dac_limiter_decay(wm8978_handle_t *handle, wm8978_dac_limiter_decay_t *decay)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_DAC_LIMITER_DECAY, &value);        /* get field */
+    *decay = (wm8978_dac_limiter_decay_t)(value);                                    /* get decay */
+    
+    return res;                                                                      /* return the result */
+}
+
+/**
+ * @brief     set dac limiter attack
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] attack dac limiter attack
+ * @return    status code
+ *            - 0 success
+ *            - 1 set dac limiter attack failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_dac_limiter_attack(wm8978_handle_t *handle, wm8978_dac_limiter_attack_t attack)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_DAC_LIMITER_ATTACK, attack);        /* set field */
+}
+
+/**
+ * @brief      get dac limiter attack
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *attack pointer to a dac limiter attack buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get dac limiter attack failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_dac_limiter_attack(wm8978_handle_t *handle, wm8978_dac_limiter_attack_t *attack)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_DAC_LIMITER_ATTACK, &value);        /* get field */
+    *attack = (wm8978_dac_limiter_attack_t)(value);                                   /* get attack */
+    
+    return res;                                                                       /* return the result */
+}
+
+/**
+ * @brief     set dac limiter level
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] level dac limiter level
+ * @return    status code
+ *            - 0 success
+ *            - 1 set dac limiter level failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_dac_limiter_level(wm8978_handle_t *handle, wm8978_dac_limiter_level_t level)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_DAC_LIMITER_LEVEL, level);        /* set field */
+}
+
+/**
+ * @brief      get dac limiter level
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *level pointer to a dac limiter level buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get dac limiter level failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_dac_limiter_level(wm8978_handle_t *handle, wm8978_dac_limiter_level_t *level)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_DAC_LIMITER_LEVEL, &value);        /* get field */
+    *level = (wm8978_dac_limiter_level_t)(value);                                    /* get level */
+    
+    return res;                                                                      /* return the result */
+}
+
+/**
+ * @brief     set dac limiter volume boost
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] db set db
+ * @return    status code
+ *            - 0 success
+ *            - 1 set dac limiter volume boost failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 db > 12
+ * @note      none
+ */
+uint8_t wm8978_set_dac_limiter_volume_boost(wm8978_handle_t *handle, uint8_t db)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_DAC_LIMITER_VOLUME_BOOST, db);        /* set field */
+}
+
+/**
+ * @brief      get dac limiter volume boost
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *db pointer to a db buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get dac limiter volume boost failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_dac_limiter_volume_boost(wm8978_handle_t *handle, uint8_t *db)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_DAC_LIMITER_VOLUME_BOOST, &value);        /* get field */
+    *db = (uint8_t)(value);                                                                 /* get db */
+    
+    return res;                                                                             /* return the result */
+}
+
+/**
+ * @brief     enable or disable notch filter
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set notch filter failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_notch_filter(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_NOTCH_FILTER, enable);        /* set field */
+}
+
+/**
+ * @brief      get notch filter status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get notch filter failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_notch_filter(wm8978_handle_t *handle, wm8978_bool_t *enable)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_NOTCH_FILTER, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                           /* get bool */
+    
+    return res;                                                                 /* return the result */
+}
+
+/**
+ * @brief     set notch filter a0 coefficient bit13 - bit7
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] update_once bool value
+ * @param[in] coefficient set coefficient
+ * @return    status code
+ *            - 0 success
+ *            - 1 set notch filter a0 coefficient failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 coefficient > 0x7F
+ * @note      none
+ */
+uint8_t wm8978_set_notch_filter_a0_coefficient_bit_13_7(wm8978_handle_t *handle, wm8978_bool_t update_once, uint8_t coefficient)
+{
+    wm8978_field_value_t list[2];
+    
+    list[0].field = WM8978_FIELD_NOTCH_FILTER_A0_COEFFICIENT_BIT_13_7_UPDATE;        /* set field */
+    list[0].value = update_once;                                                     /* set value */
+    list[1].field = WM8978_FIELD_NOTCH_FILTER_A0_COEFFICIENT_BIT_13_7;               /* set field */
+    list[1].value = coefficient;                                                     /* set value */
+    
+    return a_wm8978_field_write(handle, list, 2);                                    /* write fields */
+}
+
+/**
+ * @brief      get notch filter a0 coefficient bit13 - bit7
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *update_once pointer to a bool value buffer
+ * @param[out] *coefficient pointer to a coefficient buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get notch filter a0 coefficient bit13 - bit7 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_notch_filter_a0_coefficient_bit_13_7(wm8978_handle_t *handle, wm8978_bool_t *update_once, uint8_t *coefficient)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_NOTCH_FILTER_A0_COEFFICIENT_BIT_13_7_UPDATE, &value);        /* get field */
+    if (res != 0)                                                                                              /* check result */
+    {
+        return res;                                                                                            /* return error */
+    }
+    *update_once = (wm8978_bool_t)(value);                                                                     /* get bool */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_NOTCH_FILTER_A0_COEFFICIENT_BIT_13_7, &value);               /* get field */
+    if (res != 0)                                                                                              /* check result */
+    {
+        return res;                                                                                            /* return error */
+    }
+    *coefficient = (uint8_t)(value);                                                                           /* get coefficient */
+    
+    return 0;                                                                                                  /* success return 0 */
+}
+
+/**
+ * @brief     set notch filter a0 coefficient bit6 - bit0
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] update_once bool value
+ * @param[in] coefficient set coefficient
+ * @return    status code
+ *            - 0 success
+ *            - 1 set notch filter a0 coefficient failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 coefficient > 0x7F
+ * @note      none
+ */
+uint8_t wm8978_set_notch_filter_a0_coefficient_bit_6_0(wm8978_handle_t *handle, wm8978_bool_t update_once, uint8_t coefficient)
+{
+    wm8978_field_value_t list[2];
+    
+    list[0].field = WM8978_FIELD_NOTCH_FILTER_A0_COEFFICIENT_BIT_6_0_UPDATE;        /* set field */
+    list[0].value = update_once;                                                    /* set value */
+    list[1].field = WM8978_FIELD_NOTCH_FILTER_A0_COEFFICIENT_BIT_6_0;               /* set field */
+    list[1].value = coefficient;                                                    /* set value */
+    
+    return a_wm8978_field_write(handle, list, 2);                                   /* write fields */
+}
+
+/**
+ * @brief      get notch filter a0 coefficient bit6 - bit0
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *update_once pointer to a bool value buffer
+ * @param[out] *coefficient pointer to a coefficient buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get notch filter a0 coefficient bit6 - bit0 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_notch_filter_a0_coefficient_bit_6_0(wm8978_handle_t *handle, wm8978_bool_t *update_once, uint8_t *coefficient)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_NOTCH_FILTER_A0_COEFFICIENT_BIT_6_0_UPDATE, &value);        /* get field */
+    if (res != 0)                                                                                             /* check result */
+    {
+        return res;                                                                                           /* return error */
+    }
+    *update_once = (wm8978_bool_t)(value);                                                                    /* get bool */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_NOTCH_FILTER_A0_COEFFICIENT_BIT_6_0, &value);               /* get field */
+    if (res != 0)                                                                                             /* check result */
+    {
+        return res;                                                                                           /* return error */
+    }
+    *coefficient = (uint8_t)(value);                                                                          /* get coefficient */
+    
+    return 0;                                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     set notch filter a1 coefficient bit13 - bit7
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] update_once bool value
+ * @param[in] coefficient set coefficient
+ * @return    status code
+ *            - 0 success
+ *            - 1 set notch filter a1 coefficient failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 coefficient > 0x7F
+ * @note      none
+ */
+uint8_t wm8978_set_notch_filter_a1_coefficient_bit_13_7(wm8978_handle_t *handle, wm8978_bool_t update_once, uint8_t coefficient)
+{
+    wm8978_field_value_t list[2];
+    
+    list[0].field = WM8978_FIELD_NOTCH_FILTER_A1_COEFFICIENT_BIT_13_7_UPDATE;        /* set field */
+    list[0].value = update_once;                                                     /* set value */
+    list[1].field = WM8978_FIELD_NOTCH_FILTER_A1_COEFFICIENT_BIT_13_7;               /* set field */
+    list[1].value = coefficient;                                                     /* set value */
+    
+    return a_wm8978_field_write(handle, list, 2);                                    /* write fields */
+}
+
+/**
+ * @brief      get notch filter a1 coefficient bit13 - bit7
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *update_once pointer to a bool value buffer
+ * @param[out] *coefficient pointer to a coefficient buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get notch filter a1 coefficient bit13 - bit7 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_notch_filter_a1_coefficient_bit_13_7(wm8978_handle_t *handle, wm8978_bool_t *update_once, uint8_t *coefficient)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_NOTCH_FILTER_A1_COEFFICIENT_BIT_13_7_UPDATE, &value);        /* get field */
+    if (res != 0)                                                                                              /* check result */
+    {
+        return res;                                                                                            /* return error */
+    }
+    *update_once = (wm8978_bool_t)(value);                                                                     /* get bool */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_NOTCH_FILTER_A1_COEFFICIENT_BIT_13_7, &value);               /* get field */
+    if (res != 0)                                                                                              /* check result */
+    {
+        return res;                                                                                            /* return error */
+    }
+    *coefficient = (uint8_t)(value);                                                                           /* get coefficient */
+    
+    return 0;                                                                                                  /* success return 0 */
+}
+
+/**
+ * @brief     set notch filter a1 coefficient bit6 - bit0
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] update_once bool value
+ * @param[in] coefficient set coefficient
+ * @return    status code
+ *            - 0 success
+ *            - 1 set notch filter a1 coefficient failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 coefficient > 0x7F
+ * @note      none
+ */
+uint8_t wm8978_set_notch_filter_a1_coefficient_bit_6_0(wm8978_handle_t *handle, wm8978_bool_t update_once, uint8_t coefficient)
+{
+    wm8978_field_value_t list[2];
+    
+    list[0].field = WM8978_FIELD_NOTCH_FILTER_A1_COEFFICIENT_BIT_6_0_UPDATE;        /* set field */
+    list[0].value = update_once;                                                    /* set value */
+    list[1].field = WM8978_FIELD_NOTCH_FILTER_A1_COEFFICIENT_BIT_6_0;               /* set field */
+    list[1].value = coefficient;                                                    /* set value */
+    
+    return a_wm8978_field_write(handle, list, 2);                                   /* write fields */
+}
+
+/**
+ * @brief      get notch filter a1 coefficient bit6 - bit0
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *update_once pointer to a bool value buffer
+ * @param[out] *coefficient pointer to a coefficient buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get notch filter a1 coefficient bit6 - bit0 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_notch_filter_a1_coefficient_bit_6_0(wm8978_handle_t *handle, wm8978_bool_t *update_once, uint8_t *coefficient)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_NOTCH_FILTER_A1_COEFFICIENT_BIT_6_0_UPDATE, &value);        /* get field */
+    if (res != 0)                                                                                             /* check result */
+    {
+        return res;                                                                                           /* return error */
+    }
+    *update_once = (wm8978_bool_t)(value);                                                                    /* get bool */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_NOTCH_FILTER_A1_COEFFICIENT_BIT_6_0, &value);               /* get field */
+    if (res != 0)                                                                                             /* check result */
+    {
+        return res;                                                                                           /* return error */
+    }
+    *coefficient = (uint8_t)(value);                                                                          /* get coefficient */
+    
+    return 0;                                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     set alc
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] alc set alc
+ * @return    status code
+ *            - 0 success
+ *            - 1 set alc failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_alc(wm8978_handle_t *handle, wm8978_alc_t alc)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_ALC, alc);        /* set field */
+}
+
+/**
+ * @brief      get alc
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *alc pointer to an alc buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get alc failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_alc(wm8978_handle_t *handle, wm8978_alc_t *alc)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_ALC, &value);        /* get field */
+    *alc = (wm8978_alc_t)(value);                                      /* get alc */
+    
+    return res;                                                        /* return the result */
+}
+
+/**
+ * @brief     set alc max gain
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] gain alc max gain
+ * @return    status code
+ *            - 0 success
+ *            - 1 set alc max gain failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_alc_max_gain(wm8978_handle_t *handle, wm8978_max_gain_t gain)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_ALC_MAX_GAIN, gain);        /* set field */
+}
+
+/**
+ * @brief      get alc max gain
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *gain pointer to an alc max gain buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get alc max gain failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_alc_max_gain(wm8978_handle_t *handle, wm8978_max_gain_t *gain)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_ALC_MAX_GAIN, &value);        /* get field */
+    *gain = (wm8978_max_gain_t)(value);                                         /* get gain */
+    
+    return res;                                                                 /* return the result */
+}
+
+/**
+ * @brief     set alc min gain
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] gain alc min gain
+ * @return    status code
+ *            - 0 success
+ *            - 1 set alc min gain failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_alc_min_gain(wm8978_handle_t *handle, wm8978_min_gain_t gain)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_ALC_MIN_GAIN, gain);        /* set field */
+}
+
+/**
+ * @brief      get alc min gain
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *gain pointer to an alc min gain buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get alc min gain failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_alc_min_gain(wm8978_handle_t *handle, wm8978_min_gain_t *gain)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_ALC_MIN_GAIN, &value);        /* get field */
+    *gain = (wm8978_min_gain_t)(value);                                         /* get gain */
+    
+    return res;                                                                 /* return the result */
+}
+
+/**
+ * @brief     set alc hold time
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] t alc hold time
+ * @return    status code
+ *            - 0 success
+ *            - 1 set alc hold time failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 t > 0xF
+ * @note      none
+ */
+uint8_t wm8978_set_alc_hold_time(wm8978_handle_t *handle, uint8_t t)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_ALC_HOLD_TIME, t);        /* set field */
+}
+
+/**
+ * @brief      get alc hold time
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *t pointer to an alc hold time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get alc hold time failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_alc_hold_time(wm8978_handle_t *handle, uint8_t *t)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_ALC_HOLD_TIME, &value);        /* get field */
+    *t = (uint8_t)(value);                                                       /* get t */
+    
+    return res;                                                                  /* return the result */
+}
+
+/**
+ * @brief      convert the alc hold time to the register raw data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  ms alc hold time in ms
+ * @param[out] *reg pointer to an alc hold time raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_alc_hold_time_convert_to_register(wm8978_handle_t *handle, float ms, uint8_t *reg)
+{
+    if (handle == NULL)                /* check handle */
+    {
+        return 2;                      /* return error */
+    }
+    if (handle->inited != 1)           /* check handle initialization */
+    {
+        return 3;                      /* return error */
+    }
+    
+    *reg = a_wm8978_alc_hold_time_search((uint32_t)(ms * 1000.0f + 0.5f));        /* search the nearest step */
+    
+    return 0;                          /* success return 0 */
+}
+
+/**
+ * @brief      convert the alc hold time register raw data to the real data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  reg raw data
+ * @param[out] *ms pointer to an alc hold time real data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_alc_hold_time_convert_to_data(wm8978_handle_t *handle, uint8_t reg, float *ms)
+{
+    if (handle == NULL)             /* check handle */
+    {
+        return 2;                   /* return error */
+    }
+    if (handle->inited != 1)        /* check handle initialization */
+    {
+        return 3;                   /* return error */
+    }
+    
+    *ms = (float)(gsc_wm8978_alc_hold_time_us[reg & 0xF]) / 1000.0f;        /* convert */
+    
+    return 0;                       /* success return 0 */
+}
+
+/**
+ * @brief      convert the alc hold time in us to the register raw data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  us alc hold time in us
+ * @param[out] *reg pointer to an alc hold time raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 us is over range
+ * @note       the result is rounded to the nearest step
+ */
+uint8_t wm8978_alc_hold_time_us_convert_to_register(wm8978_handle_t *handle, uint32_t us, uint8_t *reg)
+{
+    if (handle == NULL)                                            /* check handle */
+    {
+        return 2;                                                  /* return error */
+    }
+    if (handle->inited != 1)                                       /* check handle initialization */
+    {
+        return 3;                                                  /* return error */
+    }
+    if (us > gsc_wm8978_alc_hold_time_us[15])                      /* check range */
+    {
+        handle->debug_print("wm8978: us is over range.\n");        /* us is over range */
+        
+        return 4;                                                  /* return error */
+    }
+    
+    *reg = a_wm8978_alc_hold_time_search(us);                      /* search the nearest step */
+    
+    return 0;                                                      /* success return 0 */
+}
+
+/**
+ * @brief      convert the alc hold time register raw data to us
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  reg alc hold time raw data
+ * @param[out] *us pointer to an alc hold time buffer in us
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_alc_hold_time_us_convert_to_data(wm8978_handle_t *handle, uint8_t reg, uint32_t *us)
+{
+    if (handle == NULL)                                  /* check handle */
+    {
+        return 2;                                        /* return error */
+    }
+    if (handle->inited != 1)                             /* check handle initialization */
+    {
+        return 3;                                        /* return error */
+    }
+    
+    *us = gsc_wm8978_alc_hold_time_us[reg & 0xF];        /* convert */
+    
+    return 0;                                            /* success return 0 */
+}
+
+/**
+ * @brief     set alc level
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] level set level
+ * @return    status code
+ *            - 0 success
+ *            - 1 set alc level failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_alc_level(wm8978_handle_t *handle, wm8978_alc_level_t level)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_ALC_LEVEL, level);        /* set field */
+}
+
+/**
+ * @brief      get alc level
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *level pointer to a level buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get alc level failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_alc_level(wm8978_handle_t *handle, wm8978_alc_level_t *level)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_ALC_LEVEL, &value);        /* get field */
+    *level = (wm8978_alc_level_t)(value);                                    /* get level */
+    
+    return res;                                                              /* return the result */
+}
+
+/**
+ * @brief     set alc mode
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] mode alc mode
+ * @return    status code
+ *            - 0 success
+ *            - 1 set alc mode failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_alc_mode(wm8978_handle_t *handle, wm8978_alc_mode_t mode)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_ALC_MODE, mode);        /* set field */
+}
+
+/**
+ * @brief      get alc mode
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *mode pointer to an alc mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get alc mode failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_alc_mode(wm8978_handle_t *handle, wm8978_alc_mode_t *mode)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_ALC_MODE, &value);        /* get field */
+    *mode = (wm8978_alc_mode_t)(value);                                     /* get mode */
+    
+    return res;                                                             /* return the result */
+}
+
+/**
+ * @brief     set alc decay
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] decay set decay
+ * @return    status code
+ *            - 0 success
+ *            - 1 set alc decay failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 decay > 0xF
+ * @note      none
+ */
+uint8_t wm8978_set_alc_decay(wm8978_handle_t *handle, uint8_t decay)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_ALC_DECAY, decay);        /* set field */
+}
+
+/**
+ * @brief      get alc decay
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *decay pointer to a decay buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get alc decay failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_alc_decay(wm8978_handle_t *handle, uint8_t *decay)
 {
     uint8_t res;
-    uint16_t conf;
+    uint16_t value;
     
-    if (handle == NULL)                                                      /* check handle */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_ALC_DECAY, &value);        /* get field */
+    *decay = (uint8_t)(value);                                               /* get decay */
+    
+    return res;                                                              /* return the result */
+}
+
+/**
+ * @brief     set alc attack
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] attack set attack
+ * @return    status code
+ *            - 0 success
+ *            - 1 set alc attack failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 decay > 0xF
+ * @note      none
+ */
+uint8_t wm8978_set_alc_attack(wm8978_handle_t *handle, uint8_t attack)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_ALC_ATTACK, attack);        /* set field */
+}
+
+/**
+ * @brief      get alc attack
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *attack pointer to an attack buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get alc attack failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_alc_attack(wm8978_handle_t *handle, uint8_t *attack)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_ALC_ATTACK, &value);        /* get field */
+    *attack = (uint8_t)(value);                                               /* get attack */
+    
+    return res;                                                               /* return the result */
+}
+
+/**
+ * @brief     enable or disable alc noise gate
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set alc noise gate failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_alc_noise_gate(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_ALC_NOISE_GATE, enable);        /* set field */
+}
+
+/**
+ * @brief      get alc noise gate status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get alc noise gate failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_alc_noise_gate(wm8978_handle_t *handle, wm8978_bool_t *enable)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_ALC_NOISE_GATE, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                             /* get bool */
+    
+    return res;                                                                   /* return the result */
+}
+
+/**
+ * @brief     set alc noise gate threshold
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] threshold alc noise gate threshold
+ * @return    status code
+ *            - 0 success
+ *            - 1 set alc noise gate threshold failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 threshold > 0x7
+ * @note      none
+ */
+uint8_t wm8978_set_alc_noise_gate_threshold(wm8978_handle_t *handle, uint8_t threshold)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_ALC_NOISE_GATE_THRESHOLD, threshold);        /* set field */
+}
+
+/**
+ * @brief      get alc noise gate threshold
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *threshold pointer to an alc noise gate threshold buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get alc noise gate threshold failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_alc_noise_gate_threshold(wm8978_handle_t *handle, uint8_t *threshold)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_ALC_NOISE_GATE_THRESHOLD, &value);        /* get field */
+    *threshold = (uint8_t)(value);                                                          /* get threshold */
+    
+    return res;                                                                             /* return the result */
+}
+
+/**
+ * @brief      convert the alc noise gate threshold to the register raw data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  db alc noise gate threshold in db
+ * @param[out] *reg pointer to an alc noise gate threshold raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_alc_noise_gate_threshold_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
+{
+    if (handle == NULL)                    /* check handle */
     {
-        return 2;                                                            /* return error */
+        return 2;                          /* return error */
     }
-    if (handle->inited != 1)                                                 /* check handle initialization */
+    if (handle->inited != 1)               /* check handle initialization */
     {
-        return 3;                                                            /* return error */
+        return 3;                          /* return error */
+    }
+    
+    *reg = (uint8_t)((db + 39) / (-6));    /* convert */
+    
+    return 0;                              /* success return 0 */
+}
+
+/**
+ * @brief      convert the alc noise gate threshold register raw data to the real data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  reg raw data
+ * @param[out] *db pointer to an alc noise gate threshold real data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_alc_noise_gate_threshold_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
+{
+    if (handle == NULL)                    /* check handle */
+    {
+        return 2;                          /* return error */
     }
-    if (coefficient > 0x7F)                                                  /* check coefficient */
+    if (handle->inited != 1)               /* check handle initialization */
+    {
+        return 3;                          /* return error */
+    }
+    
+    *db = (int8_t)(reg * (-6) - 39);       /* convert */
+    
+    return 0;                              /* success return 0 */
+}
+
+/**
+ * @brief     enable or disable mclk divide by 2
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set mclk divide by 2 failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_mclk_divide_by_2(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_MCLK_DIVIDE_BY_2, enable);        /* set field */
+}
+
+/**
+ * @brief      get mclk divide by 2 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get mclk divide by 2 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_mclk_divide_by_2(wm8978_handle_t *handle, wm8978_bool_t *enable)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_MCLK_DIVIDE_BY_2, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                               /* get bool */
+    
+    return res;                                                                     /* return the result */
+}
+
+/**
+ * @brief     set plln
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] n set pll
+ * @return    status code
+ *            - 0 success
+ *            - 1 set plln failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 n > 0xF
+ * @note      none
+ */
+uint8_t wm8978_set_plln(wm8978_handle_t *handle, uint8_t n)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_PLLN, n);        /* set field */
+}
+
+/**
+ * @brief      get plln
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *n pointer to a pll buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get plln failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_plln(wm8978_handle_t *handle, uint8_t *n)
+{
+    uint8_t res;
+    uint16_t value;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_PLLN, &value);        /* get field */
+    *n = (uint8_t)(value);                                              /* get n */
+    
+    return res;                                                         /* return the result */
+}
+
+/**
+ * @brief     set pll freq
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] freq pll freq
+ * @return    status code
+ *            - 0 success
+ *            - 1 set pll freq failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_pll_freq(wm8978_handle_t *handle, uint32_t freq)
+{
+    wm8978_field_value_t list[3];
+    
+    list[0].field = WM8978_FIELD_PLL_K3;                    /* set field */
+    list[0].value = (uint16_t)((freq >> 0) & 0x1FF);        /* set freq */
+    list[1].field = WM8978_FIELD_PLL_K2;                    /* set field */
+    list[1].value = (uint16_t)((freq >> 9) & 0x1FF);        /* set freq */
+    list[2].field = WM8978_FIELD_PLL_K1;                    /* set field */
+    list[2].value = (uint16_t)((freq >> 18) & 0x3F);        /* set freq */
+    
+    return a_wm8978_field_write(handle, list, 3);           /* write fields */
+}
+
+/**
+ * @brief      get pll freq
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *freq pointer to a pll freq buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get pll freq failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_pll_freq(wm8978_handle_t *handle, uint32_t *freq)
+{
+    uint8_t res;
+    uint16_t k1;
+    uint16_t k2;
+    uint16_t k3;
+    
+    res = a_wm8978_field_get(handle, WM8978_FIELD_PLL_K1, &k1);        /* get field */
+    if (res != 0)                                                      /* check result */
     {
-        handle->debug_print("wm8978: coefficient > 0x7F.\n");                /* coefficient > 0x7F*/
-        
-        return 4;                                                            /* return error */
+        return res;                                                    /* return error */
     }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_NOTCH_FILTER_2, &conf);       /* read config */
-    if (res != 0)                                                            /* check error */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_PLL_K2, &k2);        /* get field */
+    if (res != 0)                                                      /* check result */
     {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
+        return res;                                                    /* return error */
     }
-    conf &= ~(1 << 8);                                                       /* clear config */
-    conf |= update_once << 8;                                                /* set bool */
-    conf &= ~(0x7F << 0);                                                    /* clear config */
-    conf |= coefficient << 0;                                                /* set coefficient */
-    res = a_wm8978_iic_write(handle, WM8978_REG_NOTCH_FILTER_2, conf);       /* write config */
-    if (res != 0)                                                            /* check error */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_PLL_K3, &k3);        /* get field */
+    if (res != 0)                                                      /* check result */
     {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
+        return res;                                                    /* return error */
     }
+    *freq = ((uint32_t)k1 << 18) | ((uint32_t)k2 << 9) | k3;           /* get freq */
     
-    return 0;                                                                /* success return 0 */
+    return 0;                                                          /* success return 0 */
 }
 
 /**
- * @brief     set notch filter a1 coefficient bit13 - bit7
+ * @brief     set depth 3d
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] update_once bool value
- * @param[in] coefficient set coefficient
+ * @param[in] depth 3d depth
  * @return    status code
  *            - 0 success
- *            - 1 set notch filter a1 coefficient failed
+ *            - 1 set depth 3d failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 coefficient > 0x7F
+ *            - 4 depth > 0xF
  * @note      none
  */
-uint8_t wm8978_set_notch_filter_a1_coefficient_bit_13_7(wm8978_handle_t *handle, wm8978_bool_t update_once, uint8_t coefficient)
+uint8_t wm8978_set_depth_3d(wm8978_handle_t *handle, uint8_t depth)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_DEPTH_3D, depth);        /* set field */
+}
+
+/**
+ * @brief      get depth 3d
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *depth pointer to a 3d depth buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get depth 3d failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_depth_3d(wm8978_handle_t *handle, uint8_t *depth)
 {
     uint8_t res;
-    uint16_t conf;
+    uint16_t value;
     
-    if (handle == NULL)                                                      /* check handle */
-    {
-        return 2;                                                            /* return error */
-    }
-    if (handle->inited != 1)                                                 /* check handle initialization */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_DEPTH_3D, &value);        /* get field */
+    *depth = (uint8_t)(value);                                              /* get depth */
+    
+    return res;                                                             /* return the result */
+}
+
+/**
+ * @brief      convert the depth 3d to the register raw data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  percent set percent
+ * @param[out] *reg pointer to a depth 3d raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_depth_3d_convert_to_register(wm8978_handle_t *handle, float percent, uint8_t *reg)
+{
+    if (handle == NULL)                        /* check handle */
     {
-        return 3;                                                            /* return error */
+        return 2;                              /* return error */
     }
-    if (coefficient > 0x7F)                                                  /* check coefficient */
+    if (handle->inited != 1)                   /* check handle initialization */
     {
-        handle->debug_print("wm8978: coefficient > 0x7F.\n");                /* coefficient > 0x7F*/
-        
-        return 4;                                                            /* return error */
+        return 3;                              /* return error */
     }
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_NOTCH_FILTER_3, &conf);       /* read config */
-    if (res != 0)                                                            /* check error */
+    *reg = (uint8_t)(percent / 6.67f);         /* convert */
+    
+    return 0;                                  /* success return 0 */
+}
+
+/**
+ * @brief      convert the depth 3d register raw data to the real data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  reg raw data
+ * @param[out] *percent pointer to a depth 3d real data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_depth_3d_convert_to_data(wm8978_handle_t *handle, uint8_t reg, float *percent)
+{
+    if (handle == NULL)                    /* check handle */
     {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
+        return 2;                          /* return error */
     }
-    conf &= ~(1 << 8);                                                       /* clear config */
-    conf |= update_once << 8;                                                /* set bool */
-    conf &= ~(0x7F << 0);                                                    /* clear config */
-    conf |= coefficient << 0;                                                /* set coefficient */
-    res = a_wm8978_iic_write(handle, WM8978_REG_NOTCH_FILTER_3, conf);       /* write config */
-    if (res != 0)                                                            /* check error */
+    if (handle->inited != 1)               /* check handle initialization */
     {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
+        return 3;                          /* return error */
     }
     
-    return 0;                                                                /* success return 0 */
+    *percent = (float)(reg) * 6.67f;       /* convert */
+    
+    return 0;                              /* success return 0 */
 }
 
 /**
- * @brief     set notch filter a1 coefficient bit6 - bit0
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] update_once bool value
- * @param[in] coefficient set coefficient
- * @return    status code
- *            - 0 success
- *            - 1 set notch filter a1 coefficient failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- *            - 4 coefficient > 0x7F
- * @note      none
+ * @brief      convert the depth 3d in permille to the register raw data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  permille depth in 0.1%
+ * @param[out] *reg pointer to a depth 3d raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 permille is over range
+ * @note       the step is 1000 / 15 permille, the result is rounded to the nearest step
  */
-uint8_t wm8978_set_notch_filter_a1_coefficient_bit_6_0(wm8978_handle_t *handle, wm8978_bool_t update_once, uint8_t coefficient)
+uint8_t wm8978_depth_3d_permille_convert_to_register(wm8978_handle_t *handle, uint16_t permille, uint8_t *reg)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                      /* check handle */
+    if (handle == NULL)                                                  /* check handle */
     {
-        return 2;                                                            /* return error */
+        return 2;                                                        /* return error */
     }
-    if (handle->inited != 1)                                                 /* check handle initialization */
+    if (handle->inited != 1)                                             /* check handle initialization */
     {
-        return 3;                                                            /* return error */
+        return 3;                                                        /* return error */
     }
-    if (coefficient > 0x7F)                                                  /* check coefficient */
+    if (permille > 1000)                                                 /* check range */
     {
-        handle->debug_print("wm8978: coefficient > 0x7F.\n");                /* coefficient > 0x7F*/
+        handle->debug_print("wm8978: permille is over range.\n");        /* permille is over range */
         
-        return 4;                                                            /* return error */
+        return 4;                                                        /* return error */
     }
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_NOTCH_FILTER_4, &conf);       /* read config */
-    if (res != 0)                                                            /* check error */
+    *reg = (uint8_t)((permille * 15U + 500U) / 1000U);                   /* convert with rounding */
+    
+    return 0;                                                            /* success return 0 */
+}
+
+/**
+ * @brief      convert the depth 3d register raw data to permille
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  reg depth 3d raw data
+ * @param[out] *permille pointer to a depth buffer in 0.1%
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_depth_3d_permille_convert_to_data(wm8978_handle_t *handle, uint8_t reg, uint16_t *permille)
+{
+    if (handle == NULL)                                      /* check handle */
     {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
+        return 2;                                            /* return error */
     }
-    conf &= ~(1 << 8);                                                       /* clear config */
-    conf |= update_once << 8;                                                /* set bool */
-    conf &= ~(0x7F << 0);                                                    /* clear config */
-    conf |= coefficient << 0;                                                /* set coefficient */
-    res = a_wm8978_iic_write(handle, WM8978_REG_NOTCH_FILTER_4, conf);       /* write config */
-    if (res != 0)                                                            /* check error */
+    if (handle->inited != 1)                                 /* check handle initialization */
     {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
+        return 3;                                            /* return error */
     }
     
-    return 0;                                                                /* success return 0 */
+    *permille = (uint16_t)((reg * 1000U + 7U) / 15U);        /* convert with rounding */
+    
+    return 0;                                                /* success return 0 */
 }
 
 /**
- * @brief     set alc
+ * @brief     enable or disable mute input to inv rout2 mixer
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] alc set alc
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set alc failed
+ *            - 1 set mute input to inv rout2 mixer failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_alc(wm8978_handle_t *handle, wm8978_alc_t alc)
+uint8_t wm8978_set_mute_input_to_inv_rout2_mixer(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_MUTE_INPUT_TO_INV_ROUT2_MIXER, enable);        /* set field */
+}
+
+/**
+ * @brief      get mute input to inv rout2 mixer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get mute input to inv rout2 mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_mute_input_to_inv_rout2_mixer(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
+    uint16_t value;
     
-    if (handle == NULL)                                                      /* check handle */
-    {
-        return 2;                                                            /* return error */
-    }
-    if (handle->inited != 1)                                                 /* check handle initialization */
-    {
-        return 3;                                                            /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_MUTE_INPUT_TO_INV_ROUT2_MIXER, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                            /* get bool */
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_ALC_CONTROL_1, &conf);        /* read config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
-    }
-    conf &= ~(3 << 7);                                                       /* clear config */
-    conf |= alc << 7;                                                        /* set alc */
-    res = a_wm8978_iic_write(handle, WM8978_REG_ALC_CONTROL_1, conf);        /* write config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
-    }
+    return res;                                                                                  /* return the result */
+}
+
+/**
+ * @brief     enable or disable inv rout2 mixer
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set inv rout2 mixer failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_inv_rout2_mixer(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_INV_ROUT2_MIXER, enable);        /* set field */
+}
+
+/**
+ * @brief      get inv rout2 mixer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get inv rout2 mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_inv_rout2_mixer(wm8978_handle_t *handle, wm8978_bool_t *enable)
+{
+    uint8_t res;
+    uint16_t value;
     
-    return 0;                                                                /* success return 0 */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_INV_ROUT2_MIXER, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                              /* get bool */
+    
+    return res;                                                                    /* return the result */
 }
 
 /**
- * @brief     set alc max gain
+ * @brief     set beep volume
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] gain alc max gain
+ * @param[in] vol set volume
  * @return    status code
  *            - 0 success
- *            - 1 set alc max gain failed
+ *            - 1 set beep volume failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
+ *            - 4 vol > 0x7
  * @note      none
  */
-uint8_t wm8978_set_alc_max_gain(wm8978_handle_t *handle, wm8978_max_gain_t gain)
+uint8_t wm8978_set_beep_volume(wm8978_handle_t *handle, uint8_t vol)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_BEEP_VOLUME, vol);        /* set field */
+}
+
+/**
+ * @brief      get beep volume
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *vol pointer to a volume buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get beep volume failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_beep_volume(wm8978_handle_t *handle, uint8_t *vol)
 {
     uint8_t res;
-    uint16_t conf;
+    uint16_t value;
     
-    if (handle == NULL)                                                      /* check handle */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_BEEP_VOLUME, &value);        /* get field */
+    *vol = (uint8_t)(value);                                                   /* get vol */
+    
+    return res;                                                                /* return the result */
+}
+
+/**
+ * @brief      convert the beep volume to the register raw data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  db set db
+ * @param[out] *reg pointer to a beep volume raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_beep_volume_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
+{
+    if (handle == NULL)                    /* check handle */
     {
-        return 2;                                                            /* return error */
+        return 2;                          /* return error */
     }
-    if (handle->inited != 1)                                                 /* check handle initialization */
+    if (handle->inited != 1)               /* check handle initialization */
     {
-        return 3;                                                            /* return error */
+        return 3;                          /* return error */
     }
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_ALC_CONTROL_1, &conf);        /* read config */
-    if (res != 0)                                                            /* check error */
+    *reg = (uint8_t)(db + 15) / 3;         /* convert */
+    
+    return 0;                              /* success return 0 */
+}
+
+/**
+ * @brief      convert the beep volume register raw data to the real data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  reg raw data
+ * @param[out] *db pointer to a db real data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_beep_volume_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
+{
+    if (handle == NULL)                 /* check handle */
     {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
+        return 2;                       /* return error */
     }
-    conf &= ~(7 << 3);                                                       /* clear config */
-    conf |= gain << 3;                                                       /* set gain */
-    res = a_wm8978_iic_write(handle, WM8978_REG_ALC_CONTROL_1, conf);        /* write config */
-    if (res != 0)                                                            /* check error */
+    if (handle->inited != 1)            /* check handle initialization */
     {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
+        return 3;                       /* return error */
     }
     
-    return 0;                                                                /* success return 0 */
+    *db = (int8_t)(reg * 3 - 15);       /* convert */
+    
+    return 0;                           /* success return 0 */
 }
 
 /**
- * @brief     set alc min gain
+ * @brief     enable or disable beep
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] gain alc min gain
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set alc min gain failed
+ *            - 1 set beep failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_alc_min_gain(wm8978_handle_t *handle, wm8978_min_gain_t gain)
+uint8_t wm8978_set_beep(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_BEEP, enable);        /* set field */
+}
+
+/**
+ * @brief      get beep status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get beep failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_beep(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                      /* check handle */
-    {
-        return 2;                                                            /* return error */
-    }
-    if (handle->inited != 1)                                                 /* check handle initialization */
-    {
-        return 3;                                                            /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_ALC_CONTROL_1, &conf);        /* read config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
-    }
-    conf &= ~(7 << 0);                                                       /* clear config */
-    conf |= gain << 0;                                                       /* set gain */
-    res = a_wm8978_iic_write(handle, WM8978_REG_ALC_CONTROL_1, conf);        /* write config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_BEEP, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                   /* get bool */
     
-    return 0;                                                                /* success return 0 */
+    return res;                                                         /* return the result */
 }
 
 /**
- * @brief     set alc hold time
+ * @brief     set microphone bias voltage
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] t alc hold time
+ * @param[in] avdd set avdd
  * @return    status code
  *            - 0 success
- *            - 1 set alc hold time failed
+ *            - 1 set microphone bias voltage failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 t > 0xF
  * @note      none
  */
-uint8_t wm8978_set_alc_hold_time(wm8978_handle_t *handle, uint8_t t)
+uint8_t wm8978_set_microphone_bias_voltage(wm8978_handle_t *handle, wm8978_avdd_t avdd)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                      /* check handle */
-    {
-        return 2;                                                            /* return error */
-    }
-    if (handle->inited != 1)                                                 /* check handle initialization */
-    {
-        return 3;                                                            /* return error */
-    }
-    if (t > 0xF)                                                             /* check t */
-    {
-        handle->debug_print("wm8978: t > 0xF.\n");                           /* t > 0xF */
-        
-        return 4;                                                            /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_ALC_CONTROL_2, &conf);        /* read config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
-    }
-    conf &= ~(0xF << 4);                                                     /* clear config */
-    conf |= t << 4;                                                          /* set time */
-    res = a_wm8978_iic_write(handle, WM8978_REG_ALC_CONTROL_2, conf);        /* write config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
-    }
-    
-    return 0;                                                                /* success return 0 */
+    return a_wm8978_field_set(handle, WM8978_FIELD_MICROPHONE_BIAS_VOLTAGE, avdd);        /* set field */
 }
 
 /**
- * @brief      convert the alc hold time to the register raw data
+ * @brief      get microphone bias voltage
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  ms alc hold time in ms
- * @param[out] *reg pointer to an alc hold time raw data buffer
+ * @param[out] *avdd pointer to an avdd buffer
  * @return     status code
  *             - 0 success
+ *             - 1 get microphone bias voltage failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_alc_hold_time_convert_to_register(wm8978_handle_t *handle, float ms, uint8_t *reg)
+uint8_t wm8978_get_microphone_bias_voltage(wm8978_handle_t *handle, wm8978_avdd_t *avdd)
 {
-    if (handle == NULL)                /* check handle */
-    {
-        return 2;                      /* return error */
-    }
-    if (handle->inited != 1)           /* check handle initialization */
-    {
-        return 3;                      /* return error */
-    }
+    uint8_t res;
+    uint16_t value;
     
-    *reg = (uint8_t)(ms / 2.67f);      /* convert */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_MICROPHONE_BIAS_VOLTAGE, &value);        /* get field */
+    *avdd = (wm8978_avdd_t)(value);                                                        /* get avdd */
     
-    return 0;                          /* success return 0 */
+    return res;                                                                            /* return the result */
 }
 
 /**
- * @brief      convert the alc hold time register raw data to the real data
+ * @brief     enable or disable right channel input pga positive
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set right channel input pga positive failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_right_channel_input_pga_positive(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_RIGHT_CHANNEL_INPUT_PGA_POSITIVE, enable);        /* set field */
+}
+
+/**
+ * @brief      get right channel input pga positive status
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  reg raw data
- * @param[out] *ms pointer to an alc hold time real data buffer
+ * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
+ *             - 1 get right channel input pga positive failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_alc_hold_time_convert_to_data(wm8978_handle_t *handle, uint8_t reg, float *ms)
+uint8_t wm8978_get_right_channel_input_pga_positive(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
-    if (handle == NULL)             /* check handle */
-    {
-        return 2;                   /* return error */
-    }
-    if (handle->inited != 1)        /* check handle initialization */
-    {
-        return 3;                   /* return error */
-    }
+    uint8_t res;
+    uint16_t value;
     
-    *ms = (float)(reg * 2.67f);     /* convert */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_RIGHT_CHANNEL_INPUT_PGA_POSITIVE, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                               /* get bool */
     
-    return 0;                       /* success return 0 */
+    return res;                                                                                     /* return the result */
 }
 
 /**
- * @brief     set alc level
+ * @brief     enable or disable right channel input pga negative
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] level set level
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set alc level failed
+ *            - 1 set right channel input pga negative failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_alc_level(wm8978_handle_t *handle, wm8978_alc_level_t level)
+uint8_t wm8978_set_right_channel_input_pga_negative(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_RIGHT_CHANNEL_INPUT_PGA_NEGATIVE, enable);        /* set field */
+}
+
+/**
+ * @brief      get right channel input pga negative status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right channel input pga negative failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_channel_input_pga_negative(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
+    uint16_t value;
     
-    if (handle == NULL)                                                      /* check handle */
-    {
-        return 2;                                                            /* return error */
-    }
-    if (handle->inited != 1)                                                 /* check handle initialization */
-    {
-        return 3;                                                            /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_ALC_CONTROL_2, &conf);        /* read config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
-    }
-    conf &= ~(0xF << 0);                                                     /* clear config */
-    conf |= level << 0;                                                      /* set level */
-    res = a_wm8978_iic_write(handle, WM8978_REG_ALC_CONTROL_2, conf);        /* write config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_RIGHT_CHANNEL_INPUT_PGA_NEGATIVE, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                               /* get bool */
     
-    return 0;                                                                /* success return 0 */
+    return res;                                                                                     /* return the result */
 }
 
 /**
- * @brief     set alc mode
+ * @brief     enable or disable right channel input pga amplifier positive
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] mode alc mode
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set alc mode failed
+ *            - 1 set right channel input pga amplifier positive failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_alc_mode(wm8978_handle_t *handle, wm8978_alc_mode_t mode)
+uint8_t wm8978_set_right_channel_input_pga_amplifier_positive(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_RIGHT_CHANNEL_INPUT_PGA_AMPLIFIER_POSITIVE, enable);        /* set field */
+}
+
+/**
+ * @brief      get right channel input pga amplifier positive status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right channel input pga amplifier positive failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_channel_input_pga_amplifier_positive(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                      /* check handle */
-    {
-        return 2;                                                            /* return error */
-    }
-    if (handle->inited != 1)                                                 /* check handle initialization */
-    {
-        return 3;                                                            /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_ALC_CONTROL_3, &conf);        /* read config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
-    }
-    conf &= ~(1 << 8);                                                       /* clear config */
-    conf |= mode << 8;                                                       /* set mode */
-    res = a_wm8978_iic_write(handle, WM8978_REG_ALC_CONTROL_3, conf);        /* write config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_RIGHT_CHANNEL_INPUT_PGA_AMPLIFIER_POSITIVE, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                                         /* get bool */
     
-    return 0;                                                                /* success return 0 */
+    return res;                                                                                               /* return the result */
 }
 
 /**
- * @brief     set alc decay
+ * @brief     enable or disable left channel input pga positive
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] decay set decay
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set alc decay failed
+ *            - 1 set left channel input pga positive failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 decay > 0xF
  * @note      none
  */
-uint8_t wm8978_set_alc_decay(wm8978_handle_t *handle, uint8_t decay)
+uint8_t wm8978_set_left_channel_input_pga_positive(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LEFT_CHANNEL_INPUT_PGA_POSITIVE, enable);        /* set field */
+}
+
+/**
+ * @brief      get left channel input pga positive status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left channel input pga positive failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_channel_input_pga_positive(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                      /* check handle */
-    {
-        return 2;                                                            /* return error */
-    }
-    if (handle->inited != 1)                                                 /* check handle initialization */
-    {
-        return 3;                                                            /* return error */
-    }
-    if (decay > 0xF)                                                         /* check decay */
-    {
-        handle->debug_print("wm8978: decay > 0xF.\n");                       /* decay > 0xF */
-        
-        return 4;                                                            /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_ALC_CONTROL_3, &conf);        /* read config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
-    }
-    conf &= ~(0xF << 4);                                                     /* clear config */
-    conf |= decay << 4;                                                      /* set decay */
-    res = a_wm8978_iic_write(handle, WM8978_REG_ALC_CONTROL_3, conf);        /* write config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LEFT_CHANNEL_INPUT_PGA_POSITIVE, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                              /* get bool */
     
-    return 0;                                                                /* success return 0 */
+    return res;                                                                                    /* return the result */
 }
 
 /**
- * @brief     set alc attack
+ * @brief     enable or disable left channel input pga negative
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] attack set attack
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set alc attack failed
+ *            - 1 set left channel input pga negative failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 decay > 0xF
  * @note      none
  */
-uint8_t wm8978_set_alc_attack(wm8978_handle_t *handle, uint8_t attack)
+uint8_t wm8978_set_left_channel_input_pga_negative(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LEFT_CHANNEL_INPUT_PGA_NEGATIVE, enable);        /* set field */
+}
+
+/**
+ * @brief      get left channel input pga negative status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left channel input pga negative failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_channel_input_pga_negative(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
+    uint16_t value;
     
-    if (handle == NULL)                                                      /* check handle */
-    {
-        return 2;                                                            /* return error */
-    }
-    if (handle->inited != 1)                                                 /* check handle initialization */
-    {
-        return 3;                                                            /* return error */
-    }
-    if (attack > 0xF)                                                        /* check attack */
-    {
-        handle->debug_print("wm8978: attack > 0xF.\n");                      /* attack > 0xF */
-        
-        return 4;                                                            /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_ALC_CONTROL_3, &conf);        /* read config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
-    }
-    conf &= ~(0xF << 0);                                                     /* clear config */
-    conf |= attack << 0;                                                     /* set attack */
-    res = a_wm8978_iic_write(handle, WM8978_REG_ALC_CONTROL_3, conf);        /* write config */
-    if (res != 0)                                                            /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LEFT_CHANNEL_INPUT_PGA_NEGATIVE, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                              /* get bool */
     
-    return 0;                                                                /* success return 0 */
+    return res;                                                                                    /* return the result */
 }
 
 /**
- * @brief     enable or disable alc noise gate
+ * @brief     enable or disable left channel input pga amplifier positive
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set alc noise gate failed
+ *            - 1 set left channel input pga amplifier positive failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_alc_noise_gate(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_left_channel_input_pga_amplifier_positive(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LEFT_CHANNEL_INPUT_PGA_AMPLIFIER_POSITIVE, enable);        /* set field */
+}
+
+/**
+ * @brief      get left channel input pga amplifier positive status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left channel input pga amplifier positive failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_channel_input_pga_amplifier_positive(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                   /* check handle */
-    {
-        return 2;                                                         /* return error */
-    }
-    if (handle->inited != 1)                                              /* check handle initialization */
-    {
-        return 3;                                                         /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_NOISE_GATE, &conf);        /* read config */
-    if (res != 0)                                                         /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");             /* read config failed */
-        
-        return 1;                                                         /* return error */
-    }
-    conf &= ~(1 << 3);                                                    /* clear config */
-    conf |= enable << 3;                                                  /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_NOISE_GATE, conf);        /* write config */
-    if (res != 0)                                                         /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");            /* write config failed */
-        
-        return 1;                                                         /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LEFT_CHANNEL_INPUT_PGA_AMPLIFIER_POSITIVE, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                                        /* get bool */
     
-    return 0;                                                             /* success return 0 */
+    return res;                                                                                              /* return the result */
 }
 
 /**
- * @brief     set alc noise gate threshold
+ * @brief     enable or disable left input pga update
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] threshold alc noise gate threshold
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set alc noise gate threshold failed
+ *            - 1 set left input pga update failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 threshold > 0x7
  * @note      none
  */
-uint8_t wm8978_set_alc_noise_gate_threshold(wm8978_handle_t *handle, uint8_t threshold)
+uint8_t wm8978_set_left_input_pga_update(wm8978_handle_t *handle, wm8978_bool_t enable)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                   /* check handle */
-    {
-        return 2;                                                         /* return error */
-    }
-    if (handle->inited != 1)                                              /* check handle initialization */
-    {
-        return 3;                                                         /* return error */
-    }
-    if (threshold > 0x7)                                                  /* check threshold */
-    {
-        handle->debug_print("wm8978: threshold > 0x7.\n");                /* threshold > 0x7 */
-        
-        return 4;                                                         /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_NOISE_GATE, &conf);        /* read config */
-    if (res != 0)                                                         /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");             /* read config failed */
-        
-        return 1;                                                         /* return error */
-    }
-    conf &= ~(7 << 0);                                                    /* clear config */
-    conf |= threshold << 0;                                               /* set threshold */
-    res = a_wm8978_iic_write(handle, WM8978_REG_NOISE_GATE, conf);        /* write config */
-    if (res != 0)                                                         /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");            /* write config failed */
-        
-        return 1;                                                         /* return error */
-    }
-    
-    return 0;                                                             /* success return 0 */
+    return a_wm8978_field_set(handle, WM8978_FIELD_LEFT_INPUT_PGA_UPDATE, enable);        /* set field */
 }
 
 /**
- * @brief      convert the alc noise gate threshold to the register raw data
+ * @brief      get left input pga update status
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  db alc noise gate threshold in db
- * @param[out] *reg pointer to an alc noise gate threshold raw data buffer
+ * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
+ *             - 1 get left input pga update failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_alc_noise_gate_threshold_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
+uint8_t wm8978_get_left_input_pga_update(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
-    if (handle == NULL)                    /* check handle */
-    {
-        return 2;                          /* return error */
-    }
-    if (handle->inited != 1)               /* check handle initialization */
-    {
-        return 3;                          /* return error */
-    }
+    uint8_t res;
+    uint16_t value;
     
-    *reg = (uint8_t)((db + 39) / (-6));    /* convert */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LEFT_INPUT_PGA_UPDATE, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                    /* get bool */
     
-    return 0;                              /* success return 0 */
+    return res;                                                                          /* return the result */
 }
 
 /**
- * @brief      convert the alc noise gate threshold register raw data to the real data
+ * @brief     enable or disable left channel input pga zero cross
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set left channel input pga zero cross failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_left_channel_input_pga_zero_cross(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LEFT_CHANNEL_INPUT_PGA_ZERO_CROSS, enable);        /* set field */
+}
+
+/**
+ * @brief      get left channel input pga zero cross status
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  reg raw data
- * @param[out] *db pointer to an alc noise gate threshold real data buffer
+ * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
+ *             - 1 get left channel input pga zero cross failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_alc_noise_gate_threshold_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
+uint8_t wm8978_get_left_channel_input_pga_zero_cross(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
-    if (handle == NULL)                    /* check handle */
-    {
-        return 2;                          /* return error */
-    }
-    if (handle->inited != 1)               /* check handle initialization */
-    {
-        return 3;                          /* return error */
-    }
+    uint8_t res;
+    uint16_t value;
     
-    *db = (int8_t)(reg * (-6) - 39);       /* convert */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LEFT_CHANNEL_INPUT_PGA_ZERO_CROSS, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                                /* get bool */
     
-    return 0;                              /* success return 0 */
+    return res;                                                                                      /* return the result */
 }
 
 /**
- * @brief     enable or disable mclk divide by 2
+ * @brief     enable or disable left channel input pga mute
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set mclk divide by 2 failed
+ *            - 1 set left channel input pga mute failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_mclk_divide_by_2(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_left_channel_input_pga_mute(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LEFT_CHANNEL_INPUT_PGA_MUTE, enable);        /* set field */
+}
+
+/**
+ * @brief      get left channel input pga mute status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left channel input pga mute failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_channel_input_pga_mute(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                              /* check handle */
-    {
-        return 2;                                                    /* return error */
-    }
-    if (handle->inited != 1)                                         /* check handle initialization */
-    {
-        return 3;                                                    /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_PLL_N, &conf);        /* read config */
-    if (res != 0)                                                    /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");        /* read config failed */
-        
-        return 1;                                                    /* return error */
-    }
-    conf &= ~(1 << 4);                                               /* clear config */
-    conf |= enable << 4;                                             /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_PLL_N, conf);        /* write config */
-    if (res != 0)                                                    /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");       /* write config failed */
-        
-        return 1;                                                    /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LEFT_CHANNEL_INPUT_PGA_MUTE, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                          /* get bool */
     
-    return 0;                                                        /* success return 0 */
+    return res;                                                                                /* return the result */
 }
 
 /**
- * @brief     set plln
+ * @brief     set left channel input pga volume
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] n set pll
+ * @param[in] volume set volume
  * @return    status code
  *            - 0 success
- *            - 1 set plln failed
+ *            - 1 set left channel input pga volume failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 n > 0xF
+ *            - 4 volume > 0x3F
  * @note      none
  */
-uint8_t wm8978_set_plln(wm8978_handle_t *handle, uint8_t n)
+uint8_t wm8978_set_left_channel_input_pga_volume(wm8978_handle_t *handle, uint8_t volume)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LEFT_CHANNEL_INPUT_PGA_VOLUME, volume);        /* set field */
+}
+
+/**
+ * @brief      get left channel input pga volume
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *volume pointer to a volume buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left channel input pga volume failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_channel_input_pga_volume(wm8978_handle_t *handle, uint8_t *volume)
 {
     uint8_t res;
-    uint16_t conf;
+    uint16_t value;
     
-    if (handle == NULL)                                              /* check handle */
-    {
-        return 2;                                                    /* return error */
-    }
-    if (handle->inited != 1)                                         /* check handle initialization */
-    {
-        return 3;                                                    /* return error */
-    }
-    if (n > 0xF)                                                     /* check n */
-    {
-        handle->debug_print("wm8978: n > 0xF.\n");                   /* n > 0xF */
-        
-        return 4;                                                    /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LEFT_CHANNEL_INPUT_PGA_VOLUME, &value);        /* get field */
+    *volume = (uint8_t)(value);                                                                  /* get volume */
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_PLL_N, &conf);        /* read config */
-    if (res != 0)                                                    /* check error */
+    return res;                                                                                  /* return the result */
+}
+
+/**
+ * @brief      convert the left channel input pga volume to the register raw data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  db set db
+ * @param[out] *reg pointer to a volume raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_left_channel_input_pga_volume_convert_to_register(wm8978_handle_t *handle, float db, uint8_t *reg)
+{
+    if (handle == NULL)                        /* check handle */
     {
-        handle->debug_print("wm8978: read config failed.\n");        /* read config failed */
-        
-        return 1;                                                    /* return error */
+        return 2;                              /* return error */
     }
-    conf &= ~(0xF << 0);                                             /* clear config */
-    conf |= n << 0;                                                  /* set plln */
-    res = a_wm8978_iic_write(handle, WM8978_REG_PLL_N, conf);        /* write config */
-    if (res != 0)                                                    /* check error */
+    if (handle->inited != 1)                   /* check handle initialization */
     {
-        handle->debug_print("wm8978: write config failed.\n");       /* write config failed */
-        
-        return 1;                                                    /* return error */
+        return 3;                              /* return error */
     }
     
-    return 0;                                                        /* success return 0 */
+    *reg = (uint8_t)((db + 12.0f) / 0.75f);    /* convert */
+    
+    return 0;                                  /* success return 0 */
 }
 
 /**
- * @brief     set pll freq
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] freq pll freq
- * @return    status code
- *            - 0 success
- *            - 1 set pll freq failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      convert the left channel input pga volume register raw data to the real data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  reg raw data
+ * @param[out] *db pointer to a volume real data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
  */
-uint8_t wm8978_set_pll_freq(wm8978_handle_t *handle, uint32_t freq)
+uint8_t wm8978_left_channel_input_pga_volume_convert_to_data(wm8978_handle_t *handle, uint8_t reg, float *db)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                              /* check handle */
+    if (handle == NULL)                    /* check handle */
     {
-        return 2;                                                    /* return error */
+        return 2;                          /* return error */
     }
-    if (handle->inited != 1)                                         /* check handle initialization */
+    if (handle->inited != 1)               /* check handle initialization */
     {
-        return 3;                                                    /* return error */
+        return 3;                          /* return error */
     }
     
-    conf = (freq >> 0) & 0x1FF;                                      /* set freq */
-    res = a_wm8978_iic_write(handle, WM8978_REG_PLL_K3, conf);       /* write config */
-    if (res != 0)                                                    /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");       /* write config failed */
-        
-        return 1;                                                    /* return error */
-    }
-    conf = (freq >> 9) & 0x1FF;                                      /* set freq */
-    res = a_wm8978_iic_write(handle, WM8978_REG_PLL_K2, conf);       /* write config */
-    if (res != 0)                                                    /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");       /* write config failed */
-        
-        return 1;                                                    /* return error */
-    }
-    conf = (freq >> 18) & 0x3F;                                      /* set freq */
-    res = a_wm8978_iic_write(handle, WM8978_REG_PLL_K1, conf);       /* write config */
-    if (res != 0)                                                    /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");       /* write config failed */
-        
-        return 1;                                                    /* return error */
-    }
+    *db = (float)(reg) * 0.75f - 12.0f;    /* convert */
     
-    return 0;                                                        /* success return 0 */
+    return 0;                              /* success return 0 */
 }
 
 /**
- * @brief     set depth 3d
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] depth 3d depth
- * @return    status code
- *            - 0 success
- *            - 1 set depth 3d failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- *            - 4 depth > 0xF
- * @note      none
+ * @brief      convert the left channel input pga volume in centi-db to the register raw data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  cdb volume in 0.01db
+ * @param[out] *reg pointer to a volume raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 cdb is over range
+ * @note       the step is 75 cdb, the result is rounded to the nearest step
  */
-uint8_t wm8978_set_depth_3d(wm8978_handle_t *handle, uint8_t depth)
+uint8_t wm8978_left_channel_input_pga_volume_cdb_convert_to_register(wm8978_handle_t *handle, int16_t cdb, uint8_t *reg)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                              /* check handle */
+    if (handle == NULL)                                             /* check handle */
     {
-        return 2;                                                    /* return error */
+        return 2;                                                   /* return error */
     }
-    if (handle->inited != 1)                                         /* check handle initialization */
+    if (handle->inited != 1)                                        /* check handle initialization */
     {
-        return 3;                                                    /* return error */
+        return 3;                                                   /* return error */
     }
-    if (depth > 0xF)                                                 /* check depth */
+    if ((cdb < -1200) || (cdb > 3525))                              /* check range */
     {
-        handle->debug_print("wm8978: depth > 0xF.\n");               /* depth > 0xF */
+        handle->debug_print("wm8978: cdb is over range.\n");        /* cdb is over range */
         
-        return 4;                                                    /* return error */
+        return 4;                                                   /* return error */
     }
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_3D_CONTROL, &conf);   /* read config */
-    if (res != 0)                                                    /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");        /* read config failed */
-        
-        return 1;                                                    /* return error */
-    }
-    conf &= ~(0xF << 0);                                             /* clear config */
-    conf |= depth << 0;                                              /* set depth */
-    res = a_wm8978_iic_write(handle, WM8978_REG_3D_CONTROL, conf);   /* write config */
-    if (res != 0)                                                    /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");       /* write config failed */
-        
-        return 1;                                                    /* return error */
-    }
+    *reg = (uint8_t)((cdb + 1200 + 37) / 75);                       /* convert with rounding */
     
-    return 0;                                                        /* success return 0 */
+    return 0;                                                       /* success return 0 */
 }
 
 /**
- * @brief      convert the depth 3d to the register raw data
+ * @brief      convert the left channel input pga volume register raw data to centi-db
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  percent set percent
- * @param[out] *reg pointer to a depth 3d raw data buffer
+ * @param[in]  reg volume raw data
+ * @param[out] *cdb pointer to a volume buffer in 0.01db
  * @return     status code
  *             - 0 success
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_depth_3d_convert_to_register(wm8978_handle_t *handle, float percent, uint8_t *reg)
+uint8_t wm8978_left_channel_input_pga_volume_cdb_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int16_t *cdb)
 {
-    if (handle == NULL)                        /* check handle */
+    if (handle == NULL)                                /* check handle */
     {
-        return 2;                              /* return error */
+        return 2;                                      /* return error */
     }
-    if (handle->inited != 1)                   /* check handle initialization */
+    if (handle->inited != 1)                           /* check handle initialization */
     {
-        return 3;                              /* return error */
+        return 3;                                      /* return error */
     }
     
-    *reg = (uint8_t)(percent / 6.67f);         /* convert */
+    *cdb = (int16_t)((int16_t)reg * 75 - 1200);        /* convert */
     
-    return 0;                                  /* success return 0 */
+    return 0;                                          /* success return 0 */
 }
 
 /**
- * @brief      convert the depth 3d register raw data to the real data
+ * @brief     enable or disable right input pga update
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set right input pga update failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_right_input_pga_update(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_RIGHT_INPUT_PGA_UPDATE, enable);        /* set field */
+}
+
+/**
+ * @brief      get right input pga update status
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  reg raw data
- * @param[out] *percent pointer to a depth 3d real data buffer
+ * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
+ *             - 1 get right input pga update failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_depth_3d_convert_to_data(wm8978_handle_t *handle, uint8_t reg, float *percent)
+uint8_t wm8978_get_right_input_pga_update(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
-    if (handle == NULL)                    /* check handle */
-    {
-        return 2;                          /* return error */
-    }
-    if (handle->inited != 1)               /* check handle initialization */
-    {
-        return 3;                          /* return error */
-    }
+    uint8_t res;
+    uint16_t value;
     
-    *percent = (float)(reg) * 6.67f;       /* convert */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_RIGHT_INPUT_PGA_UPDATE, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                     /* get bool */
     
-    return 0;                              /* success return 0 */
+    return res;                                                                           /* return the result */
 }
 
 /**
- * @brief     enable or disable mute input to inv rout2 mixer
+ * @brief     enable or disable right channel input pga zero cross
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set mute input to inv rout2 mixer failed
+ *            - 1 set right channel input pga zero cross failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_mute_input_to_inv_rout2_mixer(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_right_channel_input_pga_zero_cross(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_RIGHT_CHANNEL_INPUT_PGA_ZERO_CROSS, enable);        /* set field */
+}
+
+/**
+ * @brief      get right channel input pga zero cross status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right channel input pga zero cross failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_channel_input_pga_zero_cross(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                 /* check handle */
-    {
-        return 2;                                                       /* return error */
-    }
-    if (handle->inited != 1)                                            /* check handle initialization */
-    {
-        return 3;                                                       /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_BEEP_CONTROL, &conf);    /* read config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");           /* read config failed */
-        
-        return 1;                                                       /* return error */
-    }
-    conf &= ~(1 << 5);                                                  /* clear config */
-    conf |= enable << 5;                                                /* set enable */
-    res = a_wm8978_iic_write(handle, WM8978_REG_BEEP_CONTROL, conf);    /* write config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");          /* write config failed */
-        
-        return 1;                                                       /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_RIGHT_CHANNEL_INPUT_PGA_ZERO_CROSS, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                                 /* get bool */
     
-    return 0;                                                           /* success return 0 */
+    return res;                                                                                       /* return the result */
 }
 
 /**
- * @brief     enable or disable inv rout2 mixer
+ * @brief     enable or disable right channel input pga mute
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set inv rout2 mixer failed
+ *            - 1 set right channel input pga mute failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_inv_rout2_mixer(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_right_channel_input_pga_mute(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_RIGHT_CHANNEL_INPUT_PGA_MUTE, enable);        /* set field */
+}
+
+/**
+ * @brief      get right channel input pga mute status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right channel input pga mute failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_channel_input_pga_mute(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                 /* check handle */
-    {
-        return 2;                                                       /* return error */
-    }
-    if (handle->inited != 1)                                            /* check handle initialization */
-    {
-        return 3;                                                       /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_BEEP_CONTROL, &conf);    /* read config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");           /* read config failed */
-        
-        return 1;                                                       /* return error */
-    }
-    conf &= ~(1 << 4);                                                  /* clear config */
-    conf |= enable << 4;                                                /* set enable */
-    res = a_wm8978_iic_write(handle, WM8978_REG_BEEP_CONTROL, conf);    /* write config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");          /* write config failed */
-        
-        return 1;                                                       /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_RIGHT_CHANNEL_INPUT_PGA_MUTE, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                           /* get bool */
     
-    return 0;                                                           /* success return 0 */
+    return res;                                                                                 /* return the result */
 }
 
 /**
- * @brief     set beep volume
+ * @brief     set right channel input pga volume
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] vol set volume
+ * @param[in] volume set volume
  * @return    status code
  *            - 0 success
- *            - 1 set beep volume failed
+ *            - 1 set right channel input pga volume failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 vol > 0x7
+ *            - 4 volume > 0x3F
  * @note      none
  */
-uint8_t wm8978_set_beep_volume(wm8978_handle_t *handle, uint8_t vol)
+uint8_t wm8978_set_right_channel_input_pga_volume(wm8978_handle_t *handle, uint8_t volume)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_RIGHT_CHANNEL_INPUT_PGA_VOLUME, volume);        /* set field */
+}
+
+/**
+ * @brief      get right channel input pga volume
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *volume pointer to a volume buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right channel input pga volume failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_channel_input_pga_volume(wm8978_handle_t *handle, uint8_t *volume)
 {
     uint8_t res;
-    uint16_t conf;
+    uint16_t value;
     
-    if (handle == NULL)                                                 /* check handle */
-    {
-        return 2;                                                       /* return error */
-    }
-    if (handle->inited != 1)                                            /* check handle initialization */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_RIGHT_CHANNEL_INPUT_PGA_VOLUME, &value);        /* get field */
+    *volume = (uint8_t)(value);                                                                   /* get volume */
+    
+    return res;                                                                                   /* return the result */
+}
+
+/**
+ * @brief      convert the right channel input pga volume to the register raw data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  db set db
+ * @param[out] *reg pointer to a volume raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_right_channel_input_pga_volume_convert_to_register(wm8978_handle_t *handle, float db, uint8_t *reg)
+{
+    if (handle == NULL)                        /* check handle */
     {
-        return 3;                                                       /* return error */
+        return 2;                              /* return error */
     }
-    if (vol > 0x7)                                                      /* check vol */
+    if (handle->inited != 1)                   /* check handle initialization */
     {
-        handle->debug_print("wm8978: vol > 0x7.\n");                    /* vol > 0x7 */
-        
-        return 4;                                                       /* return error */
+        return 3;                              /* return error */
     }
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_BEEP_CONTROL, &conf);    /* read config */
-    if (res != 0)                                                       /* check error */
+    *reg = (uint8_t)((db + 12.0f) / 0.75f);    /* convert */
+    
+    return 0;                                  /* success return 0 */
+}
+
+/**
+ * @brief      convert the right channel input pga volume register raw data to the real data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  reg raw data
+ * @param[out] *db pointer to a volume real data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_right_channel_input_pga_volume_convert_to_data(wm8978_handle_t *handle, uint8_t reg, float *db)
+{
+    if (handle == NULL)                    /* check handle */
     {
-        handle->debug_print("wm8978: read config failed.\n");           /* read config failed */
-        
-        return 1;                                                       /* return error */
+        return 2;                          /* return error */
     }
-    conf &= ~(7 << 1);                                                  /* clear config */
-    conf |= vol << 1;                                                   /* set vol */
-    res = a_wm8978_iic_write(handle, WM8978_REG_BEEP_CONTROL, conf);    /* write config */
-    if (res != 0)                                                       /* check error */
+    if (handle->inited != 1)               /* check handle initialization */
     {
-        handle->debug_print("wm8978: write config failed.\n");          /* write config failed */
-        
-        return 1;                                                       /* return error */
+        return 3;                          /* return error */
     }
     
-    return 0;                                                           /* success return 0 */
+    *db = (float)(reg) * 0.75f - 12.0f;    /* convert */
+    
+    return 0;                              /* success return 0 */
 }
 
 /**
- * @brief      convert the beep volume to the register raw data
+ * @brief      convert the right channel input pga volume in centi-db to the register raw data
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  db set db
- * @param[out] *reg pointer to a beep volume raw data buffer
+ * @param[in]  cdb volume in 0.01db
+ * @param[out] *reg pointer to a volume raw data buffer
  * @return     status code
  *             - 0 success
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ *             - 4 cdb is over range
+ * @note       the step is 75 cdb, the result is rounded to the nearest step
  */
-uint8_t wm8978_beep_volume_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
+uint8_t wm8978_right_channel_input_pga_volume_cdb_convert_to_register(wm8978_handle_t *handle, int16_t cdb, uint8_t *reg)
 {
-    if (handle == NULL)                    /* check handle */
+    if (handle == NULL)                                             /* check handle */
+    {
+        return 2;                                                   /* return error */
+    }
+    if (handle->inited != 1)                                        /* check handle initialization */
     {
-        return 2;                          /* return error */
+        return 3;                                                   /* return error */
     }
-    if (handle->inited != 1)               /* check handle initialization */
+    if ((cdb < -1200) || (cdb > 3525))                              /* check range */
     {
-        return 3;                          /* return error */
+        handle->debug_print("wm8978: cdb is over range.\n");        /* cdb is over range */
+        
+        return 4;                                                   /* return error */
     }
     
-    *reg = (uint8_t)(db + 15) / 3;         /* convert */
+    *reg = (uint8_t)((cdb + 1200 + 37) / 75);                       /* convert with rounding */
     
-    return 0;                              /* success return 0 */
+    return 0;                                                       /* success return 0 */
 }
 
 /**
- * @brief      convert the beep volume register raw data to the real data
+ * @brief      convert the right channel input pga volume register raw data to centi-db
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  reg raw data
- * @param[out] *db pointer to a db real data buffer
+ * @param[in]  reg volume raw data
+ * @param[out] *cdb pointer to a volume buffer in 0.01db
  * @return     status code
  *             - 0 success
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_beep_volume_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
+uint8_t wm8978_right_channel_input_pga_volume_cdb_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int16_t *cdb)
 {
-    if (handle == NULL)                 /* check handle */
+    if (handle == NULL)                                /* check handle */
     {
-        return 2;                       /* return error */
+        return 2;                                      /* return error */
     }
-    if (handle->inited != 1)            /* check handle initialization */
+    if (handle->inited != 1)                           /* check handle initialization */
     {
-        return 3;                       /* return error */
+        return 3;                                      /* return error */
     }
     
-    *db = (int8_t)(reg * 3 - 15);       /* convert */
+    *cdb = (int16_t)((int16_t)reg * 75 - 1200);        /* convert */
     
-    return 0;                           /* success return 0 */
+    return 0;                                          /* success return 0 */
 }
 
 /**
- * @brief     enable or disable beep
+ * @brief     enable or disable left channel input pga boost
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set beep failed
+ *            - 1 set left channel input pga boost failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_beep(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_left_channel_input_pga_boost(wm8978_handle_t *handle, wm8978_bool_t enable)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                 /* check handle */
-    {
-        return 2;                                                       /* return error */
-    }
-    if (handle->inited != 1)                                            /* check handle initialization */
-    {
-        return 3;                                                       /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_BEEP_CONTROL, &conf);    /* read config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");           /* read config failed */
-        
-        return 1;                                                       /* return error */
-    }
-    conf &= ~(1 << 0);                                                  /* clear config */
-    conf |= enable << 0;                                                /* set enable */
-    res = a_wm8978_iic_write(handle, WM8978_REG_BEEP_CONTROL, conf);    /* write config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");          /* write config failed */
-        
-        return 1;                                                       /* return error */
-    }
-    
-    return 0;                                                           /* success return 0 */
+    return a_wm8978_field_set(handle, WM8978_FIELD_LEFT_CHANNEL_INPUT_PGA_BOOST, enable);        /* set field */
 }
 
 /**
- * @brief     set microphone bias voltage
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] avdd set avdd
- * @return    status code
- *            - 0 success
- *            - 1 set microphone bias voltage failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      get left channel input pga boost status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left channel input pga boost failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
  */
-uint8_t wm8978_set_microphone_bias_voltage(wm8978_handle_t *handle, wm8978_avdd_t avdd)
+uint8_t wm8978_get_left_channel_input_pga_boost(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                              /* check handle */
-    {
-        return 2;                                                    /* return error */
-    }
-    if (handle->inited != 1)                                         /* check handle initialization */
-    {
-        return 3;                                                    /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_INPUT_CTRL, &conf);   /* read config */
-    if (res != 0)                                                    /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");        /* read config failed */
-        
-        return 1;                                                    /* return error */
-    }
-    conf &= ~(1 << 8);                                               /* clear config */
-    conf |= avdd << 8;                                               /* set avdd */
-    res = a_wm8978_iic_write(handle, WM8978_REG_INPUT_CTRL, conf);   /* write config */
-    if (res != 0)                                                    /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");       /* write config failed */
-        
-        return 1;                                                    /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LEFT_CHANNEL_INPUT_PGA_BOOST, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                           /* get bool */
     
-    return 0;                                                        /* success return 0 */
+    return res;                                                                                 /* return the result */
 }
 
 /**
- * @brief     enable or disable right channel input pga positive
+ * @brief     set left channel input boost stage
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
+ * @param[in] stage set stage
  * @return    status code
  *            - 0 success
- *            - 1 set right channel input pga positive failed
+ *            - 1 set left channel input boost stage failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
+ *            - 4 stage > 0x7
  * @note      none
  */
-uint8_t wm8978_set_right_channel_input_pga_positive(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_left_channel_input_boost_stage(wm8978_handle_t *handle, uint8_t stage)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LEFT_CHANNEL_INPUT_BOOST_STAGE, stage);        /* set field */
+}
+
+/**
+ * @brief      get left channel input boost stage
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *stage pointer to a stage buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left channel input boost stage failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_channel_input_boost_stage(wm8978_handle_t *handle, uint8_t *stage)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                              /* check handle */
-    {
-        return 2;                                                    /* return error */
-    }
-    if (handle->inited != 1)                                         /* check handle initialization */
-    {
-        return 3;                                                    /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_INPUT_CTRL, &conf);   /* read config */
-    if (res != 0)                                                    /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");        /* read config failed */
-        
-        return 1;                                                    /* return error */
-    }
-    conf &= ~(1 << 6);                                               /* clear config */
-    conf |= enable << 6;                                             /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_INPUT_CTRL, conf);   /* write config */
-    if (res != 0)                                                    /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");       /* write config failed */
-        
-        return 1;                                                    /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LEFT_CHANNEL_INPUT_BOOST_STAGE, &value);        /* get field */
+    *stage = (uint8_t)(value);                                                                    /* get stage */
     
-    return 0;                                                        /* success return 0 */
+    return res;                                                                                   /* return the result */
 }
 
 /**
- * @brief     enable or disable right channel input pga negative
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
- * @return    status code
- *            - 0 success
- *            - 1 set right channel input pga negative failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      convert the left channel input boost stage to the register raw data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  db set db
+ * @param[out] *reg pointer to a volume raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
  */
-uint8_t wm8978_set_right_channel_input_pga_negative(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_left_channel_input_boost_stage_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                              /* check handle */
+    if (handle == NULL)                    /* check handle */
     {
-        return 2;                                                    /* return error */
+        return 2;                          /* return error */
     }
-    if (handle->inited != 1)                                         /* check handle initialization */
+    if (handle->inited != 1)               /* check handle initialization */
     {
-        return 3;                                                    /* return error */
+        return 3;                          /* return error */
     }
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_INPUT_CTRL, &conf);   /* read config */
-    if (res != 0)                                                    /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");        /* read config failed */
-        
-        return 1;                                                    /* return error */
-    }
-    conf &= ~(1 << 5);                                               /* clear config */
-    conf |= enable << 5;                                             /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_INPUT_CTRL, conf);   /* write config */
-    if (res != 0)                                                    /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");       /* write config failed */
-        
-        return 1;                                                    /* return error */
-    }
+    *reg = (uint8_t)(db + 15) / 3;         /* convert */
     
-    return 0;                                                        /* success return 0 */
+    return 0;                              /* success return 0 */
 }
 
 /**
- * @brief     enable or disable right channel input pga amplifier positive
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
- * @return    status code
- *            - 0 success
- *            - 1 set right channel input pga amplifier positive failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      convert the left channel input boost stage register raw data to the real data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  reg raw data
+ * @param[out] *db pointer to a db real data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
  */
-uint8_t wm8978_set_right_channel_input_pga_amplifier_positive(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_left_channel_input_boost_stage_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                              /* check handle */
+    if (handle == NULL)                 /* check handle */
     {
-        return 2;                                                    /* return error */
+        return 2;                       /* return error */
     }
-    if (handle->inited != 1)                                         /* check handle initialization */
+    if (handle->inited != 1)            /* check handle initialization */
     {
-        return 3;                                                    /* return error */
+        return 3;                       /* return error */
     }
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_INPUT_CTRL, &conf);   /* read config */
-    if (res != 0)                                                    /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");        /* read config failed */
-        
-        return 1;                                                    /* return error */
-    }
-    conf &= ~(1 << 4);                                               /* clear config */
-    conf |= enable << 4;                                             /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_INPUT_CTRL, conf);   /* write config */
-    if (res != 0)                                                    /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");       /* write config failed */
-        
-        return 1;                                                    /* return error */
-    }
+    *db = (int8_t)(reg * 3 - 15);       /* convert */
     
-    return 0;                                                        /* success return 0 */
+    return 0;                           /* success return 0 */
 }
 
 /**
- * @brief     enable or disable left channel input pga positive
+ * @brief     set auxiliary amplifier left channel input boost stage
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
+ * @param[in] stage set stage
  * @return    status code
  *            - 0 success
- *            - 1 set left channel input pga positive failed
+ *            - 1 set auxiliary amplifier left channel input boost stage failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
+ *            - 4 stage > 0x7
  * @note      none
  */
-uint8_t wm8978_set_left_channel_input_pga_positive(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_auxiliary_amplifier_left_channel_input_boost_stage(wm8978_handle_t *handle, uint8_t stage)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_AUXILIARY_AMPLIFIER_LEFT_CHANNEL_INPUT_BOOST_STAGE, stage);        /* set field */
+}
+
+/**
+ * @brief      get auxiliary amplifier left channel input boost stage
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *stage pointer to a stage buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get auxiliary amplifier left channel input boost stage failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_auxiliary_amplifier_left_channel_input_boost_stage(wm8978_handle_t *handle, uint8_t *stage)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                              /* check handle */
-    {
-        return 2;                                                    /* return error */
-    }
-    if (handle->inited != 1)                                         /* check handle initialization */
-    {
-        return 3;                                                    /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_INPUT_CTRL, &conf);   /* read config */
-    if (res != 0)                                                    /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");        /* read config failed */
-        
-        return 1;                                                    /* return error */
-    }
-    conf &= ~(1 << 2);                                               /* clear config */
-    conf |= enable << 2;                                             /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_INPUT_CTRL, conf);   /* write config */
-    if (res != 0)                                                    /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");       /* write config failed */
-        
-        return 1;                                                    /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_AUXILIARY_AMPLIFIER_LEFT_CHANNEL_INPUT_BOOST_STAGE, &value);        /* get field */
+    *stage = (uint8_t)(value);                                                                                        /* get stage */
     
-    return 0;                                                        /* success return 0 */
+    return res;                                                                                                       /* return the result */
 }
 
 /**
- * @brief     enable or disable left channel input pga negative
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
- * @return    status code
- *            - 0 success
- *            - 1 set left channel input pga negative failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      convert the auxiliary amplifier left channel input boost stage to the register raw data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  db set db
+ * @param[out] *reg pointer to a volume raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
  */
-uint8_t wm8978_set_left_channel_input_pga_negative(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_auxiliary_amplifier_left_channel_input_boost_stage_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                              /* check handle */
+    if (handle == NULL)                    /* check handle */
     {
-        return 2;                                                    /* return error */
+        return 2;                          /* return error */
     }
-    if (handle->inited != 1)                                         /* check handle initialization */
+    if (handle->inited != 1)               /* check handle initialization */
     {
-        return 3;                                                    /* return error */
+        return 3;                          /* return error */
     }
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_INPUT_CTRL, &conf);   /* read config */
-    if (res != 0)                                                    /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");        /* read config failed */
-        
-        return 1;                                                    /* return error */
-    }
-    conf &= ~(1 << 1);                                               /* clear config */
-    conf |= enable << 1;                                             /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_INPUT_CTRL, conf);   /* write config */
-    if (res != 0)                                                    /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");       /* write config failed */
-        
-        return 1;                                                    /* return error */
-    }
+    *reg = (uint8_t)(db + 15) / 3;         /* convert */
     
-    return 0;                                                        /* success return 0 */
+    return 0;                              /* success return 0 */
 }
 
 /**
- * @brief     enable or disable left channel input pga amplifier positive
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
- * @return    status code
- *            - 0 success
- *            - 1 set left channel input pga amplifier positive failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      convert the auxiliary amplifier left channel input boost stage register raw data to the real data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  reg raw data
+ * @param[out] *db pointer to a db real data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
  */
-uint8_t wm8978_set_left_channel_input_pga_amplifier_positive(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_auxiliary_amplifier_left_channel_input_boost_stage_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                              /* check handle */
+    if (handle == NULL)                 /* check handle */
     {
-        return 2;                                                    /* return error */
+        return 2;                       /* return error */
     }
-    if (handle->inited != 1)                                         /* check handle initialization */
+    if (handle->inited != 1)            /* check handle initialization */
     {
-        return 3;                                                    /* return error */
+        return 3;                       /* return error */
     }
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_INPUT_CTRL, &conf);   /* read config */
-    if (res != 0)                                                    /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");        /* read config failed */
-        
-        return 1;                                                    /* return error */
-    }
-    conf &= ~(1 << 0);                                               /* clear config */
-    conf |= enable << 0;                                             /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_INPUT_CTRL, conf);   /* write config */
-    if (res != 0)                                                    /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");       /* write config failed */
-        
-        return 1;                                                    /* return error */
-    }
+    *db = (int8_t)(reg * 3 - 15);       /* convert */
     
-    return 0;                                                        /* success return 0 */
+    return 0;                           /* success return 0 */
 }
 
 /**
- * @brief     enable or disable left input pga update
+ * @brief     enable or disable right channel input pga boost
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set left input pga update failed
+ *            - 1 set right channel input pga boost failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_left_input_pga_update(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_right_channel_input_pga_boost(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_RIGHT_CHANNEL_INPUT_PGA_BOOST, enable);        /* set field */
+}
+
+/**
+ * @brief      get right channel input pga boost status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right channel input pga boost failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_channel_input_pga_boost(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                     /* check handle */
-    {
-        return 2;                                                           /* return error */
-    }
-    if (handle->inited != 1)                                                /* check handle initialization */
-    {
-        return 3;                                                           /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_LEFT_INP_PGA_CTRL, &conf);   /* read config */
-    if (res != 0)                                                           /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");               /* read config failed */
-        
-        return 1;                                                           /* return error */
-    }
-    conf &= ~(1 << 8);                                                      /* clear config */
-    conf |= enable << 8;                                                    /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_LEFT_INP_PGA_CTRL, conf);   /* write config */
-    if (res != 0)                                                           /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");              /* write config failed */
-        
-        return 1;                                                           /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_RIGHT_CHANNEL_INPUT_PGA_BOOST, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                            /* get bool */
     
-    return 0;                                                               /* success return 0 */
+    return res;                                                                                  /* return the result */
 }
 
 /**
- * @brief     enable or disable left channel input pga zero cross
+ * @brief     set right channel input boost stage
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
+ * @param[in] stage set stage
  * @return    status code
  *            - 0 success
- *            - 1 set left channel input pga zero cross failed
+ *            - 1 set right channel input boost stage failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
+ *            - 4 stage > 0x7
  * @note      none
  */
-uint8_t wm8978_set_left_channel_input_pga_zero_cross(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_right_channel_input_boost_stage(wm8978_handle_t *handle, uint8_t stage)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_RIGHT_CHANNEL_INPUT_BOOST_STAGE, stage);        /* set field */
+}
+
+/**
+ * @brief      get right channel input boost stage
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *stage pointer to a stage buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right channel input boost stage failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_channel_input_boost_stage(wm8978_handle_t *handle, uint8_t *stage)
 {
     uint8_t res;
-    uint16_t conf;
+    uint16_t value;
     
-    if (handle == NULL)                                                     /* check handle */
-    {
-        return 2;                                                           /* return error */
-    }
-    if (handle->inited != 1)                                                /* check handle initialization */
-    {
-        return 3;                                                           /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_RIGHT_CHANNEL_INPUT_BOOST_STAGE, &value);        /* get field */
+    *stage = (uint8_t)(value);                                                                     /* get stage */
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_LEFT_INP_PGA_CTRL, &conf);   /* read config */
-    if (res != 0)                                                           /* check error */
+    return res;                                                                                    /* return the result */
+}
+
+/**
+ * @brief      convert the right channel input boost stage to the register raw data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  db set db
+ * @param[out] *reg pointer to a volume raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_right_channel_input_boost_stage_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
+{
+    if (handle == NULL)                    /* check handle */
     {
-        handle->debug_print("wm8978: read config failed.\n");               /* read config failed */
-        
-        return 1;                                                           /* return error */
+        return 2;                          /* return error */
     }
-    conf &= ~(1 << 7);                                                      /* clear config */
-    conf |= enable << 7;                                                    /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_LEFT_INP_PGA_CTRL, conf);   /* write config */
-    if (res != 0)                                                           /* check error */
+    if (handle->inited != 1)               /* check handle initialization */
     {
-        handle->debug_print("wm8978: write config failed.\n");              /* write config failed */
-        
-        return 1;                                                           /* return error */
+        return 3;                          /* return error */
     }
     
-    return 0;                                                               /* success return 0 */
+    *reg = (uint8_t)(db + 15) / 3;         /* convert */
+    
+    return 0;                              /* success return 0 */
 }
 
 /**
- * @brief     enable or disable left channel input pga mute
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
- * @return    status code
- *            - 0 success
- *            - 1 set left channel input pga mute failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      convert the right channel input boost stage register raw data to the real data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  reg raw data
+ * @param[out] *db pointer to a db real data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
  */
-uint8_t wm8978_set_left_channel_input_pga_mute(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_right_channel_input_boost_stage_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                     /* check handle */
+    if (handle == NULL)                 /* check handle */
     {
-        return 2;                                                           /* return error */
+        return 2;                       /* return error */
     }
-    if (handle->inited != 1)                                                /* check handle initialization */
+    if (handle->inited != 1)            /* check handle initialization */
     {
-        return 3;                                                           /* return error */
+        return 3;                       /* return error */
     }
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_LEFT_INP_PGA_CTRL, &conf);   /* read config */
-    if (res != 0)                                                           /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");               /* read config failed */
-        
-        return 1;                                                           /* return error */
-    }
-    conf &= ~(1 << 6);                                                      /* clear config */
-    conf |= enable << 6;                                                    /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_LEFT_INP_PGA_CTRL, conf);   /* write config */
-    if (res != 0)                                                           /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");              /* write config failed */
-        
-        return 1;                                                           /* return error */
-    }
+    *db = (int8_t)(reg * 3 - 15);       /* convert */
     
-    return 0;                                                               /* success return 0 */
+    return 0;                           /* success return 0 */
 }
 
 /**
- * @brief     set left channel input pga volume
+ * @brief     set auxiliary amplifier right channel input boost stage
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] volume set volume
+ * @param[in] stage set stage
  * @return    status code
  *            - 0 success
- *            - 1 set left channel input pga volume failed
+ *            - 1 set auxiliary amplifier right channel input boost stage failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 volume > 0x3F
+ *            - 4 stage > 0x7
  * @note      none
  */
-uint8_t wm8978_set_left_channel_input_pga_volume(wm8978_handle_t *handle, uint8_t volume)
+uint8_t wm8978_set_auxiliary_amplifier_right_channel_input_boost_stage(wm8978_handle_t *handle, uint8_t stage)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                     /* check handle */
-    {
-        return 2;                                                           /* return error */
-    }
-    if (handle->inited != 1)                                                /* check handle initialization */
-    {
-        return 3;                                                           /* return error */
-    }
-    if (volume > 0x3F)                                                      /* check volume */
-    {
-        handle->debug_print("wm8978: volume > 0x3F.\n");                    /* volume > 0x3F */
-        
-        return 4;                                                           /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_LEFT_INP_PGA_CTRL, &conf);   /* read config */
-    if (res != 0)                                                           /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");               /* read config failed */
-        
-        return 1;                                                           /* return error */
-    }
-    conf &= ~(0x3F << 0);                                                   /* clear config */
-    conf |= volume << 0;                                                    /* set volume */
-    res = a_wm8978_iic_write(handle, WM8978_REG_LEFT_INP_PGA_CTRL, conf);   /* write config */
-    if (res != 0)                                                           /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");              /* write config failed */
-        
-        return 1;                                                           /* return error */
-    }
-    
-    return 0;                                                               /* success return 0 */
+    return a_wm8978_field_set(handle, WM8978_FIELD_AUXILIARY_AMPLIFIER_RIGHT_CHANNEL_INPUT_BOOST_STAGE, stage);        /* set field */
 }
 
 /**
- * @brief      convert the left channel input pga volume to the register raw data
+ * @brief      get auxiliary amplifier right channel input boost stage
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  db set db
- * @param[out] *reg pointer to a volume raw data buffer
+ * @param[out] *stage pointer to a stage buffer
  * @return     status code
  *             - 0 success
+ *             - 1 get auxiliary amplifier right channel input boost stage failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_left_channel_input_pga_volume_convert_to_register(wm8978_handle_t *handle, float db, uint8_t *reg)
+uint8_t wm8978_get_auxiliary_amplifier_right_channel_input_boost_stage(wm8978_handle_t *handle, uint8_t *stage)
 {
-    if (handle == NULL)                        /* check handle */
-    {
-        return 2;                              /* return error */
-    }
-    if (handle->inited != 1)                   /* check handle initialization */
-    {
-        return 3;                              /* return error */
-    }
+    uint8_t res;
+    uint16_t value;
     
-    *reg = (uint8_t)((db + 12.0f) / 0.75f);    /* convert */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_AUXILIARY_AMPLIFIER_RIGHT_CHANNEL_INPUT_BOOST_STAGE, &value);        /* get field */
+    *stage = (uint8_t)(value);                                                                                         /* get stage */
     
-    return 0;                                  /* success return 0 */
+    return res;                                                                                                        /* return the result */
 }
 
 /**
- * @brief      convert the left channel input pga volume register raw data to the real data
+ * @brief      convert the auxiliary amplifier right channel input boost stage to the register raw data
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  reg raw data
- * @param[out] *db pointer to a volume real data buffer
+ * @param[in]  db set db
+ * @param[out] *reg pointer to a db raw data buffer
  * @return     status code
  *             - 0 success
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_left_channel_input_pga_volume_convert_to_data(wm8978_handle_t *handle, uint8_t reg, float *db)
+uint8_t wm8978_auxiliary_amplifier_right_channel_input_boost_stage_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
 {
     if (handle == NULL)                    /* check handle */
     {
@@ -6072,467 +7083,355 @@ uint8_t wm8978_left_channel_input_pga_volume_convert_to_data(wm8978_handle_t *ha
         return 3;                          /* return error */
     }
     
-    *db = (float)(reg) * 0.75f - 12.0f;    /* convert */
+    *reg = (uint8_t)(db + 15) / 3;         /* convert */
     
     return 0;                              /* success return 0 */
 }
 
 /**
- * @brief     enable or disable right input pga update
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
- * @return    status code
- *            - 0 success
- *            - 1 set right input pga update failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      convert the auxiliary amplifier right channel input boost stage register raw data to the real data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  reg raw data
+ * @param[out] *db pointer to a db real data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
  */
-uint8_t wm8978_set_right_input_pga_update(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_auxiliary_amplifier_right_channel_input_boost_stage_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                     /* check handle */
+    if (handle == NULL)                 /* check handle */
     {
-        return 2;                                                           /* return error */
+        return 2;                       /* return error */
     }
-    if (handle->inited != 1)                                                /* check handle initialization */
+    if (handle->inited != 1)            /* check handle initialization */
     {
-        return 3;                                                           /* return error */
+        return 3;                       /* return error */
     }
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_RIGHT_INP_PGA_CTRL, &conf);  /* read config */
-    if (res != 0)                                                           /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");               /* read config failed */
-        
-        return 1;                                                           /* return error */
-    }
-    conf &= ~(1 << 8);                                                      /* clear config */
-    conf |= enable << 8;                                                    /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_RIGHT_INP_PGA_CTRL, conf);  /* write config */
-    if (res != 0)                                                           /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");              /* write config failed */
-        
-        return 1;                                                           /* return error */
-    }
+    *db = (int8_t)(reg * 3 - 15);       /* convert */
     
-    return 0;                                                               /* success return 0 */
+    return 0;                           /* success return 0 */
 }
 
 /**
- * @brief     enable or disable right channel input pga zero cross
+ * @brief     enable or disable left dac output to right output mixer
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set right channel input pga zero cross failed
+ *            - 1 set left dac output to right output mixer failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_right_channel_input_pga_zero_cross(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_left_dac_output_to_right_output_mixer(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LEFT_DAC_OUTPUT_TO_RIGHT_OUTPUT_MIXER, enable);        /* set field */
+}
+
+/**
+ * @brief      get left dac output to right output mixer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left dac output to right output mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_dac_output_to_right_output_mixer(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                     /* check handle */
-    {
-        return 2;                                                           /* return error */
-    }
-    if (handle->inited != 1)                                                /* check handle initialization */
-    {
-        return 3;                                                           /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_RIGHT_INP_PGA_CTRL, &conf);  /* read config */
-    if (res != 0)                                                           /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");               /* read config failed */
-        
-        return 1;                                                           /* return error */
-    }
-    conf &= ~(1 << 7);                                                      /* clear config */
-    conf |= enable << 7;                                                    /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_RIGHT_INP_PGA_CTRL, conf);  /* write config */
-    if (res != 0)                                                           /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");              /* write config failed */
-        
-        return 1;                                                           /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LEFT_DAC_OUTPUT_TO_RIGHT_OUTPUT_MIXER, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                                    /* get bool */
     
-    return 0;                                                               /* success return 0 */
+    return res;                                                                                          /* return the result */
 }
 
 /**
- * @brief     enable or disable right channel input pga mute
+ * @brief     enable or disable right dac output to left output mixer
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set right channel input pga mute failed
+ *            - 1 set right dac output to left output mixer failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_right_channel_input_pga_mute(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_right_dac_output_to_left_output_mixer(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_RIGHT_DAC_OUTPUT_TO_LEFT_OUTPUT_MIXER, enable);        /* set field */
+}
+
+/**
+ * @brief      get right dac output to left output mixer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right dac output to left output mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_dac_output_to_left_output_mixer(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                     /* check handle */
-    {
-        return 2;                                                           /* return error */
-    }
-    if (handle->inited != 1)                                                /* check handle initialization */
-    {
-        return 3;                                                           /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_RIGHT_INP_PGA_CTRL, &conf);  /* read config */
-    if (res != 0)                                                           /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");               /* read config failed */
-        
-        return 1;                                                           /* return error */
-    }
-    conf &= ~(1 << 6);                                                      /* clear config */
-    conf |= enable << 6;                                                    /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_RIGHT_INP_PGA_CTRL, conf);  /* write config */
-    if (res != 0)                                                           /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");              /* write config failed */
-        
-        return 1;                                                           /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_RIGHT_DAC_OUTPUT_TO_LEFT_OUTPUT_MIXER, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                                    /* get bool */
     
-    return 0;                                                               /* success return 0 */
+    return res;                                                                                          /* return the result */
 }
 
 /**
- * @brief     set right channel input pga volume
+ * @brief     enable or disable out4 boost
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] volume set volume
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set right channel input pga volume failed
+ *            - 1 set out4 boost failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 volume > 0x3F
  * @note      none
  */
-uint8_t wm8978_set_right_channel_input_pga_volume(wm8978_handle_t *handle, uint8_t volume)
+uint8_t wm8978_set_out4_boost(wm8978_handle_t *handle, wm8978_bool_t enable)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                     /* check handle */
-    {
-        return 2;                                                           /* return error */
-    }
-    if (handle->inited != 1)                                                /* check handle initialization */
-    {
-        return 3;                                                           /* return error */
-    }
-    if (volume > 0x3F)                                                      /* check volume */
-    {
-        handle->debug_print("wm8978: volume > 0x3F.\n");                    /* volume > 0x3F */
-        
-        return 4;                                                           /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_RIGHT_INP_PGA_CTRL, &conf);  /* read config */
-    if (res != 0)                                                           /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");               /* read config failed */
-        
-        return 1;                                                           /* return error */
-    }
-    conf &= ~(0x3F << 0);                                                   /* clear config */
-    conf |= volume << 0;                                                    /* set volume */
-    res = a_wm8978_iic_write(handle, WM8978_REG_RIGHT_INP_PGA_CTRL, conf);  /* write config */
-    if (res != 0)                                                           /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");              /* write config failed */
-        
-        return 1;                                                           /* return error */
-    }
-    
-    return 0;                                                               /* success return 0 */
+    return a_wm8978_field_set(handle, WM8978_FIELD_OUT4_BOOST, enable);        /* set field */
 }
 
 /**
- * @brief      convert the right channel input pga volume to the register raw data
+ * @brief      get out4 boost status
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  db set db
- * @param[out] *reg pointer to a volume raw data buffer
+ * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
+ *             - 1 get out4 boost failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_right_channel_input_pga_volume_convert_to_register(wm8978_handle_t *handle, float db, uint8_t *reg)
+uint8_t wm8978_get_out4_boost(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
-    if (handle == NULL)                        /* check handle */
-    {
-        return 2;                              /* return error */
-    }
-    if (handle->inited != 1)                   /* check handle initialization */
-    {
-        return 3;                              /* return error */
-    }
+    uint8_t res;
+    uint16_t value;
     
-    *reg = (uint8_t)((db + 12.0f) / 0.75f);    /* convert */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_OUT4_BOOST, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                         /* get bool */
     
-    return 0;                                  /* success return 0 */
+    return res;                                                               /* return the result */
 }
 
 /**
- * @brief      convert the right channel input pga volume register raw data to the real data
+ * @brief     enable or disable out3 boost
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set out3 boost failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_out3_boost(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_OUT3_BOOST, enable);        /* set field */
+}
+
+/**
+ * @brief      get out3 boost status
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  reg raw data
- * @param[out] *db pointer to a volume real data buffer
+ * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
+ *             - 1 get out3 boost failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_right_channel_input_pga_volume_convert_to_data(wm8978_handle_t *handle, uint8_t reg, float *db)
+uint8_t wm8978_get_out3_boost(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
-    if (handle == NULL)                    /* check handle */
-    {
-        return 2;                          /* return error */
-    }
-    if (handle->inited != 1)               /* check handle initialization */
-    {
-        return 3;                          /* return error */
-    }
+    uint8_t res;
+    uint16_t value;
     
-    *db = (float)(reg) * 0.75f - 12.0f;    /* convert */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_OUT3_BOOST, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                         /* get bool */
     
-    return 0;                              /* success return 0 */
+    return res;                                                               /* return the result */
 }
 
 /**
- * @brief     enable or disable left channel input pga boost
+ * @brief     enable or disable speaker boost
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set left channel input pga boost failed
+ *            - 1 set speaker boost failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_left_channel_input_pga_boost(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_speaker_boost(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_SPEAKER_BOOST, enable);        /* set field */
+}
+
+/**
+ * @brief      get speaker boost status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get speaker boost failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_speaker_boost(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                            /* check handle */
-    {
-        return 2;                                                                  /* return error */
-    }
-    if (handle->inited != 1)                                                       /* check handle initialization */
-    {
-        return 3;                                                                  /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_LEFT_ADC_BOOST_CTRL, &conf);        /* read config */
-    if (res != 0)                                                                  /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                      /* read config failed */
-        
-        return 1;                                                                  /* return error */
-    }
-    conf &= ~(1 << 8);                                                             /* clear config */
-    conf |= enable << 8;                                                           /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_LEFT_ADC_BOOST_CTRL, conf);        /* write config */
-    if (res != 0)                                                                  /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                     /* write config failed */
-        
-        return 1;                                                                  /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_SPEAKER_BOOST, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                            /* get bool */
     
-    return 0;                                                                      /* success return 0 */
+    return res;                                                                  /* return the result */
 }
 
 /**
- * @brief     set left channel input boost stage
+ * @brief     enable or disable thermal shutdown
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] stage set stage
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set left channel input boost stage failed
+ *            - 1 set thermal shutdown failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 stage > 0x7
  * @note      none
  */
-uint8_t wm8978_set_left_channel_input_boost_stage(wm8978_handle_t *handle, uint8_t stage)
+uint8_t wm8978_set_thermal_shutdown(wm8978_handle_t *handle, wm8978_bool_t enable)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                            /* check handle */
-    {
-        return 2;                                                                  /* return error */
-    }
-    if (handle->inited != 1)                                                       /* check handle initialization */
-    {
-        return 3;                                                                  /* return error */
-    }
-    if (stage > 0x7)                                                               /* check stage */
-    {
-        handle->debug_print("wm8978: stage > 0x7.\n");                             /* stage > 0x7 */
-        
-        return 4;                                                                  /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_LEFT_ADC_BOOST_CTRL, &conf);        /* read config */
-    if (res != 0)                                                                  /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                      /* read config failed */
-        
-        return 1;                                                                  /* return error */
-    }
-    conf &= ~(0x7 << 4);                                                           /* clear config */
-    conf |= stage << 4;                                                            /* set stage */
-    res = a_wm8978_iic_write(handle, WM8978_REG_LEFT_ADC_BOOST_CTRL, conf);        /* write config */
-    if (res != 0)                                                                  /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                     /* write config failed */
-        
-        return 1;                                                                  /* return error */
-    }
-    
-    return 0;                                                                      /* success return 0 */
+    return a_wm8978_field_set(handle, WM8978_FIELD_THERMAL_SHUTDOWN, enable);        /* set field */
 }
 
 /**
- * @brief      convert the left channel input boost stage to the register raw data
+ * @brief      get thermal shutdown status
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  db set db
- * @param[out] *reg pointer to a volume raw data buffer
+ * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
+ *             - 1 get thermal shutdown failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_left_channel_input_boost_stage_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
+uint8_t wm8978_get_thermal_shutdown(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
-    if (handle == NULL)                    /* check handle */
-    {
-        return 2;                          /* return error */
-    }
-    if (handle->inited != 1)               /* check handle initialization */
-    {
-        return 3;                          /* return error */
-    }
+    uint8_t res;
+    uint16_t value;
     
-    *reg = (uint8_t)(db + 15) / 3;         /* convert */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_THERMAL_SHUTDOWN, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                               /* get bool */
     
-    return 0;                              /* success return 0 */
+    return res;                                                                     /* return the result */
 }
 
 /**
- * @brief      convert the left channel input boost stage register raw data to the real data
+ * @brief     set vref to analogue output resistance
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] vref set vref
+ * @return    status code
+ *            - 0 success
+ *            - 1 set vref to analogue output resistance failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_vref_to_analogue_output_resistance(wm8978_handle_t *handle, wm8978_vref_t vref)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_VREF_TO_ANALOGUE_OUTPUT_RESISTANCE, vref);        /* set field */
+}
+
+/**
+ * @brief      get vref to analogue output resistance
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  reg raw data
- * @param[out] *db pointer to a db real data buffer
+ * @param[out] *vref pointer to a vref buffer
  * @return     status code
  *             - 0 success
+ *             - 1 get vref to analogue output resistance failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_left_channel_input_boost_stage_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
+uint8_t wm8978_get_vref_to_analogue_output_resistance(wm8978_handle_t *handle, wm8978_vref_t *vref)
 {
-    if (handle == NULL)                 /* check handle */
-    {
-        return 2;                       /* return error */
-    }
-    if (handle->inited != 1)            /* check handle initialization */
-    {
-        return 3;                       /* return error */
-    }
+    uint8_t res;
+    uint16_t value;
     
-    *db = (int8_t)(reg * 3 - 15);       /* convert */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_VREF_TO_ANALOGUE_OUTPUT_RESISTANCE, &value);        /* get field */
+    *vref = (wm8978_vref_t)(value);                                                                   /* get vref */
     
-    return 0;                           /* success return 0 */
+    return res;                                                                                       /* return the result */
 }
 
 /**
- * @brief     set auxiliary amplifier left channel input boost stage
+ * @brief     set aux left channel input to left mixer volume
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] stage set stage
+ * @param[in] vol set vol
  * @return    status code
  *            - 0 success
- *            - 1 set auxiliary amplifier left channel input boost stage failed
+ *            - 1 set aux left channel input to left mixer volume failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 stage > 0x7
+ *            - 4 vol > 0x7
  * @note      none
  */
-uint8_t wm8978_set_auxiliary_amplifier_left_channel_input_boost_stage(wm8978_handle_t *handle, uint8_t stage)
+uint8_t wm8978_set_aux_left_channel_input_to_left_mixer_volume(wm8978_handle_t *handle, uint8_t vol)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_AUX_LEFT_CHANNEL_INPUT_TO_LEFT_MIXER_VOLUME, vol);        /* set field */
+}
+
+/**
+ * @brief      get aux left channel input to left mixer volume
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *vol pointer to a vol buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get aux left channel input to left mixer volume failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_aux_left_channel_input_to_left_mixer_volume(wm8978_handle_t *handle, uint8_t *vol)
 {
     uint8_t res;
-    uint16_t conf;
+    uint16_t value;
     
-    if (handle == NULL)                                                            /* check handle */
-    {
-        return 2;                                                                  /* return error */
-    }
-    if (handle->inited != 1)                                                       /* check handle initialization */
-    {
-        return 3;                                                                  /* return error */
-    }
-    if (stage > 0x7)                                                               /* check stage */
-    {
-        handle->debug_print("wm8978: stage > 0x7.\n");                             /* stage > 0x7 */
-        
-        return 4;                                                                  /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_LEFT_ADC_BOOST_CTRL, &conf);        /* read config */
-    if (res != 0)                                                                  /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                      /* read config failed */
-        
-        return 1;                                                                  /* return error */
-    }
-    conf &= ~(0x7 << 0);                                                           /* clear config */
-    conf |= stage << 0;                                                            /* set stage */
-    res = a_wm8978_iic_write(handle, WM8978_REG_LEFT_ADC_BOOST_CTRL, conf);        /* write config */
-    if (res != 0)                                                                  /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                     /* write config failed */
-        
-        return 1;                                                                  /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_AUX_LEFT_CHANNEL_INPUT_TO_LEFT_MIXER_VOLUME, &value);        /* get field */
+    *vol = (uint8_t)(value);                                                                                   /* get vol */
     
-    return 0;                                                                      /* success return 0 */
+    return res;                                                                                                /* return the result */
 }
 
 /**
- * @brief      convert the auxiliary amplifier left channel input boost stage to the register raw data
+ * @brief      convert the aux left channel input to left mixer volume to the register raw data
  * @param[in]  *handle pointer to a wm8978 handle structure
  * @param[in]  db set db
- * @param[out] *reg pointer to a volume raw data buffer
+ * @param[out] *reg pointer to a db raw data buffer
  * @return     status code
  *             - 0 success
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_auxiliary_amplifier_left_channel_input_boost_stage_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
+uint8_t wm8978_aux_left_channel_input_to_left_mixer_volume_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
 {
     if (handle == NULL)                    /* check handle */
     {
@@ -6549,7 +7448,7 @@ uint8_t wm8978_auxiliary_amplifier_left_channel_input_boost_stage_convert_to_reg
 }
 
 /**
- * @brief      convert the auxiliary amplifier left channel input boost stage register raw data to the real data
+ * @brief      convert the aux left channel input to left mixer volume register raw data to the real data
  * @param[in]  *handle pointer to a wm8978 handle structure
  * @param[in]  reg raw data
  * @param[out] *db pointer to a db real data buffer
@@ -6559,7 +7458,7 @@ uint8_t wm8978_auxiliary_amplifier_left_channel_input_boost_stage_convert_to_reg
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_auxiliary_amplifier_left_channel_input_boost_stage_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
+uint8_t wm8978_aux_left_channel_input_to_left_mixer_volume_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
 {
     if (handle == NULL)                 /* check handle */
     {
@@ -6576,114 +7475,94 @@ uint8_t wm8978_auxiliary_amplifier_left_channel_input_boost_stage_convert_to_dat
 }
 
 /**
- * @brief     enable or disable right channel input pga boost
+ * @brief     enable or disable left auxiliary input to left channel output mixer
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set right channel input pga boost failed
+ *            - 1 set left auxiliary input to left channel output mixer failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_right_channel_input_pga_boost(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_left_auxiliary_input_to_left_channel_output_mixer(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LEFT_AUXILIARY_INPUT_TO_LEFT_CHANNEL_OUTPUT_MIXER, enable);        /* set field */
+}
+
+/**
+ * @brief      get left auxiliary input to left channel output mixer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left auxiliary input to left channel output mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_auxiliary_input_to_left_channel_output_mixer(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                            /* check handle */
-    {
-        return 2;                                                                  /* return error */
-    }
-    if (handle->inited != 1)                                                       /* check handle initialization */
-    {
-        return 3;                                                                  /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_RIGHT_ADC_BOOST_CTRL, &conf);       /* read config */
-    if (res != 0)                                                                  /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                      /* read config failed */
-        
-        return 1;                                                                  /* return error */
-    }
-    conf &= ~(1 << 8);                                                             /* clear config */
-    conf |= enable << 8;                                                           /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_RIGHT_ADC_BOOST_CTRL, conf);       /* write config */
-    if (res != 0)                                                                  /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                     /* write config failed */
-        
-        return 1;                                                                  /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LEFT_AUXILIARY_INPUT_TO_LEFT_CHANNEL_OUTPUT_MIXER, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                                                /* get bool */
     
-    return 0;                                                                      /* success return 0 */
+    return res;                                                                                                      /* return the result */
 }
 
 /**
- * @brief     set right channel input boost stage
+ * @brief     set left bypass volume control to output channel mixer
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] stage set stage
+ * @param[in] vol set vol
  * @return    status code
  *            - 0 success
- *            - 1 set right channel input boost stage failed
+ *            - 1 set left bypass volume control to output channel mixer failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 stage > 0x7
+ *            - 4 vol > 0x7
  * @note      none
  */
-uint8_t wm8978_set_right_channel_input_boost_stage(wm8978_handle_t *handle, uint8_t stage)
+uint8_t wm8978_set_left_bypass_volume_control_to_output_channel_mixer(wm8978_handle_t *handle, uint8_t vol)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LEFT_BYPASS_VOLUME_CONTROL_TO_OUTPUT_CHANNEL_MIXER, vol);        /* set field */
+}
+
+/**
+ * @brief      get left bypass volume control to output channel mixer
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *vol pointer to a vol buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left bypass volume control to output channel mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_bypass_volume_control_to_output_channel_mixer(wm8978_handle_t *handle, uint8_t *vol)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                            /* check handle */
-    {
-        return 2;                                                                  /* return error */
-    }
-    if (handle->inited != 1)                                                       /* check handle initialization */
-    {
-        return 3;                                                                  /* return error */
-    }
-    if (stage > 0x7)                                                               /* check stage */
-    {
-        handle->debug_print("wm8978: stage > 0x7.\n");                             /* stage > 0x7 */
-        
-        return 4;                                                                  /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_RIGHT_ADC_BOOST_CTRL, &conf);       /* read config */
-    if (res != 0)                                                                  /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                      /* read config failed */
-        
-        return 1;                                                                  /* return error */
-    }
-    conf &= ~(0x7 << 4);                                                           /* clear config */
-    conf |= stage << 4;                                                            /* set stage */
-    res = a_wm8978_iic_write(handle, WM8978_REG_RIGHT_ADC_BOOST_CTRL, conf);       /* write config */
-    if (res != 0)                                                                  /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                     /* write config failed */
-        
-        return 1;                                                                  /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LEFT_BYPASS_VOLUME_CONTROL_TO_OUTPUT_CHANNEL_MIXER, &value);        /* get field */
+    *vol = (uint8_t)(value);                                                                                          /* get vol */
     
-    return 0;                                                                      /* success return 0 */
+    return res;                                                                                                       /* return the result */
 }
 
 /**
- * @brief      convert the right channel input boost stage to the register raw data
+ * @brief      convert the left bypass volume control to output channel mixer to the register raw data
  * @param[in]  *handle pointer to a wm8978 handle structure
  * @param[in]  db set db
- * @param[out] *reg pointer to a volume raw data buffer
+ * @param[out] *reg pointer to a db raw data buffer
  * @return     status code
  *             - 0 success
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_right_channel_input_boost_stage_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
+uint8_t wm8978_left_bypass_volume_control_to_output_channel_mixer_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
 {
     if (handle == NULL)                    /* check handle */
     {
@@ -6700,7 +7579,7 @@ uint8_t wm8978_right_channel_input_boost_stage_convert_to_register(wm8978_handle
 }
 
 /**
- * @brief      convert the right channel input boost stage register raw data to the real data
+ * @brief      convert the left bypass volume control to output channel mixer register raw data to the real data
  * @param[in]  *handle pointer to a wm8978 handle structure
  * @param[in]  reg raw data
  * @param[out] *db pointer to a db real data buffer
@@ -6710,7 +7589,7 @@ uint8_t wm8978_right_channel_input_boost_stage_convert_to_register(wm8978_handle
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_right_channel_input_boost_stage_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
+uint8_t wm8978_left_bypass_volume_control_to_output_channel_mixer_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
 {
     if (handle == NULL)                 /* check handle */
     {
@@ -6727,631 +7606,536 @@ uint8_t wm8978_right_channel_input_boost_stage_convert_to_data(wm8978_handle_t *
 }
 
 /**
- * @brief     set auxiliary amplifier right channel input boost stage
+ * @brief     enable or disable left bypass path to left output mixer
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] stage set stage
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set auxiliary amplifier right channel input boost stage failed
+ *            - 1 set left bypass path to left output mixer failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 stage > 0x7
  * @note      none
  */
-uint8_t wm8978_set_auxiliary_amplifier_right_channel_input_boost_stage(wm8978_handle_t *handle, uint8_t stage)
+uint8_t wm8978_set_left_bypass_path_to_left_output_mixer(wm8978_handle_t *handle, wm8978_bool_t enable)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                            /* check handle */
-    {
-        return 2;                                                                  /* return error */
-    }
-    if (handle->inited != 1)                                                       /* check handle initialization */
-    {
-        return 3;                                                                  /* return error */
-    }
-    if (stage > 0x7)                                                               /* check stage */
-    {
-        handle->debug_print("wm8978: stage > 0x7.\n");                             /* stage > 0x7 */
-        
-        return 4;                                                                  /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_RIGHT_ADC_BOOST_CTRL, &conf);       /* read config */
-    if (res != 0)                                                                  /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                      /* read config failed */
-        
-        return 1;                                                                  /* return error */
-    }
-    conf &= ~(0x7 << 0);                                                           /* clear config */
-    conf |= stage << 0;                                                            /* set stage */
-    res = a_wm8978_iic_write(handle, WM8978_REG_RIGHT_ADC_BOOST_CTRL, conf);       /* write config */
-    if (res != 0)                                                                  /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                     /* write config failed */
-        
-        return 1;                                                                  /* return error */
-    }
-    
-    return 0;                                                                      /* success return 0 */
+    return a_wm8978_field_set(handle, WM8978_FIELD_LEFT_BYPASS_PATH_TO_LEFT_OUTPUT_MIXER, enable);        /* set field */
 }
 
 /**
- * @brief      convert the auxiliary amplifier right channel input boost stage to the register raw data
+ * @brief      get left bypass path to left output mixer status
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  db set db
- * @param[out] *reg pointer to a db raw data buffer
+ * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
+ *             - 1 get left bypass path to left output mixer failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_auxiliary_amplifier_right_channel_input_boost_stage_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
+uint8_t wm8978_get_left_bypass_path_to_left_output_mixer(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
-    if (handle == NULL)                    /* check handle */
-    {
-        return 2;                          /* return error */
-    }
-    if (handle->inited != 1)               /* check handle initialization */
-    {
-        return 3;                          /* return error */
-    }
+    uint8_t res;
+    uint16_t value;
     
-    *reg = (uint8_t)(db + 15) / 3;         /* convert */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LEFT_BYPASS_PATH_TO_LEFT_OUTPUT_MIXER, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                                    /* get bool */
     
-    return 0;                              /* success return 0 */
+    return res;                                                                                          /* return the result */
 }
 
 /**
- * @brief      convert the auxiliary amplifier right channel input boost stage register raw data to the real data
+ * @brief     enable or disable left dac output to left output mixer
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set left dac output to left output mixer failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_left_dac_output_to_left_output_mixer(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LEFT_DAC_OUTPUT_TO_LEFT_OUTPUT_MIXER, enable);        /* set field */
+}
+
+/**
+ * @brief      get left dac output to left output mixer status
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  reg raw data
- * @param[out] *db pointer to a db real data buffer
+ * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
+ *             - 1 get left dac output to left output mixer failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_auxiliary_amplifier_right_channel_input_boost_stage_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
+uint8_t wm8978_get_left_dac_output_to_left_output_mixer(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
-    if (handle == NULL)                 /* check handle */
-    {
-        return 2;                       /* return error */
-    }
-    if (handle->inited != 1)            /* check handle initialization */
-    {
-        return 3;                       /* return error */
-    }
+    uint8_t res;
+    uint16_t value;
     
-    *db = (int8_t)(reg * 3 - 15);       /* convert */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LEFT_DAC_OUTPUT_TO_LEFT_OUTPUT_MIXER, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                                   /* get bool */
     
-    return 0;                           /* success return 0 */
+    return res;                                                                                         /* return the result */
 }
 
 /**
- * @brief     enable or disable left dac output to right output mixer
+ * @brief     set aux right channel input to right mixer volume
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
+ * @param[in] vol set vol
  * @return    status code
  *            - 0 success
- *            - 1 set left dac output to right output mixer failed
+ *            - 1 set aux right channel input to right mixer volume failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
+ *            - 4 vol > 0x7
  * @note      none
  */
-uint8_t wm8978_set_left_dac_output_to_right_output_mixer(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_aux_right_channel_input_to_right_mixer_volume(wm8978_handle_t *handle, uint8_t vol)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                   /* check handle */
-    {
-        return 2;                                                         /* return error */
-    }
-    if (handle->inited != 1)                                              /* check handle initialization */
-    {
-        return 3;                                                         /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_OUTPUT_CTRL, &conf);       /* read config */
-    if (res != 0)                                                         /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");             /* read config failed */
-        
-        return 1;                                                         /* return error */
-    }
-    conf &= ~(1 << 6);                                                    /* clear config */
-    conf |= enable << 6;                                                  /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_OUTPUT_CTRL, conf);       /* write config */
-    if (res != 0)                                                         /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");            /* write config failed */
-        
-        return 1;                                                         /* return error */
-    }
-    
-    return 0;                                                             /* success return 0 */
+    return a_wm8978_field_set(handle, WM8978_FIELD_AUX_RIGHT_CHANNEL_INPUT_TO_RIGHT_MIXER_VOLUME, vol);        /* set field */
 }
 
 /**
- * @brief     enable or disable right dac output to left output mixer
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
- * @return    status code
- *            - 0 success
- *            - 1 set right dac output to left output mixer failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      get aux right channel input to right mixer volume
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *vol pointer to a vol buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get aux right channel input to right mixer volume failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
  */
-uint8_t wm8978_set_right_dac_output_to_left_output_mixer(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_get_aux_right_channel_input_to_right_mixer_volume(wm8978_handle_t *handle, uint8_t *vol)
 {
     uint8_t res;
-    uint16_t conf;
+    uint16_t value;
     
-    if (handle == NULL)                                                   /* check handle */
-    {
-        return 2;                                                         /* return error */
-    }
-    if (handle->inited != 1)                                              /* check handle initialization */
-    {
-        return 3;                                                         /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_AUX_RIGHT_CHANNEL_INPUT_TO_RIGHT_MIXER_VOLUME, &value);        /* get field */
+    *vol = (uint8_t)(value);                                                                                     /* get vol */
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_OUTPUT_CTRL, &conf);       /* read config */
-    if (res != 0)                                                         /* check error */
+    return res;                                                                                                  /* return the result */
+}
+
+/**
+ * @brief      convert the aux right channel input to right mixer volume to the register raw data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  db set db
+ * @param[out] *reg pointer to a db raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_aux_right_channel_input_to_right_mixer_volume_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
+{
+    if (handle == NULL)                    /* check handle */
     {
-        handle->debug_print("wm8978: read config failed.\n");             /* read config failed */
-        
-        return 1;                                                         /* return error */
+        return 2;                          /* return error */
     }
-    conf &= ~(1 << 5);                                                    /* clear config */
-    conf |= enable << 5;                                                  /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_OUTPUT_CTRL, conf);       /* write config */
-    if (res != 0)                                                         /* check error */
+    if (handle->inited != 1)               /* check handle initialization */
     {
-        handle->debug_print("wm8978: write config failed.\n");            /* write config failed */
-        
-        return 1;                                                         /* return error */
+        return 3;                          /* return error */
     }
     
-    return 0;                                                             /* success return 0 */
+    *reg = (uint8_t)(db + 15) / 3;         /* convert */
+    
+    return 0;                              /* success return 0 */
 }
 
 /**
- * @brief     enable or disable out4 boost
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
- * @return    status code
- *            - 0 success
- *            - 1 set out4 boost failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      convert the aux right channel input to right mixer volume raw data to the real data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  reg raw data
+ * @param[out] *db pointer to a db real data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
  */
-uint8_t wm8978_set_out4_boost(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_aux_right_channel_input_to_right_mixer_volume_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                   /* check handle */
+    if (handle == NULL)                 /* check handle */
     {
-        return 2;                                                         /* return error */
+        return 2;                       /* return error */
     }
-    if (handle->inited != 1)                                              /* check handle initialization */
+    if (handle->inited != 1)            /* check handle initialization */
     {
-        return 3;                                                         /* return error */
+        return 3;                       /* return error */
     }
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_OUTPUT_CTRL, &conf);       /* read config */
-    if (res != 0)                                                         /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");             /* read config failed */
-        
-        return 1;                                                         /* return error */
-    }
-    conf &= ~(1 << 4);                                                    /* clear config */
-    conf |= enable << 4;                                                  /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_OUTPUT_CTRL, conf);       /* write config */
-    if (res != 0)                                                         /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");            /* write config failed */
-        
-        return 1;                                                         /* return error */
-    }
+    *db = (int8_t)(reg * 3 - 15);       /* convert */
     
-    return 0;                                                             /* success return 0 */
+    return 0;                           /* success return 0 */
 }
 
 /**
- * @brief     enable or disable out3 boost
+ * @brief     enable or disable right auxiliary input to right channel output mixer
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set out3 boost failed
+ *            - 1 set right auxiliary input to right channel output mixer failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_out3_boost(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_right_auxiliary_input_to_right_channel_output_mixer(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_RIGHT_AUXILIARY_INPUT_TO_RIGHT_CHANNEL_OUTPUT_MIXER, enable);        /* set field */
+}
+
+/**
+ * @brief      get right auxiliary input to right channel output mixer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right auxiliary input to right channel output mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_auxiliary_input_to_right_channel_output_mixer(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                   /* check handle */
-    {
-        return 2;                                                         /* return error */
-    }
-    if (handle->inited != 1)                                              /* check handle initialization */
-    {
-        return 3;                                                         /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_OUTPUT_CTRL, &conf);       /* read config */
-    if (res != 0)                                                         /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");             /* read config failed */
-        
-        return 1;                                                         /* return error */
-    }
-    conf &= ~(1 << 3);                                                    /* clear config */
-    conf |= enable << 3;                                                  /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_OUTPUT_CTRL, conf);       /* write config */
-    if (res != 0)                                                         /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");            /* write config failed */
-        
-        return 1;                                                         /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_RIGHT_AUXILIARY_INPUT_TO_RIGHT_CHANNEL_OUTPUT_MIXER, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                                                  /* get bool */
     
-    return 0;                                                             /* success return 0 */
+    return res;                                                                                                        /* return the result */
 }
 
 /**
- * @brief     enable or disable speaker boost
+ * @brief     set right bypass volume control to output channel mixer
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
+ * @param[in] vol set vol
  * @return    status code
  *            - 0 success
- *            - 1 set speaker boost failed
+ *            - 1 set right bypass volume control to output channel mixer failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
+ *            - 4 vol > 0x7
  * @note      none
  */
-uint8_t wm8978_set_speaker_boost(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_right_bypass_volume_control_to_output_channel_mixer(wm8978_handle_t *handle, uint8_t vol)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_RIGHT_BYPASS_VOLUME_CONTROL_TO_OUTPUT_CHANNEL_MIXER, vol);        /* set field */
+}
+
+/**
+ * @brief      get right bypass volume control to output channel mixer
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *vol pointer to a vol buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right bypass volume control to output channel mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_bypass_volume_control_to_output_channel_mixer(wm8978_handle_t *handle, uint8_t *vol)
 {
     uint8_t res;
-    uint16_t conf;
+    uint16_t value;
     
-    if (handle == NULL)                                                   /* check handle */
-    {
-        return 2;                                                         /* return error */
-    }
-    if (handle->inited != 1)                                              /* check handle initialization */
-    {
-        return 3;                                                         /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_RIGHT_BYPASS_VOLUME_CONTROL_TO_OUTPUT_CHANNEL_MIXER, &value);        /* get field */
+    *vol = (uint8_t)(value);                                                                                           /* get vol */
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_OUTPUT_CTRL, &conf);       /* read config */
-    if (res != 0)                                                         /* check error */
+    return res;                                                                                                        /* return the result */
+}
+
+/**
+ * @brief      convert the right bypass volume control to output channel mixer to the register raw data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  db set db
+ * @param[out] *reg pointer to a db raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_right_bypass_volume_control_to_output_channel_mixer_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
+{
+    if (handle == NULL)                    /* check handle */
     {
-        handle->debug_print("wm8978: read config failed.\n");             /* read config failed */
-        
-        return 1;                                                         /* return error */
+        return 2;                          /* return error */
     }
-    conf &= ~(1 << 2);                                                    /* clear config */
-    conf |= enable << 2;                                                  /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_OUTPUT_CTRL, conf);       /* write config */
-    if (res != 0)                                                         /* check error */
+    if (handle->inited != 1)               /* check handle initialization */
     {
-        handle->debug_print("wm8978: write config failed.\n");            /* write config failed */
-        
-        return 1;                                                         /* return error */
+        return 3;                          /* return error */
     }
     
-    return 0;                                                             /* success return 0 */
+    *reg = (uint8_t)(db + 15) / 3;         /* convert */
+    
+    return 0;                              /* success return 0 */
 }
 
 /**
- * @brief     enable or disable thermal shutdown
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
- * @return    status code
- *            - 0 success
- *            - 1 set thermal shutdown failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      convert the right bypass volume control to output channel mixer raw data to the real data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  reg raw data
+ * @param[out] *db pointer to a db real data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
  */
-uint8_t wm8978_set_thermal_shutdown(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_right_bypass_volume_control_to_output_channel_mixer_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                   /* check handle */
+    if (handle == NULL)                 /* check handle */
     {
-        return 2;                                                         /* return error */
+        return 2;                       /* return error */
     }
-    if (handle->inited != 1)                                              /* check handle initialization */
+    if (handle->inited != 1)            /* check handle initialization */
     {
-        return 3;                                                         /* return error */
+        return 3;                       /* return error */
     }
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_OUTPUT_CTRL, &conf);       /* read config */
-    if (res != 0)                                                         /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");             /* read config failed */
-        
-        return 1;                                                         /* return error */
-    }
-    conf &= ~(1 << 1);                                                    /* clear config */
-    conf |= enable << 1;                                                  /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_OUTPUT_CTRL, conf);       /* write config */
-    if (res != 0)                                                         /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");            /* write config failed */
-        
-        return 1;                                                         /* return error */
-    }
+    *db = (int8_t)(reg * 3 - 15);       /* convert */
     
-    return 0;                                                             /* success return 0 */
+    return 0;                           /* success return 0 */
 }
 
 /**
- * @brief     set vref to analogue output resistance
+ * @brief     enable or disable right bypass path to right output mixer
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] vref set vref
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set vref to analogue output resistance failed
+ *            - 1 set right bypass path to right output mixer failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_vref_to_analogue_output_resistance(wm8978_handle_t *handle, wm8978_vref_t vref)
+uint8_t wm8978_set_right_bypass_path_to_right_output_mixer(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_RIGHT_BYPASS_PATH_TO_RIGHT_OUTPUT_MIXER, enable);        /* set field */
+}
+
+/**
+ * @brief      get right bypass path to right output mixer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right bypass path to right output mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_bypass_path_to_right_output_mixer(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                   /* check handle */
-    {
-        return 2;                                                         /* return error */
-    }
-    if (handle->inited != 1)                                              /* check handle initialization */
-    {
-        return 3;                                                         /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_OUTPUT_CTRL, &conf);       /* read config */
-    if (res != 0)                                                         /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");             /* read config failed */
-        
-        return 1;                                                         /* return error */
-    }
-    conf &= ~(1 << 0);                                                    /* clear config */
-    conf |= vref << 0;                                                    /* set vref */
-    res = a_wm8978_iic_write(handle, WM8978_REG_OUTPUT_CTRL, conf);       /* write config */
-    if (res != 0)                                                         /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");            /* write config failed */
-        
-        return 1;                                                         /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_RIGHT_BYPASS_PATH_TO_RIGHT_OUTPUT_MIXER, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                                      /* get bool */
     
-    return 0;                                                             /* success return 0 */
+    return res;                                                                                            /* return the result */
 }
 
 /**
- * @brief     set aux left channel input to left mixer volume
+ * @brief     enable or disable right dac output to right output mixer
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] vol set vol
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set aux left channel input to left mixer volume failed
+ *            - 1 set right dac output to right output mixer failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 vol > 0x7
  * @note      none
  */
-uint8_t wm8978_set_aux_left_channel_input_to_left_mixer_volume(wm8978_handle_t *handle, uint8_t vol)
+uint8_t wm8978_set_right_dac_output_to_right_output_mixer(wm8978_handle_t *handle, wm8978_bool_t enable)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
-    if (vol > 0x7)                                                            /* check vol */
-    {
-        handle->debug_print("wm8978: vol > 0x7.\n");                          /* vol > 0x7 */
-        
-        return 4;                                                             /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_LEFT_MIXER_CTRL, &conf);       /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(7 << 6);                                                        /* clear config */
-    conf |= vol << 6;                                                         /* set vol */
-    res = a_wm8978_iic_write(handle, WM8978_REG_LEFT_MIXER_CTRL, conf);       /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    return a_wm8978_field_set(handle, WM8978_FIELD_RIGHT_DAC_OUTPUT_TO_RIGHT_OUTPUT_MIXER, enable);        /* set field */
+}
+
+/**
+ * @brief      get right dac output to right output mixer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right dac output to right output mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_dac_output_to_right_output_mixer(wm8978_handle_t *handle, wm8978_bool_t *enable)
+{
+    uint8_t res;
+    uint16_t value;
     
-    return 0;                                                                 /* success return 0 */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_RIGHT_DAC_OUTPUT_TO_RIGHT_OUTPUT_MIXER, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                                     /* get bool */
+    
+    return res;                                                                                           /* return the result */
 }
 
 /**
- * @brief      convert the aux left channel input to left mixer volume to the register raw data
+ * @brief     enable or disable lout1 update
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set lout1 update failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_lout1_update(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LOUT1_UPDATE, enable);        /* set field */
+}
+
+/**
+ * @brief      get lout1 update status
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  db set db
- * @param[out] *reg pointer to a db raw data buffer
+ * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
+ *             - 1 get lout1 update failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_aux_left_channel_input_to_left_mixer_volume_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
+uint8_t wm8978_get_lout1_update(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
-    if (handle == NULL)                    /* check handle */
-    {
-        return 2;                          /* return error */
-    }
-    if (handle->inited != 1)               /* check handle initialization */
-    {
-        return 3;                          /* return error */
-    }
+    uint8_t res;
+    uint16_t value;
     
-    *reg = (uint8_t)(db + 15) / 3;         /* convert */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LOUT1_UPDATE, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                           /* get bool */
     
-    return 0;                              /* success return 0 */
+    return res;                                                                 /* return the result */
 }
 
 /**
- * @brief      convert the aux left channel input to left mixer volume register raw data to the real data
+ * @brief     enable or disable lout1 headphone volume zero cross
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set lout1 headphone volume zero cross failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_lout1_headphone_volume_zero_cross(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LOUT1_HEADPHONE_VOLUME_ZERO_CROSS, enable);        /* set field */
+}
+
+/**
+ * @brief      get lout1 headphone volume zero cross status
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  reg raw data
- * @param[out] *db pointer to a db real data buffer
+ * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
+ *             - 1 get lout1 headphone volume zero cross failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_aux_left_channel_input_to_left_mixer_volume_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
+uint8_t wm8978_get_lout1_headphone_volume_zero_cross(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
-    if (handle == NULL)                 /* check handle */
-    {
-        return 2;                       /* return error */
-    }
-    if (handle->inited != 1)            /* check handle initialization */
-    {
-        return 3;                       /* return error */
-    }
+    uint8_t res;
+    uint16_t value;
     
-    *db = (int8_t)(reg * 3 - 15);       /* convert */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LOUT1_HEADPHONE_VOLUME_ZERO_CROSS, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                                /* get bool */
     
-    return 0;                           /* success return 0 */
+    return res;                                                                                      /* return the result */
 }
 
 /**
- * @brief     enable or disable left auxiliary input to left channel output mixer
+ * @brief     enable or disable lout1 left headphone output mute
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set left auxiliary input to left channel output mixer failed
+ *            - 1 set lout1 left headphone output mute failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_left_auxiliary_input_to_left_channel_output_mixer(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_lout1_left_headphone_output_mute(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LOUT1_LEFT_HEADPHONE_OUTPUT_MUTE, enable);        /* set field */
+}
+
+/**
+ * @brief      get lout1 left headphone output mute status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get lout1 left headphone output mute failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_lout1_left_headphone_output_mute(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_LEFT_MIXER_CTRL, &conf);       /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 5);                                                        /* clear config */
-    conf |= enable << 5;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_LEFT_MIXER_CTRL, conf);       /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LOUT1_LEFT_HEADPHONE_OUTPUT_MUTE, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                               /* get bool */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                                                     /* return the result */
 }
 
 /**
- * @brief     set left bypass volume control to output channel mixer
+ * @brief     set lout1 left headphone output volume
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] vol set vol
+ * @param[in] vol set volume
  * @return    status code
  *            - 0 success
- *            - 1 set left bypass volume control to output channel mixer failed
+ *            - 1 set lout1 left headphone output volume failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 vol > 0x7
+ *            - 4 vol > 0x3F
  * @note      none
  */
-uint8_t wm8978_set_left_bypass_volume_control_to_output_channel_mixer(wm8978_handle_t *handle, uint8_t vol)
+uint8_t wm8978_set_lout1_left_headphone_output_volume(wm8978_handle_t *handle, uint8_t vol)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LOUT1_LEFT_HEADPHONE_OUTPUT_VOLUME, vol);        /* set field */
+}
+
+/**
+ * @brief      get lout1 left headphone output volume
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *vol pointer to a volume buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get lout1 left headphone output volume failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_lout1_left_headphone_output_volume(wm8978_handle_t *handle, uint8_t *vol)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
-    if (vol > 0x7)                                                            /* check vol */
-    {
-        handle->debug_print("wm8978: vol > 0x7.\n");                          /* vol > 0x7 */
-        
-        return 4;                                                             /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_LEFT_MIXER_CTRL, &conf);       /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(7 << 2);                                                        /* clear config */
-    conf |= vol << 2;                                                         /* set vol */
-    res = a_wm8978_iic_write(handle, WM8978_REG_LEFT_MIXER_CTRL, conf);       /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LOUT1_LEFT_HEADPHONE_OUTPUT_VOLUME, &value);        /* get field */
+    *vol = (uint8_t)(value);                                                                          /* get vol */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                                                       /* return the result */
 }
 
 /**
- * @brief      convert the left bypass volume control to output channel mixer to the register raw data
+ * @brief      convert the lout1 left headphone output volume to the register raw data
  * @param[in]  *handle pointer to a wm8978 handle structure
  * @param[in]  db set db
  * @param[out] *reg pointer to a db raw data buffer
@@ -7361,24 +8145,24 @@ uint8_t wm8978_set_left_bypass_volume_control_to_output_channel_mixer(wm8978_han
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_left_bypass_volume_control_to_output_channel_mixer_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
+uint8_t wm8978_lout1_left_headphone_output_volume_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
 {
-    if (handle == NULL)                    /* check handle */
+    if (handle == NULL)                /* check handle */
     {
-        return 2;                          /* return error */
+        return 2;                      /* return error */
     }
-    if (handle->inited != 1)               /* check handle initialization */
+    if (handle->inited != 1)           /* check handle initialization */
     {
-        return 3;                          /* return error */
+        return 3;                      /* return error */
     }
     
-    *reg = (uint8_t)(db + 15) / 3;         /* convert */
+    *reg = (uint8_t)(db + 57);         /* convert */
     
-    return 0;                              /* success return 0 */
+    return 0;                          /* success return 0 */
 }
 
 /**
- * @brief      convert the left bypass volume control to output channel mixer register raw data to the real data
+ * @brief      convert the lout1 left headphone output volume raw data to the real data
  * @param[in]  *handle pointer to a wm8978 handle structure
  * @param[in]  reg raw data
  * @param[out] *db pointer to a db real data buffer
@@ -7388,166 +8172,177 @@ uint8_t wm8978_left_bypass_volume_control_to_output_channel_mixer_convert_to_reg
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_left_bypass_volume_control_to_output_channel_mixer_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
+uint8_t wm8978_lout1_left_headphone_output_volume_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
 {
-    if (handle == NULL)                 /* check handle */
+    if (handle == NULL)             /* check handle */
     {
-        return 2;                       /* return error */
+        return 2;                   /* return error */
     }
-    if (handle->inited != 1)            /* check handle initialization */
+    if (handle->inited != 1)        /* check handle initialization */
     {
-        return 3;                       /* return error */
+        return 3;                   /* return error */
     }
     
-    *db = (int8_t)(reg * 3 - 15);       /* convert */
+    *db = (int8_t)(reg - 57);       /* convert */
     
-    return 0;                           /* success return 0 */
+    return 0;                       /* success return 0 */
 }
 
 /**
- * @brief     enable or disable left bypass path to left output mixer
+ * @brief     enable or disable rout1 update
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set left bypass path to left output mixer failed
+ *            - 1 set rout1 update failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_left_bypass_path_to_left_output_mixer(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_rout1_update(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_ROUT1_UPDATE, enable);        /* set field */
+}
+
+/**
+ * @brief      get rout1 update status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get rout1 update failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_rout1_update(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
+    uint16_t value;
     
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_ROUT1_UPDATE, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                           /* get bool */
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_LEFT_MIXER_CTRL, &conf);       /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 1);                                                        /* clear config */
-    conf |= enable << 1;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_LEFT_MIXER_CTRL, conf);       /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    return res;                                                                 /* return the result */
+}
+
+/**
+ * @brief     enable or disable rout1 headphone volume zero cross
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set rout1 headphone volume zero cross failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_rout1_headphone_volume_zero_cross(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_ROUT1_HEADPHONE_VOLUME_ZERO_CROSS, enable);        /* set field */
+}
+
+/**
+ * @brief      get rout1 headphone volume zero cross status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get rout1 headphone volume zero cross failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_rout1_headphone_volume_zero_cross(wm8978_handle_t *handle, wm8978_bool_t *enable)
+{
+    uint8_t res;
+    uint16_t value;
     
-    return 0;                                                                 /* success return 0 */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_ROUT1_HEADPHONE_VOLUME_ZERO_CROSS, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                                /* get bool */
+    
+    return res;                                                                                      /* return the result */
 }
 
 /**
- * @brief     enable or disable left dac output to left output mixer
+ * @brief     enable or disable rout1 right headphone output mute
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set left dac output to left output mixer failed
+ *            - 1 set rout1 right headphone output mute failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_left_dac_output_to_left_output_mixer(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_rout1_right_headphone_output_mute(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_ROUT1_RIGHT_HEADPHONE_OUTPUT_MUTE, enable);        /* set field */
+}
+
+/**
+ * @brief      get rout1 right headphone output mute status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get rout1 right headphone output mute failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_rout1_right_headphone_output_mute(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_LEFT_MIXER_CTRL, &conf);       /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 0);                                                        /* clear config */
-    conf |= enable << 0;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_LEFT_MIXER_CTRL, conf);       /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_ROUT1_RIGHT_HEADPHONE_OUTPUT_MUTE, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                                /* get bool */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                                                      /* return the result */
 }
 
 /**
- * @brief     set aux right channel input to right mixer volume
+ * @brief     set rout1 right headphone output volume
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] vol set vol
+ * @param[in] vol set volume
  * @return    status code
  *            - 0 success
- *            - 1 set aux right channel input to right mixer volume failed
+ *            - 1 set rout1 right headphone output volume failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 vol > 0x7
+ *            - 4 vol > 0x3F
  * @note      none
  */
-uint8_t wm8978_set_aux_right_channel_input_to_right_mixer_volume(wm8978_handle_t *handle, uint8_t vol)
+uint8_t wm8978_set_rout1_right_headphone_output_volume(wm8978_handle_t *handle, uint8_t vol)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_ROUT1_RIGHT_HEADPHONE_OUTPUT_VOLUME, vol);        /* set field */
+}
+
+/**
+ * @brief      get rout1 right headphone output volume
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *vol pointer to a volume buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get rout1 right headphone output volume failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_rout1_right_headphone_output_volume(wm8978_handle_t *handle, uint8_t *vol)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
-    if (vol > 0x7)                                                            /* check vol */
-    {
-        handle->debug_print("wm8978: vol > 0x7.\n");                          /* vol > 0x7 */
-        
-        return 4;                                                             /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_RIGHT_MIXER_CTRL, &conf);      /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(7 << 6);                                                        /* clear config */
-    conf |= vol << 6;                                                         /* set vol */
-    res = a_wm8978_iic_write(handle, WM8978_REG_RIGHT_MIXER_CTRL, conf);      /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_ROUT1_RIGHT_HEADPHONE_OUTPUT_VOLUME, &value);        /* get field */
+    *vol = (uint8_t)(value);                                                                           /* get vol */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                                                        /* return the result */
 }
 
 /**
- * @brief      convert the aux right channel input to right mixer volume to the register raw data
+ * @brief      convert the rout1 right headphone output volume to the register raw data
  * @param[in]  *handle pointer to a wm8978 handle structure
  * @param[in]  db set db
  * @param[out] *reg pointer to a db raw data buffer
@@ -7557,24 +8352,24 @@ uint8_t wm8978_set_aux_right_channel_input_to_right_mixer_volume(wm8978_handle_t
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_aux_right_channel_input_to_right_mixer_volume_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
+uint8_t wm8978_rout1_right_headphone_output_volume_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
 {
-    if (handle == NULL)                    /* check handle */
+    if (handle == NULL)                /* check handle */
     {
-        return 2;                          /* return error */
+        return 2;                      /* return error */
     }
-    if (handle->inited != 1)               /* check handle initialization */
+    if (handle->inited != 1)           /* check handle initialization */
     {
-        return 3;                          /* return error */
+        return 3;                      /* return error */
     }
     
-    *reg = (uint8_t)(db + 15) / 3;         /* convert */
+    *reg = (uint8_t)(db + 57);         /* convert */
     
-    return 0;                              /* success return 0 */
+    return 0;                          /* success return 0 */
 }
 
 /**
- * @brief      convert the aux right channel input to right mixer volume raw data to the real data
+ * @brief      convert the rout1 right headphone output volume raw data to the real data
  * @param[in]  *handle pointer to a wm8978 handle structure
  * @param[in]  reg raw data
  * @param[out] *db pointer to a db real data buffer
@@ -7584,121 +8379,177 @@ uint8_t wm8978_aux_right_channel_input_to_right_mixer_volume_convert_to_register
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_aux_right_channel_input_to_right_mixer_volume_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
+uint8_t wm8978_rout1_right_headphone_output_volume_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
 {
-    if (handle == NULL)                 /* check handle */
+    if (handle == NULL)             /* check handle */
     {
-        return 2;                       /* return error */
+        return 2;                   /* return error */
     }
-    if (handle->inited != 1)            /* check handle initialization */
+    if (handle->inited != 1)        /* check handle initialization */
     {
-        return 3;                       /* return error */
+        return 3;                   /* return error */
     }
     
-    *db = (int8_t)(reg * 3 - 15);       /* convert */
+    *db = (int8_t)(reg - 57);       /* convert */
     
-    return 0;                           /* success return 0 */
+    return 0;                       /* success return 0 */
 }
 
 /**
- * @brief     enable or disable right auxiliary input to right channel output mixer
+ * @brief     enable or disable lout2 update
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set right auxiliary input to right channel output mixer failed
+ *            - 1 set lout2 update failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_right_auxiliary_input_to_right_channel_output_mixer(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_lout2_update(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LOUT2_UPDATE, enable);        /* set field */
+}
+
+/**
+ * @brief      get lout2 update status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get lout2 update failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_lout2_update(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
+    uint16_t value;
     
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LOUT2_UPDATE, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                           /* get bool */
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_RIGHT_MIXER_CTRL, &conf);      /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 5);                                                        /* clear config */
-    conf |= enable << 5;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_RIGHT_MIXER_CTRL, conf);      /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    return res;                                                                 /* return the result */
+}
+
+/**
+ * @brief     enable or disable lout2 speaker volume zero cross
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set lout2 speaker volume zero cross failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_lout2_speaker_volume_zero_cross(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LOUT2_SPEAKER_VOLUME_ZERO_CROSS, enable);        /* set field */
+}
+
+/**
+ * @brief      get lout2 speaker volume zero cross status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get lout2 speaker volume zero cross failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_lout2_speaker_volume_zero_cross(wm8978_handle_t *handle, wm8978_bool_t *enable)
+{
+    uint8_t res;
+    uint16_t value;
     
-    return 0;                                                                 /* success return 0 */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LOUT2_SPEAKER_VOLUME_ZERO_CROSS, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                              /* get bool */
+    
+    return res;                                                                                    /* return the result */
 }
 
 /**
- * @brief     set right bypass volume control to output channel mixer
+ * @brief     enable or disable lout2 left speaker output mute
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] vol set vol
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set right bypass volume control to output channel mixer failed
+ *            - 1 set lout2 left speaker output mute failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 vol > 0x7
  * @note      none
  */
-uint8_t wm8978_set_right_bypass_volume_control_to_output_channel_mixer(wm8978_handle_t *handle, uint8_t vol)
+uint8_t wm8978_set_lout2_left_speaker_output_mute(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LOUT2_LEFT_SPEAKER_OUTPUT_MUTE, enable);        /* set field */
+}
+
+/**
+ * @brief      get lout2 left speaker output mute status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get lout2 left speaker output mute failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_lout2_left_speaker_output_mute(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
+    uint16_t value;
     
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
-    if (vol > 0x7)                                                            /* check vol */
-    {
-        handle->debug_print("wm8978: vol > 0x7.\n");                          /* vol > 0x7 */
-        
-        return 4;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LOUT2_LEFT_SPEAKER_OUTPUT_MUTE, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                             /* get bool */
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_RIGHT_MIXER_CTRL, &conf);      /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(7 << 2);                                                        /* clear config */
-    conf |= vol << 2;                                                         /* set vol */
-    res = a_wm8978_iic_write(handle, WM8978_REG_RIGHT_MIXER_CTRL, conf);      /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    return res;                                                                                   /* return the result */
+}
+
+/**
+ * @brief     set lout2 left speaker output volume
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] vol set volume
+ * @return    status code
+ *            - 0 success
+ *            - 1 set lout2 left speaker output volume failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 vol > 0x3F
+ * @note      none
+ */
+uint8_t wm8978_set_lout2_left_speaker_output_volume(wm8978_handle_t *handle, uint8_t vol)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LOUT2_LEFT_SPEAKER_OUTPUT_VOLUME, vol);        /* set field */
+}
+
+/**
+ * @brief      get lout2 left speaker output volume
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *vol pointer to a volume buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get lout2 left speaker output volume failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_lout2_left_speaker_output_volume(wm8978_handle_t *handle, uint8_t *vol)
+{
+    uint8_t res;
+    uint16_t value;
     
-    return 0;                                                                 /* success return 0 */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LOUT2_LEFT_SPEAKER_OUTPUT_VOLUME, &value);        /* get field */
+    *vol = (uint8_t)(value);                                                                        /* get vol */
+    
+    return res;                                                                                     /* return the result */
 }
 
 /**
- * @brief      convert the right bypass volume control to output channel mixer to the register raw data
+ * @brief      convert the lout2 left speaker output volume to the register raw data
  * @param[in]  *handle pointer to a wm8978 handle structure
  * @param[in]  db set db
  * @param[out] *reg pointer to a db raw data buffer
@@ -7708,24 +8559,24 @@ uint8_t wm8978_set_right_bypass_volume_control_to_output_channel_mixer(wm8978_ha
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_right_bypass_volume_control_to_output_channel_mixer_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
+uint8_t wm8978_lout2_left_speaker_output_volume_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
 {
-    if (handle == NULL)                    /* check handle */
+    if (handle == NULL)                /* check handle */
     {
-        return 2;                          /* return error */
+        return 2;                      /* return error */
     }
-    if (handle->inited != 1)               /* check handle initialization */
+    if (handle->inited != 1)           /* check handle initialization */
     {
-        return 3;                          /* return error */
+        return 3;                      /* return error */
     }
     
-    *reg = (uint8_t)(db + 15) / 3;         /* convert */
+    *reg = (uint8_t)(db + 57);         /* convert */
     
-    return 0;                              /* success return 0 */
+    return 0;                          /* success return 0 */
 }
 
 /**
- * @brief      convert the right bypass volume control to output channel mixer raw data to the real data
+ * @brief      convert the lout2 left speaker output volume raw data to the real data
  * @param[in]  *handle pointer to a wm8978 handle structure
  * @param[in]  reg raw data
  * @param[out] *db pointer to a db real data buffer
@@ -7735,301 +8586,177 @@ uint8_t wm8978_right_bypass_volume_control_to_output_channel_mixer_convert_to_re
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_right_bypass_volume_control_to_output_channel_mixer_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
+uint8_t wm8978_lout2_left_speaker_output_volume_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
 {
-    if (handle == NULL)                 /* check handle */
+    if (handle == NULL)             /* check handle */
     {
-        return 2;                       /* return error */
+        return 2;                   /* return error */
     }
-    if (handle->inited != 1)            /* check handle initialization */
+    if (handle->inited != 1)        /* check handle initialization */
     {
-        return 3;                       /* return error */
+        return 3;                   /* return error */
     }
     
-    *db = (int8_t)(reg * 3 - 15);       /* convert */
+    *db = (int8_t)(reg - 57);       /* convert */
     
-    return 0;                           /* success return 0 */
+    return 0;                       /* success return 0 */
 }
 
 /**
- * @brief     enable or disable right bypass path to right output mixer
+ * @brief     enable or disable rout2 update
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set right bypass path to right output mixer failed
+ *            - 1 set rout2 update failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_right_bypass_path_to_right_output_mixer(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_rout2_update(wm8978_handle_t *handle, wm8978_bool_t enable)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_RIGHT_MIXER_CTRL, &conf);      /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 1);                                                        /* clear config */
-    conf |= enable << 1;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_RIGHT_MIXER_CTRL, conf);      /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    
-    return 0;                                                                 /* success return 0 */
+    return a_wm8978_field_set(handle, WM8978_FIELD_ROUT2_UPDATE, enable);        /* set field */
 }
 
 /**
- * @brief     enable or disable right dac output to right output mixer
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
- * @return    status code
- *            - 0 success
- *            - 1 set right dac output to right output mixer failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      get rout2 update status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get rout2 update failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
  */
-uint8_t wm8978_set_right_dac_output_to_right_output_mixer(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_get_rout2_update(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_RIGHT_MIXER_CTRL, &conf);      /* read config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 1;                                                             /* return error */
-    }
-    conf &= ~(1 << 0);                                                        /* clear config */
-    conf |= enable << 0;                                                      /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_RIGHT_MIXER_CTRL, conf);      /* write config */
-    if (res != 0)                                                             /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 1;                                                             /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_ROUT2_UPDATE, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                           /* get bool */
     
-    return 0;                                                                 /* success return 0 */
+    return res;                                                                 /* return the result */
 }
 
 /**
- * @brief     enable or disable lout1 update
+ * @brief     enable or disable rout2 speaker volume zero cross
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set lout1 update failed
+ *            - 1 set rout2 speaker volume zero cross failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_lout1_update(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_rout2_speaker_volume_zero_cross(wm8978_handle_t *handle, wm8978_bool_t enable)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                 /* check handle */
-    {
-        return 2;                                                       /* return error */
-    }
-    if (handle->inited != 1)                                            /* check handle initialization */
-    {
-        return 3;                                                       /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_LOUT1_CTRL, &conf);      /* read config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");           /* read config failed */
-        
-        return 1;                                                       /* return error */
-    }
-    conf &= ~(1 << 8);                                                  /* clear config */
-    conf |= enable << 8;                                                /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_LOUT1_CTRL, conf);      /* write config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");          /* write config failed */
-        
-        return 1;                                                       /* return error */
-    }
-    
-    return 0;                                                           /* success return 0 */
+    return a_wm8978_field_set(handle, WM8978_FIELD_ROUT2_SPEAKER_VOLUME_ZERO_CROSS, enable);        /* set field */
 }
 
 /**
- * @brief     enable or disable lout1 headphone volume zero cross
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
- * @return    status code
- *            - 0 success
- *            - 1 set lout1 headphone volume zero cross failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      get rout2 speaker volume zero cross status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get rout2 speaker volume zero cross failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
  */
-uint8_t wm8978_set_lout1_headphone_volume_zero_cross(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_get_rout2_speaker_volume_zero_cross(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                 /* check handle */
-    {
-        return 2;                                                       /* return error */
-    }
-    if (handle->inited != 1)                                            /* check handle initialization */
-    {
-        return 3;                                                       /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_LOUT1_CTRL, &conf);      /* read config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");           /* read config failed */
-        
-        return 1;                                                       /* return error */
-    }
-    conf &= ~(1 << 7);                                                  /* clear config */
-    conf |= enable << 7;                                                /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_LOUT1_CTRL, conf);      /* write config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");          /* write config failed */
-        
-        return 1;                                                       /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_ROUT2_SPEAKER_VOLUME_ZERO_CROSS, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                              /* get bool */
     
-    return 0;                                                           /* success return 0 */
+    return res;                                                                                    /* return the result */
 }
 
 /**
- * @brief     enable or disable lout1 left headphone output mute
+ * @brief     enable or disable rout2 right speaker output mute
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set lout1 left headphone output mute failed
+ *            - 1 set rout2 right speaker output mute failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_lout1_left_headphone_output_mute(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_rout2_right_speaker_output_mute(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_ROUT2_RIGHT_SPEAKER_OUTPUT_MUTE, enable);        /* set field */
+}
+
+/**
+ * @brief      get rout2 right speaker output mute status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get rout2 right speaker output mute failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_rout2_right_speaker_output_mute(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
+    uint16_t value;
     
-    if (handle == NULL)                                                 /* check handle */
-    {
-        return 2;                                                       /* return error */
-    }
-    if (handle->inited != 1)                                            /* check handle initialization */
-    {
-        return 3;                                                       /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_LOUT1_CTRL, &conf);      /* read config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");           /* read config failed */
-        
-        return 1;                                                       /* return error */
-    }
-    conf &= ~(1 << 6);                                                  /* clear config */
-    conf |= enable << 6;                                                /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_LOUT1_CTRL, conf);      /* write config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");          /* write config failed */
-        
-        return 1;                                                       /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_ROUT2_RIGHT_SPEAKER_OUTPUT_MUTE, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                              /* get bool */
     
-    return 0;                                                           /* success return 0 */
+    return res;                                                                                    /* return the result */
 }
 
 /**
- * @brief     set lout1 left headphone output volume
+ * @brief     set rout2 right speaker output volume
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] vol set volume
  * @return    status code
  *            - 0 success
- *            - 1 set lout1 left headphone output volume failed
+ *            - 1 set rout2 right speaker output volume failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  *            - 4 vol > 0x3F
  * @note      none
  */
-uint8_t wm8978_set_lout1_left_headphone_output_volume(wm8978_handle_t *handle, uint8_t vol)
+uint8_t wm8978_set_rout2_right_speaker_output_volume(wm8978_handle_t *handle, uint8_t vol)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_ROUT2_RIGHT_SPEAKER_OUTPUT_VOLUME, vol);        /* set field */
+}
+
+/**
+ * @brief      get rout2 right speaker output volume
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *vol pointer to a volume buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get rout2 right speaker output volume failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_rout2_right_speaker_output_volume(wm8978_handle_t *handle, uint8_t *vol)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                 /* check handle */
-    {
-        return 2;                                                       /* return error */
-    }
-    if (handle->inited != 1)                                            /* check handle initialization */
-    {
-        return 3;                                                       /* return error */
-    }
-    if (vol > 0x3F)                                                     /* check vol */
-    {
-        handle->debug_print("wm8978: vol > 0x3F.\n");                   /* vol > 0x3F */
-        
-        return 4;                                                       /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_LOUT1_CTRL, &conf);      /* read config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");           /* read config failed */
-        
-        return 1;                                                       /* return error */
-    }
-    conf &= ~(0x3F << 0);                                               /* clear config */
-    conf |= vol << 0;                                                   /* set vol */
-    res = a_wm8978_iic_write(handle, WM8978_REG_LOUT1_CTRL, conf);      /* write config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");          /* write config failed */
-        
-        return 1;                                                       /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_ROUT2_RIGHT_SPEAKER_OUTPUT_VOLUME, &value);        /* get field */
+    *vol = (uint8_t)(value);                                                                         /* get vol */
     
-    return 0;                                                           /* success return 0 */
+    return res;                                                                                      /* return the result */
 }
 
 /**
- * @brief      convert the lout1 left headphone output volume to the register raw data
+ * @brief      convert the rout2 right speaker output volume to the register raw data
  * @param[in]  *handle pointer to a wm8978 handle structure
  * @param[in]  db set db
  * @param[out] *reg pointer to a db raw data buffer
@@ -8039,7 +8766,7 @@ uint8_t wm8978_set_lout1_left_headphone_output_volume(wm8978_handle_t *handle, u
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_lout1_left_headphone_output_volume_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
+uint8_t wm8978_rout2_right_speaker_output_volume_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
 {
     if (handle == NULL)                /* check handle */
     {
@@ -8056,7 +8783,7 @@ uint8_t wm8978_lout1_left_headphone_output_volume_convert_to_register(wm8978_han
 }
 
 /**
- * @brief      convert the lout1 left headphone output volume raw data to the real data
+ * @brief      convert the rout2 right speaker output volume raw data to the real data
  * @param[in]  *handle pointer to a wm8978 handle structure
  * @param[in]  reg raw data
  * @param[out] *db pointer to a db real data buffer
@@ -8066,1437 +8793,1819 @@ uint8_t wm8978_lout1_left_headphone_output_volume_convert_to_register(wm8978_han
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_lout1_left_headphone_output_volume_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
+uint8_t wm8978_rout2_right_speaker_output_volume_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
 {
     if (handle == NULL)             /* check handle */
     {
-        return 2;                   /* return error */
-    }
-    if (handle->inited != 1)        /* check handle initialization */
-    {
-        return 3;                   /* return error */
-    }
-    
-    *db = (int8_t)(reg - 57);       /* convert */
-    
-    return 0;                       /* success return 0 */
-}
-
-/**
- * @brief     enable or disable rout1 update
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
- * @return    status code
- *            - 0 success
- *            - 1 set rout1 update failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
- */
-uint8_t wm8978_set_rout1_update(wm8978_handle_t *handle, wm8978_bool_t enable)
-{
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                 /* check handle */
-    {
-        return 2;                                                       /* return error */
+        return 2;                   /* return error */
     }
-    if (handle->inited != 1)                                            /* check handle initialization */
+    if (handle->inited != 1)        /* check handle initialization */
     {
-        return 3;                                                       /* return error */
+        return 3;                   /* return error */
     }
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_ROUT1_CTRL, &conf);      /* read config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");           /* read config failed */
-        
-        return 1;                                                       /* return error */
-    }
-    conf &= ~(1 << 8);                                                  /* clear config */
-    conf |= enable << 8;                                                /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_ROUT1_CTRL, conf);      /* write config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");          /* write config failed */
-        
-        return 1;                                                       /* return error */
-    }
+    *db = (int8_t)(reg - 57);       /* convert */
     
-    return 0;                                                           /* success return 0 */
+    return 0;                       /* success return 0 */
 }
 
 /**
- * @brief     enable or disable rout1 headphone volume zero cross
+ * @brief     enable or disable out3 mute
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set rout1 headphone volume zero cross failed
+ *            - 1 set out3 mute failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_rout1_headphone_volume_zero_cross(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_out3_mute(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_OUT3_MUTE, enable);        /* set field */
+}
+
+/**
+ * @brief      get out3 mute status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get out3 mute failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_out3_mute(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                 /* check handle */
-    {
-        return 2;                                                       /* return error */
-    }
-    if (handle->inited != 1)                                            /* check handle initialization */
-    {
-        return 3;                                                       /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_ROUT1_CTRL, &conf);      /* read config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");           /* read config failed */
-        
-        return 1;                                                       /* return error */
-    }
-    conf &= ~(1 << 7);                                                  /* clear config */
-    conf |= enable << 7;                                                /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_ROUT1_CTRL, conf);      /* write config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");          /* write config failed */
-        
-        return 1;                                                       /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_OUT3_MUTE, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                        /* get bool */
     
-    return 0;                                                           /* success return 0 */
+    return res;                                                              /* return the result */
 }
 
 /**
- * @brief     enable or disable rout1 right headphone output mute
+ * @brief     enable or disable out4 mixer output to out3
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set rout1 right headphone output mute failed
+ *            - 1 set out4 mixer output to out3 failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_rout1_right_headphone_output_mute(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_out4_mixer_output_to_out3(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_OUT4_MIXER_OUTPUT_TO_OUT3, enable);        /* set field */
+}
+
+/**
+ * @brief      get out4 mixer output to out3 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get out4 mixer output to out3 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_out4_mixer_output_to_out3(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                 /* check handle */
-    {
-        return 2;                                                       /* return error */
-    }
-    if (handle->inited != 1)                                            /* check handle initialization */
-    {
-        return 3;                                                       /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_ROUT1_CTRL, &conf);      /* read config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");           /* read config failed */
-        
-        return 1;                                                       /* return error */
-    }
-    conf &= ~(1 << 6);                                                  /* clear config */
-    conf |= enable << 6;                                                /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_ROUT1_CTRL, conf);      /* write config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");          /* write config failed */
-        
-        return 1;                                                       /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_OUT4_MIXER_OUTPUT_TO_OUT3, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                        /* get bool */
     
-    return 0;                                                           /* success return 0 */
+    return res;                                                                              /* return the result */
 }
 
 /**
- * @brief     set rout1 right headphone output volume
+ * @brief     enable or disable left adc input to out3
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] vol set volume
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set rout1 right headphone output volume failed
+ *            - 1 set left adc input to out3 failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 vol > 0x3F
  * @note      none
  */
-uint8_t wm8978_set_rout1_right_headphone_output_volume(wm8978_handle_t *handle, uint8_t vol)
+uint8_t wm8978_set_left_adc_input_to_out3(wm8978_handle_t *handle, wm8978_bool_t enable)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                 /* check handle */
-    {
-        return 2;                                                       /* return error */
-    }
-    if (handle->inited != 1)                                            /* check handle initialization */
-    {
-        return 3;                                                       /* return error */
-    }
-    if (vol > 0x3F)                                                     /* check vol */
-    {
-        handle->debug_print("wm8978: vol > 0x3F.\n");                   /* vol > 0x3F */
-        
-        return 4;                                                       /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_ROUT1_CTRL, &conf);      /* read config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");           /* read config failed */
-        
-        return 1;                                                       /* return error */
-    }
-    conf &= ~(0x3F << 0);                                               /* clear config */
-    conf |= vol << 0;                                                   /* set vol */
-    res = a_wm8978_iic_write(handle, WM8978_REG_ROUT1_CTRL, conf);      /* write config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");          /* write config failed */
-        
-        return 1;                                                       /* return error */
-    }
-    
-    return 0;                                                           /* success return 0 */
+    return a_wm8978_field_set(handle, WM8978_FIELD_LEFT_ADC_INPUT_TO_OUT3, enable);        /* set field */
 }
 
 /**
- * @brief      convert the rout1 right headphone output volume to the register raw data
+ * @brief      get left adc input to out3 status
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  db set db
- * @param[out] *reg pointer to a db raw data buffer
+ * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
+ *             - 1 get left adc input to out3 failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_rout1_right_headphone_output_volume_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
+uint8_t wm8978_get_left_adc_input_to_out3(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
-    if (handle == NULL)                /* check handle */
-    {
-        return 2;                      /* return error */
-    }
-    if (handle->inited != 1)           /* check handle initialization */
-    {
-        return 3;                      /* return error */
-    }
+    uint8_t res;
+    uint16_t value;
     
-    *reg = (uint8_t)(db + 57);         /* convert */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LEFT_ADC_INPUT_TO_OUT3, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                     /* get bool */
     
-    return 0;                          /* success return 0 */
+    return res;                                                                           /* return the result */
 }
 
 /**
- * @brief      convert the rout1 right headphone output volume raw data to the real data
+ * @brief     enable or disable left dac mixer to out3
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set left dac mixer to out3 failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_left_dac_mixer_to_out3(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LEFT_DAC_MIXER_TO_OUT3, enable);        /* set field */
+}
+
+/**
+ * @brief      get left dac mixer to out3 status
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  reg raw data
- * @param[out] *db pointer to a db real data buffer
+ * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
+ *             - 1 get left dac mixer to out3 failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_rout1_right_headphone_output_volume_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
+uint8_t wm8978_get_left_dac_mixer_to_out3(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
-    if (handle == NULL)             /* check handle */
-    {
-        return 2;                   /* return error */
-    }
-    if (handle->inited != 1)        /* check handle initialization */
-    {
-        return 3;                   /* return error */
-    }
+    uint8_t res;
+    uint16_t value;
     
-    *db = (int8_t)(reg - 57);       /* convert */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LEFT_DAC_MIXER_TO_OUT3, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                     /* get bool */
     
-    return 0;                       /* success return 0 */
+    return res;                                                                           /* return the result */
 }
 
 /**
- * @brief     enable or disable lout2 update
+ * @brief     enable or disable left dac output to out3
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set lout2 update failed
+ *            - 1 set left dac output to out3 failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_lout2_update(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_left_dac_output_to_out3(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LEFT_DAC_OUTPUT_TO_OUT3, enable);        /* set field */
+}
+
+/**
+ * @brief      get left dac output to out3 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left dac output to out3 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_dac_output_to_out3(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                 /* check handle */
-    {
-        return 2;                                                       /* return error */
-    }
-    if (handle->inited != 1)                                            /* check handle initialization */
-    {
-        return 3;                                                       /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_LOUT2_CTRL, &conf);      /* read config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");           /* read config failed */
-        
-        return 1;                                                       /* return error */
-    }
-    conf &= ~(1 << 8);                                                  /* clear config */
-    conf |= enable << 8;                                                /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_LOUT2_CTRL, conf);      /* write config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");          /* write config failed */
-        
-        return 1;                                                       /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LEFT_DAC_OUTPUT_TO_OUT3, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                      /* get bool */
     
-    return 0;                                                           /* success return 0 */
+    return res;                                                                            /* return the result */
 }
 
 /**
- * @brief     enable or disable lout2 speaker volume zero cross
+ * @brief     enable or disable out4 mute
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set lout2 speaker volume zero cross failed
+ *            - 1 set out4 mute failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_lout2_speaker_volume_zero_cross(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_out4_mute(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_OUT4_MUTE, enable);        /* set field */
+}
+
+/**
+ * @brief      get out4 mute status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get out4 mute failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_out4_mute(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                 /* check handle */
-    {
-        return 2;                                                       /* return error */
-    }
-    if (handle->inited != 1)                                            /* check handle initialization */
-    {
-        return 3;                                                       /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_LOUT2_CTRL, &conf);      /* read config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");           /* read config failed */
-        
-        return 1;                                                       /* return error */
-    }
-    conf &= ~(1 << 7);                                                  /* clear config */
-    conf |= enable << 7;                                                /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_LOUT2_CTRL, conf);      /* write config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");          /* write config failed */
-        
-        return 1;                                                       /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_OUT4_MUTE, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                        /* get bool */
     
-    return 0;                                                           /* success return 0 */
+    return res;                                                              /* return the result */
 }
 
 /**
- * @brief     enable or disable lout2 left speaker output mute
+ * @brief     enable or disable out4 attenuated by 6db
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set lout2 left speaker output mute failed
+ *            - 1 set out4 attenuated by 6db failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_lout2_left_speaker_output_mute(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_out4_attenuated_by_6db(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_OUT4_ATTENUATED_BY_6DB, enable);        /* set field */
+}
+
+/**
+ * @brief      get out4 attenuated by 6db status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get out4 attenuated by 6db failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_out4_attenuated_by_6db(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                 /* check handle */
-    {
-        return 2;                                                       /* return error */
-    }
-    if (handle->inited != 1)                                            /* check handle initialization */
-    {
-        return 3;                                                       /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_LOUT2_CTRL, &conf);      /* read config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");           /* read config failed */
-        
-        return 1;                                                       /* return error */
-    }
-    conf &= ~(1 << 6);                                                  /* clear config */
-    conf |= enable << 6;                                                /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_LOUT2_CTRL, conf);      /* write config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");          /* write config failed */
-        
-        return 1;                                                       /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_OUT4_ATTENUATED_BY_6DB, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                     /* get bool */
     
-    return 0;                                                           /* success return 0 */
+    return res;                                                                           /* return the result */
 }
 
 /**
- * @brief     set lout2 left speaker output volume
+ * @brief     enable or disable left dac mixer to out4
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] vol set volume
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set lout2 left speaker output volume failed
+ *            - 1 set left dac mixer to out4 failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 vol > 0x3F
  * @note      none
  */
-uint8_t wm8978_set_lout2_left_speaker_output_volume(wm8978_handle_t *handle, uint8_t vol)
-{
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                 /* check handle */
-    {
-        return 2;                                                       /* return error */
-    }
-    if (handle->inited != 1)                                            /* check handle initialization */
-    {
-        return 3;                                                       /* return error */
-    }
-    if (vol > 0x3F)                                                     /* check vol */
-    {
-        handle->debug_print("wm8978: vol > 0x3F.\n");                   /* vol > 0x3F */
-        
-        return 4;                                                       /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_LOUT2_CTRL, &conf);      /* read config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");           /* read config failed */
-        
-        return 1;                                                       /* return error */
-    }
-    conf &= ~(0x3F << 0);                                               /* clear config */
-    conf |= vol << 0;                                                   /* set vol */
-    res = a_wm8978_iic_write(handle, WM8978_REG_LOUT2_CTRL, conf);      /* write config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");          /* write config failed */
-        
-        return 1;                                                       /* return error */
-    }
-    
-    return 0;                                                           /* success return 0 */
+uint8_t wm8978_set_left_dac_mixer_to_out4(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LEFT_DAC_MIXER_TO_OUT4, enable);        /* set field */
 }
 
 /**
- * @brief      convert the lout2 left speaker output volume to the register raw data
+ * @brief      get left dac mixer to out4 status
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  db set db
- * @param[out] *reg pointer to a db raw data buffer
+ * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
+ *             - 1 get left dac mixer to out4 failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_lout2_left_speaker_output_volume_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
+uint8_t wm8978_get_left_dac_mixer_to_out4(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
-    if (handle == NULL)                /* check handle */
-    {
-        return 2;                      /* return error */
-    }
-    if (handle->inited != 1)           /* check handle initialization */
-    {
-        return 3;                      /* return error */
-    }
+    uint8_t res;
+    uint16_t value;
     
-    *reg = (uint8_t)(db + 57);         /* convert */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LEFT_DAC_MIXER_TO_OUT4, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                     /* get bool */
     
-    return 0;                          /* success return 0 */
+    return res;                                                                           /* return the result */
 }
 
 /**
- * @brief      convert the lout2 left speaker output volume raw data to the real data
+ * @brief     enable or disable left dac to out4
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set left dac to out4 failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wm8978_set_left_dac_to_out4(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_LEFT_DAC_TO_OUT4, enable);        /* set field */
+}
+
+/**
+ * @brief      get left dac to out4 status
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  reg raw data
- * @param[out] *db pointer to a db real data buffer
+ * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
+ *             - 1 get left dac to out4 failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_lout2_left_speaker_output_volume_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
+uint8_t wm8978_get_left_dac_to_out4(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
-    if (handle == NULL)             /* check handle */
-    {
-        return 2;                   /* return error */
-    }
-    if (handle->inited != 1)        /* check handle initialization */
-    {
-        return 3;                   /* return error */
-    }
+    uint8_t res;
+    uint16_t value;
     
-    *db = (int8_t)(reg - 57);       /* convert */
+    res = a_wm8978_field_get(handle, WM8978_FIELD_LEFT_DAC_TO_OUT4, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                               /* get bool */
     
-    return 0;                       /* success return 0 */
+    return res;                                                                     /* return the result */
 }
 
 /**
- * @brief     enable or disable rout2 update
+ * @brief     enable or disable right adc input to out4
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set rout2 update failed
+ *            - 1 set right adc input to out4 failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_rout2_update(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_right_adc_input_to_out4(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_RIGHT_ADC_INPUT_TO_OUT4, enable);        /* set field */
+}
+
+/**
+ * @brief      get right adc input to out4 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right adc input to out4 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_adc_input_to_out4(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
+    uint16_t value;
     
-    if (handle == NULL)                                                 /* check handle */
-    {
-        return 2;                                                       /* return error */
-    }
-    if (handle->inited != 1)                                            /* check handle initialization */
-    {
-        return 3;                                                       /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_ROUT2_CTRL, &conf);      /* read config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");           /* read config failed */
-        
-        return 1;                                                       /* return error */
-    }
-    conf &= ~(1 << 8);                                                  /* clear config */
-    conf |= enable << 8;                                                /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_ROUT2_CTRL, conf);      /* write config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");          /* write config failed */
-        
-        return 1;                                                       /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_RIGHT_ADC_INPUT_TO_OUT4, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                      /* get bool */
     
-    return 0;                                                           /* success return 0 */
+    return res;                                                                            /* return the result */
 }
 
 /**
- * @brief     enable or disable rout2 speaker volume zero cross
+ * @brief     enable or disable right dac mixer to out4
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set rout2 speaker volume zero cross failed
+ *            - 1 set right dac mixer to out4 failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_rout2_speaker_volume_zero_cross(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_right_dac_mixer_to_out4(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_RIGHT_DAC_MIXER_TO_OUT4, enable);        /* set field */
+}
+
+/**
+ * @brief      get right dac mixer to out4 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right dac mixer to out4 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_dac_mixer_to_out4(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                 /* check handle */
-    {
-        return 2;                                                       /* return error */
-    }
-    if (handle->inited != 1)                                            /* check handle initialization */
-    {
-        return 3;                                                       /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_ROUT2_CTRL, &conf);      /* read config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");           /* read config failed */
-        
-        return 1;                                                       /* return error */
-    }
-    conf &= ~(1 << 7);                                                  /* clear config */
-    conf |= enable << 7;                                                /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_ROUT2_CTRL, conf);      /* write config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");          /* write config failed */
-        
-        return 1;                                                       /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_RIGHT_DAC_MIXER_TO_OUT4, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                      /* get bool */
     
-    return 0;                                                           /* success return 0 */
+    return res;                                                                            /* return the result */
 }
 
 /**
- * @brief     enable or disable rout2 right speaker output mute
+ * @brief     enable or disable right dac output to out4
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set rout2 right speaker output mute failed
+ *            - 1 set right dac output to out4 failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_rout2_right_speaker_output_mute(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_right_dac_output_to_out4(wm8978_handle_t *handle, wm8978_bool_t enable)
+{
+    return a_wm8978_field_set(handle, WM8978_FIELD_RIGHT_DAC_OUTPUT_TO_OUT4, enable);        /* set field */
+}
+
+/**
+ * @brief      get right dac output to out4 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right dac output to out4 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_dac_output_to_out4(wm8978_handle_t *handle, wm8978_bool_t *enable)
 {
     uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                 /* check handle */
-    {
-        return 2;                                                       /* return error */
-    }
-    if (handle->inited != 1)                                            /* check handle initialization */
-    {
-        return 3;                                                       /* return error */
-    }
+    uint16_t value;
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_ROUT2_CTRL, &conf);      /* read config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: read config failed.\n");           /* read config failed */
-        
-        return 1;                                                       /* return error */
-    }
-    conf &= ~(1 << 6);                                                  /* clear config */
-    conf |= enable << 6;                                                /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_ROUT2_CTRL, conf);      /* write config */
-    if (res != 0)                                                       /* check error */
-    {
-        handle->debug_print("wm8978: write config failed.\n");          /* write config failed */
-        
-        return 1;                                                       /* return error */
-    }
+    res = a_wm8978_field_get(handle, WM8978_FIELD_RIGHT_DAC_OUTPUT_TO_OUT4, &value);        /* get field */
+    *enable = (wm8978_bool_t)(value);                                                       /* get bool */
     
-    return 0;                                                           /* success return 0 */
+    return res;                                                                             /* return the result */
 }
 
 /**
- * @brief     set rout2 right speaker output volume
+ * @brief     check the links, open the bus and reset the chip
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] vol set volume
  * @return    status code
  *            - 0 success
- *            - 1 set rout2 right speaker output volume failed
+ *            - 1 iic initialization failed
  *            - 2 handle is NULL
- *            - 3 handle is not initialized
- *            - 4 vol > 0x3F
- * @note      none
+ *            - 3 linked functions is NULL
+ *            - 4 reset failed
+ * @note      the caller must wait 100ms before a_wm8978_init_finish
  */
-uint8_t wm8978_set_rout2_right_speaker_output_volume(wm8978_handle_t *handle, uint8_t vol)
+static uint8_t a_wm8978_init_start(wm8978_handle_t *handle)
 {
     uint8_t res;
     uint16_t conf;
     
-    if (handle == NULL)                                                 /* check handle */
+    if (handle == NULL)                                                                   /* check handle */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (handle->debug_print == NULL)                                                      /* check debug_print */
+    {
+        return 3;                                                                         /* return error */
+    }
+    if ((handle->iic_init == NULL) && (handle->iic_init_ctx == NULL))                     /* check iic_init */
+    {
+        handle->debug_print("wm8978: iic_init is null.\n");                               /* iic_init is null */
+        
+        return 3;                                                                         /* return error */
+    }
+    if ((handle->iic_deinit == NULL) && (handle->iic_deinit_ctx == NULL))                 /* check iic_deinit */
     {
-        return 2;                                                       /* return error */
+        handle->debug_print("wm8978: iic_deinit is null.\n");                             /* iic_deinit is null */
+        
+        return 3;                                                                         /* return error */
     }
-    if (handle->inited != 1)                                            /* check handle initialization */
+    if ((handle->iic_write == NULL) && (handle->iic_write_ctx == NULL))                   /* check iic_write */
     {
-        return 3;                                                       /* return error */
+        handle->debug_print("wm8978: iic_write is null.\n");                              /* iic_write is null */
+        
+        return 3;                                                                         /* return error */
     }
-    if (vol > 0x3F)                                                     /* check vol */
+    if ((handle->delay_ms == NULL) && (handle->delay_ms_ctx == NULL))                     /* check delay_ms */
     {
-        handle->debug_print("wm8978: vol > 0x3F.\n");                   /* vol > 0x3F */
+        handle->debug_print("wm8978: delay_ms is null.\n");                               /* delay_ms is null */
         
-        return 4;                                                       /* return error */
+        return 3;                                                                         /* return error */
     }
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_ROUT2_CTRL, &conf);      /* read config */
-    if (res != 0)                                                       /* check error */
+    if (handle->iic_addr == 0)                                                            /* check iic address */
     {
-        handle->debug_print("wm8978: read config failed.\n");           /* read config failed */
+        handle->iic_addr = WM8978_ADDRESS;                                                /* use the default address */
+    }
+    if (a_wm8978_iic_init(handle) != 0)                                                   /* iic init */
+    {
+        handle->debug_print("wm8978: iic init failed.\n");                                /* iic init failed */
         
-        return 1;                                                       /* return error */
+        return 1;                                                                         /* return error */
     }
-    conf &= ~(0x3F << 0);                                               /* clear config */
-    conf |= vol << 0;                                                   /* set vol */
-    res = a_wm8978_iic_write(handle, WM8978_REG_ROUT2_CTRL, conf);      /* write config */
-    if (res != 0)                                                       /* check error */
+    conf = 0x0000;                                                                        /* set any value */
+    res = a_wm8978_iic_write(handle, WM8978_REG_SOFTWARE_RESET, conf);                    /* write config */
+    if (res != 0)                                                                         /* check error */
     {
-        handle->debug_print("wm8978: write config failed.\n");          /* write config failed */
+        handle->debug_print("wm8978: write config failed.\n");                            /* write config failed */
+        (void)a_wm8978_iic_deinit(handle);                                                /* iic deinit */
         
-        return 1;                                                       /* return error */
+        return 4;                                                                         /* return error */
     }
     
-    return 0;                                                           /* success return 0 */
+    return 0;                                                                             /* success return 0 */
 }
 
 /**
- * @brief      convert the rout2 right speaker output volume to the register raw data
- * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  db set db
- * @param[out] *reg pointer to a db raw data buffer
- * @return     status code
- *             - 0 success
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
+ * @brief     load the reset register map and flag the handle
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @note      none
  */
-uint8_t wm8978_rout2_right_speaker_output_volume_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg)
+static void a_wm8978_init_finish(wm8978_handle_t *handle)
 {
-    if (handle == NULL)                /* check handle */
-    {
-        return 2;                      /* return error */
-    }
-    if (handle->inited != 1)           /* check handle initialization */
+    uint8_t i;
+    
+    for (i = 0; i < 58; i++)                                     /* set all */
     {
-        return 3;                      /* return error */
+        handle->reg[i] = gsc_wm8978_init_reg[i];                 /* save regs */
     }
-    
-    *reg = (uint8_t)(db + 57);         /* convert */
-    
-    return 0;                          /* success return 0 */
+    handle->inited = 1;                                          /* flag inited */
 }
 
 /**
- * @brief      convert the rout2 right speaker output volume raw data to the real data
- * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  reg raw data
- * @param[out] *db pointer to a db real data buffer
- * @return     status code
- *             - 0 success
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
+ * @brief     initialize the chip
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic initialization failed
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 reset failed
+ * @note      none
  */
-uint8_t wm8978_rout2_right_speaker_output_volume_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int8_t *db)
+uint8_t wm8978_init(wm8978_handle_t *handle)
 {
-    if (handle == NULL)             /* check handle */
-    {
-        return 2;                   /* return error */
-    }
-    if (handle->inited != 1)        /* check handle initialization */
+    uint8_t res;
+    
+    res = a_wm8978_init_start(handle);                /* check, open and reset */
+    if (res != 0)                                     /* check the result */
     {
-        return 3;                   /* return error */
+        return res;                                   /* return error */
     }
+    a_wm8978_delay_ms(handle, 100);                   /* delay 100ms */
+    a_wm8978_init_finish(handle);                     /* load the register map */
     
-    *db = (int8_t)(reg - 57);       /* convert */
-    
-    return 0;                       /* success return 0 */
+    return 0;                                         /* success return 0 */
 }
 
 /**
- * @brief     enable or disable out3 mute
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
+ * @brief     initialize several chips together
+ * @param[in] **handle pointer to a wm8978 handle array
+ * @param[in] num handle number
  * @return    status code
  *            - 0 success
- *            - 1 set out3 mute failed
+ *            - 1 iic initialization failed
  *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ *            - 3 linked functions is NULL
+ *            - 4 reset failed
+ * @note      every chip is reset first and all of them share one 100ms settle delay,
+ *            if one chip fails the buses already opened are closed again
  */
-uint8_t wm8978_set_out3_mute(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_multi_init(wm8978_handle_t **handle, uint8_t num)
 {
     uint8_t res;
-    uint16_t conf;
+    uint8_t i;
+    uint8_t j;
     
-    if (handle == NULL)                                                      /* check handle */
+    if ((handle == NULL) || (num == 0))                           /* check handle */
     {
-        return 2;                                                            /* return error */
+        return 2;                                                 /* return error */
     }
-    if (handle->inited != 1)                                                 /* check handle initialization */
+    
+    for (i = 0; i < num; i++)                                     /* reset all chips */
     {
-        return 3;                                                            /* return error */
+        res = a_wm8978_init_start(handle[i]);                     /* check, open and reset */
+        if (res != 0)                                             /* check the result */
+        {
+            for (j = 0; j < i; j++)                               /* close the opened buses */
+            {
+                (void)a_wm8978_iic_deinit(handle[j]);             /* iic deinit */
+            }
+            
+            return res;                                           /* return error */
+        }
     }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_OUT3_MIXER_CTRL, &conf);      /* read config */
-    if (res != 0)                                                            /* check error */
+    a_wm8978_delay_ms(handle[0], 100);                            /* delay 100ms once */
+    for (i = 0; i < num; i++)                                     /* finish all chips */
     {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
+        a_wm8978_init_finish(handle[i]);                          /* load the register map */
     }
-    conf &= ~(1 << 6);                                                       /* clear config */
-    conf |= enable << 6;                                                     /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_OUT3_MIXER_CTRL, conf);      /* write config */
-    if (res != 0)                                                            /* check error */
+    
+    return 0;                                                     /* success return 0 */
+}
+
+/**
+ * @brief     set the iic address
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] addr iic address
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      call it before wm8978_init, 0 selects the default address
+ */
+uint8_t wm8978_set_addr(wm8978_handle_t *handle, uint8_t addr)
+{
+    if (handle == NULL)               /* check handle */
     {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
+        return 2;                     /* return error */
+    }
+    
+    handle->iic_addr = addr;          /* set address */
+    
+    return 0;                         /* success return 0 */
+}
+
+/**
+ * @brief      get the iic address
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *addr pointer to an iic address buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t wm8978_get_addr(wm8978_handle_t *handle, uint8_t *addr)
+{
+    if (handle == NULL)               /* check handle */
+    {
+        return 2;                     /* return error */
     }
     
-    return 0;                                                                /* success return 0 */
+    *addr = handle->iic_addr;         /* get address */
+    
+    return 0;                         /* success return 0 */
 }
 
 /**
- * @brief     enable or disable out4 mixer output to out3
+ * @brief     close the chip
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set out4 mixer output to out3 failed
+ *            - 1 iic deinit failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
+ *            - 4 power down failed
  * @note      none
  */
-uint8_t wm8978_set_out4_mixer_output_to_out3(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_deinit(wm8978_handle_t *handle)
 {
     uint8_t res;
     uint16_t conf;
     
-    if (handle == NULL)                                                      /* check handle */
+    if (handle == NULL)                                                       /* check handle */
     {
-        return 2;                                                            /* return error */
+        return 2;                                                             /* return error */
     }
-    if (handle->inited != 1)                                                 /* check handle initialization */
+    if (handle->inited != 1)                                                  /* check handle initialization */
     {
-        return 3;                                                            /* return error */
+        return 3;                                                             /* return error */
     }
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_OUT3_MIXER_CTRL, &conf);      /* read config */
-    if (res != 0)                                                            /* check error */
+    res = a_wm8978_iic_read(handle, WM8978_REG_POWER_MANAGE_2, &conf);        /* read config */
+    if (res != 0)                                                             /* check error */
     {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
+        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
         
-        return 1;                                                            /* return error */
+        return 4;                                                             /* return error */
     }
-    conf &= ~(1 << 3);                                                       /* clear config */
-    conf |= enable << 3;                                                     /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_OUT3_MIXER_CTRL, conf);      /* write config */
-    if (res != 0)                                                            /* check error */
+    conf &= ~(1 << 6);                                                        /* clear config */
+    conf |= 1 << 6;                                                           /* set bool */
+    res = a_wm8978_iic_write(handle, WM8978_REG_POWER_MANAGE_2, conf);        /* write config */
+    if (res != 0)                                                             /* check error */
     {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
+        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
         
-        return 1;                                                            /* return error */
+        return 4;                                                             /* return error */
+    }
+    res = a_wm8978_iic_deinit(handle);                                        /* close iic */
+    if (res != 0)                                                             /* check the result */
+    {
+        handle->debug_print("wm8978: iic deinit failed.\n");                  /* iic deinit failed */
+        
+        return 1;                                                             /* return error */
     }
+    handle->inited = 0;                                                       /* flag close */
     
-    return 0;                                                                /* success return 0 */
+    return 0;                                                                 /* success return 0 */
 }
 
 /**
- * @brief     enable or disable left adc input to out3
+ * @brief     set the chip register
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
+ * @param[in] reg iic register address
+ * @param[in] value data written to the register
  * @return    status code
  *            - 0 success
- *            - 1 set left adc input to out3 failed
+ *            - 1 write failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t wm8978_set_left_adc_input_to_out3(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_reg(wm8978_handle_t *handle, uint8_t reg, uint16_t value)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                      /* check handle */
-    {
-        return 2;                                                            /* return error */
-    }
-    if (handle->inited != 1)                                                 /* check handle initialization */
-    {
-        return 3;                                                            /* return error */
-    }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_OUT3_MIXER_CTRL, &conf);      /* read config */
-    if (res != 0)                                                            /* check error */
+    if (handle == NULL)                                           /* check handle */
     {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
+        return 2;                                                 /* return error */
     }
-    conf &= ~(1 << 2);                                                       /* clear config */
-    conf |= enable << 2;                                                     /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_OUT3_MIXER_CTRL, conf);      /* write config */
-    if (res != 0)                                                            /* check error */
+    if (handle->inited != 1)                                      /* check handle initialization */
     {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
+        return 3;                                                 /* return error */
     }
     
-    return 0;                                                                /* success return 0 */
+    return a_wm8978_reg_update(handle, reg, 0x1FF, value);        /* write reg */
 }
 
 /**
- * @brief     enable or disable left dac mixer to out3
+ * @brief     update masked bits of the chip register
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
+ * @param[in] reg iic register address
+ * @param[in] mask changed bits
+ * @param[in] bits new bits
  * @return    status code
  *            - 0 success
- *            - 1 set left dac mixer to out3 failed
+ *            - 1 update failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      the shadow read-modify-write runs under the register lock,
+ *            bits outside the mask are kept
  */
-uint8_t wm8978_set_left_dac_mixer_to_out3(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_update_reg(wm8978_handle_t *handle, uint8_t reg, uint16_t mask, uint16_t bits)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                      /* check handle */
+    if (handle == NULL)                                         /* check handle */
     {
-        return 2;                                                            /* return error */
+        return 2;                                               /* return error */
     }
-    if (handle->inited != 1)                                                 /* check handle initialization */
+    if (handle->inited != 1)                                    /* check handle initialization */
     {
-        return 3;                                                            /* return error */
+        return 3;                                               /* return error */
     }
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_OUT3_MIXER_CTRL, &conf);      /* read config */
-    if (res != 0)                                                            /* check error */
+    return a_wm8978_reg_update(handle, reg, mask, bits);        /* update reg */
+}
+
+/**
+ * @brief      get the chip register
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  reg iic register address
+ * @param[out] *value pointer to a register value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_reg(wm8978_handle_t *handle, uint8_t reg, uint16_t *value)
+{
+    if (handle == NULL)                                  /* check handle */
     {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
+        return 2;                                        /* return error */
     }
-    conf &= ~(1 << 1);                                                       /* clear config */
-    conf |= enable << 1;                                                     /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_OUT3_MIXER_CTRL, conf);      /* write config */
-    if (res != 0)                                                            /* check error */
+    if (handle->inited != 1)                             /* check handle initialization */
     {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
+        return 3;                                        /* return error */
     }
     
-    return 0;                                                                /* success return 0 */
+    return a_wm8978_iic_read(handle, reg, value);        /* read reg from the shadow */
 }
 
 /**
- * @brief     enable or disable left dac output to out3
+ * @brief     set a register field
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
+ * @param[in] field register field
+ * @param[in] value field value
  * @return    status code
  *            - 0 success
- *            - 1 set left dac output to out3 failed
+ *            - 1 set field failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
+ *            - 4 field or value is invalid
  * @note      none
  */
-uint8_t wm8978_set_left_dac_output_to_out3(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_set_field(wm8978_handle_t *handle, wm8978_field_t field, uint16_t value)
+{
+    return a_wm8978_field_set(handle, field, value);        /* set field */
+}
+
+/**
+ * @brief      get a register field
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  field register field
+ * @param[out] *value pointer to a field value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get field failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 field is invalid
+ * @note       none
+ */
+uint8_t wm8978_get_field(wm8978_handle_t *handle, wm8978_field_t field, uint16_t *value)
+{
+    return a_wm8978_field_get(handle, field, value);        /* get field */
+}
+
+/**
+ * @brief     set several register fields in one pass
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] *list pointer to a field value list
+ * @param[in] len list length
+ * @return    status code
+ *            - 0 success
+ *            - 1 set fields failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 field or value is invalid
+ * @note      every value is range checked before anything is written and
+ *            consecutive fields of the same register share one bus write
+ */
+uint8_t wm8978_set_fields(wm8978_handle_t *handle, const wm8978_field_value_t *list, uint8_t len)
+{
+    if (list == NULL)                                         /* check list */
+    {
+        return 4;                                             /* return error */
+    }
+    
+    return a_wm8978_field_write(handle, list, len);           /* write fields */
+}
+
+/**
+ * @brief     set the same register fields on several chips
+ * @param[in] **handle pointer to a wm8978 handle array
+ * @param[in] num handle number
+ * @param[in] *list pointer to a field value list
+ * @param[in] len list length
+ * @return    status code
+ *            - 0 success
+ *            - 1 set fields failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 field or value is invalid
+ * @note      the writes are interleaved register by register across the chips, so
+ *            chips on separate buses with queued transfers progress in parallel
+ */
+uint8_t wm8978_multi_set_fields(wm8978_handle_t **handle, uint8_t num, const wm8978_field_value_t *list, uint8_t len)
 {
     uint8_t res;
-    uint16_t conf;
+    uint8_t i;
+    uint8_t start;
+    uint8_t end;
     
-    if (handle == NULL)                                                      /* check handle */
+    if ((handle == NULL) || (num == 0))                                                     /* check handle */
     {
-        return 2;                                                            /* return error */
+        return 2;                                                                           /* return error */
     }
-    if (handle->inited != 1)                                                 /* check handle initialization */
+    if (list == NULL)                                                                       /* check list */
     {
-        return 3;                                                            /* return error */
+        return 4;                                                                           /* return error */
     }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_OUT3_MIXER_CTRL, &conf);      /* read config */
-    if (res != 0)                                                            /* check error */
+    for (i = 0; i < num; i++)                                                               /* check all handles */
     {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
+        if (handle[i] == NULL)                                                              /* check handle */
+        {
+            return 2;                                                                       /* return error */
+        }
+        if (handle[i]->inited != 1)                                                         /* check handle initialization */
+        {
+            return 3;                                                                       /* return error */
+        }
     }
-    conf &= ~(1 << 0);                                                       /* clear config */
-    conf |= enable << 0;                                                     /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_OUT3_MIXER_CTRL, conf);      /* write config */
-    if (res != 0)                                                            /* check error */
+    res = a_wm8978_field_check(handle[0], list, len);                                       /* check all fields */
+    if (res != 0)                                                                           /* check the result */
     {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
+        return res;                                                                         /* return error */
     }
     
-    return 0;                                                                /* success return 0 */
+    start = 0;                                                                              /* init 0 */
+    while (start < len)                                                                     /* run all registers */
+    {
+        end = (uint8_t)(start + 1);                                                         /* next field */
+        while ((end < len) && (gsc_wm8978_field[list[end].field].reg ==
+                               gsc_wm8978_field[list[start].field].reg))                    /* same register */
+        {
+            end++;                                                                          /* next field */
+        }
+        for (i = 0; i < num; i++)                                                           /* write all chips */
+        {
+            res = a_wm8978_field_write(handle[i], &list[start], (uint8_t)(end - start));    /* write one register */
+            if (res != 0)                                                                   /* check the result */
+            {
+                return res;                                                                 /* return error */
+            }
+        }
+        start = end;                                                                        /* next register */
+    }
+    
+    return 0;                                                                               /* success return 0 */
 }
 
 /**
- * @brief     enable or disable out4 mute
+ * @brief     initialize a volume ramp
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
+ * @param[in] *ramp pointer to a wm8978 ramp structure
+ * @param[in] duration_ms ramp duration in ms
+ * @param[in] max_writes max bus writes per tick
  * @return    status code
  *            - 0 success
- *            - 1 set out4 mute failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 ramp is NULL or param is invalid
+ * @note      duration_ms <= 0x7FFFFF, max_writes >= 2
  */
-uint8_t wm8978_set_out4_mute(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_ramp_init(wm8978_handle_t *handle, wm8978_ramp_t *ramp, uint32_t duration_ms, uint8_t max_writes)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                      /* check handle */
+    if (handle == NULL)                                                  /* check handle */
     {
-        return 2;                                                            /* return error */
+        return 2;                                                        /* return error */
     }
-    if (handle->inited != 1)                                                 /* check handle initialization */
+    if (handle->inited != 1)                                             /* check handle initialization */
     {
-        return 3;                                                            /* return error */
+        return 3;                                                        /* return error */
     }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_OUT4_MIXER_CTRL, &conf);      /* read config */
-    if (res != 0)                                                            /* check error */
+    if (ramp == NULL)                                                    /* check ramp */
     {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
+        return 4;                                                        /* return error */
+    }
+    if (duration_ms > 0x7FFFFF)                                          /* check duration */
+    {
+        handle->debug_print("wm8978: duration_ms > 0x7FFFFF.\n");        /* duration_ms > 0x7FFFFF */
         
-        return 1;                                                            /* return error */
+        return 4;                                                        /* return error */
     }
-    conf &= ~(1 << 6);                                                       /* clear config */
-    conf |= enable << 6;                                                     /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_OUT4_MIXER_CTRL, conf);      /* write config */
-    if (res != 0)                                                            /* check error */
+    if (max_writes < 2)                                                  /* check max writes */
     {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
+        handle->debug_print("wm8978: max_writes < 2.\n");                /* max_writes < 2 */
         
-        return 1;                                                            /* return error */
+        return 4;                                                        /* return error */
     }
     
-    return 0;                                                                /* success return 0 */
+    memset(ramp, 0, sizeof(wm8978_ramp_t));                              /* clear the ramp */
+    ramp->duration_ms = duration_ms;                                     /* set duration */
+    ramp->max_writes = max_writes;                                       /* set max writes */
+    
+    return 0;                                                            /* success return 0 */
 }
 
 /**
- * @brief     enable or disable out4 attenuated by 6db
+ * @brief     add a gain stage to a volume ramp
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
+ * @param[in] *ramp pointer to a wm8978 ramp structure
+ * @param[in] stage ramped gain stage
+ * @param[in] target target register volume of both channels
  * @return    status code
  *            - 0 success
- *            - 1 set out4 attenuated by 6db failed
+ *            - 1 add stage failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 ramp is NULL, stage or target is invalid
+ * @note      the ramp starts from the current left and right volume of the stage,
+ *            the input pga, out1 and out2 stages step on zero crossings, so adding
+ *            one of them enables the slow clock whose timeout applies the latched
+ *            volume when the signal is silent or dc
  */
-uint8_t wm8978_set_out4_attenuated_by_6db(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_ramp_add(wm8978_handle_t *handle, wm8978_ramp_t *ramp, wm8978_ramp_stage_t stage, uint8_t target)
 {
     uint8_t res;
-    uint16_t conf;
+    uint8_t i;
+    uint8_t ch;
+    uint16_t value;
+    const wm8978_ramp_desc_t *desc;
     
-    if (handle == NULL)                                                      /* check handle */
+    if (handle == NULL)                                                                    /* check handle */
     {
-        return 2;                                                            /* return error */
+        return 2;                                                                          /* return error */
     }
-    if (handle->inited != 1)                                                 /* check handle initialization */
+    if (handle->inited != 1)                                                               /* check handle initialization */
     {
-        return 3;                                                            /* return error */
+        return 3;                                                                          /* return error */
     }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_OUT4_MIXER_CTRL, &conf);      /* read config */
-    if (res != 0)                                                            /* check error */
+    if (ramp == NULL)                                                                      /* check ramp */
+    {
+        return 4;                                                                          /* return error */
+    }
+    for (i = 0; i < 5; i++)                                                                /* find the stage */
+    {
+        if ((uint32_t)stage == (1U << i))                                                  /* check stage */
+        {
+            break;                                                                         /* break */
+        }
+    }
+    if (i == 5)                                                                            /* check the result */
     {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
+        handle->debug_print("wm8978: stage is invalid.\n");                                /* stage is invalid */
         
-        return 1;                                                            /* return error */
+        return 4;                                                                          /* return error */
     }
-    conf &= ~(1 << 5);                                                       /* clear config */
-    conf |= enable << 5;                                                     /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_OUT4_MIXER_CTRL, conf);      /* write config */
-    if (res != 0)                                                            /* check error */
+    desc = &gsc_wm8978_ramp[i];                                                            /* get descriptor */
+    if (target > gsc_wm8978_field[desc->volume[0]].max)                                    /* check target */
     {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
+        handle->debug_print("wm8978: target > 0x%X.\n",
+                            gsc_wm8978_field[desc->volume[0]].max);                        /* target is over range */
         
-        return 1;                                                            /* return error */
+        return 4;                                                                          /* return error */
     }
     
-    return 0;                                                                /* success return 0 */
+    if (desc->zero_cross[0] != WM8978_RAMP_NO_FIELD)                                       /* check zero cross */
+    {
+        res = a_wm8978_field_set(handle, WM8978_FIELD_SLOW_CLOCK, 1);                      /* enable the zero cross timeout */
+        if (res != 0)                                                                      /* check result */
+        {
+            return 1;                                                                      /* return error */
+        }
+    }
+    for (ch = 0; ch < 2; ch++)                                                             /* read both channels */
+    {
+        res = a_wm8978_field_get(handle, (wm8978_field_t)desc->volume[ch], &value);        /* get field */
+        if (res != 0)                                                                      /* check result */
+        {
+            return 1;                                                                      /* return error */
+        }
+        ramp->start[i][ch] = (uint8_t)value;                                               /* set start */
+        ramp->current[i][ch] = (uint8_t)value;                                             /* set current */
+    }
+    ramp->target[i] = target;                                                              /* set target */
+    ramp->stage |= (uint8_t)stage;                                                         /* add stage */
+    
+    return 0;                                                                              /* success return 0 */
 }
 
 /**
- * @brief     enable or disable left dac mixer to out4
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
- * @return    status code
- *            - 0 success
- *            - 1 set left dac mixer to out4 failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      run a volume ramp tick
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  *ramp pointer to a wm8978 ramp structure
+ * @param[in]  ms elapsed time since the last tick in ms
+ * @param[out] *done pointer to a bool buffer, true when all stages reached the target
+ * @return     status code
+ *             - 0 success
+ *             - 1 tick failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 ramp is NULL
+ * @note       call it from a periodic timer until done is true,
+ *             every stage step pre-loads the left volume and latches both channels
+ *             with the right volume write, zero cross is enabled where the stage has it,
+ *             stages which do not fit into max_writes are served first by the next tick
  */
-uint8_t wm8978_set_left_dac_mixer_to_out4(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_ramp_tick(wm8978_handle_t *handle, wm8978_ramp_t *ramp, uint32_t ms, wm8978_bool_t *done)
 {
     uint8_t res;
-    uint16_t conf;
+    uint8_t i;
+    uint8_t k;
+    uint8_t ch;
+    uint8_t len;
+    uint8_t writes;
+    uint8_t step[2];
+    wm8978_field_value_t list[3];
+    const wm8978_ramp_desc_t *desc;
     
-    if (handle == NULL)                                                      /* check handle */
+    if (handle == NULL)                                                                                    /* check handle */
     {
-        return 2;                                                            /* return error */
+        return 2;                                                                                          /* return error */
     }
-    if (handle->inited != 1)                                                 /* check handle initialization */
+    if (handle->inited != 1)                                                                               /* check handle initialization */
     {
-        return 3;                                                            /* return error */
+        return 3;                                                                                          /* return error */
+    }
+    if ((ramp == NULL) || (done == NULL))                                                                  /* check ramp */
+    {
+        return 4;                                                                                          /* return error */
+    }
+    
+    *done = WM8978_BOOL_FALSE;                                                                             /* init false */
+    if (ms >= ramp->duration_ms - ramp->elapsed_ms)                                                        /* check the end */
+    {
+        ramp->elapsed_ms = ramp->duration_ms;                                                              /* reach the end */
+    }
+    else
+    {
+        ramp->elapsed_ms += ms;                                                                            /* add elapsed time */
+    }
+    writes = 0;                                                                                            /* init 0 */
+    for (k = 0; k < 5; k++)                                                                                /* run all stages */
+    {
+        i = (uint8_t)((ramp->next + k) % 5);                                                               /* round robin */
+        if ((ramp->stage & (1U << i)) == 0)                                                                /* check stage */
+        {
+            continue;                                                                                      /* skip */
+        }
+        step[0] = a_wm8978_ramp_step(ramp, i, 0);                                                          /* get left step */
+        step[1] = a_wm8978_ramp_step(ramp, i, 1);                                                          /* get right step */
+        if ((step[0] == ramp->current[i][0]) && (step[1] == ramp->current[i][1]))                          /* check change */
+        {
+            continue;                                                                                      /* skip */
+        }
+        if (writes + 2 > ramp->max_writes)                                                                 /* check the bus budget */
+        {
+            ramp->next = i;                                                                                /* serve it first next time */
+            
+            return 0;                                                                                      /* success return 0 */
+        }
+        desc = &gsc_wm8978_ramp[i];                                                                        /* get descriptor */
+        for (ch = 0; ch < 2; ch++)                                                                         /* left pre-loads, right latches */
+        {
+            len = 0;                                                                                       /* init 0 */
+            if (desc->zero_cross[ch] != WM8978_RAMP_NO_FIELD)                                              /* check zero cross */
+            {
+                list[len].field = (wm8978_field_t)desc->zero_cross[ch];                                    /* set field */
+                list[len].value = 1;                                                                       /* enable zero cross */
+                len++;                                                                                     /* next field */
+            }
+            list[len].field = (wm8978_field_t)desc->volume[ch];                                            /* set field */
+            list[len].value = step[ch];                                                                    /* set volume */
+            len++;                                                                                         /* next field */
+            list[len].field = (wm8978_field_t)desc->update[ch];                                            /* set field */
+            list[len].value = ch;                                                                          /* latch on the right channel */
+            len++;                                                                                         /* next field */
+            res = a_wm8978_field_write(handle, list, len);                                                 /* write one register */
+            if (res != 0)                                                                                  /* check the result */
+            {
+                return 1;                                                                                  /* return error */
+            }
+            ramp->current[i][ch] = step[ch];                                                               /* set current */
+        }
+        writes += 2;                                                                                       /* add writes */
+        ramp->next = (uint8_t)((i + 1) % 5);                                                               /* next stage */
+    }
+    for (i = 0; i < 5; i++)                                                                                /* check all stages */
+    {
+        if (((ramp->stage & (1U << i)) != 0) &&
+            ((ramp->current[i][0] != ramp->target[i]) || (ramp->current[i][1] != ramp->target[i])))        /* check target */
+        {
+            return 0;                                                                                      /* success return 0 */
+        }
+    }
+    *done = WM8978_BOOL_TRUE;                                                                              /* all done */
+    
+    return 0;                                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      solve an eq preset from a target response
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  *band pointer to an eq1 - eq5 band array
+ * @param[out] *preset pointer to a wm8978 eq preset structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 band or preset is NULL
+ * @note       every band takes the nearest frequency on a log scale and its gain is clamped
+ *             to -12db - 12db, the difference to the request is kept in the preset
+ */
+uint8_t wm8978_eq_design(wm8978_handle_t *handle, const wm8978_eq_band_t *band, wm8978_eq_preset_t *preset)
+{
+    uint8_t i;
+    uint8_t j;
+    int8_t gain;
+    uint32_t f2;
+    
+    if (handle == NULL)                                                                                   /* check handle */
+    {
+        return 2;                                                                                         /* return error */
+    }
+    if (handle->inited != 1)                                                                              /* check handle initialization */
+    {
+        return 3;                                                                                         /* return error */
     }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_OUT4_MIXER_CTRL, &conf);      /* read config */
-    if (res != 0)                                                            /* check error */
+    if ((band == NULL) || (preset == NULL))                                                               /* check band and preset */
     {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
+        return 4;                                                                                         /* return error */
     }
-    conf &= ~(1 << 4);                                                       /* clear config */
-    conf |= enable << 4;                                                     /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_OUT4_MIXER_CTRL, conf);      /* write config */
-    if (res != 0)                                                            /* check error */
+    
+    for (i = 0; i < 5; i++)                                                                               /* solve all bands */
     {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        
-        return 1;                                                            /* return error */
+        f2 = (uint32_t)band[i].freq_hz * band[i].freq_hz;                                                 /* square of the frequency */
+        j = 0;                                                                                            /* init 0 */
+        while ((j < 3) &&
+               (f2 > (uint32_t)gsc_wm8978_eq_freq[i][j] * gsc_wm8978_eq_freq[i][j + 1]))                  /* above the geometric mean */
+        {
+            j++;                                                                                          /* next frequency */
+        }
+        gain = band[i].gain_db;                                                                           /* get gain */
+        if (gain > 12)                                                                                    /* check max gain */
+        {
+            gain = 12;                                                                                    /* clamp to 12db */
+        }
+        if (gain < -12)                                                                                   /* check min gain */
+        {
+            gain = -12;                                                                                   /* clamp to -12db */
+        }
+        preset->reg[i] = (uint16_t)(((uint16_t)j << 5) | (uint16_t)(12 - gain));                          /* set freq and gain */
+        if ((i >= 1) && (i <= 3) && (band[i].bandwidth == WM8978_EQ_BANDWIDTH_WIDE))                      /* peak band */
+        {
+            preset->reg[i] |= 1 << 8;                                                                     /* set wide bandwidth */
+        }
+        preset->freq_error_hz[i] = (int16_t)((int32_t)band[i].freq_hz - gsc_wm8978_eq_freq[i][j]);        /* set freq error */
+        preset->gain_error_db[i] = (int8_t)(band[i].gain_db - gain);                                      /* set gain error */
     }
     
-    return 0;                                                                /* success return 0 */
+    return 0;                                                                                             /* success return 0 */
 }
 
 /**
- * @brief     enable or disable left dac to out4
+ * @brief     apply an eq preset
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
+ * @param[in] *preset pointer to a wm8978 eq preset structure
  * @return    status code
  *            - 0 success
- *            - 1 set left dac to out4 failed
+ *            - 1 apply failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 preset is NULL or invalid
+ * @note      the preset costs exactly five register writes, bands losing gain are written
+ *            before bands gaining it, so the response never passes through a transient boost
  */
-uint8_t wm8978_set_left_dac_to_out4(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_eq_apply(wm8978_handle_t *handle, const wm8978_eq_preset_t *preset)
 {
     uint8_t res;
+    uint8_t i;
+    uint8_t pass;
+    uint8_t boost;
     uint16_t conf;
     
-    if (handle == NULL)                                                      /* check handle */
+    if (handle == NULL)                                                                                /* check handle */
     {
-        return 2;                                                            /* return error */
+        return 2;                                                                                      /* return error */
     }
-    if (handle->inited != 1)                                                 /* check handle initialization */
+    if (handle->inited != 1)                                                                           /* check handle initialization */
     {
-        return 3;                                                            /* return error */
+        return 3;                                                                                      /* return error */
+    }
+    if (preset == NULL)                                                                                /* check preset */
+    {
+        return 4;                                                                                      /* return error */
+    }
+    for (i = 0; i < 5; i++)                                                                            /* check all bands */
+    {
+        if (((preset->reg[i] & ~gsc_wm8978_eq_mask[i]) != 0) || ((preset->reg[i] & 0x1F) > 24))        /* check bits */
+        {
+            handle->debug_print("wm8978: eq%d preset is invalid.\n", i + 1);                           /* preset is invalid */
+            
+            return 4;                                                                                  /* return error */
+        }
     }
     
-    res = a_wm8978_iic_read(handle, WM8978_REG_OUT4_MIXER_CTRL, &conf);      /* read config */
-    if (res != 0)                                                            /* check error */
+    for (pass = 0; pass < 2; pass++)                                                                   /* cut first, then boost */
+    {
+        for (i = 0; i < 5; i++)                                                                        /* run all bands */
+        {
+            res = a_wm8978_iic_read(handle, (uint8_t)(WM8978_REG_EQ1 + i), &conf);                     /* read config */
+            if (res != 0)                                                                              /* check error */
+            {
+                handle->debug_print("wm8978: read config failed.\n");                                  /* read config failed */
+                
+                return 1;                                                                              /* return error */
+            }
+            boost = ((preset->reg[i] & 0x1F) < (conf & 0x1F)) ? 1 : 0;                                 /* a smaller value is more gain */
+            if (boost != pass)                                                                         /* check the pass */
+            {
+                continue;                                                                              /* skip */
+            }
+            res = a_wm8978_reg_update(handle, (uint8_t)(WM8978_REG_EQ1 + i),
+                                      gsc_wm8978_eq_mask[i], preset->reg[i]);                          /* write the band */
+            if (res != 0)                                                                              /* check the result */
+            {
+                return 1;                                                                              /* return error */
+            }
+        }
+    }
+    
+    return 0;                                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      design the notch filter coefficients
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  fs sample rate in hz
+ * @param[in]  centre_hz notch centre frequency in hz
+ * @param[in]  bandwidth_hz notch -3db bandwidth in hz
+ * @param[out] *a0 pointer to a 14 bits a0 coefficient buffer
+ * @param[out] *a1 pointer to a 14 bits a1 coefficient buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 param is invalid
+ * @note       0 < centre_hz < fs / 2, 0 < bandwidth_hz < fs / 2,
+ *             a0 = (1 - tan(wb / 2)) / (1 + tan(wb / 2)), a1 = -(1 + a0) * cos(w0),
+ *             the register values are -a0 * 2^13 and -a1 * 2^12 in 14 bits two's complement
+ */
+uint8_t wm8978_notch_design(wm8978_handle_t *handle, uint32_t fs, uint32_t centre_hz, uint32_t bandwidth_hz,
+                            uint16_t *a0, uint16_t *a1)
+{
+    int32_t c;
+    int32_t s;
+    int32_t cw;
+    int32_t sw;
+    int32_t v0;
+    int32_t v1;
+    int64_t den;
+    uint32_t phase;
+    
+    if (handle == NULL)                                                   /* check handle */
+    {
+        return 2;                                                         /* return error */
+    }
+    if (handle->inited != 1)                                              /* check handle initialization */
+    {
+        return 3;                                                         /* return error */
+    }
+    if ((a0 == NULL) || (a1 == NULL))                                     /* check buffer */
+    {
+        return 4;                                                         /* return error */
+    }
+    if ((centre_hz == 0) || (centre_hz >= fs / 2))                        /* check centre */
     {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
+        handle->debug_print("wm8978: centre_hz is invalid.\n");           /* centre_hz is invalid */
         
-        return 1;                                                            /* return error */
+        return 4;                                                         /* return error */
     }
-    conf &= ~(1 << 3);                                                       /* clear config */
-    conf |= enable << 3;                                                     /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_OUT4_MIXER_CTRL, conf);      /* write config */
-    if (res != 0)                                                            /* check error */
+    if ((bandwidth_hz == 0) || (bandwidth_hz >= fs / 2))                  /* check bandwidth */
     {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
+        handle->debug_print("wm8978: bandwidth_hz is invalid.\n");        /* bandwidth_hz is invalid */
         
-        return 1;                                                            /* return error */
+        return 4;                                                         /* return error */
     }
     
-    return 0;                                                                /* success return 0 */
+    phase = (uint32_t)(((uint64_t)bandwidth_hz << 31) / fs);              /* wb / 2 */
+    a_wm8978_cordic(phase, &c, &s);                                       /* get cos and sin */
+    den = (int64_t)c + s;                                                 /* (1 + tan) * cos */
+    v0 = -a_wm8978_div_round(((int64_t)c - s) * 8192, den);               /* -a0 * 2^13 */
+    phase = (uint32_t)(((uint64_t)centre_hz << 32) / fs);                 /* w0 */
+    if (phase > 0x40000000U)                                              /* second quarter */
+    {
+        a_wm8978_cordic(0x80000000U - phase, &cw, &sw);                   /* get cos and sin */
+        cw = -cw;                                                         /* cos(pi - x) = -cos(x) */
+    }
+    else
+    {
+        a_wm8978_cordic(phase, &cw, &sw);                                 /* get cos and sin */
+    }
+    v1 = a_wm8978_div_round((int64_t)c * cw, den << 17);                  /* (1 + a0) * cos(w0) * 2^12 */
+    if (v0 > 8191)                                                        /* check max */
+    {
+        v0 = 8191;                                                        /* clamp */
+    }
+    if (v0 < -8192)                                                       /* check min */
+    {
+        v0 = -8192;                                                       /* clamp */
+    }
+    if (v1 > 8191)                                                        /* check max */
+    {
+        v1 = 8191;                                                        /* clamp */
+    }
+    if (v1 < -8192)                                                       /* check min */
+    {
+        v1 = -8192;                                                       /* clamp */
+    }
+    *a0 = (uint16_t)(v0 & 0x3FFF);                                        /* set a0 */
+    *a1 = (uint16_t)(v1 & 0x3FFF);                                        /* set a1 */
+    
+    return 0;                                                             /* success return 0 */
 }
 
 /**
- * @brief     enable or disable right adc input to out4
+ * @brief     apply the notch filter coefficients
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
+ * @param[in] a0 14 bits a0 coefficient
+ * @param[in] a1 14 bits a1 coefficient
  * @return    status code
  *            - 0 success
- *            - 1 set right adc input to out4 failed
+ *            - 1 apply failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 coefficient is invalid
+ * @note      the first three registers are written with the update bit clear and the
+ *            last one sets it, so the filter switches to all new coefficients at once,
+ *            the notch filter enable bit is not changed
  */
-uint8_t wm8978_set_right_adc_input_to_out4(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_notch_apply(wm8978_handle_t *handle, uint16_t a0, uint16_t a1)
 {
-    uint8_t res;
-    uint16_t conf;
+    wm8978_field_value_t list[8];
     
-    if (handle == NULL)                                                      /* check handle */
-    {
-        return 2;                                                            /* return error */
-    }
-    if (handle->inited != 1)                                                 /* check handle initialization */
+    if (handle == NULL)                                                              /* check handle */
     {
-        return 3;                                                            /* return error */
+        return 2;                                                                    /* return error */
     }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_OUT4_MIXER_CTRL, &conf);      /* read config */
-    if (res != 0)                                                            /* check error */
+    if (handle->inited != 1)                                                         /* check handle initialization */
     {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
+        return 3;                                                                    /* return error */
     }
-    conf &= ~(1 << 2);                                                       /* clear config */
-    conf |= enable << 2;                                                     /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_OUT4_MIXER_CTRL, conf);      /* write config */
-    if (res != 0)                                                            /* check error */
+    if ((a0 > 0x3FFF) || (a1 > 0x3FFF))                                              /* check coefficient */
     {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
+        handle->debug_print("wm8978: coefficient > 0x3FFF.\n");                      /* coefficient > 0x3FFF */
         
-        return 1;                                                            /* return error */
+        return 4;                                                                    /* return error */
     }
     
-    return 0;                                                                /* success return 0 */
+    list[0].field = WM8978_FIELD_NOTCH_FILTER_A0_COEFFICIENT_BIT_13_7_UPDATE;        /* set field */
+    list[0].value = 0;                                                               /* hold */
+    list[1].field = WM8978_FIELD_NOTCH_FILTER_A0_COEFFICIENT_BIT_13_7;               /* set field */
+    list[1].value = (a0 >> 7) & 0x7F;                                                /* set a0 high */
+    list[2].field = WM8978_FIELD_NOTCH_FILTER_A0_COEFFICIENT_BIT_6_0_UPDATE;         /* set field */
+    list[2].value = 0;                                                               /* hold */
+    list[3].field = WM8978_FIELD_NOTCH_FILTER_A0_COEFFICIENT_BIT_6_0;                /* set field */
+    list[3].value = a0 & 0x7F;                                                       /* set a0 low */
+    list[4].field = WM8978_FIELD_NOTCH_FILTER_A1_COEFFICIENT_BIT_13_7_UPDATE;        /* set field */
+    list[4].value = 0;                                                               /* hold */
+    list[5].field = WM8978_FIELD_NOTCH_FILTER_A1_COEFFICIENT_BIT_13_7;               /* set field */
+    list[5].value = (a1 >> 7) & 0x7F;                                                /* set a1 high */
+    list[6].field = WM8978_FIELD_NOTCH_FILTER_A1_COEFFICIENT_BIT_6_0_UPDATE;         /* set field */
+    list[6].value = 1;                                                               /* latch all */
+    list[7].field = WM8978_FIELD_NOTCH_FILTER_A1_COEFFICIENT_BIT_6_0;                /* set field */
+    list[7].value = a1 & 0x7F;                                                       /* set a1 low */
+    
+    return a_wm8978_field_write(handle, list, 8);                                    /* write fields */
 }
 
 /**
- * @brief     enable or disable right dac mixer to out4
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
- * @return    status code
- *            - 0 success
- *            - 1 set right dac mixer to out4 failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      solve a clock plan for a mclk and sample rate pair
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  mclk_hz mclk in hz
+ * @param[in]  fs sample rate in hz
+ * @param[out] *plan pointer to a wm8978 clock plan structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 param is invalid
+ *             - 5 no valid plan
+ * @note       8000 <= fs <= 48000, common pairs come from a precomputed table,
+ *             bclk is set to 64fs for the master mode
  */
-uint8_t wm8978_set_right_dac_mixer_to_out4(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_clock_solve(wm8978_handle_t *handle, uint32_t mclk_hz, uint32_t fs, wm8978_clock_plan_t *plan)
 {
     uint8_t res;
-    uint16_t conf;
+    uint32_t i;
     
-    if (handle == NULL)                                                      /* check handle */
+    if (handle == NULL)                                                                        /* check handle */
     {
-        return 2;                                                            /* return error */
+        return 2;                                                                              /* return error */
     }
-    if (handle->inited != 1)                                                 /* check handle initialization */
+    if (handle->inited != 1)                                                                   /* check handle initialization */
     {
-        return 3;                                                            /* return error */
+        return 3;                                                                              /* return error */
     }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_OUT4_MIXER_CTRL, &conf);      /* read config */
-    if (res != 0)                                                            /* check error */
+    if (plan == NULL)                                                                          /* check plan */
+    {
+        return 4;                                                                              /* return error */
+    }
+    if (mclk_hz == 0)                                                                          /* check mclk */
     {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
+        handle->debug_print("wm8978: mclk_hz is invalid.\n");                                  /* mclk_hz is invalid */
         
-        return 1;                                                            /* return error */
+        return 4;                                                                              /* return error */
     }
-    conf &= ~(1 << 1);                                                       /* clear config */
-    conf |= enable << 1;                                                     /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_OUT4_MIXER_CTRL, conf);      /* write config */
-    if (res != 0)                                                            /* check error */
+    if ((fs < 8000) || (fs > 48000))                                                           /* check fs */
     {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
+        handle->debug_print("wm8978: fs is invalid.\n");                                       /* fs is invalid */
         
-        return 1;                                                            /* return error */
+        return 4;                                                                              /* return error */
     }
     
-    return 0;                                                                /* success return 0 */
+    for (i = 0; i < sizeof(gsc_wm8978_clock) / sizeof(gsc_wm8978_clock[0]); i++)               /* search the table */
+    {
+        if ((gsc_wm8978_clock[i].mclk_hz == mclk_hz) && (gsc_wm8978_clock[i].fs == fs))        /* check pair */
+        {
+            *plan = gsc_wm8978_clock[i].plan;                                                  /* copy the plan */
+            
+            return 0;                                                                          /* success return 0 */
+        }
+    }
+    res = a_wm8978_clock_search(mclk_hz, fs, plan);                                            /* search a plan */
+    if (res != 0)                                                                              /* check the result */
+    {
+        handle->debug_print("wm8978: no valid clock plan.\n");                                 /* no valid clock plan */
+        
+        return 5;                                                                              /* return error */
+    }
+    
+    return 0;                                                                                  /* success return 0 */
 }
 
 /**
- * @brief     enable or disable right dac output to out4
+ * @brief     apply a clock plan
  * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
+ * @param[in] *plan pointer to a wm8978 clock plan structure
  * @return    status code
  *            - 0 success
- *            - 1 set right dac output to out4 failed
+ *            - 1 apply failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 plan is NULL or invalid
+ * @note      only the fields which differ from the current registers are written,
+ *            the pll is powered and programmed before it is selected and powered down
+ *            after mclk is selected, the clock mode is not changed
  */
-uint8_t wm8978_set_right_dac_output_to_out4(wm8978_handle_t *handle, wm8978_bool_t enable)
+uint8_t wm8978_clock_apply(wm8978_handle_t *handle, const wm8978_clock_plan_t *plan)
 {
     uint8_t res;
-    uint16_t conf;
+    uint8_t i;
+    uint8_t len;
+    uint8_t num;
+    uint8_t pll;
+    uint16_t value;
+    wm8978_field_value_t want[10];
+    wm8978_field_value_t list[10];
     
-    if (handle == NULL)                                                      /* check handle */
+    if (handle == NULL)                                                     /* check handle */
     {
-        return 2;                                                            /* return error */
+        return 2;                                                           /* return error */
     }
-    if (handle->inited != 1)                                                 /* check handle initialization */
+    if (handle->inited != 1)                                                /* check handle initialization */
     {
-        return 3;                                                            /* return error */
+        return 3;                                                           /* return error */
     }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_OUT4_MIXER_CTRL, &conf);      /* read config */
-    if (res != 0)                                                            /* check error */
+    if (plan == NULL)                                                       /* check plan */
     {
-        handle->debug_print("wm8978: read config failed.\n");                /* read config failed */
-        
-        return 1;                                                            /* return error */
+        return 4;                                                           /* return error */
     }
-    conf &= ~(1 << 0);                                                       /* clear config */
-    conf |= enable << 0;                                                     /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_OUT4_MIXER_CTRL, conf);      /* write config */
-    if (res != 0)                                                            /* check error */
+    if ((plan->plln > 0xF) || (plan->pll_freq > 0xFFFFFF))                  /* check pll */
     {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
+        handle->debug_print("wm8978: pll is invalid.\n");                   /* pll is invalid */
         
-        return 1;                                                            /* return error */
+        return 4;                                                           /* return error */
     }
     
-    return 0;                                                                /* success return 0 */
+    pll = (plan->clksel == WM8978_CLKSEL_PLL_OUTPUT) ? 1 : 0;               /* check pll */
+    len = 0;                                                                /* init 0 */
+    if (pll != 0)                                                           /* pll is used */
+    {
+        want[len].field = WM8978_FIELD_PLL;                                 /* set field */
+        want[len].value = 1;                                                /* power on first */
+        len++;                                                              /* next field */
+        want[len].field = WM8978_FIELD_MCLK_DIVIDE_BY_2;                    /* set field */
+        want[len].value = plan->mclk_divide_by_2;                           /* set prescaler */
+        len++;                                                              /* next field */
+        want[len].field = WM8978_FIELD_PLLN;                                /* set field */
+        want[len].value = plan->plln;                                       /* set plln */
+        len++;                                                              /* next field */
+        want[len].field = WM8978_FIELD_PLL_K1;                              /* set field */
+        want[len].value = (uint16_t)((plan->pll_freq >> 18) & 0x3F);        /* set k1 */
+        len++;                                                              /* next field */
+        want[len].field = WM8978_FIELD_PLL_K2;                              /* set field */
+        want[len].value = (uint16_t)((plan->pll_freq >> 9) & 0x1FF);        /* set k2 */
+        len++;                                                              /* next field */
+        want[len].field = WM8978_FIELD_PLL_K3;                              /* set field */
+        want[len].value = (uint16_t)(plan->pll_freq & 0x1FF);               /* set k3 */
+        len++;                                                              /* next field */
+    }
+    want[len].field = WM8978_FIELD_CLKSEL;                                  /* set field */
+    want[len].value = plan->clksel;                                         /* set clksel */
+    len++;                                                                  /* next field */
+    want[len].field = WM8978_FIELD_MCLK_DIV;                                /* set field */
+    want[len].value = plan->mclk_div;                                       /* set mclk div */
+    len++;                                                                  /* next field */
+    want[len].field = WM8978_FIELD_BCLK_DIV;                                /* set field */
+    want[len].value = plan->bclk_div;                                       /* set bclk div */
+    len++;                                                                  /* next field */
+    want[len].field = WM8978_FIELD_APPROXIMATE_SAMPLE_RATE;                 /* set field */
+    want[len].value = plan->sample_rate;                                    /* set sample rate */
+    len++;                                                                  /* next field */
+    if (pll == 0)                                                           /* pll is not used */
+    {
+        want[len].field = WM8978_FIELD_PLL;                                 /* set field */
+        want[len].value = 0;                                                /* power off last */
+        len++;                                                              /* next field */
+    }
+    res = a_wm8978_field_check(handle, want, len);                          /* check all fields */
+    if (res != 0)                                                           /* check the result */
+    {
+        return res;                                                         /* return error */
+    }
+    
+    num = 0;                                                                /* init 0 */
+    for (i = 0; i < len; i++)                                               /* drop unchanged fields */
+    {
+        res = a_wm8978_field_get(handle, want[i].field, &value);            /* get field */
+        if (res != 0)                                                       /* check the result */
+        {
+            return 1;                                                       /* return error */
+        }
+        if (value != want[i].value)                                         /* check change */
+        {
+            list[num] = want[i];                                            /* keep the field */
+            num++;                                                          /* next field */
+        }
+    }
+    res = a_wm8978_field_write(handle, list, num);                          /* write changed fields */
+    if (res != 0)                                                           /* check the result */
+    {
+        return 1;                                                           /* return error */
+    }
+    
+    return 0;                                                               /* success return 0 */
 }
 
 /**
- * @brief     initialize the chip
+ * @brief     trim the pll rate of a clock plan
  * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] *plan pointer to the applied wm8978 clock plan structure
+ * @param[in] ppb rate correction in ppb
  * @return    status code
  *            - 0 success
- *            - 1 iic initialization failed
+ *            - 1 trim failed
  *            - 2 handle is NULL
- *            - 3 linked functions is NULL
- *            - 4 reset failed
- * @note      none
+ *            - 3 handle is not initialized
+ *            - 4 plan is NULL or invalid
+ *            - 5 ppb is over range
+ * @note      the correction is relative to the plan, plln never changes and only the
+ *            k registers which differ from the current ones are written, k3 first,
+ *            so a trim without a carry is a single write
  */
-uint8_t wm8978_init(wm8978_handle_t *handle)
+uint8_t wm8978_pll_trim(wm8978_handle_t *handle, const wm8978_clock_plan_t *plan, int32_t ppb)
 {
     uint8_t res;
     uint8_t i;
-    uint16_t conf;
+    uint16_t value;
+    int64_t r;
+    int64_t k;
+    wm8978_field_value_t list[3];
     
-    if (handle == NULL)                                                      /* check handle */
-    {
-        return 2;                                                            /* return error */
-    }
-    if (handle->debug_print == NULL)                                         /* check debug_print */
-    {
-        return 3;                                                            /* return error */
-    }
-    if (handle->iic_init == NULL)                                            /* check iic_init */
-    {
-        handle->debug_print("wm8978: iic_init is null.\n");                  /* iic_init is null */
-        
-        return 3;                                                            /* return error */
-    }
-    if (handle->iic_deinit == NULL)                                          /* check iic_deinit */
+    if (handle == NULL)                                                                                     /* check handle */
     {
-        handle->debug_print("wm8978: iic_deinit is null.\n");                /* iic_deinit is null */
-        
-        return 3;                                                            /* return error */
+        return 2;                                                                                           /* return error */
     }
-    if (handle->iic_write == NULL)                                           /* check iic_write */
+    if (handle->inited != 1)                                                                                /* check handle initialization */
     {
-        handle->debug_print("wm8978: iic_write is null.\n");                 /* iic_write is null */
-        
-        return 3;                                                            /* return error */
+        return 3;                                                                                           /* return error */
     }
-    if (handle->delay_ms == NULL)                                            /* check delay_ms */
+    if ((plan == NULL) || (plan->clksel != WM8978_CLKSEL_PLL_OUTPUT) || (plan->pll_freq > 0xFFFFFF))        /* check plan */
     {
-        handle->debug_print("wm8978: delay_ms is null.\n");                  /* delay_ms is null */
-        
-        return 3;                                                            /* return error */
+        return 4;                                                                                           /* return error */
     }
     
-    if (handle->iic_init() != 0)                                             /* iic init */
-    {
-        handle->debug_print("wm8978: iic init failed.\n");                   /* iic init failed */
-        
-        return 1;                                                            /* return error */
-    }
-    conf = 0x0000;                                                           /* set any value */
-    res = a_wm8978_iic_write(handle, WM8978_REG_SOFTWARE_RESET, conf);       /* write config */
-    if (res != 0)                                                            /* check error */
+    r = ((int64_t)plan->plln << 24) | plan->pll_freq;                                                       /* ratio in q24 */
+    r += r * ppb / 1000000000LL;                                                                            /* apply the correction */
+    k = r - ((int64_t)plan->plln << 24);                                                                    /* fractional part */
+    if ((k < 0) || (k > 0xFFFFFF))                                                                          /* check range */
     {
-        handle->debug_print("wm8978: write config failed.\n");               /* write config failed */
-        (void)handle->iic_deinit();                                          /* iic deinit */
+        handle->debug_print("wm8978: ppb is over range.\n");                                                /* ppb is over range */
         
-        return 4;                                                            /* return error */
+        return 5;                                                                                           /* return error */
     }
-    handle->delay_ms(100);                                                   /* delay 100ms */
-    for (i = 0; i < 58; i++)                                                 /* set all */
+    list[0].field = WM8978_FIELD_PLL_K3;                                                                    /* set field */
+    list[0].value = (uint16_t)(k & 0x1FF);                                                                  /* set k3 */
+    list[1].field = WM8978_FIELD_PLL_K2;                                                                    /* set field */
+    list[1].value = (uint16_t)((k >> 9) & 0x1FF);                                                           /* set k2 */
+    list[2].field = WM8978_FIELD_PLL_K1;                                                                    /* set field */
+    list[2].value = (uint16_t)((k >> 18) & 0x3F);                                                           /* set k1 */
+    for (i = 0; i < 3; i++)                                                                                 /* write changed registers */
     {
-        handle->reg[i] = gsc_wm8978_init_reg[i];                             /* save regs */
+        res = a_wm8978_field_get(handle, list[i].field, &value);                                            /* get field */
+        if (res != 0)                                                                                       /* check the result */
+        {
+            return 1;                                                                                       /* return error */
+        }
+        if (value == list[i].value)                                                                         /* check change */
+        {
+            continue;                                                                                       /* skip */
+        }
+        res = a_wm8978_field_write(handle, &list[i], 1);                                                    /* write field */
+        if (res != 0)                                                                                       /* check the result */
+        {
+            return 1;                                                                                       /* return error */
+        }
     }
-    handle->inited = 1;                                                      /* flag inited */
     
-    return 0;                                                                /* success return 0 */
+    return 0;                                                                                               /* success return 0 */
 }
 
 /**
- * @brief     close the chip
+ * @brief     initialize a drift estimator
  * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] *drift pointer to a wm8978 drift structure
+ * @param[in] target target buffer fill level
+ * @param[in] kp proportional gain in ppb per fill unit
+ * @param[in] ki integral gain in ppb per fill unit and update
+ * @param[in] limit_ppb max correction in ppb
  * @return    status code
  *            - 0 success
- *            - 1 iic deinit failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 power down failed
- * @note      none
+ *            - 4 drift is NULL or limit_ppb is invalid
+ * @note      0 < limit_ppb <= 1000000
  */
-uint8_t wm8978_deinit(wm8978_handle_t *handle)
+uint8_t wm8978_drift_init(wm8978_handle_t *handle, wm8978_drift_t *drift, int32_t target,
+                          int32_t kp, int32_t ki, int32_t limit_ppb)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                       /* check handle */
+    if (handle == NULL)                                                /* check handle */
     {
-        return 2;                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                  /* check handle initialization */
-    {
-        return 3;                                                             /* return error */
+        return 2;                                                      /* return error */
     }
-    
-    res = a_wm8978_iic_read(handle, WM8978_REG_POWER_MANAGE_2, &conf);        /* read config */
-    if (res != 0)                                                             /* check error */
+    if (handle->inited != 1)                                           /* check handle initialization */
     {
-        handle->debug_print("wm8978: read config failed.\n");                 /* read config failed */
-        
-        return 4;                                                             /* return error */
+        return 3;                                                      /* return error */
     }
-    conf &= ~(1 << 6);                                                        /* clear config */
-    conf |= 1 << 6;                                                           /* set bool */
-    res = a_wm8978_iic_write(handle, WM8978_REG_POWER_MANAGE_2, conf);        /* write config */
-    if (res != 0)                                                             /* check error */
+    if (drift == NULL)                                                 /* check drift */
     {
-        handle->debug_print("wm8978: write config failed.\n");                /* write config failed */
-        
-        return 4;                                                             /* return error */
+        return 4;                                                      /* return error */
     }
-    res = handle->iic_deinit();                                               /* close iic */
-    if (res != 0)                                                             /* check the result */
+    if ((limit_ppb <= 0) || (limit_ppb > 1000000))                     /* check limit */
     {
-        handle->debug_print("wm8978: iic deinit failed.\n");                  /* iic deinit failed */
+        handle->debug_print("wm8978: limit_ppb is invalid.\n");        /* limit_ppb is invalid */
         
-        return 1;                                                             /* return error */
+        return 4;                                                      /* return error */
     }
-    handle->inited = 0;                                                       /* flag close */
     
-    return 0;                                                                 /* success return 0 */
+    drift->target = target;                                            /* set target */
+    drift->kp = kp;                                                    /* set kp */
+    drift->ki = ki;                                                    /* set ki */
+    drift->limit_ppb = limit_ppb;                                      /* set limit */
+    drift->integral_ppb = 0;                                           /* init 0 */
+    drift->ppb = 0;                                                    /* init 0 */
+    
+    return 0;                                                          /* success return 0 */
 }
 
 /**
- * @brief     set the chip register
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] reg iic register address
- * @param[in] value data written to the register
- * @return    status code
- *            - 0 success
- *            - 1 write failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      update a drift estimator with the buffer fill level
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  *drift pointer to a wm8978 drift structure
+ * @param[in]  fill current buffer fill level
+ * @param[out] *ppb pointer to a rate correction buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 drift is NULL
+ * @note       a fill level above the target speeds the codec up, the integral term is
+ *             clamped to the limit so it never winds up, feed ppb to wm8978_pll_trim
  */
-uint8_t wm8978_set_reg(wm8978_handle_t *handle, uint8_t reg, uint16_t value)
+uint8_t wm8978_drift_update(wm8978_handle_t *handle, wm8978_drift_t *drift, int32_t fill, int32_t *ppb)
 {
-    if (handle == NULL)                                  /* check handle */
+    int64_t error;
+    int64_t integral;
+    int64_t out;
+    
+    if (handle == NULL)                                        /* check handle */
     {
-        return 2;                                        /* return error */
+        return 2;                                              /* return error */
     }
-    if (handle->inited != 1)                             /* check handle initialization */
+    if (handle->inited != 1)                                   /* check handle initialization */
     {
-        return 3;                                        /* return error */
+        return 3;                                              /* return error */
+    }
+    if ((drift == NULL) || (ppb == NULL))                      /* check drift */
+    {
+        return 4;                                              /* return error */
+    }
+    
+    error = (int64_t)fill - drift->target;                     /* fill error */
+    integral = drift->integral_ppb + error * drift->ki;        /* integrate */
+    if (integral > drift->limit_ppb)                           /* check max */
+    {
+        integral = drift->limit_ppb;                           /* clamp */
+    }
+    if (integral < -drift->limit_ppb)                          /* check min */
+    {
+        integral = -drift->limit_ppb;                          /* clamp */
+    }
+    drift->integral_ppb = (int32_t)integral;                   /* save integral */
+    out = integral + error * drift->kp;                        /* pi output */
+    if (out > drift->limit_ppb)                                /* check max */
+    {
+        out = drift->limit_ppb;                                /* clamp */
+    }
+    if (out < -drift->limit_ppb)                               /* check min */
+    {
+        out = -drift->limit_ppb;                               /* clamp */
     }
+    drift->ppb = (int32_t)out;                                 /* save output */
+    *ppb = drift->ppb;                                         /* set output */
     
-    return a_wm8978_iic_write(handle, reg, value);       /* write reg */
+    return 0;                                                  /* success return 0 */
 }
 
 /**
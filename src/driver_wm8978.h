@@ -495,19 +495,301 @@ typedef enum
     WM8978_ALC_LEVEL_NEGATIVE_22P5 = 0x00,       /**< -22.5dB */
 } wm8978_alc_level_t;
 
+/**
+ * @brief wm8978 register field enumeration definition
+ */
+typedef enum
+{
+    WM8978_FIELD_DC_BUFFER                                           = 0x00,        /**< dc buffer */
+    WM8978_FIELD_OUT4_MIXER                                          = 0x01,        /**< out4 mixer */
+    WM8978_FIELD_OUT3_MIXER                                          = 0x02,        /**< out3 mixer */
+    WM8978_FIELD_PLL                                                 = 0x03,        /**< pll */
+    WM8978_FIELD_MICROPHONE_BIAS                                     = 0x04,        /**< microphone bias */
+    WM8978_FIELD_ANALOGUE_AMPLIFIER_BIAS                             = 0x05,        /**< analogue amplifier bias */
+    WM8978_FIELD_UNUSED_INPUT_OUTPUT_TIE_OFF_BUFFER                  = 0x06,        /**< unused input output tie off buffer */
+    WM8978_FIELD_REFERENCE_IMPEDANCE                                 = 0x07,        /**< reference impedance */
+    WM8978_FIELD_RIGHT_OUT1                                          = 0x08,        /**< right out1 */
+    WM8978_FIELD_LEFT_OUT1                                           = 0x09,        /**< left out1 */
+    WM8978_FIELD_SLEEP                                               = 0x0A,        /**< sleep */
+    WM8978_FIELD_RIGHT_CHANNEL_INPUT_BOOST                           = 0x0B,        /**< right channel input boost */
+    WM8978_FIELD_LEFT_CHANNEL_INPUT_BOOST                            = 0x0C,        /**< left channel input boost */
+    WM8978_FIELD_RIGHT_CHANNEL_INPUT_PGA                             = 0x0D,        /**< right channel input pga */
+    WM8978_FIELD_LEFT_CHANNEL_INPUT_PGA                              = 0x0E,        /**< left channel input pga */
+    WM8978_FIELD_RIGHT_CHANNEL_ADC                                   = 0x0F,        /**< right channel adc */
+    WM8978_FIELD_LEFT_CHANNEL_ADC                                    = 0x10,        /**< left channel adc */
+    WM8978_FIELD_OUT4                                                = 0x11,        /**< out4 */
+    WM8978_FIELD_OUT3                                                = 0x12,        /**< out3 */
+    WM8978_FIELD_LEFT_OUT2                                           = 0x13,        /**< left out2 */
+    WM8978_FIELD_RIGHT_OUT2                                          = 0x14,        /**< right out2 */
+    WM8978_FIELD_RIGHT_OUTPUT_CHANNEL_MIXER                          = 0x15,        /**< right output channel mixer */
+    WM8978_FIELD_LEFT_OUTPUT_CHANNEL_MIXER                           = 0x16,        /**< left output channel mixer */
+    WM8978_FIELD_RIGHT_CHANNEL_DAC                                   = 0x17,        /**< right channel dac */
+    WM8978_FIELD_LEFT_CHANNEL_DAC                                    = 0x18,        /**< left channel dac */
+    WM8978_FIELD_BCLK_POLARITY                                       = 0x19,        /**< bclk polarity */
+    WM8978_FIELD_LRCLK_POLARITY                                      = 0x1A,        /**< lrclk polarity */
+    WM8978_FIELD_WORD_LENGTH                                         = 0x1B,        /**< word length */
+    WM8978_FIELD_DATA_FORMAT                                         = 0x1C,        /**< data format */
+    WM8978_FIELD_DAC_APPEAR                                          = 0x1D,        /**< dac appear */
+    WM8978_FIELD_ADC_APPEAR                                          = 0x1E,        /**< adc appear */
+    WM8978_FIELD_CHANNEL                                             = 0x1F,        /**< channel */
+    WM8978_FIELD_COMPANDING_8BIT_MODE                                = 0x20,        /**< companding 8bit mode */
+    WM8978_FIELD_DAC_COMPANDING                                      = 0x21,        /**< dac companding */
+    WM8978_FIELD_ADC_COMPANDING                                      = 0x22,        /**< adc companding */
+    WM8978_FIELD_LOOPBACK                                            = 0x23,        /**< loopback */
+    WM8978_FIELD_CLKSEL                                              = 0x24,        /**< clksel */
+    WM8978_FIELD_MCLK_DIV                                            = 0x25,        /**< mclk div */
+    WM8978_FIELD_BCLK_DIV                                            = 0x26,        /**< bclk div */
+    WM8978_FIELD_CLOCK_MODE                                          = 0x27,        /**< clock mode */
+    WM8978_FIELD_APPROXIMATE_SAMPLE_RATE                             = 0x28,        /**< approximate sample rate */
+    WM8978_FIELD_SLOW_CLOCK                                          = 0x29,        /**< slow clock */
+    WM8978_FIELD_PLL_DIV                                             = 0x2A,        /**< pll div */
+    WM8978_FIELD_GPIO1_POLARITY                                      = 0x2B,        /**< gpio1 polarity */
+    WM8978_FIELD_GPIO1_SELECT                                        = 0x2C,        /**< gpio1 select */
+    WM8978_FIELD_VMID_1                                              = 0x2D,        /**< vmid 1 */
+    WM8978_FIELD_VMID_0                                              = 0x2E,        /**< vmid 0 */
+    WM8978_FIELD_JACK_DETECTION                                      = 0x2F,        /**< jack detection */
+    WM8978_FIELD_JACK_GPIO                                           = 0x30,        /**< jack gpio */
+    WM8978_FIELD_SOFT_MUTE                                           = 0x31,        /**< soft mute */
+    WM8978_FIELD_DAC_OVERSAMPLE_RATE                                 = 0x32,        /**< dac oversample rate */
+    WM8978_FIELD_AMUTE                                               = 0x33,        /**< amute */
+    WM8978_FIELD_RIGHT_DAC_OUTPUT_POLARITY                           = 0x34,        /**< right dac output polarity */
+    WM8978_FIELD_LEFT_DAC_OUTPUT_POLARITY                            = 0x35,        /**< left dac output polarity */
+    WM8978_FIELD_DAC_LEFT_VOLUME_UPDATE                              = 0x36,        /**< dac left volume update */
+    WM8978_FIELD_DAC_LEFT_VOLUME                                     = 0x37,        /**< dac left volume */
+    WM8978_FIELD_DAC_RIGHT_VOLUME_UPDATE                             = 0x38,        /**< dac right volume update */
+    WM8978_FIELD_DAC_RIGHT_VOLUME                                    = 0x39,        /**< dac right volume */
+    WM8978_FIELD_JACK_LOGIC_1                                        = 0x3A,        /**< jack logic 1 */
+    WM8978_FIELD_JACK_LOGIC_0                                        = 0x3B,        /**< jack logic 0 */
+    WM8978_FIELD_HIGH_PASS_FILTER                                    = 0x3C,        /**< high pass filter */
+    WM8978_FIELD_MODE                                                = 0x3D,        /**< chip mode */
+    WM8978_FIELD_HIGH_PASS_FILTER_CUT_OFF                            = 0x3E,        /**< high pass filter cut off */
+    WM8978_FIELD_ADC_OVERSAMPLE_RATE                                 = 0x3F,        /**< adc oversample rate */
+    WM8978_FIELD_ADC_RIGHT_CHANNEL_POLARITY                          = 0x40,        /**< adc right channel polarity */
+    WM8978_FIELD_ADC_LEFT_CHANNEL_POLARITY                           = 0x41,        /**< adc left channel polarity */
+    WM8978_FIELD_ADC_LEFT_VOLUME_UPDATE                              = 0x42,        /**< adc left volume update */
+    WM8978_FIELD_ADC_LEFT_VOLUME                                     = 0x43,        /**< adc left volume */
+    WM8978_FIELD_ADC_RIGHT_VOLUME_UPDATE                             = 0x44,        /**< adc right volume update */
+    WM8978_FIELD_ADC_RIGHT_VOLUME                                    = 0x45,        /**< adc right volume */
+    WM8978_FIELD_EQUALISER_APPLY                                     = 0x46,        /**< equaliser apply */
+    WM8978_FIELD_EQ1_CUT_OFF                                         = 0x47,        /**< eq1 cut off */
+    WM8978_FIELD_EQ1_GAIN                                            = 0x48,        /**< eq1 gain */
+    WM8978_FIELD_EQ2_BANDWIDTH                                       = 0x49,        /**< eq2 bandwidth */
+    WM8978_FIELD_EQ2_CENTRE_FREQ                                     = 0x4A,        /**< eq2 centre freq */
+    WM8978_FIELD_EQ2_GAIN                                            = 0x4B,        /**< eq2 gain */
+    WM8978_FIELD_EQ3_BANDWIDTH                                       = 0x4C,        /**< eq3 bandwidth */
+    WM8978_FIELD_EQ3_CENTRE_FREQ                                     = 0x4D,        /**< eq3 centre freq */
+    WM8978_FIELD_EQ3_GAIN                                            = 0x4E,        /**< eq3 gain */
+    WM8978_FIELD_EQ4_BANDWIDTH                                       = 0x4F,        /**< eq4 bandwidth */
+    WM8978_FIELD_EQ4_CENTRE_FREQ                                     = 0x50,        /**< eq4 centre freq */
+    WM8978_FIELD_EQ4_GAIN                                            = 0x51,        /**< eq4 gain */
+    WM8978_FIELD_EQ5_CUT_OFF                                         = 0x52,        /**< eq5 cut off */
+    WM8978_FIELD_EQ5_GAIN                                            = 0x53,        /**< eq5 gain */
+    WM8978_FIELD_DAC_DIGITAL_LIMITER                                 = 0x54,        /**< dac digital limiter */
+    WM8978_FIELD_DAC_LIMITER_DECAY                                   = 0x55,        /**< dac limiter decay */
+    WM8978_FIELD_DAC_LIMITER_ATTACK                                  = 0x56,        /**< dac limiter attack */
+    WM8978_FIELD_DAC_LIMITER_LEVEL                                   = 0x57,        /**< dac limiter level */
+    WM8978_FIELD_DAC_LIMITER_VOLUME_BOOST                            = 0x58,        /**< dac limiter volume boost */
+    WM8978_FIELD_NOTCH_FILTER                                        = 0x59,        /**< notch filter */
+    WM8978_FIELD_NOTCH_FILTER_A0_COEFFICIENT_BIT_13_7_UPDATE         = 0x5A,        /**< notch filter a0 coefficient bit13 - bit7 update */
+    WM8978_FIELD_NOTCH_FILTER_A0_COEFFICIENT_BIT_13_7                = 0x5B,        /**< notch filter a0 coefficient bit13 - bit7 */
+    WM8978_FIELD_NOTCH_FILTER_A0_COEFFICIENT_BIT_6_0_UPDATE          = 0x5C,        /**< notch filter a0 coefficient bit6 - bit0 update */
+    WM8978_FIELD_NOTCH_FILTER_A0_COEFFICIENT_BIT_6_0                 = 0x5D,        /**< notch filter a0 coefficient bit6 - bit0 */
+    WM8978_FIELD_NOTCH_FILTER_A1_COEFFICIENT_BIT_13_7_UPDATE         = 0x5E,        /**< notch filter a1 coefficient bit13 - bit7 update */
+    WM8978_FIELD_NOTCH_FILTER_A1_COEFFICIENT_BIT_13_7                = 0x5F,        /**< notch filter a1 coefficient bit13 - bit7 */
+    WM8978_FIELD_NOTCH_FILTER_A1_COEFFICIENT_BIT_6_0_UPDATE          = 0x60,        /**< notch filter a1 coefficient bit6 - bit0 update */
+    WM8978_FIELD_NOTCH_FILTER_A1_COEFFICIENT_BIT_6_0                 = 0x61,        /**< notch filter a1 coefficient bit6 - bit0 */
+    WM8978_FIELD_ALC                                                 = 0x62,        /**< alc */
+    WM8978_FIELD_ALC_MAX_GAIN                                        = 0x63,        /**< alc max gain */
+    WM8978_FIELD_ALC_MIN_GAIN                                        = 0x64,        /**< alc min gain */
+    WM8978_FIELD_ALC_HOLD_TIME                                       = 0x65,        /**< alc hold time */
+    WM8978_FIELD_ALC_LEVEL                                           = 0x66,        /**< alc level */
+    WM8978_FIELD_ALC_MODE                                            = 0x67,        /**< alc mode */
+    WM8978_FIELD_ALC_DECAY                                           = 0x68,        /**< alc decay */
+    WM8978_FIELD_ALC_ATTACK                                          = 0x69,        /**< alc attack */
+    WM8978_FIELD_ALC_NOISE_GATE                                      = 0x6A,        /**< alc noise gate */
+    WM8978_FIELD_ALC_NOISE_GATE_THRESHOLD                            = 0x6B,        /**< alc noise gate threshold */
+    WM8978_FIELD_MCLK_DIVIDE_BY_2                                    = 0x6C,        /**< mclk divide by 2 */
+    WM8978_FIELD_PLLN                                                = 0x6D,        /**< plln */
+    WM8978_FIELD_PLL_K3                                              = 0x6E,        /**< pll k3 */
+    WM8978_FIELD_PLL_K2                                              = 0x6F,        /**< pll k2 */
+    WM8978_FIELD_PLL_K1                                              = 0x70,        /**< pll k1 */
+    WM8978_FIELD_DEPTH_3D                                            = 0x71,        /**< depth 3d */
+    WM8978_FIELD_MUTE_INPUT_TO_INV_ROUT2_MIXER                       = 0x72,        /**< mute input to inv rout2 mixer */
+    WM8978_FIELD_INV_ROUT2_MIXER                                     = 0x73,        /**< inv rout2 mixer */
+    WM8978_FIELD_BEEP_VOLUME                                         = 0x74,        /**< beep volume */
+    WM8978_FIELD_BEEP                                                = 0x75,        /**< beep */
+    WM8978_FIELD_MICROPHONE_BIAS_VOLTAGE                             = 0x76,        /**< microphone bias voltage */
+    WM8978_FIELD_RIGHT_CHANNEL_INPUT_PGA_POSITIVE                    = 0x77,        /**< right channel input pga positive */
+    WM8978_FIELD_RIGHT_CHANNEL_INPUT_PGA_NEGATIVE                    = 0x78,        /**< right channel input pga negative */
+    WM8978_FIELD_RIGHT_CHANNEL_INPUT_PGA_AMPLIFIER_POSITIVE          = 0x79,        /**< right channel input pga amplifier positive */
+    WM8978_FIELD_LEFT_CHANNEL_INPUT_PGA_POSITIVE                     = 0x7A,        /**< left channel input pga positive */
+    WM8978_FIELD_LEFT_CHANNEL_INPUT_PGA_NEGATIVE                     = 0x7B,        /**< left channel input pga negative */
+    WM8978_FIELD_LEFT_CHANNEL_INPUT_PGA_AMPLIFIER_POSITIVE           = 0x7C,        /**< left channel input pga amplifier positive */
+    WM8978_FIELD_LEFT_INPUT_PGA_UPDATE                               = 0x7D,        /**< left input pga update */
+    WM8978_FIELD_LEFT_CHANNEL_INPUT_PGA_ZERO_CROSS                   = 0x7E,        /**< left channel input pga zero cross */
+    WM8978_FIELD_LEFT_CHANNEL_INPUT_PGA_MUTE                         = 0x7F,        /**< left channel input pga mute */
+    WM8978_FIELD_LEFT_CHANNEL_INPUT_PGA_VOLUME                       = 0x80,        /**< left channel input pga volume */
+    WM8978_FIELD_RIGHT_INPUT_PGA_UPDATE                              = 0x81,        /**< right input pga update */
+    WM8978_FIELD_RIGHT_CHANNEL_INPUT_PGA_ZERO_CROSS                  = 0x82,        /**< right channel input pga zero cross */
+    WM8978_FIELD_RIGHT_CHANNEL_INPUT_PGA_MUTE                        = 0x83,        /**< right channel input pga mute */
+    WM8978_FIELD_RIGHT_CHANNEL_INPUT_PGA_VOLUME                      = 0x84,        /**< right channel input pga volume */
+    WM8978_FIELD_LEFT_CHANNEL_INPUT_PGA_BOOST                        = 0x85,        /**< left channel input pga boost */
+    WM8978_FIELD_LEFT_CHANNEL_INPUT_BOOST_STAGE                      = 0x86,        /**< left channel input boost stage */
+    WM8978_FIELD_AUXILIARY_AMPLIFIER_LEFT_CHANNEL_INPUT_BOOST_STAGE  = 0x87,        /**< auxiliary amplifier left channel input boost stage */
+    WM8978_FIELD_RIGHT_CHANNEL_INPUT_PGA_BOOST                       = 0x88,        /**< right channel input pga boost */
+    WM8978_FIELD_RIGHT_CHANNEL_INPUT_BOOST_STAGE                     = 0x89,        /**< right channel input boost stage */
+    WM8978_FIELD_AUXILIARY_AMPLIFIER_RIGHT_CHANNEL_INPUT_BOOST_STAGE = 0x8A,        /**< auxiliary amplifier right channel input boost stage */
+    WM8978_FIELD_LEFT_DAC_OUTPUT_TO_RIGHT_OUTPUT_MIXER               = 0x8B,        /**< left dac output to right output mixer */
+    WM8978_FIELD_RIGHT_DAC_OUTPUT_TO_LEFT_OUTPUT_MIXER               = 0x8C,        /**< right dac output to left output mixer */
+    WM8978_FIELD_OUT4_BOOST                                          = 0x8D,        /**< out4 boost */
+    WM8978_FIELD_OUT3_BOOST                                          = 0x8E,        /**< out3 boost */
+    WM8978_FIELD_SPEAKER_BOOST                                       = 0x8F,        /**< speaker boost */
+    WM8978_FIELD_THERMAL_SHUTDOWN                                    = 0x90,        /**< thermal shutdown */
+    WM8978_FIELD_VREF_TO_ANALOGUE_OUTPUT_RESISTANCE                  = 0x91,        /**< vref to analogue output resistance */
+    WM8978_FIELD_AUX_LEFT_CHANNEL_INPUT_TO_LEFT_MIXER_VOLUME         = 0x92,        /**< aux left channel input to left mixer volume */
+    WM8978_FIELD_LEFT_AUXILIARY_INPUT_TO_LEFT_CHANNEL_OUTPUT_MIXER   = 0x93,        /**< left auxiliary input to left channel output mixer */
+    WM8978_FIELD_LEFT_BYPASS_VOLUME_CONTROL_TO_OUTPUT_CHANNEL_MIXER  = 0x94,        /**< left bypass volume control to output channel mixer */
+    WM8978_FIELD_LEFT_BYPASS_PATH_TO_LEFT_OUTPUT_MIXER               = 0x95,        /**< left bypass path to left output mixer */
+    WM8978_FIELD_LEFT_DAC_OUTPUT_TO_LEFT_OUTPUT_MIXER                = 0x96,        /**< left dac output to left output mixer */
+    WM8978_FIELD_AUX_RIGHT_CHANNEL_INPUT_TO_RIGHT_MIXER_VOLUME       = 0x97,        /**< aux right channel input to right mixer volume */
+    WM8978_FIELD_RIGHT_AUXILIARY_INPUT_TO_RIGHT_CHANNEL_OUTPUT_MIXER = 0x98,        /**< right auxiliary input to right channel output mixer */
+    WM8978_FIELD_RIGHT_BYPASS_VOLUME_CONTROL_TO_OUTPUT_CHANNEL_MIXER = 0x99,        /**< right bypass volume control to output channel mixer */
+    WM8978_FIELD_RIGHT_BYPASS_PATH_TO_RIGHT_OUTPUT_MIXER             = 0x9A,        /**< right bypass path to right output mixer */
+    WM8978_FIELD_RIGHT_DAC_OUTPUT_TO_RIGHT_OUTPUT_MIXER              = 0x9B,        /**< right dac output to right output mixer */
+    WM8978_FIELD_LOUT1_UPDATE                                        = 0x9C,        /**< lout1 update */
+    WM8978_FIELD_LOUT1_HEADPHONE_VOLUME_ZERO_CROSS                   = 0x9D,        /**< lout1 headphone volume zero cross */
+    WM8978_FIELD_LOUT1_LEFT_HEADPHONE_OUTPUT_MUTE                    = 0x9E,        /**< lout1 left headphone output mute */
+    WM8978_FIELD_LOUT1_LEFT_HEADPHONE_OUTPUT_VOLUME                  = 0x9F,        /**< lout1 left headphone output volume */
+    WM8978_FIELD_ROUT1_UPDATE                                        = 0xA0,        /**< rout1 update */
+    WM8978_FIELD_ROUT1_HEADPHONE_VOLUME_ZERO_CROSS                   = 0xA1,        /**< rout1 headphone volume zero cross */
+    WM8978_FIELD_ROUT1_RIGHT_HEADPHONE_OUTPUT_MUTE                   = 0xA2,        /**< rout1 right headphone output mute */
+    WM8978_FIELD_ROUT1_RIGHT_HEADPHONE_OUTPUT_VOLUME                 = 0xA3,        /**< rout1 right headphone output volume */
+    WM8978_FIELD_LOUT2_UPDATE                                        = 0xA4,        /**< lout2 update */
+    WM8978_FIELD_LOUT2_SPEAKER_VOLUME_ZERO_CROSS                     = 0xA5,        /**< lout2 speaker volume zero cross */
+    WM8978_FIELD_LOUT2_LEFT_SPEAKER_OUTPUT_MUTE                      = 0xA6,        /**< lout2 left speaker output mute */
+    WM8978_FIELD_LOUT2_LEFT_SPEAKER_OUTPUT_VOLUME                    = 0xA7,        /**< lout2 left speaker output volume */
+    WM8978_FIELD_ROUT2_UPDATE                                        = 0xA8,        /**< rout2 update */
+    WM8978_FIELD_ROUT2_SPEAKER_VOLUME_ZERO_CROSS                     = 0xA9,        /**< rout2 speaker volume zero cross */
+    WM8978_FIELD_ROUT2_RIGHT_SPEAKER_OUTPUT_MUTE                     = 0xAA,        /**< rout2 right speaker output mute */
+    WM8978_FIELD_ROUT2_RIGHT_SPEAKER_OUTPUT_VOLUME                   = 0xAB,        /**< rout2 right speaker output volume */
+    WM8978_FIELD_OUT3_MUTE                                           = 0xAC,        /**< out3 mute */
+    WM8978_FIELD_OUT4_MIXER_OUTPUT_TO_OUT3                           = 0xAD,        /**< out4 mixer output to out3 */
+    WM8978_FIELD_LEFT_ADC_INPUT_TO_OUT3                              = 0xAE,        /**< left adc input to out3 */
+    WM8978_FIELD_LEFT_DAC_MIXER_TO_OUT3                              = 0xAF,        /**< left dac mixer to out3 */
+    WM8978_FIELD_LEFT_DAC_OUTPUT_TO_OUT3                             = 0xB0,        /**< left dac output to out3 */
+    WM8978_FIELD_OUT4_MUTE                                           = 0xB1,        /**< out4 mute */
+    WM8978_FIELD_OUT4_ATTENUATED_BY_6DB                              = 0xB2,        /**< out4 attenuated by 6db */
+    WM8978_FIELD_LEFT_DAC_MIXER_TO_OUT4                              = 0xB3,        /**< left dac mixer to out4 */
+    WM8978_FIELD_LEFT_DAC_TO_OUT4                                    = 0xB4,        /**< left dac to out4 */
+    WM8978_FIELD_RIGHT_ADC_INPUT_TO_OUT4                             = 0xB5,        /**< right adc input to out4 */
+    WM8978_FIELD_RIGHT_DAC_MIXER_TO_OUT4                             = 0xB6,        /**< right dac mixer to out4 */
+    WM8978_FIELD_RIGHT_DAC_OUTPUT_TO_OUT4                            = 0xB7,        /**< right dac output to out4 */
+} wm8978_field_t;
+
+/**
+ * @brief wm8978 field value structure definition
+ */
+typedef struct wm8978_field_value_s
+{
+    wm8978_field_t field;        /**< register field */
+    uint16_t value;              /**< field value */
+} wm8978_field_value_t;
+
+/**
+ * @brief wm8978 ramp stage enumeration definition
+ */
+typedef enum
+{
+    WM8978_RAMP_STAGE_DAC       = 0x01,        /**< dac digital volume */
+    WM8978_RAMP_STAGE_ADC       = 0x02,        /**< adc digital volume */
+    WM8978_RAMP_STAGE_INPUT_PGA = 0x04,        /**< input pga volume */
+    WM8978_RAMP_STAGE_OUT1      = 0x08,        /**< out1 headphone volume */
+    WM8978_RAMP_STAGE_OUT2      = 0x10,        /**< out2 speaker volume */
+} wm8978_ramp_stage_t;
+
+/**
+ * @brief wm8978 ramp structure definition
+ */
+typedef struct wm8978_ramp_s
+{
+    uint8_t stage;                 /**< ramped stage mask */
+    uint8_t max_writes;            /**< max bus writes per tick */
+    uint8_t next;                  /**< first stage served by the next tick */
+    uint8_t target[5];             /**< target volume of each stage */
+    uint8_t start[5][2];           /**< left and right start volume of each stage */
+    uint8_t current[5][2];         /**< left and right current volume of each stage */
+    uint32_t duration_ms;          /**< ramp duration in ms */
+    uint32_t elapsed_ms;           /**< elapsed time in ms */
+} wm8978_ramp_t;
+
+/**
+ * @brief wm8978 eq band structure definition
+ */
+typedef struct wm8978_eq_band_s
+{
+    uint16_t freq_hz;                        /**< cut off or centre frequency in hz */
+    int8_t gain_db;                          /**< gain in db */
+    wm8978_eq_bandwidth_t bandwidth;         /**< bandwidth, only used by eq2 - eq4 */
+} wm8978_eq_band_t;
+
+/**
+ * @brief wm8978 eq preset structure definition
+ */
+typedef struct wm8978_eq_preset_s
+{
+    uint16_t reg[5];                 /**< eq1 - eq5 register bits */
+    int16_t freq_error_hz[5];        /**< requested minus achieved frequency in hz */
+    int8_t gain_error_db[5];         /**< requested minus achieved gain in db */
+} wm8978_eq_preset_t;
+
+/**
+ * @brief wm8978 clock plan structure definition
+ */
+typedef struct wm8978_clock_plan_s
+{
+    wm8978_clksel_t clksel;                         /**< sysclk source, the pll is powered only when selected */
+    wm8978_bool_t mclk_divide_by_2;                 /**< pll input prescaler */
+    uint8_t plln;                                   /**< pll integer ratio */
+    uint32_t pll_freq;                              /**< pll 24 bits fractional ratio */
+    wm8978_mclk_div_t mclk_div;                     /**< sysclk divider */
+    wm8978_bclk_div_t bclk_div;                     /**< bclk divider */
+    wm8978_approximate_sample_t sample_rate;        /**< approximate sample rate of the filters */
+    int32_t error_ppb;                              /**< achieved minus requested sample rate in ppb */
+} wm8978_clock_plan_t;
+
+/**
+ * @brief wm8978 drift estimator structure definition
+ */
+typedef struct wm8978_drift_s
+{
+    int32_t target;             /**< target buffer fill level */
+    int32_t kp;                 /**< proportional gain in ppb per fill unit */
+    int32_t ki;                 /**< integral gain in ppb per fill unit and update */
+    int32_t limit_ppb;          /**< max correction in ppb */
+    int32_t integral_ppb;       /**< integral term in ppb */
+    int32_t ppb;                /**< last correction in ppb */
+} wm8978_drift_t;
+
 /**
  * @brief wm8978 handle structure definition
  */
 typedef struct wm8978_handle_s
 {
-    uint8_t iic_addr;                                                                   /**< iic device address */
-    uint8_t (*iic_init)(void);                                                          /**< point to an iic_init function address */
-    uint8_t (*iic_deinit)(void);                                                        /**< point to an iic_deinit function address */
-    uint8_t (*iic_write)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);        /**< point to an iic_write function address */
-    void (*delay_ms)(uint32_t ms);                                                      /**< point to a delay_ms function address */
-    void (*debug_print)(const char *const fmt, ...);                                    /**< point to a debug_print function address */
-    uint16_t reg[58];                                                                   /**< reg buffer */
-    uint8_t inited;                                                                     /**< inited flag */
+    uint8_t iic_addr;                                                                              /**< iic device address */
+    uint8_t (*iic_init)(void);                                                                     /**< point to an iic_init function address */
+    uint8_t (*iic_deinit)(void);                                                                   /**< point to an iic_deinit function address */
+    uint8_t (*iic_write)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);                   /**< point to an iic_write function address */
+    void (*delay_ms)(uint32_t ms);                                                                 /**< point to a delay_ms function address */
+    void (*debug_print)(const char *const fmt, ...);                                               /**< point to a debug_print function address */
+    void *ctx;                                                                                     /**< user context passed to the ctx link functions */
+    uint8_t (*iic_init_ctx)(void *ctx);                                                            /**< point to an iic_init_ctx function address */
+    uint8_t (*iic_deinit_ctx)(void *ctx);                                                          /**< point to an iic_deinit_ctx function address */
+    uint8_t (*iic_write_ctx)(void *ctx, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);    /**< point to an iic_write_ctx function address */
+    void (*delay_ms_ctx)(void *ctx, uint32_t ms);                                                  /**< point to a delay_ms_ctx function address */
+    void (*lock)(void *ctx, uint8_t reg);                                                          /**< point to a register lock function address */
+    void (*unlock)(void *ctx, uint8_t reg);                                                        /**< point to a register unlock function address */
+    uint16_t reg[58];                                                                              /**< reg buffer */
+    uint8_t inited;                                                                                /**< inited flag */
 } wm8978_handle_t;
 
 /**
@@ -585,6 +867,63 @@ typedef struct wm8978_info_s
  */
 #define DRIVER_WM8978_LINK_DEBUG_PRINT(HANDLE, FUC)  (HANDLE)->debug_print = FUC
 
+/**
+ * @brief     link the user context passed to the ctx link functions
+ * @param[in] HANDLE pointer to a wm8978 handle structure
+ * @param[in] CTX pointer to a user context
+ * @note      none
+ */
+#define DRIVER_WM8978_LINK_CTX(HANDLE, CTX)                 (HANDLE)->ctx = CTX
+
+/**
+ * @brief     link iic_init_ctx function
+ * @param[in] HANDLE pointer to a wm8978 handle structure
+ * @param[in] FUC pointer to an iic_init_ctx function address
+ * @note      a linked ctx function is used instead of iic_init
+ */
+#define DRIVER_WM8978_LINK_IIC_INIT_CTX(HANDLE, FUC)        (HANDLE)->iic_init_ctx = FUC
+
+/**
+ * @brief     link iic_deinit_ctx function
+ * @param[in] HANDLE pointer to a wm8978 handle structure
+ * @param[in] FUC pointer to an iic_deinit_ctx function address
+ * @note      a linked ctx function is used instead of iic_deinit
+ */
+#define DRIVER_WM8978_LINK_IIC_DEINIT_CTX(HANDLE, FUC)      (HANDLE)->iic_deinit_ctx = FUC
+
+/**
+ * @brief     link iic_write_ctx function
+ * @param[in] HANDLE pointer to a wm8978 handle structure
+ * @param[in] FUC pointer to an iic_write_ctx function address
+ * @note      a linked ctx function is used instead of iic_write
+ */
+#define DRIVER_WM8978_LINK_IIC_WRITE_CTX(HANDLE, FUC)       (HANDLE)->iic_write_ctx = FUC
+
+/**
+ * @brief     link delay_ms_ctx function
+ * @param[in] HANDLE pointer to a wm8978 handle structure
+ * @param[in] FUC pointer to a delay_ms_ctx function address
+ * @note      a linked ctx function is used instead of delay_ms
+ */
+#define DRIVER_WM8978_LINK_DELAY_MS_CTX(HANDLE, FUC)        (HANDLE)->delay_ms_ctx = FUC
+
+/**
+ * @brief     link lock function
+ * @param[in] HANDLE pointer to a wm8978 handle structure
+ * @param[in] FUC pointer to a lock function address
+ * @note      optional, called with the register address before every read-modify-write,
+ *            callers on different registers may run concurrently
+ */
+#define DRIVER_WM8978_LINK_LOCK(HANDLE, FUC)                (HANDLE)->lock = FUC
+
+/**
+ * @brief     link unlock function
+ * @param[in] HANDLE pointer to a wm8978 handle structure
+ * @param[in] FUC pointer to an unlock function address
+ * @note      optional, called with the register address after every read-modify-write
+ */
+#define DRIVER_WM8978_LINK_UNLOCK(HANDLE, FUC)              (HANDLE)->unlock = FUC
+
 /**
  * @}
  */
@@ -619,6 +958,43 @@ uint8_t wm8978_info(wm8978_info_t *info);
  */
 uint8_t wm8978_init(wm8978_handle_t *handle);
 
+/**
+ * @brief     initialize several chips together
+ * @param[in] **handle pointer to a wm8978 handle array
+ * @param[in] num handle number
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic initialization failed
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 reset failed
+ * @note      every chip is reset first and all of them share one 100ms settle delay,
+ *            if one chip fails the buses already opened are closed again
+ */
+uint8_t wm8978_multi_init(wm8978_handle_t **handle, uint8_t num);
+
+/**
+ * @brief     set the iic address
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] addr iic address
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      call it before wm8978_init, 0 selects the default address
+ */
+uint8_t wm8978_set_addr(wm8978_handle_t *handle, uint8_t addr);
+
+/**
+ * @brief      get the iic address
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *addr pointer to an iic address buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t wm8978_get_addr(wm8978_handle_t *handle, uint8_t *addr);
+
 /**
  * @brief     close the chip
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -657,6 +1033,19 @@ uint8_t wm8978_soft_reset(wm8978_handle_t *handle);
  */
 uint8_t wm8978_set_dc_buffer(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get dc buffer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get dc buffer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_dc_buffer(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable out4 mixer
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -670,6 +1059,19 @@ uint8_t wm8978_set_dc_buffer(wm8978_handle_t *handle, wm8978_bool_t enable);
  */
 uint8_t wm8978_set_out4_mixer(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get out4 mixer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get out4 mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_out4_mixer(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable out3 mixer
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -683,6 +1085,19 @@ uint8_t wm8978_set_out4_mixer(wm8978_handle_t *handle, wm8978_bool_t enable);
  */
 uint8_t wm8978_set_out3_mixer(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get out3 mixer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get out3 mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_out3_mixer(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable pll
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -696,6 +1111,19 @@ uint8_t wm8978_set_out3_mixer(wm8978_handle_t *handle, wm8978_bool_t enable);
  */
 uint8_t wm8978_set_pll(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get pll status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get pll failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_pll(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable microphone bias
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -709,6 +1137,19 @@ uint8_t wm8978_set_pll(wm8978_handle_t *handle, wm8978_bool_t enable);
  */
 uint8_t wm8978_set_microphone_bias(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get microphone bias status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get microphone bias failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_microphone_bias(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable analogue amplifier bias
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -722,6 +1163,19 @@ uint8_t wm8978_set_microphone_bias(wm8978_handle_t *handle, wm8978_bool_t enable
  */
 uint8_t wm8978_set_analogue_amplifier_bias(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get analogue amplifier bias status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get analogue amplifier bias failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_analogue_amplifier_bias(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable unused input output tie off buffer
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -735,6 +1189,19 @@ uint8_t wm8978_set_analogue_amplifier_bias(wm8978_handle_t *handle, wm8978_bool_
  */
 uint8_t wm8978_set_unused_input_output_tie_off_buffer(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get unused input output tie off buffer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get unused input output tie off buffer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_unused_input_output_tie_off_buffer(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     set reference impedance
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -748,6 +1215,19 @@ uint8_t wm8978_set_unused_input_output_tie_off_buffer(wm8978_handle_t *handle, w
  */
 uint8_t wm8978_set_reference_impedance(wm8978_handle_t *handle, wm8978_impedance_t impedance);
 
+/**
+ * @brief      get reference impedance
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *impedance pointer to a reference impedance buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get reference impedance failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_reference_impedance(wm8978_handle_t *handle, wm8978_impedance_t *impedance);
+
 /**
  * @brief     enable or disable right out1
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -761,6 +1241,19 @@ uint8_t wm8978_set_reference_impedance(wm8978_handle_t *handle, wm8978_impedance
  */
 uint8_t wm8978_set_right_out1(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get right out1 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right out1 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_out1(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable left out1
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -774,6 +1267,19 @@ uint8_t wm8978_set_right_out1(wm8978_handle_t *handle, wm8978_bool_t enable);
  */
 uint8_t wm8978_set_left_out1(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get left out1 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left out1 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_out1(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable sleep
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -787,6 +1293,19 @@ uint8_t wm8978_set_left_out1(wm8978_handle_t *handle, wm8978_bool_t enable);
  */
 uint8_t wm8978_set_sleep(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get sleep status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get sleep failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_sleep(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable right channel input boost
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -800,6 +1319,19 @@ uint8_t wm8978_set_sleep(wm8978_handle_t *handle, wm8978_bool_t enable);
  */
 uint8_t wm8978_set_right_channel_input_boost(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get right channel input boost status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right channel input boost failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_channel_input_boost(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable left channel input boost
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -813,6 +1345,19 @@ uint8_t wm8978_set_right_channel_input_boost(wm8978_handle_t *handle, wm8978_boo
  */
 uint8_t wm8978_set_left_channel_input_boost(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get left channel input boost status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left channel input boost failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_channel_input_boost(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable right channel input pga
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -826,6 +1371,19 @@ uint8_t wm8978_set_left_channel_input_boost(wm8978_handle_t *handle, wm8978_bool
  */
 uint8_t wm8978_set_right_channel_input_pga(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get right channel input pga status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right channel input pga failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_channel_input_pga(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable left channel input pga
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -839,6 +1397,19 @@ uint8_t wm8978_set_right_channel_input_pga(wm8978_handle_t *handle, wm8978_bool_
  */
 uint8_t wm8978_set_left_channel_input_pga(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get left channel input pga status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left channel input pga failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_channel_input_pga(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable right channel adc
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -852,6 +1423,19 @@ uint8_t wm8978_set_left_channel_input_pga(wm8978_handle_t *handle, wm8978_bool_t
  */
 uint8_t wm8978_set_right_channel_adc(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get right channel adc status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right channel adc failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_channel_adc(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable left channel adc
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -865,6 +1449,19 @@ uint8_t wm8978_set_right_channel_adc(wm8978_handle_t *handle, wm8978_bool_t enab
  */
 uint8_t wm8978_set_left_channel_adc(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get left channel adc status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left channel adc failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_channel_adc(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable out4
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -878,6 +1475,19 @@ uint8_t wm8978_set_left_channel_adc(wm8978_handle_t *handle, wm8978_bool_t enabl
  */
 uint8_t wm8978_set_out4(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get out4 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get out4 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_out4(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable out3
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -891,6 +1501,19 @@ uint8_t wm8978_set_out4(wm8978_handle_t *handle, wm8978_bool_t enable);
  */
 uint8_t wm8978_set_out3(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get out3 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get out3 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_out3(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable left out2
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -905,7 +1528,20 @@ uint8_t wm8978_set_out3(wm8978_handle_t *handle, wm8978_bool_t enable);
 uint8_t wm8978_set_left_out2(wm8978_handle_t *handle, wm8978_bool_t enable);
 
 /**
- * @brief     enable or disable right out2
+ * @brief      get left out2 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left out2 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_out2(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
+/**
+ * @brief     enable or disable right out2
  * @param[in] *handle pointer to a wm8978 handle structure
  * @param[in] enable bool value
  * @return    status code
@@ -917,6 +1553,19 @@ uint8_t wm8978_set_left_out2(wm8978_handle_t *handle, wm8978_bool_t enable);
  */
 uint8_t wm8978_set_right_out2(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get right out2 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right out2 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_out2(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable right output channel mixer
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -930,6 +1579,19 @@ uint8_t wm8978_set_right_out2(wm8978_handle_t *handle, wm8978_bool_t enable);
  */
 uint8_t wm8978_set_right_output_channel_mixer(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get right output channel mixer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right output channel mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_output_channel_mixer(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable left output channel mixer
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -943,6 +1605,19 @@ uint8_t wm8978_set_right_output_channel_mixer(wm8978_handle_t *handle, wm8978_bo
  */
 uint8_t wm8978_set_left_output_channel_mixer(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get left output channel mixer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left output channel mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_output_channel_mixer(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable right channel dac
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -956,6 +1631,19 @@ uint8_t wm8978_set_left_output_channel_mixer(wm8978_handle_t *handle, wm8978_boo
  */
 uint8_t wm8978_set_right_channel_dac(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get right channel dac status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right channel dac failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_channel_dac(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable left channel dac
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -969,6 +1657,19 @@ uint8_t wm8978_set_right_channel_dac(wm8978_handle_t *handle, wm8978_bool_t enab
  */
 uint8_t wm8978_set_left_channel_dac(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get left channel dac status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left channel dac failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_channel_dac(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     set bclk polarity
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -982,6 +1683,19 @@ uint8_t wm8978_set_left_channel_dac(wm8978_handle_t *handle, wm8978_bool_t enabl
  */
 uint8_t wm8978_set_bclk_polarity(wm8978_handle_t *handle, wm8978_polarity_t polarity);
 
+/**
+ * @brief      get bclk polarity
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *polarity pointer to a bclk polarity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get bclk polarity failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_bclk_polarity(wm8978_handle_t *handle, wm8978_polarity_t *polarity);
+
 /**
  * @brief     set lrclk polarity
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -995,6 +1709,19 @@ uint8_t wm8978_set_bclk_polarity(wm8978_handle_t *handle, wm8978_polarity_t pola
  */
 uint8_t wm8978_set_lrclk_polarity(wm8978_handle_t *handle, wm8978_polarity_t polarity);
 
+/**
+ * @brief      get lrclk polarity
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *polarity pointer to a lrclk polarity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get lrclk polarity failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_lrclk_polarity(wm8978_handle_t *handle, wm8978_polarity_t *polarity);
+
 /**
  * @brief     set word length
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1008,6 +1735,19 @@ uint8_t wm8978_set_lrclk_polarity(wm8978_handle_t *handle, wm8978_polarity_t pol
  */
 uint8_t wm8978_set_word_length(wm8978_handle_t *handle, wm8978_word_length_t word_length);
 
+/**
+ * @brief      get word length
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *word_length pointer to an iis word length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get word length failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_word_length(wm8978_handle_t *handle, wm8978_word_length_t *word_length);
+
 /**
  * @brief     set data format
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1021,6 +1761,19 @@ uint8_t wm8978_set_word_length(wm8978_handle_t *handle, wm8978_word_length_t wor
  */
 uint8_t wm8978_set_data_format(wm8978_handle_t *handle, wm8978_data_format_t format);
 
+/**
+ * @brief      get data format
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *format pointer to a data format buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get data format failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_data_format(wm8978_handle_t *handle, wm8978_data_format_t *format);
+
 /**
  * @brief     set dac appear
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1034,6 +1787,19 @@ uint8_t wm8978_set_data_format(wm8978_handle_t *handle, wm8978_data_format_t for
  */
 uint8_t wm8978_set_dac_appear(wm8978_handle_t *handle, wm8978_appear_t appear);
 
+/**
+ * @brief      get dac appear
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *appear pointer to a dac appear side buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get dac appear failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_dac_appear(wm8978_handle_t *handle, wm8978_appear_t *appear);
+
 /**
  * @brief     set adc appear
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1047,6 +1813,19 @@ uint8_t wm8978_set_dac_appear(wm8978_handle_t *handle, wm8978_appear_t appear);
  */
 uint8_t wm8978_set_adc_appear(wm8978_handle_t *handle, wm8978_appear_t appear);
 
+/**
+ * @brief      get adc appear
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *appear pointer to an adc appear side buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get adc appear failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_adc_appear(wm8978_handle_t *handle, wm8978_appear_t *appear);
+
 /**
  * @brief     set channel
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1060,6 +1839,19 @@ uint8_t wm8978_set_adc_appear(wm8978_handle_t *handle, wm8978_appear_t appear);
  */
 uint8_t wm8978_set_channel(wm8978_handle_t *handle, wm8978_channel_t channel);
 
+/**
+ * @brief      get channel
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *channel pointer to an audio channel buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get channel failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_channel(wm8978_handle_t *handle, wm8978_channel_t *channel);
+
 /**
  * @brief     enable or disable companding 8bit mode
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1073,6 +1865,19 @@ uint8_t wm8978_set_channel(wm8978_handle_t *handle, wm8978_channel_t channel);
  */
 uint8_t wm8978_set_companding_8bit_mode(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get companding 8bit mode status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get companding 8bit mode failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_companding_8bit_mode(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     set dac companding
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1086,6 +1891,19 @@ uint8_t wm8978_set_companding_8bit_mode(wm8978_handle_t *handle, wm8978_bool_t e
  */
 uint8_t wm8978_set_dac_companding(wm8978_handle_t *handle, wm8978_companding_t companding);
 
+/**
+ * @brief      get dac companding
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *companding pointer to a dac companding buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get dac companding failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_dac_companding(wm8978_handle_t *handle, wm8978_companding_t *companding);
+
 /**
  * @brief     set adc companding
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1099,6 +1917,19 @@ uint8_t wm8978_set_dac_companding(wm8978_handle_t *handle, wm8978_companding_t c
  */
 uint8_t wm8978_set_adc_companding(wm8978_handle_t *handle, wm8978_companding_t companding);
 
+/**
+ * @brief      get adc companding
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *companding pointer to an adc companding buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get adc companding failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_adc_companding(wm8978_handle_t *handle, wm8978_companding_t *companding);
+
 /**
  * @brief     enable or disable loopback
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1112,6 +1943,19 @@ uint8_t wm8978_set_adc_companding(wm8978_handle_t *handle, wm8978_companding_t c
  */
 uint8_t wm8978_set_loopback(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get loopback status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get loopback failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_loopback(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     set clksel
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1125,6 +1969,19 @@ uint8_t wm8978_set_loopback(wm8978_handle_t *handle, wm8978_bool_t enable);
  */
 uint8_t wm8978_set_clksel(wm8978_handle_t *handle, wm8978_clksel_t clksel);
 
+/**
+ * @brief      get clksel
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *clksel pointer to a clksel buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get clksel failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_clksel(wm8978_handle_t *handle, wm8978_clksel_t *clksel);
+
 /**
  * @brief     set mclk div
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1138,6 +1995,19 @@ uint8_t wm8978_set_clksel(wm8978_handle_t *handle, wm8978_clksel_t clksel);
  */
 uint8_t wm8978_set_mclk_div(wm8978_handle_t *handle, wm8978_mclk_div_t d);
 
+/**
+ * @brief      get mclk div
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *d pointer to a mclk div buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get mclk div failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_mclk_div(wm8978_handle_t *handle, wm8978_mclk_div_t *d);
+
 /**
  * @brief     set bclk div
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1151,6 +2021,19 @@ uint8_t wm8978_set_mclk_div(wm8978_handle_t *handle, wm8978_mclk_div_t d);
  */
 uint8_t wm8978_set_bclk_div(wm8978_handle_t *handle, wm8978_bclk_div_t d);
 
+/**
+ * @brief      get bclk div
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *d pointer to a bclk div buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get bclk div failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_bclk_div(wm8978_handle_t *handle, wm8978_bclk_div_t *d);
+
 /**
  * @brief     set clock mode
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1164,6 +2047,19 @@ uint8_t wm8978_set_bclk_div(wm8978_handle_t *handle, wm8978_bclk_div_t d);
  */
 uint8_t wm8978_set_clock_mode(wm8978_handle_t *handle, wm8978_clock_mode_t mode);
 
+/**
+ * @brief      get clock mode
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *mode pointer to a clock mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get clock mode failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_clock_mode(wm8978_handle_t *handle, wm8978_clock_mode_t *mode);
+
 /**
  * @brief     set approximate sample rate
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1177,6 +2073,19 @@ uint8_t wm8978_set_clock_mode(wm8978_handle_t *handle, wm8978_clock_mode_t mode)
  */
 uint8_t wm8978_set_approximate_sample_rate(wm8978_handle_t *handle, wm8978_approximate_sample_t sample);
 
+/**
+ * @brief      get approximate sample rate
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *sample pointer to an approximate sample rate buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get approximate sample rate failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_approximate_sample_rate(wm8978_handle_t *handle, wm8978_approximate_sample_t *sample);
+
 /**
  * @brief     enable or disable slow clock
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1190,6 +2099,19 @@ uint8_t wm8978_set_approximate_sample_rate(wm8978_handle_t *handle, wm8978_appro
  */
 uint8_t wm8978_set_slow_clock(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get slow clock status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get slow clock failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_slow_clock(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     set pll div
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1203,6 +2125,19 @@ uint8_t wm8978_set_slow_clock(wm8978_handle_t *handle, wm8978_bool_t enable);
  */
 uint8_t wm8978_set_pll_div(wm8978_handle_t *handle, wm8978_pll_div_t d);
 
+/**
+ * @brief      get pll div
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *d pointer to a pll div buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get pll div failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_pll_div(wm8978_handle_t *handle, wm8978_pll_div_t *d);
+
 /**
  * @brief     set gpio1 polarity
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1216,6 +2151,19 @@ uint8_t wm8978_set_pll_div(wm8978_handle_t *handle, wm8978_pll_div_t d);
  */
 uint8_t wm8978_set_gpio1_polarity(wm8978_handle_t *handle, wm8978_polarity_t polarity);
 
+/**
+ * @brief      get gpio1 polarity
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *polarity pointer to a gpio1 polarity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get gpio1 polarity failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_gpio1_polarity(wm8978_handle_t *handle, wm8978_polarity_t *polarity);
+
 /**
  * @brief     set gpio1 select
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1229,6 +2177,19 @@ uint8_t wm8978_set_gpio1_polarity(wm8978_handle_t *handle, wm8978_polarity_t pol
  */
 uint8_t wm8978_set_gpio1_select(wm8978_handle_t *handle, wm8978_gpio1_sel_t sel);
 
+/**
+ * @brief      get gpio1 select
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *sel pointer to a gpio1 select buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get gpio1 select failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_gpio1_select(wm8978_handle_t *handle, wm8978_gpio1_sel_t *sel);
+
 /**
  * @brief     enable or disable vmid 1
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1242,6 +2203,19 @@ uint8_t wm8978_set_gpio1_select(wm8978_handle_t *handle, wm8978_gpio1_sel_t sel)
  */
 uint8_t wm8978_set_vmid_1(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get vmid 1 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get vmid 1 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_vmid_1(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable vmid 0
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1255,6 +2229,19 @@ uint8_t wm8978_set_vmid_1(wm8978_handle_t *handle, wm8978_bool_t enable);
  */
 uint8_t wm8978_set_vmid_0(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get vmid 0 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get vmid 0 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_vmid_0(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable jack detection
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1269,9 +2256,22 @@ uint8_t wm8978_set_vmid_0(wm8978_handle_t *handle, wm8978_bool_t enable);
 uint8_t wm8978_set_jack_detection(wm8978_handle_t *handle, wm8978_bool_t enable);
 
 /**
- * @brief     set jack gpio
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] sel jack gpio select
+ * @brief      get jack detection status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get jack detection failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_jack_detection(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
+/**
+ * @brief     set jack gpio
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] sel jack gpio select
  * @return    status code
  *            - 0 success
  *            - 1 set jack gpio failed
@@ -1281,6 +2281,19 @@ uint8_t wm8978_set_jack_detection(wm8978_handle_t *handle, wm8978_bool_t enable)
  */
 uint8_t wm8978_set_jack_gpio(wm8978_handle_t *handle, wm8978_jack_sel_t sel);
 
+/**
+ * @brief      get jack gpio
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *sel pointer to a jack gpio select buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get jack gpio failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_jack_gpio(wm8978_handle_t *handle, wm8978_jack_sel_t *sel);
+
 /**
  * @brief     enable or disable soft mute
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1294,6 +2307,19 @@ uint8_t wm8978_set_jack_gpio(wm8978_handle_t *handle, wm8978_jack_sel_t sel);
  */
 uint8_t wm8978_set_soft_mute(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get soft mute status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get soft mute failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_soft_mute(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     set dac oversample rate
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1307,6 +2333,19 @@ uint8_t wm8978_set_soft_mute(wm8978_handle_t *handle, wm8978_bool_t enable);
  */
 uint8_t wm8978_set_dac_oversample_rate(wm8978_handle_t *handle, wm8978_dac_oversample_rate_t rate);
 
+/**
+ * @brief      get dac oversample rate
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *rate pointer to a dac oversample rate buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get dac oversample rate failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_dac_oversample_rate(wm8978_handle_t *handle, wm8978_dac_oversample_rate_t *rate);
+
 /**
  * @brief     enable or disable amute
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1320,6 +2359,19 @@ uint8_t wm8978_set_dac_oversample_rate(wm8978_handle_t *handle, wm8978_dac_overs
  */
 uint8_t wm8978_set_amute(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get amute status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get amute failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_amute(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     set right dac output polarity
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1333,6 +2385,19 @@ uint8_t wm8978_set_amute(wm8978_handle_t *handle, wm8978_bool_t enable);
  */
 uint8_t wm8978_set_right_dac_output_polarity(wm8978_handle_t *handle, wm8978_polarity_t polarity);
 
+/**
+ * @brief      get right dac output polarity
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *polarity pointer to a right dac output polarity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right dac output polarity failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_dac_output_polarity(wm8978_handle_t *handle, wm8978_polarity_t *polarity);
+
 /**
  * @brief     set left dac output polarity
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1346,6 +2411,19 @@ uint8_t wm8978_set_right_dac_output_polarity(wm8978_handle_t *handle, wm8978_pol
  */
 uint8_t wm8978_set_left_dac_output_polarity(wm8978_handle_t *handle, wm8978_polarity_t polarity);
 
+/**
+ * @brief      get left dac output polarity
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *polarity pointer to a left dac output polarity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left dac output polarity failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_dac_output_polarity(wm8978_handle_t *handle, wm8978_polarity_t *polarity);
+
 /**
  * @brief     set dac left volume
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1360,6 +2438,20 @@ uint8_t wm8978_set_left_dac_output_polarity(wm8978_handle_t *handle, wm8978_pola
  */
 uint8_t wm8978_set_dac_left_volume(wm8978_handle_t *handle, wm8978_bool_t enable, uint8_t volume);
 
+/**
+ * @brief      get dac left volume
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to an update once flag buffer
+ * @param[out] *volume pointer to a volume buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get dac left volume failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_dac_left_volume(wm8978_handle_t *handle, wm8978_bool_t *enable, uint8_t *volume);
+
 /**
  * @brief     set dac right volume
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1374,6 +2466,20 @@ uint8_t wm8978_set_dac_left_volume(wm8978_handle_t *handle, wm8978_bool_t enable
  */
 uint8_t wm8978_set_dac_right_volume(wm8978_handle_t *handle, wm8978_bool_t enable, uint8_t volume);
 
+/**
+ * @brief      get dac right volume
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to an update once flag buffer
+ * @param[out] *volume pointer to a volume buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get dac right volume failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_dac_right_volume(wm8978_handle_t *handle, wm8978_bool_t *enable, uint8_t *volume);
+
 /**
  * @brief     set jack logic 1
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1388,6 +2494,20 @@ uint8_t wm8978_set_dac_right_volume(wm8978_handle_t *handle, wm8978_bool_t enabl
  */
 uint8_t wm8978_set_jack_logic_1(wm8978_handle_t *handle, wm8978_jack_t jack, wm8978_bool_t enable);
 
+/**
+ * @brief      get jack logic 1
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  jack jack operation
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get jack logic 1 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_jack_logic_1(wm8978_handle_t *handle, wm8978_jack_t jack, wm8978_bool_t *enable);
+
 /**
  * @brief     set jack logic 0
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1402,6 +2522,20 @@ uint8_t wm8978_set_jack_logic_1(wm8978_handle_t *handle, wm8978_jack_t jack, wm8
  */
 uint8_t wm8978_set_jack_logic_0(wm8978_handle_t *handle, wm8978_jack_t jack, wm8978_bool_t enable);
 
+/**
+ * @brief      get jack logic 0
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  jack jack operation
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get jack logic 0 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_jack_logic_0(wm8978_handle_t *handle, wm8978_jack_t jack, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable high pass filter
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1415,6 +2549,19 @@ uint8_t wm8978_set_jack_logic_0(wm8978_handle_t *handle, wm8978_jack_t jack, wm8
  */
 uint8_t wm8978_set_high_pass_filter(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get high pass filter status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get high pass filter failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_high_pass_filter(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     set chip mode
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1428,6 +2575,19 @@ uint8_t wm8978_set_high_pass_filter(wm8978_handle_t *handle, wm8978_bool_t enabl
  */
 uint8_t wm8978_set_mode(wm8978_handle_t *handle, wm8978_mode_t mode);
 
+/**
+ * @brief      get chip mode
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *mode pointer to a mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get chip mode failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_mode(wm8978_handle_t *handle, wm8978_mode_t *mode);
+
 /**
  * @brief     set high pass filter cut off
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1441,6 +2601,19 @@ uint8_t wm8978_set_mode(wm8978_handle_t *handle, wm8978_mode_t mode);
  */
 uint8_t wm8978_set_high_pass_filter_cut_off(wm8978_handle_t *handle, wm8978_high_pass_filter_cut_off_t cut);
 
+/**
+ * @brief      get high pass filter cut off
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *cut pointer to a high pass filter cut off buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get high pass filter cut off failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_high_pass_filter_cut_off(wm8978_handle_t *handle, wm8978_high_pass_filter_cut_off_t *cut);
+
 /**
  * @brief     set adc oversample rate
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1454,6 +2627,19 @@ uint8_t wm8978_set_high_pass_filter_cut_off(wm8978_handle_t *handle, wm8978_high
  */
 uint8_t wm8978_set_adc_oversample_rate(wm8978_handle_t *handle, wm8978_adc_oversample_rate_t rate);
 
+/**
+ * @brief      get adc oversample rate
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *rate pointer to an adc oversample rate buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get adc oversample rate failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_adc_oversample_rate(wm8978_handle_t *handle, wm8978_adc_oversample_rate_t *rate);
+
 /**
  * @brief     set adc right channel polarity
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1467,6 +2653,19 @@ uint8_t wm8978_set_adc_oversample_rate(wm8978_handle_t *handle, wm8978_adc_overs
  */
 uint8_t wm8978_set_adc_right_channel_polarity(wm8978_handle_t *handle, wm8978_polarity_t polarity);
 
+/**
+ * @brief      get adc right channel polarity
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *polarity pointer to an adc polarity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get adc right channel polarity failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_adc_right_channel_polarity(wm8978_handle_t *handle, wm8978_polarity_t *polarity);
+
 /**
  * @brief     set adc left channel polarity
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1480,6 +2679,19 @@ uint8_t wm8978_set_adc_right_channel_polarity(wm8978_handle_t *handle, wm8978_po
  */
 uint8_t wm8978_set_adc_left_channel_polarity(wm8978_handle_t *handle, wm8978_polarity_t polarity);
 
+/**
+ * @brief      get adc left channel polarity
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *polarity pointer to an adc polarity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get adc left channel polarity failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_adc_left_channel_polarity(wm8978_handle_t *handle, wm8978_polarity_t *polarity);
+
 /**
  * @brief     set adc left volume
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1494,6 +2706,20 @@ uint8_t wm8978_set_adc_left_channel_polarity(wm8978_handle_t *handle, wm8978_pol
  */
 uint8_t wm8978_set_adc_left_volume(wm8978_handle_t *handle, wm8978_bool_t enable, uint8_t volume);
 
+/**
+ * @brief      get adc left volume
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to an update once flag buffer
+ * @param[out] *volume pointer to a volume buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get adc left volume failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_adc_left_volume(wm8978_handle_t *handle, wm8978_bool_t *enable, uint8_t *volume);
+
 /**
  * @brief     set adc right volume
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1508,6 +2734,20 @@ uint8_t wm8978_set_adc_left_volume(wm8978_handle_t *handle, wm8978_bool_t enable
  */
 uint8_t wm8978_set_adc_right_volume(wm8978_handle_t *handle, wm8978_bool_t enable, uint8_t volume);
 
+/**
+ * @brief      get adc right volume
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to an update once flag buffer
+ * @param[out] *volume pointer to a volume buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get adc right volume failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_adc_right_volume(wm8978_handle_t *handle, wm8978_bool_t *enable, uint8_t *volume);
+
 /**
  * @brief      convert the volume data to the register raw data
  * @param[in]  *handle pointer to a wm8978 handle structure
@@ -1534,6 +2774,33 @@ uint8_t wm8978_volume_convert_to_register(wm8978_handle_t *handle, float db, uin
  */
 uint8_t wm8978_volume_convert_to_data(wm8978_handle_t *handle, uint8_t reg, float *db);
 
+/**
+ * @brief      convert the volume in centi-db to the register raw data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  cdb volume in 0.01db
+ * @param[out] *reg pointer to a volume raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 cdb is over range
+ * @note       the step is 50 cdb, the result is rounded to the nearest step
+ */
+uint8_t wm8978_volume_cdb_convert_to_register(wm8978_handle_t *handle, int16_t cdb, uint8_t *reg);
+
+/**
+ * @brief      convert the volume register raw data to centi-db
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  reg volume raw data
+ * @param[out] *cdb pointer to a volume buffer in 0.01db
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_volume_cdb_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int16_t *cdb);
+
 /**
  * @brief     set equaliser apply
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1547,6 +2814,19 @@ uint8_t wm8978_volume_convert_to_data(wm8978_handle_t *handle, uint8_t reg, floa
  */
 uint8_t wm8978_set_equaliser_apply(wm8978_handle_t *handle, wm8978_equaliser_t equaliser);
 
+/**
+ * @brief      get equaliser apply
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *equaliser pointer to an equaliser buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get equaliser apply failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_equaliser_apply(wm8978_handle_t *handle, wm8978_equaliser_t *equaliser);
+
 /**
  * @brief     set eq1 cut off
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1560,6 +2840,19 @@ uint8_t wm8978_set_equaliser_apply(wm8978_handle_t *handle, wm8978_equaliser_t e
  */
 uint8_t wm8978_set_eq1_cut_off(wm8978_handle_t *handle, wm8978_eq1_band_cut_off_t cut_off);
 
+/**
+ * @brief      get eq1 cut off
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *cut_off pointer to a cut off freq buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get eq1 cut off failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_eq1_cut_off(wm8978_handle_t *handle, wm8978_eq1_band_cut_off_t *cut_off);
+
 /**
  * @brief     set eq1 gain
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1574,6 +2867,19 @@ uint8_t wm8978_set_eq1_cut_off(wm8978_handle_t *handle, wm8978_eq1_band_cut_off_
  */
 uint8_t wm8978_set_eq1_gain(wm8978_handle_t *handle, uint8_t gain);
 
+/**
+ * @brief      get eq1 gain
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *gain pointer to an eq1 gain buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get eq1 gain failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_eq1_gain(wm8978_handle_t *handle, uint8_t *gain);
+
 /**
  * @brief     set eq2 bandwidth
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1587,6 +2893,19 @@ uint8_t wm8978_set_eq1_gain(wm8978_handle_t *handle, uint8_t gain);
  */
 uint8_t wm8978_set_eq2_bandwidth(wm8978_handle_t *handle, wm8978_eq_bandwidth_t width);
 
+/**
+ * @brief      get eq2 bandwidth
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *width pointer to a bandwidth buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get eq2 bandwidth failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_eq2_bandwidth(wm8978_handle_t *handle, wm8978_eq_bandwidth_t *width);
+
 /**
  * @brief     set eq2 centre freq
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1600,6 +2919,19 @@ uint8_t wm8978_set_eq2_bandwidth(wm8978_handle_t *handle, wm8978_eq_bandwidth_t
  */
 uint8_t wm8978_set_eq2_centre_freq(wm8978_handle_t *handle, wm8978_eq2_band_centre_freq_t freq);
 
+/**
+ * @brief      get eq2 centre freq
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *freq pointer to a centre freq buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get eq2 centre freq failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_eq2_centre_freq(wm8978_handle_t *handle, wm8978_eq2_band_centre_freq_t *freq);
+
 /**
  * @brief     set eq2 gain
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1614,6 +2946,19 @@ uint8_t wm8978_set_eq2_centre_freq(wm8978_handle_t *handle, wm8978_eq2_band_cent
  */
 uint8_t wm8978_set_eq2_gain(wm8978_handle_t *handle, uint8_t gain);
 
+/**
+ * @brief      get eq2 gain
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *gain pointer to an eq2 gain buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get eq2 gain failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_eq2_gain(wm8978_handle_t *handle, uint8_t *gain);
+
 /**
  * @brief     set eq3 bandwidth
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1627,6 +2972,19 @@ uint8_t wm8978_set_eq2_gain(wm8978_handle_t *handle, uint8_t gain);
  */
 uint8_t wm8978_set_eq3_bandwidth(wm8978_handle_t *handle, wm8978_eq_bandwidth_t width);
 
+/**
+ * @brief      get eq3 bandwidth
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *width pointer to a bandwidth buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get eq3 bandwidth failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_eq3_bandwidth(wm8978_handle_t *handle, wm8978_eq_bandwidth_t *width);
+
 /**
  * @brief     set eq3 centre freq
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1640,6 +2998,19 @@ uint8_t wm8978_set_eq3_bandwidth(wm8978_handle_t *handle, wm8978_eq_bandwidth_t
  */
 uint8_t wm8978_set_eq3_centre_freq(wm8978_handle_t *handle, wm8978_eq3_band_centre_freq_t freq);
 
+/**
+ * @brief      get eq3 centre freq
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *freq pointer to a centre freq buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get eq3 centre freq failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_eq3_centre_freq(wm8978_handle_t *handle, wm8978_eq3_band_centre_freq_t *freq);
+
 /**
  * @brief     set eq3 gain
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1654,6 +3025,19 @@ uint8_t wm8978_set_eq3_centre_freq(wm8978_handle_t *handle, wm8978_eq3_band_cent
  */
 uint8_t wm8978_set_eq3_gain(wm8978_handle_t *handle, uint8_t gain);
 
+/**
+ * @brief      get eq3 gain
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *gain pointer to an eq3 gain buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get eq3 gain failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_eq3_gain(wm8978_handle_t *handle, uint8_t *gain);
+
 /**
  * @brief     set eq4 bandwidth
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1667,6 +3051,19 @@ uint8_t wm8978_set_eq3_gain(wm8978_handle_t *handle, uint8_t gain);
  */
 uint8_t wm8978_set_eq4_bandwidth(wm8978_handle_t *handle, wm8978_eq_bandwidth_t width);
 
+/**
+ * @brief      get eq4 bandwidth
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *width pointer to a bandwidth buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get eq4 bandwidth failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_eq4_bandwidth(wm8978_handle_t *handle, wm8978_eq_bandwidth_t *width);
+
 /**
  * @brief     set eq4 centre freq
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1680,6 +3077,19 @@ uint8_t wm8978_set_eq4_bandwidth(wm8978_handle_t *handle, wm8978_eq_bandwidth_t
  */
 uint8_t wm8978_set_eq4_centre_freq(wm8978_handle_t *handle, wm8978_eq4_band_centre_freq_t freq);
 
+/**
+ * @brief      get eq4 centre freq
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *freq pointer to a centre freq buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get eq4 centre freq failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_eq4_centre_freq(wm8978_handle_t *handle, wm8978_eq4_band_centre_freq_t *freq);
+
 /**
  * @brief     set eq4 gain
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1694,6 +3104,19 @@ uint8_t wm8978_set_eq4_centre_freq(wm8978_handle_t *handle, wm8978_eq4_band_cent
  */
 uint8_t wm8978_set_eq4_gain(wm8978_handle_t *handle, uint8_t gain);
 
+/**
+ * @brief      get eq4 gain
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *gain pointer to an eq4 gain buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get eq4 gain failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_eq4_gain(wm8978_handle_t *handle, uint8_t *gain);
+
 /**
  * @brief     set eq5 cut off
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1707,6 +3130,19 @@ uint8_t wm8978_set_eq4_gain(wm8978_handle_t *handle, uint8_t gain);
  */
 uint8_t wm8978_set_eq5_cut_off(wm8978_handle_t *handle, wm8978_eq5_band_cut_off_t cut_off);
 
+/**
+ * @brief      get eq5 cut off
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *cut_off pointer to a cut off freq buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get eq5 cut off failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_eq5_cut_off(wm8978_handle_t *handle, wm8978_eq5_band_cut_off_t *cut_off);
+
 /**
  * @brief     set eq5 gain
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1721,6 +3157,19 @@ uint8_t wm8978_set_eq5_cut_off(wm8978_handle_t *handle, wm8978_eq5_band_cut_off_
  */
 uint8_t wm8978_set_eq5_gain(wm8978_handle_t *handle, uint8_t gain);
 
+/**
+ * @brief      get eq5 gain
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *gain pointer to an eq5 gain buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get eq5 gain failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_eq5_gain(wm8978_handle_t *handle, uint8_t *gain);
+
 /**
  * @brief      convert the eq gain to the register raw data
  * @param[in]  *handle pointer to a wm8978 handle structure
@@ -1760,6 +3209,19 @@ uint8_t wm8978_eq_gain_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int
  */
 uint8_t wm8978_set_dac_digital_limiter(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get dac digital limiter status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get dac digital limiter failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_dac_digital_limiter(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     set dac limiter decay
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1773,6 +3235,19 @@ uint8_t wm8978_set_dac_digital_limiter(wm8978_handle_t *handle, wm8978_bool_t en
  */
 uint8_t wm8978_set_dac_limiter_decay(wm8978_handle_t *handle, wm8978_dac_limiter_decay_t decay);
 
+/**
+ * @brief      get dac limiter decay
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *decay pointer to a dac limiter decay buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get dac limiter decay failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_dac_limiter_decay(wm8978_handle_t *handle, wm8978_dac_limiter_decay_t *decay);
+
 /**
  * @brief     set dac limiter attack
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1786,6 +3261,19 @@ uint8_t wm8978_set_dac_limiter_decay(wm8978_handle_t *handle, wm8978_dac_limiter
  */
 uint8_t wm8978_set_dac_limiter_attack(wm8978_handle_t *handle, wm8978_dac_limiter_attack_t attack);
 
+/**
+ * @brief      get dac limiter attack
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *attack pointer to a dac limiter attack buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get dac limiter attack failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_dac_limiter_attack(wm8978_handle_t *handle, wm8978_dac_limiter_attack_t *attack);
+
 /**
  * @brief     set dac limiter level
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1799,6 +3287,19 @@ uint8_t wm8978_set_dac_limiter_attack(wm8978_handle_t *handle, wm8978_dac_limite
  */
 uint8_t wm8978_set_dac_limiter_level(wm8978_handle_t *handle, wm8978_dac_limiter_level_t level);
 
+/**
+ * @brief      get dac limiter level
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *level pointer to a dac limiter level buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get dac limiter level failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_dac_limiter_level(wm8978_handle_t *handle, wm8978_dac_limiter_level_t *level);
+
 /**
  * @brief     set dac limiter volume boost
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1813,6 +3314,19 @@ uint8_t wm8978_set_dac_limiter_level(wm8978_handle_t *handle, wm8978_dac_limiter
  */
 uint8_t wm8978_set_dac_limiter_volume_boost(wm8978_handle_t *handle, uint8_t db);
 
+/**
+ * @brief      get dac limiter volume boost
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *db pointer to a db buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get dac limiter volume boost failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_dac_limiter_volume_boost(wm8978_handle_t *handle, uint8_t *db);
+
 /**
  * @brief     enable or disable notch filter
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1826,6 +3340,19 @@ uint8_t wm8978_set_dac_limiter_volume_boost(wm8978_handle_t *handle, uint8_t db)
  */
 uint8_t wm8978_set_notch_filter(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get notch filter status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get notch filter failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_notch_filter(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     set notch filter a0 coefficient bit13 - bit7
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1841,6 +3368,20 @@ uint8_t wm8978_set_notch_filter(wm8978_handle_t *handle, wm8978_bool_t enable);
  */
 uint8_t wm8978_set_notch_filter_a0_coefficient_bit_13_7(wm8978_handle_t *handle, wm8978_bool_t update_once, uint8_t coefficient);
 
+/**
+ * @brief      get notch filter a0 coefficient bit13 - bit7
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *update_once pointer to a bool value buffer
+ * @param[out] *coefficient pointer to a coefficient buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get notch filter a0 coefficient bit13 - bit7 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_notch_filter_a0_coefficient_bit_13_7(wm8978_handle_t *handle, wm8978_bool_t *update_once, uint8_t *coefficient);
+
 /**
  * @brief     set notch filter a0 coefficient bit6 - bit0
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1856,6 +3397,20 @@ uint8_t wm8978_set_notch_filter_a0_coefficient_bit_13_7(wm8978_handle_t *handle,
  */
 uint8_t wm8978_set_notch_filter_a0_coefficient_bit_6_0(wm8978_handle_t *handle, wm8978_bool_t update_once, uint8_t coefficient);
 
+/**
+ * @brief      get notch filter a0 coefficient bit6 - bit0
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *update_once pointer to a bool value buffer
+ * @param[out] *coefficient pointer to a coefficient buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get notch filter a0 coefficient bit6 - bit0 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_notch_filter_a0_coefficient_bit_6_0(wm8978_handle_t *handle, wm8978_bool_t *update_once, uint8_t *coefficient);
+
 /**
  * @brief     set notch filter a1 coefficient bit13 - bit7
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1871,6 +3426,20 @@ uint8_t wm8978_set_notch_filter_a0_coefficient_bit_6_0(wm8978_handle_t *handle,
  */
 uint8_t wm8978_set_notch_filter_a1_coefficient_bit_13_7(wm8978_handle_t *handle, wm8978_bool_t update_once, uint8_t coefficient);
 
+/**
+ * @brief      get notch filter a1 coefficient bit13 - bit7
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *update_once pointer to a bool value buffer
+ * @param[out] *coefficient pointer to a coefficient buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get notch filter a1 coefficient bit13 - bit7 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_notch_filter_a1_coefficient_bit_13_7(wm8978_handle_t *handle, wm8978_bool_t *update_once, uint8_t *coefficient);
+
 /**
  * @brief     set notch filter a1 coefficient bit6 - bit0
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1886,6 +3455,20 @@ uint8_t wm8978_set_notch_filter_a1_coefficient_bit_13_7(wm8978_handle_t *handle,
  */
 uint8_t wm8978_set_notch_filter_a1_coefficient_bit_6_0(wm8978_handle_t *handle, wm8978_bool_t update_once, uint8_t coefficient);
 
+/**
+ * @brief      get notch filter a1 coefficient bit6 - bit0
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *update_once pointer to a bool value buffer
+ * @param[out] *coefficient pointer to a coefficient buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get notch filter a1 coefficient bit6 - bit0 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_notch_filter_a1_coefficient_bit_6_0(wm8978_handle_t *handle, wm8978_bool_t *update_once, uint8_t *coefficient);
+
 /**
  * @brief     set alc
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1899,6 +3482,19 @@ uint8_t wm8978_set_notch_filter_a1_coefficient_bit_6_0(wm8978_handle_t *handle,
  */
 uint8_t wm8978_set_alc(wm8978_handle_t *handle, wm8978_alc_t alc);
 
+/**
+ * @brief      get alc
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *alc pointer to an alc buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get alc failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_alc(wm8978_handle_t *handle, wm8978_alc_t *alc);
+
 /**
  * @brief     set alc max gain
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1912,6 +3508,19 @@ uint8_t wm8978_set_alc(wm8978_handle_t *handle, wm8978_alc_t alc);
  */
 uint8_t wm8978_set_alc_max_gain(wm8978_handle_t *handle, wm8978_max_gain_t gain);
 
+/**
+ * @brief      get alc max gain
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *gain pointer to an alc max gain buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get alc max gain failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_alc_max_gain(wm8978_handle_t *handle, wm8978_max_gain_t *gain);
+
 /**
  * @brief     set alc min gain
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1925,6 +3534,19 @@ uint8_t wm8978_set_alc_max_gain(wm8978_handle_t *handle, wm8978_max_gain_t gain)
  */
 uint8_t wm8978_set_alc_min_gain(wm8978_handle_t *handle, wm8978_min_gain_t gain);
 
+/**
+ * @brief      get alc min gain
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *gain pointer to an alc min gain buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get alc min gain failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_alc_min_gain(wm8978_handle_t *handle, wm8978_min_gain_t *gain);
+
 /**
  * @brief     set alc hold time
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1939,6 +3561,19 @@ uint8_t wm8978_set_alc_min_gain(wm8978_handle_t *handle, wm8978_min_gain_t gain)
  */
 uint8_t wm8978_set_alc_hold_time(wm8978_handle_t *handle, uint8_t t);
 
+/**
+ * @brief      get alc hold time
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *t pointer to an alc hold time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get alc hold time failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_alc_hold_time(wm8978_handle_t *handle, uint8_t *t);
+
 /**
  * @brief      convert the alc hold time to the register raw data
  * @param[in]  *handle pointer to a wm8978 handle structure
@@ -1965,6 +3600,33 @@ uint8_t wm8978_alc_hold_time_convert_to_register(wm8978_handle_t *handle, float
  */
 uint8_t wm8978_alc_hold_time_convert_to_data(wm8978_handle_t *handle, uint8_t reg, float *ms);
 
+/**
+ * @brief      convert the alc hold time in us to the register raw data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  us alc hold time in us
+ * @param[out] *reg pointer to an alc hold time raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 us is over range
+ * @note       the result is rounded to the nearest step
+ */
+uint8_t wm8978_alc_hold_time_us_convert_to_register(wm8978_handle_t *handle, uint32_t us, uint8_t *reg);
+
+/**
+ * @brief      convert the alc hold time register raw data to us
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  reg alc hold time raw data
+ * @param[out] *us pointer to an alc hold time buffer in us
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_alc_hold_time_us_convert_to_data(wm8978_handle_t *handle, uint8_t reg, uint32_t *us);
+
 /**
  * @brief     set alc level
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1978,6 +3640,19 @@ uint8_t wm8978_alc_hold_time_convert_to_data(wm8978_handle_t *handle, uint8_t re
  */
 uint8_t wm8978_set_alc_level(wm8978_handle_t *handle, wm8978_alc_level_t level);
 
+/**
+ * @brief      get alc level
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *level pointer to a level buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get alc level failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_alc_level(wm8978_handle_t *handle, wm8978_alc_level_t *level);
+
 /**
  * @brief     set alc mode
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -1991,6 +3666,19 @@ uint8_t wm8978_set_alc_level(wm8978_handle_t *handle, wm8978_alc_level_t level);
  */
 uint8_t wm8978_set_alc_mode(wm8978_handle_t *handle, wm8978_alc_mode_t mode);
 
+/**
+ * @brief      get alc mode
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *mode pointer to an alc mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get alc mode failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_alc_mode(wm8978_handle_t *handle, wm8978_alc_mode_t *mode);
+
 /**
  * @brief     set alc decay
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2005,6 +3693,19 @@ uint8_t wm8978_set_alc_mode(wm8978_handle_t *handle, wm8978_alc_mode_t mode);
  */
 uint8_t wm8978_set_alc_decay(wm8978_handle_t *handle, uint8_t decay);
 
+/**
+ * @brief      get alc decay
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *decay pointer to a decay buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get alc decay failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_alc_decay(wm8978_handle_t *handle, uint8_t *decay);
+
 /**
  * @brief     set alc attack
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2019,6 +3720,19 @@ uint8_t wm8978_set_alc_decay(wm8978_handle_t *handle, uint8_t decay);
  */
 uint8_t wm8978_set_alc_attack(wm8978_handle_t *handle, uint8_t attack);
 
+/**
+ * @brief      get alc attack
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *attack pointer to an attack buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get alc attack failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_alc_attack(wm8978_handle_t *handle, uint8_t *attack);
+
 /**
  * @brief     enable or disable alc noise gate
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2032,6 +3746,19 @@ uint8_t wm8978_set_alc_attack(wm8978_handle_t *handle, uint8_t attack);
  */
 uint8_t wm8978_set_alc_noise_gate(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get alc noise gate status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get alc noise gate failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_alc_noise_gate(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     set alc noise gate threshold
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2047,17 +3774,30 @@ uint8_t wm8978_set_alc_noise_gate(wm8978_handle_t *handle, wm8978_bool_t enable)
 uint8_t wm8978_set_alc_noise_gate_threshold(wm8978_handle_t *handle, uint8_t threshold);
 
 /**
- * @brief      convert the alc noise gate threshold to the register raw data
+ * @brief      get alc noise gate threshold
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  db alc noise gate threshold in db
- * @param[out] *reg pointer to an alc noise gate threshold raw data buffer
+ * @param[out] *threshold pointer to an alc noise gate threshold buffer
  * @return     status code
  *             - 0 success
+ *             - 1 get alc noise gate threshold failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_alc_noise_gate_threshold_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg);
+uint8_t wm8978_get_alc_noise_gate_threshold(wm8978_handle_t *handle, uint8_t *threshold);
+
+/**
+ * @brief      convert the alc noise gate threshold to the register raw data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  db alc noise gate threshold in db
+ * @param[out] *reg pointer to an alc noise gate threshold raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_alc_noise_gate_threshold_convert_to_register(wm8978_handle_t *handle, int8_t db, uint8_t *reg);
 
 /**
  * @brief      convert the alc noise gate threshold register raw data to the real data
@@ -2085,6 +3825,19 @@ uint8_t wm8978_alc_noise_gate_threshold_convert_to_data(wm8978_handle_t *handle,
  */
 uint8_t wm8978_set_mclk_divide_by_2(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get mclk divide by 2 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get mclk divide by 2 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_mclk_divide_by_2(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     set plln
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2099,6 +3852,19 @@ uint8_t wm8978_set_mclk_divide_by_2(wm8978_handle_t *handle, wm8978_bool_t enabl
  */
 uint8_t wm8978_set_plln(wm8978_handle_t *handle, uint8_t n);
 
+/**
+ * @brief      get plln
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *n pointer to a pll buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get plln failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_plln(wm8978_handle_t *handle, uint8_t *n);
+
 /**
  * @brief     set pll freq
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2112,6 +3878,19 @@ uint8_t wm8978_set_plln(wm8978_handle_t *handle, uint8_t n);
  */
 uint8_t wm8978_set_pll_freq(wm8978_handle_t *handle, uint32_t freq);
 
+/**
+ * @brief      get pll freq
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *freq pointer to a pll freq buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get pll freq failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_pll_freq(wm8978_handle_t *handle, uint32_t *freq);
+
 /**
  * @brief     set depth 3d
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2126,6 +3905,19 @@ uint8_t wm8978_set_pll_freq(wm8978_handle_t *handle, uint32_t freq);
  */
 uint8_t wm8978_set_depth_3d(wm8978_handle_t *handle, uint8_t depth);
 
+/**
+ * @brief      get depth 3d
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *depth pointer to a 3d depth buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get depth 3d failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_depth_3d(wm8978_handle_t *handle, uint8_t *depth);
+
 /**
  * @brief      convert the depth 3d to the register raw data
  * @param[in]  *handle pointer to a wm8978 handle structure
@@ -2152,6 +3944,33 @@ uint8_t wm8978_depth_3d_convert_to_register(wm8978_handle_t *handle, float perce
  */
 uint8_t wm8978_depth_3d_convert_to_data(wm8978_handle_t *handle, uint8_t reg, float *percent);
 
+/**
+ * @brief      convert the depth 3d in permille to the register raw data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  permille depth in 0.1%
+ * @param[out] *reg pointer to a depth 3d raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 permille is over range
+ * @note       the step is 1000 / 15 permille, the result is rounded to the nearest step
+ */
+uint8_t wm8978_depth_3d_permille_convert_to_register(wm8978_handle_t *handle, uint16_t permille, uint8_t *reg);
+
+/**
+ * @brief      convert the depth 3d register raw data to permille
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  reg depth 3d raw data
+ * @param[out] *permille pointer to a depth buffer in 0.1%
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_depth_3d_permille_convert_to_data(wm8978_handle_t *handle, uint8_t reg, uint16_t *permille);
+
 /**
  * @brief     enable or disable mute input to inv rout2 mixer
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2165,6 +3984,19 @@ uint8_t wm8978_depth_3d_convert_to_data(wm8978_handle_t *handle, uint8_t reg, fl
  */
 uint8_t wm8978_set_mute_input_to_inv_rout2_mixer(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get mute input to inv rout2 mixer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get mute input to inv rout2 mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_mute_input_to_inv_rout2_mixer(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable inv rout2 mixer
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2178,6 +4010,19 @@ uint8_t wm8978_set_mute_input_to_inv_rout2_mixer(wm8978_handle_t *handle, wm8978
  */
 uint8_t wm8978_set_inv_rout2_mixer(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get inv rout2 mixer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get inv rout2 mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_inv_rout2_mixer(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     set beep volume
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2192,6 +4037,19 @@ uint8_t wm8978_set_inv_rout2_mixer(wm8978_handle_t *handle, wm8978_bool_t enable
  */
 uint8_t wm8978_set_beep_volume(wm8978_handle_t *handle, uint8_t vol);
 
+/**
+ * @brief      get beep volume
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *vol pointer to a volume buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get beep volume failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_beep_volume(wm8978_handle_t *handle, uint8_t *vol);
+
 /**
  * @brief      convert the beep volume to the register raw data
  * @param[in]  *handle pointer to a wm8978 handle structure
@@ -2231,6 +4089,19 @@ uint8_t wm8978_beep_volume_convert_to_data(wm8978_handle_t *handle, uint8_t reg,
  */
 uint8_t wm8978_set_beep(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get beep status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get beep failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_beep(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     set microphone bias voltage
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2244,6 +4115,19 @@ uint8_t wm8978_set_beep(wm8978_handle_t *handle, wm8978_bool_t enable);
  */
 uint8_t wm8978_set_microphone_bias_voltage(wm8978_handle_t *handle, wm8978_avdd_t avdd);
 
+/**
+ * @brief      get microphone bias voltage
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *avdd pointer to an avdd buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get microphone bias voltage failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_microphone_bias_voltage(wm8978_handle_t *handle, wm8978_avdd_t *avdd);
+
 /**
  * @brief     enable or disable right channel input pga positive
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2257,6 +4141,19 @@ uint8_t wm8978_set_microphone_bias_voltage(wm8978_handle_t *handle, wm8978_avdd_
  */
 uint8_t wm8978_set_right_channel_input_pga_positive(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get right channel input pga positive status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right channel input pga positive failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_channel_input_pga_positive(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable right channel input pga negative
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2270,6 +4167,19 @@ uint8_t wm8978_set_right_channel_input_pga_positive(wm8978_handle_t *handle, wm8
  */
 uint8_t wm8978_set_right_channel_input_pga_negative(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get right channel input pga negative status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right channel input pga negative failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_channel_input_pga_negative(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable right channel input pga amplifier positive
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2283,6 +4193,19 @@ uint8_t wm8978_set_right_channel_input_pga_negative(wm8978_handle_t *handle, wm8
  */
 uint8_t wm8978_set_right_channel_input_pga_amplifier_positive(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get right channel input pga amplifier positive status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right channel input pga amplifier positive failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_channel_input_pga_amplifier_positive(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable left channel input pga positive
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2296,6 +4219,19 @@ uint8_t wm8978_set_right_channel_input_pga_amplifier_positive(wm8978_handle_t *h
  */
 uint8_t wm8978_set_left_channel_input_pga_positive(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get left channel input pga positive status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left channel input pga positive failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_channel_input_pga_positive(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable left channel input pga negative
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2309,6 +4245,19 @@ uint8_t wm8978_set_left_channel_input_pga_positive(wm8978_handle_t *handle, wm89
  */
 uint8_t wm8978_set_left_channel_input_pga_negative(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get left channel input pga negative status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left channel input pga negative failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_channel_input_pga_negative(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable left channel input pga amplifier positive
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2322,6 +4271,19 @@ uint8_t wm8978_set_left_channel_input_pga_negative(wm8978_handle_t *handle, wm89
  */
 uint8_t wm8978_set_left_channel_input_pga_amplifier_positive(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get left channel input pga amplifier positive status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left channel input pga amplifier positive failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_channel_input_pga_amplifier_positive(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable left input pga update
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2335,6 +4297,19 @@ uint8_t wm8978_set_left_channel_input_pga_amplifier_positive(wm8978_handle_t *ha
  */
 uint8_t wm8978_set_left_input_pga_update(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get left input pga update status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left input pga update failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_input_pga_update(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable left channel input pga zero cross
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2348,6 +4323,19 @@ uint8_t wm8978_set_left_input_pga_update(wm8978_handle_t *handle, wm8978_bool_t
  */
 uint8_t wm8978_set_left_channel_input_pga_zero_cross(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get left channel input pga zero cross status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left channel input pga zero cross failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_channel_input_pga_zero_cross(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable left channel input pga mute
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2361,6 +4349,19 @@ uint8_t wm8978_set_left_channel_input_pga_zero_cross(wm8978_handle_t *handle, wm
  */
 uint8_t wm8978_set_left_channel_input_pga_mute(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get left channel input pga mute status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left channel input pga mute failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_channel_input_pga_mute(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     set left channel input pga volume
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2375,6 +4376,19 @@ uint8_t wm8978_set_left_channel_input_pga_mute(wm8978_handle_t *handle, wm8978_b
  */
 uint8_t wm8978_set_left_channel_input_pga_volume(wm8978_handle_t *handle, uint8_t volume);
 
+/**
+ * @brief      get left channel input pga volume
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *volume pointer to a volume buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left channel input pga volume failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_channel_input_pga_volume(wm8978_handle_t *handle, uint8_t *volume);
+
 /**
  * @brief      convert the left channel input pga volume to the register raw data
  * @param[in]  *handle pointer to a wm8978 handle structure
@@ -2401,6 +4415,33 @@ uint8_t wm8978_left_channel_input_pga_volume_convert_to_register(wm8978_handle_t
  */
 uint8_t wm8978_left_channel_input_pga_volume_convert_to_data(wm8978_handle_t *handle, uint8_t reg, float *db);
 
+/**
+ * @brief      convert the left channel input pga volume in centi-db to the register raw data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  cdb volume in 0.01db
+ * @param[out] *reg pointer to a volume raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 cdb is over range
+ * @note       the step is 75 cdb, the result is rounded to the nearest step
+ */
+uint8_t wm8978_left_channel_input_pga_volume_cdb_convert_to_register(wm8978_handle_t *handle, int16_t cdb, uint8_t *reg);
+
+/**
+ * @brief      convert the left channel input pga volume register raw data to centi-db
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  reg volume raw data
+ * @param[out] *cdb pointer to a volume buffer in 0.01db
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_left_channel_input_pga_volume_cdb_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int16_t *cdb);
+
 /**
  * @brief     enable or disable right input pga update
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2414,6 +4455,19 @@ uint8_t wm8978_left_channel_input_pga_volume_convert_to_data(wm8978_handle_t *ha
  */
 uint8_t wm8978_set_right_input_pga_update(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get right input pga update status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right input pga update failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_input_pga_update(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable right channel input pga zero cross
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2427,6 +4481,19 @@ uint8_t wm8978_set_right_input_pga_update(wm8978_handle_t *handle, wm8978_bool_t
  */
 uint8_t wm8978_set_right_channel_input_pga_zero_cross(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get right channel input pga zero cross status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right channel input pga zero cross failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_channel_input_pga_zero_cross(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable right channel input pga mute
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2440,6 +4507,19 @@ uint8_t wm8978_set_right_channel_input_pga_zero_cross(wm8978_handle_t *handle, w
  */
 uint8_t wm8978_set_right_channel_input_pga_mute(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get right channel input pga mute status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right channel input pga mute failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_channel_input_pga_mute(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     set right channel input pga volume
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2455,23 +4535,36 @@ uint8_t wm8978_set_right_channel_input_pga_mute(wm8978_handle_t *handle, wm8978_
 uint8_t wm8978_set_right_channel_input_pga_volume(wm8978_handle_t *handle, uint8_t volume);
 
 /**
- * @brief      convert the right channel input pga volume to the register raw data
+ * @brief      get right channel input pga volume
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  db set db
- * @param[out] *reg pointer to a volume raw data buffer
+ * @param[out] *volume pointer to a volume buffer
  * @return     status code
  *             - 0 success
+ *             - 1 get right channel input pga volume failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t wm8978_right_channel_input_pga_volume_convert_to_register(wm8978_handle_t *handle, float db, uint8_t *reg);
+uint8_t wm8978_get_right_channel_input_pga_volume(wm8978_handle_t *handle, uint8_t *volume);
 
 /**
- * @brief      convert the right channel input pga volume register raw data to the real data
+ * @brief      convert the right channel input pga volume to the register raw data
  * @param[in]  *handle pointer to a wm8978 handle structure
- * @param[in]  reg raw data
- * @param[out] *db pointer to a volume real data buffer
+ * @param[in]  db set db
+ * @param[out] *reg pointer to a volume raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_right_channel_input_pga_volume_convert_to_register(wm8978_handle_t *handle, float db, uint8_t *reg);
+
+/**
+ * @brief      convert the right channel input pga volume register raw data to the real data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  reg raw data
+ * @param[out] *db pointer to a volume real data buffer
  * @return     status code
  *             - 0 success
  *             - 2 handle is NULL
@@ -2480,6 +4573,33 @@ uint8_t wm8978_right_channel_input_pga_volume_convert_to_register(wm8978_handle_
  */
 uint8_t wm8978_right_channel_input_pga_volume_convert_to_data(wm8978_handle_t *handle, uint8_t reg, float *db);
 
+/**
+ * @brief      convert the right channel input pga volume in centi-db to the register raw data
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  cdb volume in 0.01db
+ * @param[out] *reg pointer to a volume raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 cdb is over range
+ * @note       the step is 75 cdb, the result is rounded to the nearest step
+ */
+uint8_t wm8978_right_channel_input_pga_volume_cdb_convert_to_register(wm8978_handle_t *handle, int16_t cdb, uint8_t *reg);
+
+/**
+ * @brief      convert the right channel input pga volume register raw data to centi-db
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  reg volume raw data
+ * @param[out] *cdb pointer to a volume buffer in 0.01db
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_right_channel_input_pga_volume_cdb_convert_to_data(wm8978_handle_t *handle, uint8_t reg, int16_t *cdb);
+
 /**
  * @brief     enable or disable left channel input pga boost
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2493,6 +4613,19 @@ uint8_t wm8978_right_channel_input_pga_volume_convert_to_data(wm8978_handle_t *h
  */
 uint8_t wm8978_set_left_channel_input_pga_boost(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get left channel input pga boost status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left channel input pga boost failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_channel_input_pga_boost(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     set left channel input boost stage
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2507,6 +4640,19 @@ uint8_t wm8978_set_left_channel_input_pga_boost(wm8978_handle_t *handle, wm8978_
  */
 uint8_t wm8978_set_left_channel_input_boost_stage(wm8978_handle_t *handle, uint8_t stage);
 
+/**
+ * @brief      get left channel input boost stage
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *stage pointer to a stage buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left channel input boost stage failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_channel_input_boost_stage(wm8978_handle_t *handle, uint8_t *stage);
+
 /**
  * @brief      convert the left channel input boost stage to the register raw data
  * @param[in]  *handle pointer to a wm8978 handle structure
@@ -2547,6 +4693,19 @@ uint8_t wm8978_left_channel_input_boost_stage_convert_to_data(wm8978_handle_t *h
  */
 uint8_t wm8978_set_auxiliary_amplifier_left_channel_input_boost_stage(wm8978_handle_t *handle, uint8_t stage);
 
+/**
+ * @brief      get auxiliary amplifier left channel input boost stage
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *stage pointer to a stage buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get auxiliary amplifier left channel input boost stage failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_auxiliary_amplifier_left_channel_input_boost_stage(wm8978_handle_t *handle, uint8_t *stage);
+
 /**
  * @brief      convert the auxiliary amplifier left channel input boost stage to the register raw data
  * @param[in]  *handle pointer to a wm8978 handle structure
@@ -2586,6 +4745,19 @@ uint8_t wm8978_auxiliary_amplifier_left_channel_input_boost_stage_convert_to_dat
  */
 uint8_t wm8978_set_right_channel_input_pga_boost(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get right channel input pga boost status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right channel input pga boost failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_channel_input_pga_boost(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     set right channel input boost stage
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2600,6 +4772,19 @@ uint8_t wm8978_set_right_channel_input_pga_boost(wm8978_handle_t *handle, wm8978
  */
 uint8_t wm8978_set_right_channel_input_boost_stage(wm8978_handle_t *handle, uint8_t stage);
 
+/**
+ * @brief      get right channel input boost stage
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *stage pointer to a stage buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right channel input boost stage failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_channel_input_boost_stage(wm8978_handle_t *handle, uint8_t *stage);
+
 /**
  * @brief      convert the right channel input boost stage to the register raw data
  * @param[in]  *handle pointer to a wm8978 handle structure
@@ -2640,6 +4825,19 @@ uint8_t wm8978_right_channel_input_boost_stage_convert_to_data(wm8978_handle_t *
  */
 uint8_t wm8978_set_auxiliary_amplifier_right_channel_input_boost_stage(wm8978_handle_t *handle, uint8_t stage);
 
+/**
+ * @brief      get auxiliary amplifier right channel input boost stage
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *stage pointer to a stage buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get auxiliary amplifier right channel input boost stage failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_auxiliary_amplifier_right_channel_input_boost_stage(wm8978_handle_t *handle, uint8_t *stage);
+
 /**
  * @brief      convert the auxiliary amplifier right channel input boost stage to the register raw data
  * @param[in]  *handle pointer to a wm8978 handle structure
@@ -2679,6 +4877,19 @@ uint8_t wm8978_auxiliary_amplifier_right_channel_input_boost_stage_convert_to_da
  */
 uint8_t wm8978_set_left_dac_output_to_right_output_mixer(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get left dac output to right output mixer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left dac output to right output mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_dac_output_to_right_output_mixer(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable right dac output to left output mixer
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2692,6 +4903,19 @@ uint8_t wm8978_set_left_dac_output_to_right_output_mixer(wm8978_handle_t *handle
  */
 uint8_t wm8978_set_right_dac_output_to_left_output_mixer(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get right dac output to left output mixer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right dac output to left output mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_dac_output_to_left_output_mixer(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable out4 boost
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2705,6 +4929,19 @@ uint8_t wm8978_set_right_dac_output_to_left_output_mixer(wm8978_handle_t *handle
  */
 uint8_t wm8978_set_out4_boost(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get out4 boost status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get out4 boost failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_out4_boost(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable out3 boost
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2718,6 +4955,19 @@ uint8_t wm8978_set_out4_boost(wm8978_handle_t *handle, wm8978_bool_t enable);
  */
 uint8_t wm8978_set_out3_boost(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get out3 boost status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get out3 boost failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_out3_boost(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable speaker boost
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2731,6 +4981,19 @@ uint8_t wm8978_set_out3_boost(wm8978_handle_t *handle, wm8978_bool_t enable);
  */
 uint8_t wm8978_set_speaker_boost(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get speaker boost status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get speaker boost failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_speaker_boost(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable thermal shutdown
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2744,6 +5007,19 @@ uint8_t wm8978_set_speaker_boost(wm8978_handle_t *handle, wm8978_bool_t enable);
  */
 uint8_t wm8978_set_thermal_shutdown(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get thermal shutdown status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get thermal shutdown failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_thermal_shutdown(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     set vref to analogue output resistance
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2757,6 +5033,19 @@ uint8_t wm8978_set_thermal_shutdown(wm8978_handle_t *handle, wm8978_bool_t enabl
  */
 uint8_t wm8978_set_vref_to_analogue_output_resistance(wm8978_handle_t *handle, wm8978_vref_t vref);
 
+/**
+ * @brief      get vref to analogue output resistance
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *vref pointer to a vref buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get vref to analogue output resistance failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_vref_to_analogue_output_resistance(wm8978_handle_t *handle, wm8978_vref_t *vref);
+
 /**
  * @brief     set aux left channel input to left mixer volume
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2771,6 +5060,19 @@ uint8_t wm8978_set_vref_to_analogue_output_resistance(wm8978_handle_t *handle, w
  */
 uint8_t wm8978_set_aux_left_channel_input_to_left_mixer_volume(wm8978_handle_t *handle, uint8_t vol);
 
+/**
+ * @brief      get aux left channel input to left mixer volume
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *vol pointer to a vol buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get aux left channel input to left mixer volume failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_aux_left_channel_input_to_left_mixer_volume(wm8978_handle_t *handle, uint8_t *vol);
+
 /**
  * @brief      convert the aux left channel input to left mixer volume to the register raw data
  * @param[in]  *handle pointer to a wm8978 handle structure
@@ -2810,6 +5112,19 @@ uint8_t wm8978_aux_left_channel_input_to_left_mixer_volume_convert_to_data(wm897
  */
 uint8_t wm8978_set_left_auxiliary_input_to_left_channel_output_mixer(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get left auxiliary input to left channel output mixer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left auxiliary input to left channel output mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_auxiliary_input_to_left_channel_output_mixer(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     set left bypass volume control to output channel mixer
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2824,6 +5139,19 @@ uint8_t wm8978_set_left_auxiliary_input_to_left_channel_output_mixer(wm8978_hand
  */
 uint8_t wm8978_set_left_bypass_volume_control_to_output_channel_mixer(wm8978_handle_t *handle, uint8_t vol);
 
+/**
+ * @brief      get left bypass volume control to output channel mixer
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *vol pointer to a vol buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left bypass volume control to output channel mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_bypass_volume_control_to_output_channel_mixer(wm8978_handle_t *handle, uint8_t *vol);
+
 /**
  * @brief      convert the left bypass volume control to output channel mixer to the register raw data
  * @param[in]  *handle pointer to a wm8978 handle structure
@@ -2863,6 +5191,19 @@ uint8_t wm8978_left_bypass_volume_control_to_output_channel_mixer_convert_to_dat
  */
 uint8_t wm8978_set_left_bypass_path_to_left_output_mixer(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get left bypass path to left output mixer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left bypass path to left output mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_bypass_path_to_left_output_mixer(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable left dac output to left output mixer
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2876,6 +5217,19 @@ uint8_t wm8978_set_left_bypass_path_to_left_output_mixer(wm8978_handle_t *handle
  */
 uint8_t wm8978_set_left_dac_output_to_left_output_mixer(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get left dac output to left output mixer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left dac output to left output mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_dac_output_to_left_output_mixer(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     set aux right channel input to right mixer volume
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2890,6 +5244,19 @@ uint8_t wm8978_set_left_dac_output_to_left_output_mixer(wm8978_handle_t *handle,
  */
 uint8_t wm8978_set_aux_right_channel_input_to_right_mixer_volume(wm8978_handle_t *handle, uint8_t vol);
 
+/**
+ * @brief      get aux right channel input to right mixer volume
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *vol pointer to a vol buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get aux right channel input to right mixer volume failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_aux_right_channel_input_to_right_mixer_volume(wm8978_handle_t *handle, uint8_t *vol);
+
 /**
  * @brief      convert the aux right channel input to right mixer volume to the register raw data
  * @param[in]  *handle pointer to a wm8978 handle structure
@@ -2929,6 +5296,19 @@ uint8_t wm8978_aux_right_channel_input_to_right_mixer_volume_convert_to_data(wm8
  */
 uint8_t wm8978_set_right_auxiliary_input_to_right_channel_output_mixer(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get right auxiliary input to right channel output mixer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right auxiliary input to right channel output mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_auxiliary_input_to_right_channel_output_mixer(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     set right bypass volume control to output channel mixer
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2943,6 +5323,19 @@ uint8_t wm8978_set_right_auxiliary_input_to_right_channel_output_mixer(wm8978_ha
  */
 uint8_t wm8978_set_right_bypass_volume_control_to_output_channel_mixer(wm8978_handle_t *handle, uint8_t vol);
 
+/**
+ * @brief      get right bypass volume control to output channel mixer
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *vol pointer to a vol buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right bypass volume control to output channel mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_bypass_volume_control_to_output_channel_mixer(wm8978_handle_t *handle, uint8_t *vol);
+
 /**
  * @brief      convert the right bypass volume control to output channel mixer to the register raw data
  * @param[in]  *handle pointer to a wm8978 handle structure
@@ -2982,6 +5375,19 @@ uint8_t wm8978_right_bypass_volume_control_to_output_channel_mixer_convert_to_da
  */
 uint8_t wm8978_set_right_bypass_path_to_right_output_mixer(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get right bypass path to right output mixer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right bypass path to right output mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_bypass_path_to_right_output_mixer(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable right dac output to right output mixer
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -2995,6 +5401,19 @@ uint8_t wm8978_set_right_bypass_path_to_right_output_mixer(wm8978_handle_t *hand
  */
 uint8_t wm8978_set_right_dac_output_to_right_output_mixer(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get right dac output to right output mixer status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right dac output to right output mixer failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_dac_output_to_right_output_mixer(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable lout1 update
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -3008,6 +5427,19 @@ uint8_t wm8978_set_right_dac_output_to_right_output_mixer(wm8978_handle_t *handl
  */
 uint8_t wm8978_set_lout1_update(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get lout1 update status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get lout1 update failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_lout1_update(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable lout1 headphone volume zero cross
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -3022,18 +5454,44 @@ uint8_t wm8978_set_lout1_update(wm8978_handle_t *handle, wm8978_bool_t enable);
 uint8_t wm8978_set_lout1_headphone_volume_zero_cross(wm8978_handle_t *handle, wm8978_bool_t enable);
 
 /**
- * @brief     enable or disable lout1 left headphone output mute
- * @param[in] *handle pointer to a wm8978 handle structure
- * @param[in] enable bool value
- * @return    status code
- *            - 0 success
- *            - 1 set lout1 left headphone output mute failed
+ * @brief      get lout1 headphone volume zero cross status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get lout1 headphone volume zero cross failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_lout1_headphone_volume_zero_cross(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
+/**
+ * @brief     enable or disable lout1 left headphone output mute
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set lout1 left headphone output mute failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
 uint8_t wm8978_set_lout1_left_headphone_output_mute(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get lout1 left headphone output mute status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get lout1 left headphone output mute failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_lout1_left_headphone_output_mute(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     set lout1 left headphone output volume
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -3048,6 +5506,19 @@ uint8_t wm8978_set_lout1_left_headphone_output_mute(wm8978_handle_t *handle, wm8
  */
 uint8_t wm8978_set_lout1_left_headphone_output_volume(wm8978_handle_t *handle, uint8_t vol);
 
+/**
+ * @brief      get lout1 left headphone output volume
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *vol pointer to a volume buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get lout1 left headphone output volume failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_lout1_left_headphone_output_volume(wm8978_handle_t *handle, uint8_t *vol);
+
 /**
  * @brief      convert the lout1 left headphone output volume to the register raw data
  * @param[in]  *handle pointer to a wm8978 handle structure
@@ -3087,6 +5558,19 @@ uint8_t wm8978_lout1_left_headphone_output_volume_convert_to_data(wm8978_handle_
  */
 uint8_t wm8978_set_rout1_update(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get rout1 update status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get rout1 update failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_rout1_update(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable rout1 headphone volume zero cross
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -3100,6 +5584,19 @@ uint8_t wm8978_set_rout1_update(wm8978_handle_t *handle, wm8978_bool_t enable);
  */
 uint8_t wm8978_set_rout1_headphone_volume_zero_cross(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get rout1 headphone volume zero cross status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get rout1 headphone volume zero cross failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_rout1_headphone_volume_zero_cross(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable rout1 right headphone output mute
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -3113,6 +5610,19 @@ uint8_t wm8978_set_rout1_headphone_volume_zero_cross(wm8978_handle_t *handle, wm
  */
 uint8_t wm8978_set_rout1_right_headphone_output_mute(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get rout1 right headphone output mute status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get rout1 right headphone output mute failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_rout1_right_headphone_output_mute(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     set rout1 right headphone output volume
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -3127,6 +5637,19 @@ uint8_t wm8978_set_rout1_right_headphone_output_mute(wm8978_handle_t *handle, wm
  */
 uint8_t wm8978_set_rout1_right_headphone_output_volume(wm8978_handle_t *handle, uint8_t vol);
 
+/**
+ * @brief      get rout1 right headphone output volume
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *vol pointer to a volume buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get rout1 right headphone output volume failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_rout1_right_headphone_output_volume(wm8978_handle_t *handle, uint8_t *vol);
+
 /**
  * @brief      convert the rout1 right headphone output volume to the register raw data
  * @param[in]  *handle pointer to a wm8978 handle structure
@@ -3166,6 +5689,19 @@ uint8_t wm8978_rout1_right_headphone_output_volume_convert_to_data(wm8978_handle
  */
 uint8_t wm8978_set_lout2_update(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get lout2 update status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get lout2 update failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_lout2_update(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable lout2 speaker volume zero cross
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -3179,6 +5715,19 @@ uint8_t wm8978_set_lout2_update(wm8978_handle_t *handle, wm8978_bool_t enable);
  */
 uint8_t wm8978_set_lout2_speaker_volume_zero_cross(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get lout2 speaker volume zero cross status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get lout2 speaker volume zero cross failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_lout2_speaker_volume_zero_cross(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable lout2 left speaker output mute
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -3192,6 +5741,19 @@ uint8_t wm8978_set_lout2_speaker_volume_zero_cross(wm8978_handle_t *handle, wm89
  */
 uint8_t wm8978_set_lout2_left_speaker_output_mute(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get lout2 left speaker output mute status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get lout2 left speaker output mute failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_lout2_left_speaker_output_mute(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     set lout2 left speaker output volume
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -3206,6 +5768,19 @@ uint8_t wm8978_set_lout2_left_speaker_output_mute(wm8978_handle_t *handle, wm897
  */
 uint8_t wm8978_set_lout2_left_speaker_output_volume(wm8978_handle_t *handle, uint8_t vol);
 
+/**
+ * @brief      get lout2 left speaker output volume
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *vol pointer to a volume buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get lout2 left speaker output volume failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_lout2_left_speaker_output_volume(wm8978_handle_t *handle, uint8_t *vol);
+
 /**
  * @brief      convert the lout2 left speaker output volume to the register raw data
  * @param[in]  *handle pointer to a wm8978 handle structure
@@ -3245,6 +5820,19 @@ uint8_t wm8978_lout2_left_speaker_output_volume_convert_to_data(wm8978_handle_t
  */
 uint8_t wm8978_set_rout2_update(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get rout2 update status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get rout2 update failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_rout2_update(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable rout2 speaker volume zero cross
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -3258,6 +5846,19 @@ uint8_t wm8978_set_rout2_update(wm8978_handle_t *handle, wm8978_bool_t enable);
  */
 uint8_t wm8978_set_rout2_speaker_volume_zero_cross(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get rout2 speaker volume zero cross status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get rout2 speaker volume zero cross failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_rout2_speaker_volume_zero_cross(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable rout2 right speaker output mute
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -3271,6 +5872,19 @@ uint8_t wm8978_set_rout2_speaker_volume_zero_cross(wm8978_handle_t *handle, wm89
  */
 uint8_t wm8978_set_rout2_right_speaker_output_mute(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get rout2 right speaker output mute status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get rout2 right speaker output mute failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_rout2_right_speaker_output_mute(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     set rout2 right speaker output volume
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -3285,6 +5899,19 @@ uint8_t wm8978_set_rout2_right_speaker_output_mute(wm8978_handle_t *handle, wm89
  */
 uint8_t wm8978_set_rout2_right_speaker_output_volume(wm8978_handle_t *handle, uint8_t vol);
 
+/**
+ * @brief      get rout2 right speaker output volume
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *vol pointer to a volume buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get rout2 right speaker output volume failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_rout2_right_speaker_output_volume(wm8978_handle_t *handle, uint8_t *vol);
+
 /**
  * @brief      convert the rout2 right speaker output volume to the register raw data
  * @param[in]  *handle pointer to a wm8978 handle structure
@@ -3324,6 +5951,19 @@ uint8_t wm8978_rout2_right_speaker_output_volume_convert_to_data(wm8978_handle_t
  */
 uint8_t wm8978_set_out3_mute(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get out3 mute status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get out3 mute failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_out3_mute(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable out4 mixer output to out3
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -3337,6 +5977,19 @@ uint8_t wm8978_set_out3_mute(wm8978_handle_t *handle, wm8978_bool_t enable);
  */
 uint8_t wm8978_set_out4_mixer_output_to_out3(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get out4 mixer output to out3 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get out4 mixer output to out3 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_out4_mixer_output_to_out3(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable left adc input to out3
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -3350,6 +6003,19 @@ uint8_t wm8978_set_out4_mixer_output_to_out3(wm8978_handle_t *handle, wm8978_boo
  */
 uint8_t wm8978_set_left_adc_input_to_out3(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get left adc input to out3 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left adc input to out3 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_adc_input_to_out3(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable left dac mixer to out3
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -3363,6 +6029,19 @@ uint8_t wm8978_set_left_adc_input_to_out3(wm8978_handle_t *handle, wm8978_bool_t
  */
 uint8_t wm8978_set_left_dac_mixer_to_out3(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get left dac mixer to out3 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left dac mixer to out3 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_dac_mixer_to_out3(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable left dac output to out3
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -3376,6 +6055,19 @@ uint8_t wm8978_set_left_dac_mixer_to_out3(wm8978_handle_t *handle, wm8978_bool_t
  */
 uint8_t wm8978_set_left_dac_output_to_out3(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get left dac output to out3 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left dac output to out3 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_dac_output_to_out3(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable out4 mute
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -3389,6 +6081,19 @@ uint8_t wm8978_set_left_dac_output_to_out3(wm8978_handle_t *handle, wm8978_bool_
  */
 uint8_t wm8978_set_out4_mute(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get out4 mute status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get out4 mute failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_out4_mute(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable out4 attenuated by 6db
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -3402,6 +6107,19 @@ uint8_t wm8978_set_out4_mute(wm8978_handle_t *handle, wm8978_bool_t enable);
  */
 uint8_t wm8978_set_out4_attenuated_by_6db(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get out4 attenuated by 6db status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get out4 attenuated by 6db failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_out4_attenuated_by_6db(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable left dac mixer to out4
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -3415,6 +6133,19 @@ uint8_t wm8978_set_out4_attenuated_by_6db(wm8978_handle_t *handle, wm8978_bool_t
  */
 uint8_t wm8978_set_left_dac_mixer_to_out4(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get left dac mixer to out4 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left dac mixer to out4 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_dac_mixer_to_out4(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable left dac to out4
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -3428,6 +6159,19 @@ uint8_t wm8978_set_left_dac_mixer_to_out4(wm8978_handle_t *handle, wm8978_bool_t
  */
 uint8_t wm8978_set_left_dac_to_out4(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get left dac to out4 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get left dac to out4 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_left_dac_to_out4(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable right adc input to out4
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -3441,6 +6185,19 @@ uint8_t wm8978_set_left_dac_to_out4(wm8978_handle_t *handle, wm8978_bool_t enabl
  */
 uint8_t wm8978_set_right_adc_input_to_out4(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get right adc input to out4 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right adc input to out4 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_adc_input_to_out4(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable right dac mixer to out4
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -3454,6 +6211,19 @@ uint8_t wm8978_set_right_adc_input_to_out4(wm8978_handle_t *handle, wm8978_bool_
  */
 uint8_t wm8978_set_right_dac_mixer_to_out4(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get right dac mixer to out4 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right dac mixer to out4 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_dac_mixer_to_out4(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @brief     enable or disable right dac output to out4
  * @param[in] *handle pointer to a wm8978 handle structure
@@ -3467,6 +6237,19 @@ uint8_t wm8978_set_right_dac_mixer_to_out4(wm8978_handle_t *handle, wm8978_bool_
  */
 uint8_t wm8978_set_right_dac_output_to_out4(wm8978_handle_t *handle, wm8978_bool_t enable);
 
+/**
+ * @brief      get right dac output to out4 status
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get right dac output to out4 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_right_dac_output_to_out4(wm8978_handle_t *handle, wm8978_bool_t *enable);
+
 /**
  * @}
  */
@@ -3492,6 +6275,304 @@ uint8_t wm8978_set_right_dac_output_to_out4(wm8978_handle_t *handle, wm8978_bool
  */
 uint8_t wm8978_set_reg(wm8978_handle_t *handle, uint8_t reg, uint16_t value);
 
+/**
+ * @brief     update masked bits of the chip register
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] reg iic register address
+ * @param[in] mask changed bits
+ * @param[in] bits new bits
+ * @return    status code
+ *            - 0 success
+ *            - 1 update failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the shadow read-modify-write runs under the register lock,
+ *            bits outside the mask are kept
+ */
+uint8_t wm8978_update_reg(wm8978_handle_t *handle, uint8_t reg, uint16_t mask, uint16_t bits);
+
+/**
+ * @brief      get the chip register
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  reg iic register address
+ * @param[out] *value pointer to a register value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wm8978_get_reg(wm8978_handle_t *handle, uint8_t reg, uint16_t *value);
+
+/**
+ * @brief     set a register field
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] field register field
+ * @param[in] value field value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set field failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 field or value is invalid
+ * @note      none
+ */
+uint8_t wm8978_set_field(wm8978_handle_t *handle, wm8978_field_t field, uint16_t value);
+
+/**
+ * @brief      get a register field
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  field register field
+ * @param[out] *value pointer to a field value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get field failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 field is invalid
+ * @note       none
+ */
+uint8_t wm8978_get_field(wm8978_handle_t *handle, wm8978_field_t field, uint16_t *value);
+
+/**
+ * @brief     set several register fields in one pass
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] *list pointer to a field value list
+ * @param[in] len list length
+ * @return    status code
+ *            - 0 success
+ *            - 1 set fields failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 field or value is invalid
+ * @note      every value is range checked before anything is written and
+ *            consecutive fields of the same register share one bus write
+ */
+uint8_t wm8978_set_fields(wm8978_handle_t *handle, const wm8978_field_value_t *list, uint8_t len);
+
+/**
+ * @brief     set the same register fields on several chips
+ * @param[in] **handle pointer to a wm8978 handle array
+ * @param[in] num handle number
+ * @param[in] *list pointer to a field value list
+ * @param[in] len list length
+ * @return    status code
+ *            - 0 success
+ *            - 1 set fields failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 field or value is invalid
+ * @note      the writes are interleaved register by register across the chips, so
+ *            chips on separate buses with queued transfers progress in parallel
+ */
+uint8_t wm8978_multi_set_fields(wm8978_handle_t **handle, uint8_t num, const wm8978_field_value_t *list, uint8_t len);
+
+/**
+ * @brief     initialize a volume ramp
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] *ramp pointer to a wm8978 ramp structure
+ * @param[in] duration_ms ramp duration in ms
+ * @param[in] max_writes max bus writes per tick
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 ramp is NULL or param is invalid
+ * @note      duration_ms <= 0x7FFFFF, max_writes >= 2
+ */
+uint8_t wm8978_ramp_init(wm8978_handle_t *handle, wm8978_ramp_t *ramp, uint32_t duration_ms, uint8_t max_writes);
+
+/**
+ * @brief     add a gain stage to a volume ramp
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] *ramp pointer to a wm8978 ramp structure
+ * @param[in] stage ramped gain stage
+ * @param[in] target target register volume of both channels
+ * @return    status code
+ *            - 0 success
+ *            - 1 add stage failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 ramp is NULL, stage or target is invalid
+ * @note      the ramp starts from the current left and right volume of the stage,
+ *            the input pga, out1 and out2 stages step on zero crossings, so adding
+ *            one of them enables the slow clock whose timeout applies the latched
+ *            volume when the signal is silent or dc
+ */
+uint8_t wm8978_ramp_add(wm8978_handle_t *handle, wm8978_ramp_t *ramp, wm8978_ramp_stage_t stage, uint8_t target);
+
+/**
+ * @brief      run a volume ramp tick
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  *ramp pointer to a wm8978 ramp structure
+ * @param[in]  ms elapsed time since the last tick in ms
+ * @param[out] *done pointer to a bool buffer, true when all stages reached the target
+ * @return     status code
+ *             - 0 success
+ *             - 1 tick failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 ramp is NULL
+ * @note       call it from a periodic timer until done is true,
+ *             every stage step pre-loads the left volume and latches both channels
+ *             with the right volume write, zero cross is enabled where the stage has it,
+ *             stages which do not fit into max_writes are served first by the next tick
+ */
+uint8_t wm8978_ramp_tick(wm8978_handle_t *handle, wm8978_ramp_t *ramp, uint32_t ms, wm8978_bool_t *done);
+
+/**
+ * @brief      solve an eq preset from a target response
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  *band pointer to an eq1 - eq5 band array
+ * @param[out] *preset pointer to a wm8978 eq preset structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 band or preset is NULL
+ * @note       every band takes the nearest frequency on a log scale and its gain is clamped
+ *             to -12db - 12db, the difference to the request is kept in the preset
+ */
+uint8_t wm8978_eq_design(wm8978_handle_t *handle, const wm8978_eq_band_t *band, wm8978_eq_preset_t *preset);
+
+/**
+ * @brief     apply an eq preset
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] *preset pointer to a wm8978 eq preset structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 apply failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 preset is NULL or invalid
+ * @note      the preset costs exactly five register writes, bands losing gain are written
+ *            before bands gaining it, so the response never passes through a transient boost
+ */
+uint8_t wm8978_eq_apply(wm8978_handle_t *handle, const wm8978_eq_preset_t *preset);
+
+/**
+ * @brief      design the notch filter coefficients
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  fs sample rate in hz
+ * @param[in]  centre_hz notch centre frequency in hz
+ * @param[in]  bandwidth_hz notch -3db bandwidth in hz
+ * @param[out] *a0 pointer to a 14 bits a0 coefficient buffer
+ * @param[out] *a1 pointer to a 14 bits a1 coefficient buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 param is invalid
+ * @note       0 < centre_hz < fs / 2, 0 < bandwidth_hz < fs / 2,
+ *             a0 = (1 - tan(wb / 2)) / (1 + tan(wb / 2)), a1 = -(1 + a0) * cos(w0),
+ *             the register values are -a0 * 2^13 and -a1 * 2^12 in 14 bits two's complement
+ */
+uint8_t wm8978_notch_design(wm8978_handle_t *handle, uint32_t fs, uint32_t centre_hz, uint32_t bandwidth_hz,
+                            uint16_t *a0, uint16_t *a1);
+
+/**
+ * @brief     apply the notch filter coefficients
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] a0 14 bits a0 coefficient
+ * @param[in] a1 14 bits a1 coefficient
+ * @return    status code
+ *            - 0 success
+ *            - 1 apply failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 coefficient is invalid
+ * @note      the first three registers are written with the update bit clear and the
+ *            last one sets it, so the filter switches to all new coefficients at once,
+ *            the notch filter enable bit is not changed
+ */
+uint8_t wm8978_notch_apply(wm8978_handle_t *handle, uint16_t a0, uint16_t a1);
+
+/**
+ * @brief      solve a clock plan for a mclk and sample rate pair
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  mclk_hz mclk in hz
+ * @param[in]  fs sample rate in hz
+ * @param[out] *plan pointer to a wm8978 clock plan structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 param is invalid
+ *             - 5 no valid plan
+ * @note       8000 <= fs <= 48000, common pairs come from a precomputed table,
+ *             bclk is set to 64fs for the master mode
+ */
+uint8_t wm8978_clock_solve(wm8978_handle_t *handle, uint32_t mclk_hz, uint32_t fs, wm8978_clock_plan_t *plan);
+
+/**
+ * @brief     apply a clock plan
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] *plan pointer to a wm8978 clock plan structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 apply failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 plan is NULL or invalid
+ * @note      only the fields which differ from the current registers are written,
+ *            the pll is powered and programmed before it is selected and powered down
+ *            after mclk is selected, the clock mode is not changed
+ */
+uint8_t wm8978_clock_apply(wm8978_handle_t *handle, const wm8978_clock_plan_t *plan);
+
+/**
+ * @brief     trim the pll rate of a clock plan
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] *plan pointer to the applied wm8978 clock plan structure
+ * @param[in] ppb rate correction in ppb
+ * @return    status code
+ *            - 0 success
+ *            - 1 trim failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 plan is NULL or invalid
+ *            - 5 ppb is over range
+ * @note      the correction is relative to the plan, plln never changes and only the
+ *            k registers which differ from the current ones are written, k3 first,
+ *            so a trim without a carry is a single write
+ */
+uint8_t wm8978_pll_trim(wm8978_handle_t *handle, const wm8978_clock_plan_t *plan, int32_t ppb);
+
+/**
+ * @brief     initialize a drift estimator
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] *drift pointer to a wm8978 drift structure
+ * @param[in] target target buffer fill level
+ * @param[in] kp proportional gain in ppb per fill unit
+ * @param[in] ki integral gain in ppb per fill unit and update
+ * @param[in] limit_ppb max correction in ppb
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 drift is NULL or limit_ppb is invalid
+ * @note      0 < limit_ppb <= 1000000
+ */
+uint8_t wm8978_drift_init(wm8978_handle_t *handle, wm8978_drift_t *drift, int32_t target,
+                          int32_t kp, int32_t ki, int32_t limit_ppb);
+
+/**
+ * @brief      update a drift estimator with the buffer fill level
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[in]  *drift pointer to a wm8978 drift structure
+ * @param[in]  fill current buffer fill level
+ * @param[out] *ppb pointer to a rate correction buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 drift is NULL
+ * @note       a fill level above the target speeds the codec up, the integral term is
+ *             clamped to the limit so it never winds up, feed ppb to wm8978_pll_trim
+ */
+uint8_t wm8978_drift_update(wm8978_handle_t *handle, wm8978_drift_t *drift, int32_t fill, int32_t *ppb);
+
 /**
  * @}
  */
@@ -0,0 +1,493 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_wm8978.hpp
+ * @brief     driver wm8978 c++ register field header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_WM8978_HPP
+#define DRIVER_WM8978_HPP
+
+#include "driver_wm8978.h"
+
+/**
+ * @defgroup wm8978_cpp_driver wm8978 c++ field layer
+ * @brief    wm8978 typed register field modules
+ * @ingroup  wm8978_driver
+ * @note     the layer works on the register shadow of an initialized handle,
+ *           every modify() call costs one masked shadow update and one bus write
+ * @{
+ */
+
+namespace wm8978
+{
+
+/**
+ * @brief wm8978 register address definition
+ */
+namespace reg
+{
+    constexpr uint8_t software_reset = 0x00;               /**< software reset register */
+    constexpr uint8_t power_manage_1 = 0x01;               /**< power manage 1 register */
+    constexpr uint8_t power_manage_2 = 0x02;               /**< power manage 2 register */
+    constexpr uint8_t power_manage_3 = 0x03;               /**< power manage 3 register */
+    constexpr uint8_t audio_interface = 0x04;              /**< audio interface register */
+    constexpr uint8_t companding_ctrl = 0x05;              /**< companding ctrl register */
+    constexpr uint8_t clock_gen_ctrl = 0x06;               /**< clock gen ctrl register */
+    constexpr uint8_t additional_ctrl = 0x07;              /**< additional ctrl register */
+    constexpr uint8_t gpio = 0x08;                         /**< gpio register */
+    constexpr uint8_t jack_detect_control = 0x09;          /**< jack detect control register */
+    constexpr uint8_t dac_control = 0x0A;                  /**< dac control register */
+    constexpr uint8_t left_dac_digital_vol = 0x0B;         /**< left dac digital vol register */
+    constexpr uint8_t right_dac_digital_vol = 0x0C;        /**< right dac digital vol register */
+    constexpr uint8_t jack_detect_control2 = 0x0D;         /**< jack detect control2 register */
+    constexpr uint8_t adc_control = 0x0E;                  /**< adc control register */
+    constexpr uint8_t left_adc_digital_vol = 0x0F;         /**< left adc digital vol register */
+    constexpr uint8_t right_adc_digital_vol = 0x10;        /**< right adc digital vol register */
+    constexpr uint8_t eq1 = 0x12;                          /**< eq1 low shelf register */
+    constexpr uint8_t eq2 = 0x13;                          /**< eq2 peak1 register */
+    constexpr uint8_t eq3 = 0x14;                          /**< eq3 peak2 register */
+    constexpr uint8_t eq4 = 0x15;                          /**< eq4 peak3 register */
+    constexpr uint8_t eq5 = 0x16;                          /**< eq5 high shelf register */
+    constexpr uint8_t dac_limiter_1 = 0x18;                /**< dac limiter 1 register */
+    constexpr uint8_t dac_limiter_2 = 0x19;                /**< dac limiter 2 register */
+    constexpr uint8_t notch_filter_1 = 0x1B;               /**< notch filter 1 register */
+    constexpr uint8_t notch_filter_2 = 0x1C;               /**< notch filter 2 register */
+    constexpr uint8_t notch_filter_3 = 0x1D;               /**< notch filter 3 register */
+    constexpr uint8_t notch_filter_4 = 0x1E;               /**< notch filter 4 register */
+    constexpr uint8_t alc_control_1 = 0x20;                /**< alc control 1 register */
+    constexpr uint8_t alc_control_2 = 0x21;                /**< alc control 2 register */
+    constexpr uint8_t alc_control_3 = 0x22;                /**< alc control 3 register */
+    constexpr uint8_t noise_gate = 0x23;                   /**< noise gate register */
+    constexpr uint8_t pll_n = 0x24;                        /**< pll n register */
+    constexpr uint8_t pll_k1 = 0x25;                       /**< pll k1 register */
+    constexpr uint8_t pll_k2 = 0x26;                       /**< pll k2 register */
+    constexpr uint8_t pll_k3 = 0x27;                       /**< pll k3 register */
+    constexpr uint8_t control_3d = 0x29;                   /**< 3d control register */
+    constexpr uint8_t beep_control = 0x2B;                 /**< beep control register */
+    constexpr uint8_t input_ctrl = 0x2C;                   /**< input ctrl register */
+    constexpr uint8_t left_inp_pga_ctrl = 0x2D;            /**< left inp pga gain ctrl register */
+    constexpr uint8_t right_inp_pga_ctrl = 0x2E;           /**< right inp pga gain ctrl register */
+    constexpr uint8_t left_adc_boost_ctrl = 0x2F;          /**< left adc boost ctrl register */
+    constexpr uint8_t right_adc_boost_ctrl = 0x30;         /**< right adc boost ctrl register */
+    constexpr uint8_t output_ctrl = 0x31;                  /**< output ctrl register */
+    constexpr uint8_t left_mixer_ctrl = 0x32;              /**< left mixer ctrl register */
+    constexpr uint8_t right_mixer_ctrl = 0x33;             /**< right mixer ctrl register */
+    constexpr uint8_t lout1_ctrl = 0x34;                   /**< lout1 register */
+    constexpr uint8_t rout1_ctrl = 0x35;                   /**< rout1 register */
+    constexpr uint8_t lout2_ctrl = 0x36;                   /**< lout2 register */
+    constexpr uint8_t rout2_ctrl = 0x37;                   /**< rout2 register */
+    constexpr uint8_t out3_mixer_ctrl = 0x38;              /**< out3 mixer register */
+    constexpr uint8_t out4_mixer_ctrl = 0x39;              /**< out4 mixer register */
+}
+
+/**
+ * @brief pending change of one field, the bits are already shifted into place
+ */
+template <class F>
+struct Change
+{
+    uint16_t bits;        /**< shifted field bits */
+};
+
+/**
+ * @brief typed register field definition
+ * @note  Reg is the register address, Shift the lsb position, Width the bit width,
+ *        T the c type the setter of this field takes and Max the largest valid value,
+ *        Max defaults to the full field width and matches the range of the c setter
+ */
+template <uint8_t Reg, uint8_t Shift, uint8_t Width, typename T = uint16_t,
+          uint16_t Max = static_cast<uint16_t>((1U << Width) - 1U)>
+struct Field
+{
+    static_assert(Reg <= 0x39, "register is out of range");
+    static_assert((Width >= 1) && ((Shift + Width) <= 9), "field must fit in a 9 bit register");
+    static_assert(Max <= ((1U << Width) - 1U), "max does not fit in the field");
+
+    using value_type = T;                                                                         /**< field value type */
+    static constexpr uint8_t reg = Reg;                                                           /**< register address */
+    static constexpr uint8_t shift = Shift;                                                       /**< lsb position */
+    static constexpr uint16_t max = Max;                                                          /**< max field value */
+    static constexpr uint16_t mask = static_cast<uint16_t>(((1U << Width) - 1U) << Shift);        /**< register mask */
+
+    /**
+     * @brief     make a change from a runtime value
+     * @param[in] value field value
+     * @return    field change
+     * @note      bits above the field width are dropped, values above max are not checked,
+     *            use the c setter when the value is not known at compile time and may be out of range
+     */
+    static constexpr Change<Field> set(T value) noexcept
+    {
+        return Change<Field>{static_cast<uint16_t>((static_cast<uint16_t>(value) << Shift) & mask)};
+    }
+
+    /**
+     * @brief  make a change from a constant checked at compile time
+     * @return field change
+     * @note   none
+     */
+    template <uint16_t V>
+    static constexpr Change<Field> set() noexcept
+    {
+        static_assert(V <= max, "value does not fit in the field");
+
+        return Change<Field>{static_cast<uint16_t>(V << Shift)};
+    }
+};
+
+/**
+ * @brief     change several fields of one register with a single bus write
+ * @param[in] *handle pointer to a wm8978 handle structure
+ * @param[in] first first field change
+ * @param[in] rest other field changes
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      all fields must belong to the same register and must not overlap,
+ *            both are checked at compile time
+ */
+template <class F, class... Fs>
+inline uint8_t modify(wm8978_handle_t *handle, Change<F> first, Change<Fs>... rest) noexcept
+{
+    static_assert((true && ... && (Fs::reg == F::reg)), "all fields must belong to the same register");
+    static_assert((static_cast<uint32_t>(F::mask) + ... + static_cast<uint32_t>(Fs::mask)) ==
+                  (static_cast<uint32_t>(F::mask) | ... | static_cast<uint32_t>(Fs::mask)), "fields overlap");
+    constexpr uint16_t mask = static_cast<uint16_t>((F::mask | ... | Fs::mask));
+    uint16_t bits;
+
+    if (handle == nullptr)                                                             /* check handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                           /* check handle initialization */
+    {
+        return 3;                                                                      /* return error */
+    }
+
+    bits = static_cast<uint16_t>(first.bits | (0U | ... | rest.bits));                /* merge fields */
+
+    return wm8978_update_reg(handle, F::reg, mask, bits);                              /* update under the register lock */
+}
+
+/**
+ * @brief      read one field from the register shadow
+ * @param[in]  *handle pointer to a wm8978 handle structure
+ * @param[out] *value pointer to a field value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+template <class F>
+inline uint8_t get(const wm8978_handle_t *handle, typename F::value_type *value) noexcept
+{
+    if (handle == nullptr)                                                             /* check handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                           /* check handle initialization */
+    {
+        return 3;                                                                      /* return error */
+    }
+
+    *value = static_cast<typename F::value_type>((handle->reg[F::reg] & F::mask) >> F::shift);        /* get field */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief wm8978 integer conversion definition, mirrors the *_cdb / *_us / *_permille c helpers
+ * @note  the functions are constexpr so lookup tables can be built at compile time,
+ *        inputs must already be inside the range checked by the c helpers
+ */
+namespace convert
+{
+    /**
+     * @brief alc hold time table in us
+     */
+    constexpr uint32_t alc_hold_time_us[16] =
+    {
+        0, 2667, 5333, 10667, 21333, 42667, 85333, 170667,
+        341333, 682667, 1365333, 2730667, 5461333, 10922667, 21845333, 43690667,
+    };
+
+    /**
+     * @brief -12700 to 0 cdb, 50 cdb step
+     */
+    constexpr uint8_t volume_from_cdb(int16_t cdb) noexcept
+    {
+        return static_cast<uint8_t>((cdb + 12700 + 25) / 50 + 1);
+    }
+
+    /**
+     * @brief volume raw data to cdb
+     */
+    constexpr int16_t volume_to_cdb(uint8_t reg) noexcept
+    {
+        return static_cast<int16_t>((static_cast<int16_t>(reg) - 1) * 50 - 12700);
+    }
+
+    /**
+     * @brief -1200 to 3525 cdb, 75 cdb step
+     */
+    constexpr uint8_t pga_volume_from_cdb(int16_t cdb) noexcept
+    {
+        return static_cast<uint8_t>((cdb + 1200 + 37) / 75);
+    }
+
+    /**
+     * @brief pga volume raw data to cdb
+     */
+    constexpr int16_t pga_volume_to_cdb(uint8_t reg) noexcept
+    {
+        return static_cast<int16_t>(static_cast<int16_t>(reg) * 75 - 1200);
+    }
+
+    /**
+     * @brief 0 to 1000 permille
+     */
+    constexpr uint8_t depth_3d_from_permille(uint16_t permille) noexcept
+    {
+        return static_cast<uint8_t>((permille * 15U + 500U) / 1000U);
+    }
+
+    /**
+     * @brief depth 3d raw data to permille
+     */
+    constexpr uint16_t depth_3d_to_permille(uint8_t reg) noexcept
+    {
+        return static_cast<uint16_t>((reg * 1000U + 7U) / 15U);
+    }
+}
+
+/**
+ * @brief wm8978 register field definition, mirrors wm8978_field_t
+ */
+namespace field
+{
+    using dc_buffer = Field<reg::power_manage_1, 8, 1, wm8978_bool_t>;                                                    /**< dc buffer */
+    using out4_mixer = Field<reg::power_manage_1, 7, 1, wm8978_bool_t>;                                                   /**< out4 mixer */
+    using out3_mixer = Field<reg::power_manage_1, 6, 1, wm8978_bool_t>;                                                   /**< out3 mixer */
+    using pll = Field<reg::power_manage_1, 5, 1, wm8978_bool_t>;                                                          /**< pll */
+    using microphone_bias = Field<reg::power_manage_1, 4, 1, wm8978_bool_t>;                                              /**< microphone bias */
+    using analogue_amplifier_bias = Field<reg::power_manage_1, 3, 1, wm8978_bool_t>;                                      /**< analogue amplifier bias */
+    using unused_input_output_tie_off_buffer = Field<reg::power_manage_1, 2, 1, wm8978_bool_t>;                           /**< unused input output tie off buffer */
+    using reference_impedance = Field<reg::power_manage_1, 0, 2, wm8978_impedance_t>;                                     /**< reference impedance */
+    using right_out1 = Field<reg::power_manage_2, 8, 1, wm8978_bool_t>;                                                   /**< right out1 */
+    using left_out1 = Field<reg::power_manage_2, 7, 1, wm8978_bool_t>;                                                    /**< left out1 */
+    using sleep = Field<reg::power_manage_2, 6, 1, wm8978_bool_t>;                                                        /**< sleep */
+    using right_channel_input_boost = Field<reg::power_manage_2, 5, 1, wm8978_bool_t>;                                    /**< right channel input boost */
+    using left_channel_input_boost = Field<reg::power_manage_2, 4, 1, wm8978_bool_t>;                                     /**< left channel input boost */
+    using right_channel_input_pga = Field<reg::power_manage_2, 3, 1, wm8978_bool_t>;                                      /**< right channel input pga */
+    using left_channel_input_pga = Field<reg::power_manage_2, 2, 1, wm8978_bool_t>;                                       /**< left channel input pga */
+    using right_channel_adc = Field<reg::power_manage_2, 1, 1, wm8978_bool_t>;                                            /**< right channel adc */
+    using left_channel_adc = Field<reg::power_manage_2, 0, 1, wm8978_bool_t>;                                             /**< left channel adc */
+    using out4 = Field<reg::power_manage_3, 8, 1, wm8978_bool_t>;                                                         /**< out4 */
+    using out3 = Field<reg::power_manage_3, 7, 1, wm8978_bool_t>;                                                         /**< out3 */
+    using left_out2 = Field<reg::power_manage_3, 6, 1, wm8978_bool_t>;                                                    /**< left out2 */
+    using right_out2 = Field<reg::power_manage_3, 5, 1, wm8978_bool_t>;                                                   /**< right out2 */
+    using right_output_channel_mixer = Field<reg::power_manage_3, 3, 1, wm8978_bool_t>;                                   /**< right output channel mixer */
+    using left_output_channel_mixer = Field<reg::power_manage_3, 2, 1, wm8978_bool_t>;                                    /**< left output channel mixer */
+    using right_channel_dac = Field<reg::power_manage_3, 1, 1, wm8978_bool_t>;                                            /**< right channel dac */
+    using left_channel_dac = Field<reg::power_manage_3, 0, 1, wm8978_bool_t>;                                             /**< left channel dac */
+    using bclk_polarity = Field<reg::audio_interface, 8, 1, wm8978_polarity_t>;                                           /**< bclk polarity */
+    using lrclk_polarity = Field<reg::audio_interface, 7, 1, wm8978_polarity_t>;                                          /**< lrclk polarity */
+    using word_length = Field<reg::audio_interface, 5, 2, wm8978_word_length_t>;                                          /**< word length */
+    using data_format = Field<reg::audio_interface, 3, 2, wm8978_data_format_t>;                                          /**< data format */
+    using dac_appear = Field<reg::audio_interface, 2, 1, wm8978_appear_t>;                                                /**< dac appear */
+    using adc_appear = Field<reg::audio_interface, 1, 1, wm8978_appear_t>;                                                /**< adc appear */
+    using channel = Field<reg::audio_interface, 0, 1, wm8978_channel_t>;                                                  /**< channel */
+    using companding_8bit_mode = Field<reg::companding_ctrl, 5, 1, wm8978_bool_t>;                                        /**< companding 8bit mode */
+    using dac_companding = Field<reg::companding_ctrl, 3, 2, wm8978_companding_t>;                                        /**< dac companding */
+    using adc_companding = Field<reg::companding_ctrl, 1, 2, wm8978_companding_t>;                                        /**< adc companding */
+    using loopback = Field<reg::companding_ctrl, 0, 1, wm8978_bool_t>;                                                    /**< loopback */
+    using clksel = Field<reg::clock_gen_ctrl, 8, 1, wm8978_clksel_t>;                                                     /**< clksel */
+    using mclk_div = Field<reg::clock_gen_ctrl, 5, 3, wm8978_mclk_div_t>;                                                 /**< mclk div */
+    using bclk_div = Field<reg::clock_gen_ctrl, 2, 3, wm8978_bclk_div_t>;                                                 /**< bclk div */
+    using clock_mode = Field<reg::clock_gen_ctrl, 0, 1, wm8978_clock_mode_t>;                                             /**< clock mode */
+    using approximate_sample_rate = Field<reg::additional_ctrl, 1, 3, wm8978_approximate_sample_t>;                       /**< approximate sample rate */
+    using slow_clock = Field<reg::additional_ctrl, 0, 1, wm8978_bool_t>;                                                  /**< slow clock */
+    using pll_div = Field<reg::gpio, 4, 2, wm8978_pll_div_t>;                                                             /**< pll div */
+    using gpio1_polarity = Field<reg::gpio, 3, 1, wm8978_polarity_t>;                                                     /**< gpio1 polarity */
+    using gpio1_select = Field<reg::gpio, 0, 3, wm8978_gpio1_sel_t>;                                                      /**< gpio1 select */
+    using vmid_1 = Field<reg::jack_detect_control, 8, 1, wm8978_bool_t>;                                                  /**< vmid 1 */
+    using vmid_0 = Field<reg::jack_detect_control, 7, 1, wm8978_bool_t>;                                                  /**< vmid 0 */
+    using jack_detection = Field<reg::jack_detect_control, 6, 1, wm8978_bool_t>;                                          /**< jack detection */
+    using jack_gpio = Field<reg::jack_detect_control, 4, 2, wm8978_jack_sel_t>;                                           /**< jack gpio */
+    using soft_mute = Field<reg::dac_control, 6, 1, wm8978_bool_t>;                                                       /**< soft mute */
+    using dac_oversample_rate = Field<reg::dac_control, 3, 1, wm8978_dac_oversample_rate_t>;                              /**< dac oversample rate */
+    using amute = Field<reg::dac_control, 2, 1, wm8978_bool_t>;                                                           /**< amute */
+    using right_dac_output_polarity = Field<reg::dac_control, 1, 1, wm8978_polarity_t>;                                   /**< right dac output polarity */
+    using left_dac_output_polarity = Field<reg::dac_control, 0, 1, wm8978_polarity_t>;                                    /**< left dac output polarity */
+    using dac_left_volume_update = Field<reg::left_dac_digital_vol, 8, 1, wm8978_bool_t>;                                 /**< dac left volume update */
+    using dac_left_volume = Field<reg::left_dac_digital_vol, 0, 8, uint8_t>;                                              /**< dac left volume */
+    using dac_right_volume_update = Field<reg::right_dac_digital_vol, 8, 1, wm8978_bool_t>;                               /**< dac right volume update */
+    using dac_right_volume = Field<reg::right_dac_digital_vol, 0, 8, uint8_t>;                                            /**< dac right volume */
+    using jack_logic_1 = Field<reg::jack_detect_control2, 4, 4, uint16_t>;                                                /**< jack logic 1 */
+    using jack_logic_0 = Field<reg::jack_detect_control2, 0, 4, uint16_t>;                                                /**< jack logic 0 */
+    using high_pass_filter = Field<reg::adc_control, 8, 1, wm8978_bool_t>;                                                /**< high pass filter */
+    using mode = Field<reg::adc_control, 7, 1, wm8978_mode_t>;                                                            /**< chip mode */
+    using high_pass_filter_cut_off = Field<reg::adc_control, 4, 3, wm8978_high_pass_filter_cut_off_t>;                    /**< high pass filter cut off */
+    using adc_oversample_rate = Field<reg::adc_control, 3, 1, wm8978_adc_oversample_rate_t>;                              /**< adc oversample rate */
+    using adc_right_channel_polarity = Field<reg::adc_control, 1, 1, wm8978_polarity_t>;                                  /**< adc right channel polarity */
+    using adc_left_channel_polarity = Field<reg::adc_control, 0, 1, wm8978_polarity_t>;                                   /**< adc left channel polarity */
+    using adc_left_volume_update = Field<reg::left_adc_digital_vol, 8, 1, wm8978_bool_t>;                                 /**< adc left volume update */
+    using adc_left_volume = Field<reg::left_adc_digital_vol, 0, 8, uint8_t>;                                              /**< adc left volume */
+    using adc_right_volume_update = Field<reg::right_adc_digital_vol, 8, 1, wm8978_bool_t>;                               /**< adc right volume update */
+    using adc_right_volume = Field<reg::right_adc_digital_vol, 0, 8, uint8_t>;                                            /**< adc right volume */
+    using equaliser_apply = Field<reg::eq1, 8, 1, wm8978_equaliser_t>;                                                    /**< equaliser apply */
+    using eq1_cut_off = Field<reg::eq1, 5, 2, wm8978_eq1_band_cut_off_t>;                                                 /**< eq1 cut off */
+    using eq1_gain = Field<reg::eq1, 0, 5, uint8_t>;                                                                      /**< eq1 gain */
+    using eq2_bandwidth = Field<reg::eq2, 8, 1, wm8978_eq_bandwidth_t>;                                                   /**< eq2 bandwidth */
+    using eq2_centre_freq = Field<reg::eq2, 5, 2, wm8978_eq2_band_centre_freq_t>;                                         /**< eq2 centre freq */
+    using eq2_gain = Field<reg::eq2, 0, 5, uint8_t>;                                                                      /**< eq2 gain */
+    using eq3_bandwidth = Field<reg::eq3, 8, 1, wm8978_eq_bandwidth_t>;                                                   /**< eq3 bandwidth */
+    using eq3_centre_freq = Field<reg::eq3, 5, 2, wm8978_eq3_band_centre_freq_t>;                                         /**< eq3 centre freq */
+    using eq3_gain = Field<reg::eq3, 0, 5, uint8_t>;                                                                      /**< eq3 gain */
+    using eq4_bandwidth = Field<reg::eq4, 8, 1, wm8978_eq_bandwidth_t>;                                                   /**< eq4 bandwidth */
+    using eq4_centre_freq = Field<reg::eq4, 5, 2, wm8978_eq4_band_centre_freq_t>;                                         /**< eq4 centre freq */
+    using eq4_gain = Field<reg::eq4, 0, 5, uint8_t>;                                                                      /**< eq4 gain */
+    using eq5_cut_off = Field<reg::eq5, 5, 2, wm8978_eq5_band_cut_off_t>;                                                 /**< eq5 cut off */
+    using eq5_gain = Field<reg::eq5, 0, 5, uint8_t>;                                                                      /**< eq5 gain */
+    using dac_digital_limiter = Field<reg::dac_limiter_1, 8, 1, wm8978_bool_t>;                                           /**< dac digital limiter */
+    using dac_limiter_decay = Field<reg::dac_limiter_1, 4, 4, wm8978_dac_limiter_decay_t>;                                /**< dac limiter decay */
+    using dac_limiter_attack = Field<reg::dac_limiter_1, 0, 4, wm8978_dac_limiter_attack_t>;                              /**< dac limiter attack */
+    using dac_limiter_level = Field<reg::dac_limiter_2, 4, 3, wm8978_dac_limiter_level_t>;                                /**< dac limiter level */
+    using dac_limiter_volume_boost = Field<reg::dac_limiter_2, 0, 4, uint8_t, 0x0C>;                                      /**< dac limiter volume boost */
+    using notch_filter = Field<reg::notch_filter_1, 7, 1, wm8978_bool_t>;                                                 /**< notch filter */
+    using notch_filter_a0_coefficient_bit_13_7_update = Field<reg::notch_filter_1, 8, 1, wm8978_bool_t>;                  /**< notch filter a0 coefficient bit13 - bit7 update */
+    using notch_filter_a0_coefficient_bit_13_7 = Field<reg::notch_filter_1, 0, 7, uint8_t>;                               /**< notch filter a0 coefficient bit13 - bit7 */
+    using notch_filter_a0_coefficient_bit_6_0_update = Field<reg::notch_filter_2, 8, 1, wm8978_bool_t>;                   /**< notch filter a0 coefficient bit6 - bit0 update */
+    using notch_filter_a0_coefficient_bit_6_0 = Field<reg::notch_filter_2, 0, 7, uint8_t>;                                /**< notch filter a0 coefficient bit6 - bit0 */
+    using notch_filter_a1_coefficient_bit_13_7_update = Field<reg::notch_filter_3, 8, 1, wm8978_bool_t>;                  /**< notch filter a1 coefficient bit13 - bit7 update */
+    using notch_filter_a1_coefficient_bit_13_7 = Field<reg::notch_filter_3, 0, 7, uint8_t>;                               /**< notch filter a1 coefficient bit13 - bit7 */
+    using notch_filter_a1_coefficient_bit_6_0_update = Field<reg::notch_filter_4, 8, 1, wm8978_bool_t>;                   /**< notch filter a1 coefficient bit6 - bit0 update */
+    using notch_filter_a1_coefficient_bit_6_0 = Field<reg::notch_filter_4, 0, 7, uint8_t>;                                /**< notch filter a1 coefficient bit6 - bit0 */
+    using alc = Field<reg::alc_control_1, 7, 2, wm8978_alc_t>;                                                            /**< alc */
+    using alc_max_gain = Field<reg::alc_control_1, 3, 3, wm8978_max_gain_t>;                                              /**< alc max gain */
+    using alc_min_gain = Field<reg::alc_control_1, 0, 3, wm8978_min_gain_t>;                                              /**< alc min gain */
+    using alc_hold_time = Field<reg::alc_control_2, 4, 4, uint8_t>;                                                       /**< alc hold time */
+    using alc_level = Field<reg::alc_control_2, 0, 4, wm8978_alc_level_t>;                                                /**< alc level */
+    using alc_mode = Field<reg::alc_control_3, 8, 1, wm8978_alc_mode_t>;                                                  /**< alc mode */
+    using alc_decay = Field<reg::alc_control_3, 4, 4, uint8_t>;                                                           /**< alc decay */
+    using alc_attack = Field<reg::alc_control_3, 0, 4, uint8_t>;                                                          /**< alc attack */
+    using alc_noise_gate = Field<reg::noise_gate, 3, 1, wm8978_bool_t>;                                                   /**< alc noise gate */
+    using alc_noise_gate_threshold = Field<reg::noise_gate, 0, 3, uint8_t>;                                               /**< alc noise gate threshold */
+    using mclk_divide_by_2 = Field<reg::pll_n, 4, 1, wm8978_bool_t>;                                                      /**< mclk divide by 2 */
+    using plln = Field<reg::pll_n, 0, 4, uint8_t>;                                                                        /**< plln */
+    using pll_k3 = Field<reg::pll_k3, 0, 9, uint16_t>;                                                                    /**< pll k3 */
+    using pll_k2 = Field<reg::pll_k2, 0, 9, uint16_t>;                                                                    /**< pll k2 */
+    using pll_k1 = Field<reg::pll_k1, 0, 6, uint16_t>;                                                                    /**< pll k1 */
+    using depth_3d = Field<reg::control_3d, 0, 4, uint8_t>;                                                               /**< depth 3d */
+    using mute_input_to_inv_rout2_mixer = Field<reg::beep_control, 5, 1, wm8978_bool_t>;                                  /**< mute input to inv rout2 mixer */
+    using inv_rout2_mixer = Field<reg::beep_control, 4, 1, wm8978_bool_t>;                                                /**< inv rout2 mixer */
+    using beep_volume = Field<reg::beep_control, 1, 3, uint8_t>;                                                          /**< beep volume */
+    using beep = Field<reg::beep_control, 0, 1, wm8978_bool_t>;                                                           /**< beep */
+    using microphone_bias_voltage = Field<reg::input_ctrl, 8, 1, wm8978_avdd_t>;                                          /**< microphone bias voltage */
+    using right_channel_input_pga_positive = Field<reg::input_ctrl, 6, 1, wm8978_bool_t>;                                 /**< right channel input pga positive */
+    using right_channel_input_pga_negative = Field<reg::input_ctrl, 5, 1, wm8978_bool_t>;                                 /**< right channel input pga negative */
+    using right_channel_input_pga_amplifier_positive = Field<reg::input_ctrl, 4, 1, wm8978_bool_t>;                       /**< right channel input pga amplifier positive */
+    using left_channel_input_pga_positive = Field<reg::input_ctrl, 2, 1, wm8978_bool_t>;                                  /**< left channel input pga positive */
+    using left_channel_input_pga_negative = Field<reg::input_ctrl, 1, 1, wm8978_bool_t>;                                  /**< left channel input pga negative */
+    using left_channel_input_pga_amplifier_positive = Field<reg::input_ctrl, 0, 1, wm8978_bool_t>;                        /**< left channel input pga amplifier positive */
+    using left_input_pga_update = Field<reg::left_inp_pga_ctrl, 8, 1, wm8978_bool_t>;                                     /**< left input pga update */
+    using left_channel_input_pga_zero_cross = Field<reg::left_inp_pga_ctrl, 7, 1, wm8978_bool_t>;                         /**< left channel input pga zero cross */
+    using left_channel_input_pga_mute = Field<reg::left_inp_pga_ctrl, 6, 1, wm8978_bool_t>;                               /**< left channel input pga mute */
+    using left_channel_input_pga_volume = Field<reg::left_inp_pga_ctrl, 0, 6, uint8_t>;                                   /**< left channel input pga volume */
+    using right_input_pga_update = Field<reg::right_inp_pga_ctrl, 8, 1, wm8978_bool_t>;                                   /**< right input pga update */
+    using right_channel_input_pga_zero_cross = Field<reg::right_inp_pga_ctrl, 7, 1, wm8978_bool_t>;                       /**< right channel input pga zero cross */
+    using right_channel_input_pga_mute = Field<reg::right_inp_pga_ctrl, 6, 1, wm8978_bool_t>;                             /**< right channel input pga mute */
+    using right_channel_input_pga_volume = Field<reg::right_inp_pga_ctrl, 0, 6, uint8_t>;                                 /**< right channel input pga volume */
+    using left_channel_input_pga_boost = Field<reg::left_adc_boost_ctrl, 8, 1, wm8978_bool_t>;                            /**< left channel input pga boost */
+    using left_channel_input_boost_stage = Field<reg::left_adc_boost_ctrl, 4, 3, uint8_t>;                                /**< left channel input boost stage */
+    using auxiliary_amplifier_left_channel_input_boost_stage = Field<reg::left_adc_boost_ctrl, 0, 3, uint8_t>;            /**< auxiliary amplifier left channel input boost stage */
+    using right_channel_input_pga_boost = Field<reg::right_adc_boost_ctrl, 8, 1, wm8978_bool_t>;                          /**< right channel input pga boost */
+    using right_channel_input_boost_stage = Field<reg::right_adc_boost_ctrl, 4, 3, uint8_t>;                              /**< right channel input boost stage */
+    using auxiliary_amplifier_right_channel_input_boost_stage = Field<reg::right_adc_boost_ctrl, 0, 3, uint8_t>;          /**< auxiliary amplifier right channel input boost stage */
+    using left_dac_output_to_right_output_mixer = Field<reg::output_ctrl, 6, 1, wm8978_bool_t>;                           /**< left dac output to right output mixer */
+    using right_dac_output_to_left_output_mixer = Field<reg::output_ctrl, 5, 1, wm8978_bool_t>;                           /**< right dac output to left output mixer */
+    using out4_boost = Field<reg::output_ctrl, 4, 1, wm8978_bool_t>;                                                      /**< out4 boost */
+    using out3_boost = Field<reg::output_ctrl, 3, 1, wm8978_bool_t>;                                                      /**< out3 boost */
+    using speaker_boost = Field<reg::output_ctrl, 2, 1, wm8978_bool_t>;                                                   /**< speaker boost */
+    using thermal_shutdown = Field<reg::output_ctrl, 1, 1, wm8978_bool_t>;                                                /**< thermal shutdown */
+    using vref_to_analogue_output_resistance = Field<reg::output_ctrl, 0, 1, wm8978_vref_t>;                              /**< vref to analogue output resistance */
+    using aux_left_channel_input_to_left_mixer_volume = Field<reg::left_mixer_ctrl, 6, 3, uint8_t>;                       /**< aux left channel input to left mixer volume */
+    using left_auxiliary_input_to_left_channel_output_mixer = Field<reg::left_mixer_ctrl, 5, 1, wm8978_bool_t>;           /**< left auxiliary input to left channel output mixer */
+    using left_bypass_volume_control_to_output_channel_mixer = Field<reg::left_mixer_ctrl, 2, 3, uint8_t>;                /**< left bypass volume control to output channel mixer */
+    using left_bypass_path_to_left_output_mixer = Field<reg::left_mixer_ctrl, 1, 1, wm8978_bool_t>;                       /**< left bypass path to left output mixer */
+    using left_dac_output_to_left_output_mixer = Field<reg::left_mixer_ctrl, 0, 1, wm8978_bool_t>;                        /**< left dac output to left output mixer */
+    using aux_right_channel_input_to_right_mixer_volume = Field<reg::right_mixer_ctrl, 6, 3, uint8_t>;                    /**< aux right channel input to right mixer volume */
+    using right_auxiliary_input_to_right_channel_output_mixer = Field<reg::right_mixer_ctrl, 5, 1, wm8978_bool_t>;        /**< right auxiliary input to right channel output mixer */
+    using right_bypass_volume_control_to_output_channel_mixer = Field<reg::right_mixer_ctrl, 2, 3, uint8_t>;              /**< right bypass volume control to output channel mixer */
+    using right_bypass_path_to_right_output_mixer = Field<reg::right_mixer_ctrl, 1, 1, wm8978_bool_t>;                    /**< right bypass path to right output mixer */
+    using right_dac_output_to_right_output_mixer = Field<reg::right_mixer_ctrl, 0, 1, wm8978_bool_t>;                     /**< right dac output to right output mixer */
+    using lout1_update = Field<reg::lout1_ctrl, 8, 1, wm8978_bool_t>;                                                     /**< lout1 update */
+    using lout1_headphone_volume_zero_cross = Field<reg::lout1_ctrl, 7, 1, wm8978_bool_t>;                                /**< lout1 headphone volume zero cross */
+    using lout1_left_headphone_output_mute = Field<reg::lout1_ctrl, 6, 1, wm8978_bool_t>;                                 /**< lout1 left headphone output mute */
+    using lout1_left_headphone_output_volume = Field<reg::lout1_ctrl, 0, 6, uint8_t>;                                     /**< lout1 left headphone output volume */
+    using rout1_update = Field<reg::rout1_ctrl, 8, 1, wm8978_bool_t>;                                                     /**< rout1 update */
+    using rout1_headphone_volume_zero_cross = Field<reg::rout1_ctrl, 7, 1, wm8978_bool_t>;                                /**< rout1 headphone volume zero cross */
+    using rout1_right_headphone_output_mute = Field<reg::rout1_ctrl, 6, 1, wm8978_bool_t>;                                /**< rout1 right headphone output mute */
+    using rout1_right_headphone_output_volume = Field<reg::rout1_ctrl, 0, 6, uint8_t>;                                    /**< rout1 right headphone output volume */
+    using lout2_update = Field<reg::lout2_ctrl, 8, 1, wm8978_bool_t>;                                                     /**< lout2 update */
+    using lout2_speaker_volume_zero_cross = Field<reg::lout2_ctrl, 7, 1, wm8978_bool_t>;                                  /**< lout2 speaker volume zero cross */
+    using lout2_left_speaker_output_mute = Field<reg::lout2_ctrl, 6, 1, wm8978_bool_t>;                                   /**< lout2 left speaker output mute */
+    using lout2_left_speaker_output_volume = Field<reg::lout2_ctrl, 0, 6, uint8_t>;                                       /**< lout2 left speaker output volume */
+    using rout2_update = Field<reg::rout2_ctrl, 8, 1, wm8978_bool_t>;                                                     /**< rout2 update */
+    using rout2_speaker_volume_zero_cross = Field<reg::rout2_ctrl, 7, 1, wm8978_bool_t>;                                  /**< rout2 speaker volume zero cross */
+    using rout2_right_speaker_output_mute = Field<reg::rout2_ctrl, 6, 1, wm8978_bool_t>;                                  /**< rout2 right speaker output mute */
+    using rout2_right_speaker_output_volume = Field<reg::rout2_ctrl, 0, 6, uint8_t>;                                      /**< rout2 right speaker output volume */
+    using out3_mute = Field<reg::out3_mixer_ctrl, 6, 1, wm8978_bool_t>;                                                   /**< out3 mute */
+    using out4_mixer_output_to_out3 = Field<reg::out3_mixer_ctrl, 3, 1, wm8978_bool_t>;                                   /**< out4 mixer output to out3 */
+    using left_adc_input_to_out3 = Field<reg::out3_mixer_ctrl, 2, 1, wm8978_bool_t>;                                      /**< left adc input to out3 */
+    using left_dac_mixer_to_out3 = Field<reg::out3_mixer_ctrl, 1, 1, wm8978_bool_t>;                                      /**< left dac mixer to out3 */
+    using left_dac_output_to_out3 = Field<reg::out3_mixer_ctrl, 0, 1, wm8978_bool_t>;                                     /**< left dac output to out3 */
+    using out4_mute = Field<reg::out4_mixer_ctrl, 6, 1, wm8978_bool_t>;                                                   /**< out4 mute */
+    using out4_attenuated_by_6db = Field<reg::out4_mixer_ctrl, 5, 1, wm8978_bool_t>;                                      /**< out4 attenuated by 6db */
+    using left_dac_mixer_to_out4 = Field<reg::out4_mixer_ctrl, 4, 1, wm8978_bool_t>;                                      /**< left dac mixer to out4 */
+    using left_dac_to_out4 = Field<reg::out4_mixer_ctrl, 3, 1, wm8978_bool_t>;                                            /**< left dac to out4 */
+    using right_adc_input_to_out4 = Field<reg::out4_mixer_ctrl, 2, 1, wm8978_bool_t>;                                     /**< right adc input to out4 */
+    using right_dac_mixer_to_out4 = Field<reg::out4_mixer_ctrl, 1, 1, wm8978_bool_t>;                                     /**< right dac mixer to out4 */
+    using right_dac_output_to_out4 = Field<reg::out4_mixer_ctrl, 0, 1, wm8978_bool_t>;                                    /**< right dac output to out4 */
+}
+
+}
+
+/**
+ * @}
+ */
+
+#endif
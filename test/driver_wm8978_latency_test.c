@@ -0,0 +1,806 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_wm8978_latency_test.c
+ * @brief     driver wm8978 latency test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_wm8978_latency_test.h"
+
+/**
+ * @brief latency test definition
+ */
+#define WM8978_LATENCY_FREQ             48000        /**< sample rate */
+#define WM8978_LATENCY_FRAME            2048         /**< frames of one dma cycle */
+#define WM8978_LATENCY_BURST            255          /**< burst length */
+#define WM8978_LATENCY_AMPLITUDE        8192         /**< burst amplitude */
+#define WM8978_LATENCY_CAPTURE          8192         /**< captured frames of one sweep run */
+#define WM8978_LATENCY_INJECT           8            /**< fills before the burst is injected */
+#define WM8978_LATENCY_TIMEOUT          2000         /**< sweep run timeout in ms */
+
+/**
+ * @brief latency sweep structure definition
+ */
+typedef struct wm8978_latency_config_s
+{
+    uint32_t size;           /**< buffer size */
+    uint8_t segment;         /**< segment number */
+} wm8978_latency_config_t;
+
+/**
+ * @brief latency run structure definition
+ */
+typedef struct wm8978_latency_run_s
+{
+    int16_t *tx;                      /**< transmit buffer */
+    int16_t *rx;                      /**< receive buffer */
+    uint32_t seg_frame;               /**< frames of one segment */
+    uint32_t period_us;               /**< segment period in us */
+    uint32_t capture;                 /**< captured frames */
+    uint8_t segment;                  /**< segment number */
+    uint8_t next;                     /**< next expected fill index */
+    volatile uint8_t running;         /**< running flag */
+    wav_health_t health;              /**< health counters */
+} wm8978_latency_run_t;
+
+static wm8978_handle_t gs_handle;                          /**< wm8978 handle */
+static int8_t gs_burst[WM8978_LATENCY_BURST];              /**< burst sign */
+static int16_t gs_capture[WM8978_LATENCY_CAPTURE];         /**< left channel capture */
+static wm8978_latency_run_t gs_run;                        /**< sweep run */
+static const wm8978_latency_config_t gsc_config[] = 
+{
+    {1024 * 2, 2},
+    {1024 * 4, 2},
+    {1024 * 8, 2},
+    {1024 * 16, 2},
+};
+
+/**
+ * @brief  wm8978 config
+ * @return status code
+ *         - 0 success
+ *         - 1 config failed
+ * @note   none
+ */
+static uint8_t a_wm8978_config(void)
+{
+    uint8_t res;
+    
+    /* enable microphone bias */
+    res = wm8978_set_microphone_bias(&gs_handle, WM8978_BOOL_TRUE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* enable analogue amplifier bias */
+    res = wm8978_set_analogue_amplifier_bias(&gs_handle, WM8978_BOOL_TRUE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* set 5k reference impedance */
+    res = wm8978_set_reference_impedance(&gs_handle, WM8978_IMPEDANCE_5K);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* enable left out1 */
+    res = wm8978_set_left_out1(&gs_handle, WM8978_BOOL_TRUE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* enable right out1 */
+    res = wm8978_set_right_out1(&gs_handle, WM8978_BOOL_TRUE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* disable sleep */
+    res = wm8978_set_sleep(&gs_handle, WM8978_BOOL_FALSE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* enable left channel input boost */
+    res = wm8978_set_left_channel_input_boost(&gs_handle, WM8978_BOOL_TRUE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* enable right channel input boost */
+    res = wm8978_set_right_channel_input_boost(&gs_handle, WM8978_BOOL_TRUE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* enable left channel input pga */
+    res = wm8978_set_left_channel_input_pga(&gs_handle, WM8978_BOOL_TRUE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* enable right channel input pga */
+    res = wm8978_set_right_channel_input_pga(&gs_handle, WM8978_BOOL_TRUE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* enable left channel adc */
+    res = wm8978_set_left_channel_adc(&gs_handle, WM8978_BOOL_TRUE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* enable right channel adc */
+    res = wm8978_set_right_channel_adc(&gs_handle, WM8978_BOOL_TRUE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* enable left output channel mixer */
+    res = wm8978_set_left_output_channel_mixer(&gs_handle, WM8978_BOOL_TRUE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* enable right output channel mixer */
+    res = wm8978_set_right_output_channel_mixer(&gs_handle, WM8978_BOOL_TRUE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* enable left channel dac */
+    res = wm8978_set_left_channel_dac(&gs_handle, WM8978_BOOL_TRUE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* enable right channel dac */
+    res = wm8978_set_right_channel_dac(&gs_handle, WM8978_BOOL_TRUE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* set iis format */
+    res = wm8978_set_data_format(&gs_handle, WM8978_DATA_FORMAT_IIS);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* set 16bits */
+    res = wm8978_set_word_length(&gs_handle, WM8978_WORD_LENGTH_16_BITS);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* 2 channels */
+    res = wm8978_set_channel(&gs_handle, WM8978_CHANNEL_STEREO);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* disable loopback */
+    res = wm8978_set_loopback(&gs_handle, WM8978_BOOL_FALSE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* set mclk */
+    res = wm8978_set_clksel(&gs_handle, WM8978_CLKSEL_MCLK);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* mclk div by 1 */
+    res = wm8978_set_mclk_div(&gs_handle, WM8978_MCLK_DIV_BY_1);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* set input mode */
+    res = wm8978_set_clock_mode(&gs_handle, WM8978_CLOCK_MODE_INPUT);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* set 48khz */
+    res = wm8978_set_approximate_sample_rate(&gs_handle, WM8978_APPROXIMATE_SAMPLE_48_KHZ);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* disable high pass filter */
+    res = wm8978_set_high_pass_filter(&gs_handle, WM8978_BOOL_FALSE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* disable alc */
+    res = wm8978_set_alc(&gs_handle, WM8978_ALC_OFF);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* connect l2 to the left pga */
+    res = wm8978_set_left_channel_input_pga_positive(&gs_handle, WM8978_BOOL_TRUE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* disconnect lin from the left pga */
+    res = wm8978_set_left_channel_input_pga_negative(&gs_handle, WM8978_BOOL_FALSE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* disconnect lip from the left pga */
+    res = wm8978_set_left_channel_input_pga_amplifier_positive(&gs_handle, WM8978_BOOL_FALSE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* connect r2 to the right pga */
+    res = wm8978_set_right_channel_input_pga_positive(&gs_handle, WM8978_BOOL_TRUE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* disconnect rin from the right pga */
+    res = wm8978_set_right_channel_input_pga_negative(&gs_handle, WM8978_BOOL_FALSE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* disconnect rip from the right pga */
+    res = wm8978_set_right_channel_input_pga_amplifier_positive(&gs_handle, WM8978_BOOL_FALSE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* disable left bypass path */
+    res = wm8978_set_left_bypass_path_to_left_output_mixer(&gs_handle, WM8978_BOOL_FALSE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* disable right bypass path */
+    res = wm8978_set_right_bypass_path_to_right_output_mixer(&gs_handle, WM8978_BOOL_FALSE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* left dac to left output mixer */
+    res = wm8978_set_left_dac_output_to_left_output_mixer(&gs_handle, WM8978_BOOL_TRUE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* right dac to right output mixer */
+    res = wm8978_set_right_dac_output_to_right_output_mixer(&gs_handle, WM8978_BOOL_TRUE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* disable soft mute */
+    res = wm8978_set_soft_mute(&gs_handle, WM8978_BOOL_FALSE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  make the burst sign
+ * @note   8 bits maximum length sequence, its autocorrelation has one sharp peak
+ */
+static void a_wm8978_latency_burst(void)
+{
+    uint8_t lfsr = 0xFF;
+    uint16_t i;
+    
+    for (i = 0; i < WM8978_LATENCY_BURST; i++)
+    {
+        uint8_t bit = ((lfsr >> 7) ^ (lfsr >> 5) ^ (lfsr >> 4) ^ (lfsr >> 3)) & 0x01;
+        
+        gs_burst[i] = ((lfsr & 0x01) != 0) ? 1 : -1;
+        lfsr = (uint8_t)((lfsr << 1) | bit);
+    }
+}
+
+/**
+ * @brief      cross correlate the capture with the burst
+ * @param[in]  *rx pointer to a capture buffer
+ * @param[in]  frame captured frames
+ * @param[in]  step samples of one frame
+ * @param[in]  search searched start frames
+ * @param[out] *lag pointer to a lag buffer
+ * @param[out] *peak pointer to a peak buffer
+ * @param[out] *mean pointer to a mean buffer
+ * @note       the dma buffer is circular, so the correlation wraps too
+ */
+static void a_wm8978_latency_correlate(int16_t *rx, uint32_t frame, uint32_t step, uint32_t search, 
+                                       uint32_t *lag, int32_t *peak, int32_t *mean)
+{
+    uint32_t i;
+    uint32_t k;
+    int64_t sum = 0;
+    
+    *lag = 0;
+    *peak = 0;
+    for (i = 0; i < search; i++)
+    {
+        int32_t c = 0;
+        int32_t a;
+        uint32_t j = i;
+        
+        for (k = 0; k < WM8978_LATENCY_BURST; k++)
+        {
+            c += gs_burst[k] * rx[j * step];
+            j++;
+            if (j >= frame)
+            {
+                j = 0;
+            }
+        }
+        a = (c < 0) ? -c : c;
+        sum += a;
+        if (a > *peak)
+        {
+            *peak = a;
+            *lag = i;
+        }
+    }
+    *mean = (int32_t)(sum / search);
+}
+
+/**
+ * @brief     latency buffer fill
+ * @param[in] index buffer index
+ * @return    status code
+ *            - 0 success
+ *            - 1 not running
+ * @note      the received segment is passed through to the released transmit segment at -6dB,
+ *            the burst is added once, so the capture holds the burst and its first echo,
+ *            the echo distance is the pass through latency of the buffer configuration
+ */
+uint8_t wm8978_latency_buffer_fill(uint8_t index)
+{
+    uint32_t t0;
+    uint32_t i;
+    uint32_t duration;
+    int32_t slack;
+    int16_t *tx;
+    int16_t *rx;
+    uint8_t gap;
+    
+    if (gs_run.running == 0)
+    {
+        return 1;
+    }
+    
+    /* check the skipped segments */
+    t0 = wav_timestamp_us();
+    gap = (uint8_t)((index + gs_run.segment - gs_run.next) % gs_run.segment);
+    if (gap != 0)
+    {
+        gs_run.health.underrun += gap;
+        gs_run.health.overrun += gap;
+    }
+    gs_run.next = (uint8_t)((index + 1) % gs_run.segment);
+    gs_run.health.fill++;
+    
+    /* pass through */
+    tx = gs_run.tx + gs_run.seg_frame * 2 * index;
+    rx = gs_run.rx + gs_run.seg_frame * 2 * index;
+    for (i = 0; i < gs_run.seg_frame; i++)
+    {
+        int16_t v = 0;
+        
+        if ((gs_run.health.fill >= WM8978_LATENCY_INJECT) && (gs_run.capture < WM8978_LATENCY_CAPTURE))
+        {
+            v = (int16_t)(rx[i * 2] / 2);
+        }
+        if ((gs_run.health.fill == WM8978_LATENCY_INJECT) && (i < WM8978_LATENCY_BURST))
+        {
+            v = (int16_t)(v + gs_burst[i] * WM8978_LATENCY_AMPLITUDE);
+        }
+        if ((gs_run.health.fill >= (uint32_t)(WM8978_LATENCY_INJECT + gs_run.segment - 1)) && 
+            (gs_run.capture < WM8978_LATENCY_CAPTURE))
+        {
+            gs_capture[gs_run.capture] = rx[i * 2];
+            gs_run.capture++;
+        }
+        tx[i * 2 + 0] = v;
+        tx[i * 2 + 1] = v;
+    }
+    
+    /* check the deadline */
+    duration = wav_timestamp_us() - t0;
+    slack = (int32_t)(gs_run.period_us * (uint32_t)(gs_run.segment - 1)) - (int32_t)duration;
+    if (duration > gs_run.health.max_fill_us)
+    {
+        gs_run.health.max_fill_us = duration;
+    }
+    if (slack < gs_run.health.min_slack_us)
+    {
+        gs_run.health.min_slack_us = slack;
+    }
+    if (slack < 0)
+    {
+        gs_run.health.late++;
+        gs_run.health.underrun++;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      run one buffer configuration
+ * @param[in]  *buf pointer to a buffer
+ * @param[in]  *config pointer to a config structure
+ * @param[out] *echo pointer to an echo distance buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ *             - 2 no echo captured
+ * @note       buf holds the transmit and the receive buffer of the configuration
+ */
+static uint8_t a_wm8978_latency_run(uint8_t *buf, const wm8978_latency_config_t *config, uint32_t *echo)
+{
+    uint8_t res;
+    uint32_t timeout;
+    uint32_t first;
+    uint32_t second;
+    int32_t peak;
+    int32_t mean;
+    
+    /* reset the run */
+    memset(buf, 0, config->size * 2);
+    gs_run.tx = (int16_t *)buf;
+    gs_run.rx = (int16_t *)(buf + config->size);
+    gs_run.segment = config->segment;
+    gs_run.seg_frame = config->size / config->segment / 4;
+    gs_run.period_us = (uint32_t)((uint64_t)gs_run.seg_frame * 1000000 / WM8978_LATENCY_FREQ);
+    gs_run.capture = 0;
+    gs_run.next = 0;
+    gs_run.health.fill = 0;
+    gs_run.health.underrun = 0;
+    gs_run.health.overrun = 0;
+    gs_run.health.late = 0;
+    gs_run.health.max_fill_us = 0;
+    gs_run.health.min_slack_us = INT32_MAX;
+    gs_run.running = 1;
+    
+    /* play and capture */
+    res = wav_iis_transmit_receive((uint16_t *)gs_run.tx, (uint16_t *)gs_run.rx, (uint16_t)(config->size / 2));
+    if (res != 0)
+    {
+        gs_run.running = 0;
+        
+        return 1;
+    }
+    timeout = WM8978_LATENCY_TIMEOUT;
+    while ((gs_run.capture < WM8978_LATENCY_CAPTURE) && (timeout != 0))
+    {
+        wm8978_interface_delay_ms(1);
+        timeout--;
+    }
+    res = wav_iis_stop();
+    gs_run.running = 0;
+    if ((res != 0) || (timeout == 0))
+    {
+        return 1;
+    }
+    
+    /* the burst arrives within the first segment of the capture */
+    a_wm8978_latency_correlate(gs_capture, WM8978_LATENCY_CAPTURE, 1, 
+                               gs_run.seg_frame + config->size / 8, &first, &peak, &mean);
+    if (peak < mean * 8 + 1)
+    {
+        return 2;
+    }
+    
+    /* the echo follows one pass through later */
+    a_wm8978_latency_correlate(gs_capture + first + WM8978_LATENCY_BURST, 
+                               WM8978_LATENCY_CAPTURE - first - WM8978_LATENCY_BURST, 1, 
+                               WM8978_LATENCY_CAPTURE - first - WM8978_LATENCY_BURST * 2, 
+                               &second, &peak, &mean);
+    if (peak < mean * 8 + 1)
+    {
+        return 2;
+    }
+    *echo = second + WM8978_LATENCY_BURST;
+    
+    return 0;
+}
+
+/**
+ * @brief  latency test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   connect LOUT1/ROUT1 to L2/R2 with a cable before running,
+ *         the codec loopback bit only routes the adc back to the dac
+ */
+uint8_t wm8978_latency_test(void)
+{
+    uint8_t res;
+    uint8_t segment;
+    uint8_t *buf;
+    uint32_t size;
+    uint32_t i;
+    uint32_t lag;
+    uint32_t echo;
+    uint32_t best = 0;
+    int32_t peak;
+    int32_t mean;
+    int16_t *tx;
+    int16_t *rx;
+    wm8978_info_t info;
+    
+    /* link interface function */
+    DRIVER_WM8978_LINK_INIT(&gs_handle, wm8978_handle_t); 
+    DRIVER_WM8978_LINK_IIC_INIT(&gs_handle, wm8978_interface_iic_init);
+    DRIVER_WM8978_LINK_IIC_DEINIT(&gs_handle, wm8978_interface_iic_deinit);
+    DRIVER_WM8978_LINK_IIC_WRITE(&gs_handle, wm8978_interface_iic_write);
+    DRIVER_WM8978_LINK_DELAY_MS(&gs_handle, wm8978_interface_delay_ms);
+    DRIVER_WM8978_LINK_DEBUG_PRINT(&gs_handle, wm8978_interface_debug_print);
+    
+    /* get information */
+    res = wm8978_info(&info);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: get info failed.\n");
+        
+        return 1;
+    }
+    else
+    {
+        /* print chip info */
+        wm8978_interface_debug_print("wm8978: chip is %s.\n", info.chip_name);
+        wm8978_interface_debug_print("wm8978: manufacturer is %s.\n", info.manufacturer_name);
+        wm8978_interface_debug_print("wm8978: interface is %s.\n", info.interface);
+        wm8978_interface_debug_print("wm8978: driver version is %d.%d.\n", info.driver_version / 1000, (info.driver_version % 1000) / 100);
+        wm8978_interface_debug_print("wm8978: min supply voltage is %0.1fV.\n", info.supply_voltage_min_v);
+        wm8978_interface_debug_print("wm8978: max supply voltage is %0.1fV.\n", info.supply_voltage_max_v);
+        wm8978_interface_debug_print("wm8978: max current is %0.2fmA.\n", info.max_current_ma);
+        wm8978_interface_debug_print("wm8978: max temperature is %0.1fC.\n", info.temperature_max);
+        wm8978_interface_debug_print("wm8978: min temperature is %0.1fC.\n", info.temperature_min);
+    }
+    
+    /* start latency test */
+    wm8978_interface_debug_print("wm8978: start latency test.\n");
+    
+    /* get buffer */
+    res = wav_buffer_get(&buf, &size, &segment);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: wav buffer get failed.\n");
+        
+        return 1;
+    }
+    if (size < WM8978_LATENCY_FRAME * 4 * 2)
+    {
+        wm8978_interface_debug_print("wm8978: wav buffer is too small.\n");
+        
+        return 1;
+    }
+    tx = (int16_t *)buf;
+    rx = (int16_t *)(buf + WM8978_LATENCY_FRAME * 4);
+    
+    /* make the stimulus */
+    a_wm8978_latency_burst();
+    for (i = 0; i < WM8978_LATENCY_FRAME; i++)
+    {
+        int16_t v = (i < WM8978_LATENCY_BURST) ? (int16_t)(gs_burst[i] * WM8978_LATENCY_AMPLITUDE) : 0;
+        
+        tx[i * 2 + 0] = v;
+        tx[i * 2 + 1] = v;
+        rx[i * 2 + 0] = 0;
+        rx[i * 2 + 1] = 0;
+    }
+    
+    /* wm8978 init */
+    res = wm8978_init(&gs_handle);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* config */
+    res = a_wm8978_config();
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: config failed.\n");
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* iis init */
+    res = wav_iis_init(I2S_STANDARD_PHILIPS, I2S_MODE_MASTER_TX, I2S_CPOL_LOW, 
+                       I2S_DATAFORMAT_16B, I2S_MCLKOUTPUT_ENABLE, WM8978_LATENCY_FREQ);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: iis init failed.\n");
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* play and capture */
+    res = wav_iis_transmit_receive((uint16_t *)tx, (uint16_t *)rx, WM8978_LATENCY_FRAME * 2);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: iis transmit receive failed.\n");
+        (void)wav_iis_deinit();
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* run several dma cycles to reach the steady state */
+    wm8978_interface_delay_ms(500);
+    
+    /* stop */
+    res = wav_iis_stop();
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: iis stop failed.\n");
+        (void)wav_iis_deinit();
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* cross correlate */
+    a_wm8978_latency_correlate(rx, WM8978_LATENCY_FRAME, 2, WM8978_LATENCY_FRAME, &lag, &peak, &mean);
+    wm8978_interface_debug_print("wm8978: correlation peak %d mean %d.\n", peak, mean);
+    if (peak < mean * 8 + 1)
+    {
+        wm8978_interface_debug_print("wm8978: no burst captured, check the LOUT1/ROUT1 to L2/R2 cable.\n");
+        (void)wav_iis_deinit();
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    wm8978_interface_debug_print("wm8978: codec round trip latency is %d samples, %0.3fms.\n", 
+                                 lag, (float)lag * 1000.0f / (float)WM8978_LATENCY_FREQ);
+    
+    /* run every buffer configuration */
+    for (i = 0; i < sizeof(gsc_config) / sizeof(wm8978_latency_config_t); i++)
+    {
+        const wm8978_latency_config_t *config = &gsc_config[i];
+        uint32_t seg_frame = config->size / config->segment / 4;
+        
+        if (config->segment != segment)
+        {
+            wm8978_interface_debug_print("wm8978: buffer %d bytes %d segments skipped, the iis layer only drives %d segments.\n", 
+                                         config->size, config->segment, segment);
+            
+            continue;
+        }
+        if ((config->size * 2 > size) || 
+            (seg_frame + config->size / 4 + lag * 2 + WM8978_LATENCY_BURST * 2 > WM8978_LATENCY_CAPTURE))
+        {
+            wm8978_interface_debug_print("wm8978: buffer %d bytes %d segments skipped, it does not fit the test buffers.\n", 
+                                         config->size, config->segment);
+            
+            continue;
+        }
+        res = a_wm8978_latency_run(buf, config, &echo);
+        if (res == 1)
+        {
+            wm8978_interface_debug_print("wm8978: latency run failed.\n");
+            (void)wav_iis_deinit();
+            (void)wm8978_deinit(&gs_handle);
+            
+            return 1;
+        }
+        wm8978_interface_debug_print("wm8978: buffer %d bytes %d segments, fill %d underrun %d overrun %d late %d max fill %dus min slack %dus.\n", 
+                                     config->size, config->segment, gs_run.health.fill, gs_run.health.underrun, 
+                                     gs_run.health.overrun, gs_run.health.late, gs_run.health.max_fill_us, 
+                                     gs_run.health.min_slack_us);
+        if (res != 0)
+        {
+            wm8978_interface_debug_print("wm8978: buffer %d bytes %d segments, no echo captured.\n", 
+                                         config->size, config->segment);
+            
+            continue;
+        }
+        
+        /* the received segment is sent in the transmit segment of the same index, */
+        /* so one pass through takes the whole buffer plus the codec round trip */
+        wm8978_interface_debug_print("wm8978: buffer %d bytes %d segments, pass through latency %d samples %0.2fms, expected %d samples.\n", 
+                                     config->size, config->segment, echo, (float)echo * 1000.0f / (float)WM8978_LATENCY_FREQ, 
+                                     config->size / 4 + lag);
+        if ((gs_run.health.underrun == 0) && (gs_run.health.overrun == 0) && 
+            (gs_run.health.late == 0) && (best == 0))
+        {
+            best = config->size;
+            wm8978_interface_debug_print("wm8978: lowest safe latency is %0.2fms with buffer %d bytes %d segments.\n", 
+                                         (float)echo * 1000.0f / (float)WM8978_LATENCY_FREQ, config->size, config->segment);
+        }
+    }
+    (void)wav_iis_deinit();
+    if (best == 0)
+    {
+        wm8978_interface_debug_print("wm8978: no buffer configuration ran without underrun.\n");
+    }
+    
+    /* finish latency test */
+    wm8978_interface_debug_print("wm8978: finish latency test.\n");
+    (void)wm8978_deinit(&gs_handle);
+    
+    return 0;
+}
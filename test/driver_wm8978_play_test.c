@@ -37,8 +37,250 @@
 #include "driver_wm8978_play_test.h"
 #include <stdlib.h>
 
-static wav_handle_t gs_wav_handle;       /**< wav handle */
-static wm8978_handle_t gs_handle;        /**< wm8978 handle */
+/**
+ * @brief stream test definition
+ */
+#define WM8978_STREAM_RATE              48000        /**< stream sample rate */
+#define WM8978_STREAM_PACKET_MS         10           /**< packet period in ms */
+#define WM8978_STREAM_FRAME             480          /**< frames of one packet */
+#define WM8978_STREAM_TARGET_MS         40           /**< jitter buffer target in ms */
+
+/**
+ * @brief source test definition
+ */
+#define WM8978_SOURCE_RATE              16000        /**< source sample rate */
+#define WM8978_SOURCE_PERIOD            32           /**< tone period in samples */
+#define WM8978_SOURCE_PULL_FRAME        16000        /**< pulled frames */
+#define WM8978_SOURCE_TIMEOUT           5000         /**< play timeout in ms */
+
+/**
+ * @brief cache test definition
+ */
+#define WM8978_CACHE_CLIP_A             "0:cache_a.wav"        /**< first clip path */
+#define WM8978_CACHE_CLIP_B             "0:cache_b.wav"        /**< second clip path */
+
+static wav_handle_t gs_wav_handle;                        /**< wav handle */
+static wm8978_handle_t gs_handle;                         /**< wm8978 handle */
+static int16_t gs_packet[WM8978_STREAM_FRAME * 2];        /**< stream packet */
+static uint32_t gs_pull_frame;                            /**< pulled frames */
+static wav_cache_t gs_cache;                              /**< clip cache */
+static volatile uint8_t gs_end_flag;                      /**< end callback fired flag */
+static volatile uint32_t gs_end_us;                       /**< end callback time in us */
+
+/**
+ * @brief     wav mute
+ * @param[in] enable mute enable
+ * @return    status code
+ *            - 0 success
+ *            - 1 mute failed
+ * @note      none
+ */
+static uint8_t a_wav_mute(uint8_t enable)
+{
+    return wm8978_set_soft_mute(&gs_handle, (wm8978_bool_t)enable);        /* set soft mute */
+}
+
+/**
+ * @brief wav end callback
+ * @note  none
+ */
+static void a_wav_end(void)
+{
+    gs_end_us = wav_timestamp_us();        /* save the time */
+    gs_end_flag = 1;                       /* set the flag */
+}
+
+/**
+ * @brief     triangle tone sample
+ * @param[in] phase sample index in the period
+ * @param[in] period period in samples
+ * @return    sample
+ * @note      the peak is about -8dBFS
+ */
+static int16_t a_wm8978_triangle(uint32_t phase, uint32_t period)
+{
+    int32_t step = 24576 / (int32_t)period;
+    
+    phase %= period;
+    if (phase < period / 2)
+    {
+        return (int16_t)((int32_t)phase * step * 2 - 12288);
+    }
+    else
+    {
+        return (int16_t)((int32_t)(period - phase) * step * 2 - 12288);
+    }
+}
+
+/**
+ * @brief      pull the tone
+ * @param[out] *buf pointer to a pcm buffer
+ * @param[in]  len buffer length in bytes
+ * @param[out] *got pointer to a filled length buffer
+ * @return     status code
+ *             - 0 success
+ * @note       16 bits mono, it ends after WM8978_SOURCE_PULL_FRAME frames
+ */
+static uint8_t a_wav_pull(uint8_t *buf, uint32_t len, uint32_t *got)
+{
+    int16_t *p = (int16_t *)buf;
+    uint32_t n = len / 2;
+    uint32_t i;
+    
+    if (n > WM8978_SOURCE_PULL_FRAME - gs_pull_frame)
+    {
+        n = WM8978_SOURCE_PULL_FRAME - gs_pull_frame;
+    }
+    for (i = 0; i < n; i++)
+    {
+        p[i] = a_wm8978_triangle(gs_pull_frame + i, WM8978_SOURCE_PERIOD);
+    }
+    gs_pull_frame += n;
+    *got = n * 2;
+    
+    return 0;
+}
+
+/**
+ * @brief     put a little endian word
+ * @param[in] *buf pointer to a buffer
+ * @param[in] v value
+ * @param[in] len byte number
+ * @note      none
+ */
+static void a_wm8978_put_le(uint8_t *buf, uint32_t v, uint8_t len)
+{
+    uint8_t i;
+    
+    for (i = 0; i < len; i++)
+    {
+        buf[i] = (uint8_t)(v >> (8 * i));
+    }
+}
+
+/**
+ * @brief     make a 16 bits mono wav clip of the tone
+ * @param[in] *buf pointer to a clip buffer
+ * @param[in] size clip buffer size
+ * @param[in] period tone period in samples
+ * @return    clip length in bytes
+ * @note      44 bytes header followed by the pcm data
+ */
+static uint32_t a_wm8978_make_clip(uint8_t *buf, uint32_t size, uint32_t period)
+{
+    uint32_t len = (size - 44) & ~0x1U;
+    uint32_t i;
+    
+    memcpy(buf, "RIFF", 4);
+    a_wm8978_put_le(buf + 4, len + 36, 4);
+    memcpy(buf + 8, "WAVEfmt ", 8);
+    a_wm8978_put_le(buf + 16, 16, 4);
+    a_wm8978_put_le(buf + 20, 1, 2);
+    a_wm8978_put_le(buf + 22, 1, 2);
+    a_wm8978_put_le(buf + 24, WM8978_SOURCE_RATE, 4);
+    a_wm8978_put_le(buf + 28, WM8978_SOURCE_RATE * 2, 4);
+    a_wm8978_put_le(buf + 32, 2, 2);
+    a_wm8978_put_le(buf + 34, 16, 2);
+    memcpy(buf + 36, "data", 4);
+    a_wm8978_put_le(buf + 40, len, 4);
+    for (i = 0; i < len / 2; i++)
+    {
+        int16_t v = a_wm8978_triangle(i, period);
+        
+        a_wm8978_put_le(buf + 44 + i * 2, (uint16_t)v, 2);
+    }
+    
+    return len + 44;
+}
+
+/**
+ * @brief     write a file
+ * @param[in] *path pointer to a path buffer
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      len must fit one audio write
+ */
+static uint8_t a_wm8978_write_file(char *path, uint8_t *buf, uint32_t len)
+{
+    uint64_t size = 0;
+    
+    if (wav_audio_init(1, path, &size) != 0)
+    {
+        return 1;
+    }
+    if (wav_audio_write(0, (uint16_t)len, buf) != 0)
+    {
+        (void)wav_audio_deinit();
+        
+        return 1;
+    }
+    if (wav_audio_deinit() != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     service the player for a while
+ * @param[in] ms service time in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 service failed
+ * @note      the service is polled every 1ms so the end comes right after the last sample
+ */
+static uint8_t a_wm8978_play_service(uint32_t ms)
+{
+    wav_bool_t primed;
+    
+    while (ms != 0)
+    {
+        if (wav_player_service(&gs_wav_handle, &primed) != 0)
+        {
+            return 1;
+        }
+        wav_delay_ms(1);
+        ms--;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      wait for the play end
+ * @param[out] *ms pointer to a play time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 timeout
+ * @note       the time is counted from the call
+ */
+static uint8_t a_wm8978_play_wait(uint32_t *ms)
+{
+    uint32_t t0 = wav_timestamp_us();
+    uint32_t timeout = WM8978_SOURCE_TIMEOUT;
+    wav_status_t status = WAV_STATUS_PLAY;
+    
+    while (timeout != 0)
+    {
+        (void)wav_player_get_status(&gs_wav_handle, &status);
+        if (status == WAV_STATUS_STOP)
+        {
+            break;
+        }
+        if (a_wm8978_play_service(1) != 0)
+        {
+            break;
+        }
+        timeout--;
+    }
+    *ms = (wav_timestamp_us() - t0) / 1000;
+    
+    return (status == WAV_STATUS_STOP) ? 0 : 1;
+}
 
 /**
  * @brief  wm8978 config
@@ -419,7 +661,7 @@ static uint8_t a_wm8978_config(void)
     }
     
     /* -10db */
-    res = wm8978_volume_convert_to_register(&gs_handle, -10, &reg);
+    res = wm8978_volume_cdb_convert_to_register(&gs_handle, -1000, &reg);
     if (res != 0)
     {
         return 1;
@@ -1508,17 +1750,16 @@ uint8_t wm8978_play_buffer_fill(uint8_t index)
 
 
 /**
- * @brief     play test
- * @param[in] *path pointer to a path buffer
+ * @brief     play init
+ * @param[in] *name pointer to a test name
  * @return    status code
  *            - 0 success
- *            - 1 test failed
- * @note      none
+ *            - 1 init failed
+ * @note      links the interfaces, inits the codec and the wav handle
  */
-uint8_t wm8978_play_test(char *path)
+static uint8_t a_wm8978_play_init(const char *name)
 {
     uint8_t res;
-    wav_status_t status;
     wm8978_info_t info;
     
     /* link interface function */
@@ -1534,9 +1775,13 @@ uint8_t wm8978_play_test(char *path)
     WAV_LINK_IIS_RESUME(&gs_wav_handle, wav_iis_resume);
     WAV_LINK_IIS_SET_FREQ(&gs_wav_handle, wav_iis_set_freq);
     WAV_LINK_IIS_WRITE(&gs_wav_handle, wav_iis_write);
+    WAV_LINK_IIS_WRITE_ONCE(&gs_wav_handle, wav_iis_write_once);
+    WAV_LINK_IIS_GET_REMAIN(&gs_wav_handle, wav_iis_get_tx_remain);
     WAV_LINK_IIS_READ(&gs_wav_handle, wav_iis_read);
     WAV_LINK_DELAY_MS(&gs_wav_handle, wav_delay_ms);
     WAV_LINK_DEBUG_PRINT(&gs_wav_handle, wav_debug_print);
+    WAV_LINK_TIMESTAMP_US(&gs_wav_handle, wav_timestamp_us);
+    WAV_LINK_MUTE(&gs_wav_handle, a_wav_mute);
     
     /* link interface function */
     DRIVER_WM8978_LINK_INIT(&gs_handle, wm8978_handle_t); 
@@ -1568,8 +1813,8 @@ uint8_t wm8978_play_test(char *path)
         wm8978_interface_debug_print("wm8978: min temperature is %0.1fC.\n", info.temperature_min);
     }
     
-    /* start play test */
-    wm8978_interface_debug_print("wm8978: start play test.\n");
+    /* start test */
+    wm8978_interface_debug_print("wm8978: start %s test.\n", name);
     
     /* wm8978 init */
     res = wm8978_init(&gs_handle);
@@ -1600,16 +1845,19 @@ uint8_t wm8978_play_test(char *path)
         return 1;
     }
     
-    /* wav player init */
-    res = wav_player_init(&gs_wav_handle, path);
-    if (res != 0)
-    {
-        wm8978_interface_debug_print("wm8978: wav player init failed.\n");
-        (void)wav_deinit(&gs_wav_handle);
-        (void)wm8978_deinit(&gs_handle);
-        
-        return 1;
-    }
+    return 0;
+}
+
+/**
+ * @brief  play format
+ * @return status code
+ *         - 0 success
+ *         - 1 format failed
+ * @note   sets the codec and the iis to the format of the wav handle, it deinits both on failure
+ */
+static uint8_t a_wm8978_play_format(void)
+{
+    uint8_t res;
     
     if (gs_wav_handle.wav.num_channel == 1)
     {
@@ -1705,16 +1953,191 @@ uint8_t wm8978_play_test(char *path)
         return 1;
     }
     
-    /* wav player start */
-    res = wav_player_start(&gs_wav_handle);
+    return 0;
+}
+
+/**
+ * @brief     play test
+ * @param[in] *path pointer to a path buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      none
+ */
+uint8_t wm8978_play_test(char *path)
+{
+    uint8_t res;
+    uint8_t i;
+    uint32_t t;
+    wav_bool_t primed;
+    wav_status_t status;
+    wav_health_t health;
+    uint32_t first_us;
+    uint32_t primed_us;
+    uint8_t *buf;
+    uint32_t size;
+    uint8_t segment;
+    
+    /* init */
+    res = a_wm8978_play_init("play");
     if (res != 0)
     {
-        wm8978_interface_debug_print("wm8978: wav player start failed.\n");
+        return 1;
+    }
+    
+    /* set buffer */
+    res = wav_buffer_get(&buf, &size, &segment);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: wav buffer get failed.\n");
+        (void)wav_deinit(&gs_wav_handle);
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = wav_set_buffer(&gs_wav_handle, buf, size, segment);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: wav set buffer failed.\n");
+        (void)wav_deinit(&gs_wav_handle);
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* set end callback */
+    gs_end_flag = 0;
+    res = wav_player_set_end_callback(&gs_wav_handle, a_wav_end);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: wav player set end callback failed.\n");
+        (void)wav_deinit(&gs_wav_handle);
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* start with fast start off and then on */
+    for (i = 0; i < 2; i++)
+    {
+        /* wav player init */
+        res = wav_player_init(&gs_wav_handle, path);
+        if (res != 0)
+        {
+            wm8978_interface_debug_print("wm8978: wav player init failed.\n");
+            (void)wav_deinit(&gs_wav_handle);
+            (void)wm8978_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* set the format */
+        res = a_wm8978_play_format();
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* set fast start */
+        res = wav_player_set_fast_start(&gs_wav_handle, (i == 0) ? WAV_BOOL_FALSE : WAV_BOOL_TRUE);
+        if (res != 0)
+        {
+            wm8978_interface_debug_print("wm8978: wav player set fast start failed.\n");
+            (void)wav_deinit(&gs_wav_handle);
+            (void)wm8978_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* wav player start */
+        res = wav_player_start(&gs_wav_handle);
+        if (res != 0)
+        {
+            wm8978_interface_debug_print("wm8978: wav player start failed.\n");
+            (void)wav_deinit(&gs_wav_handle);
+            (void)wm8978_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* prime the lead while the head is playing */
+        primed = WAV_BOOL_FALSE;
+        for (t = 0; (t < 1000) && (primed == WAV_BOOL_FALSE); t++)
+        {
+            res = wav_player_service(&gs_wav_handle, &primed);
+            if (res != 0)
+            {
+                wm8978_interface_debug_print("wm8978: wav player service failed.\n");
+                (void)wav_player_stop(&gs_wav_handle);
+                (void)wav_deinit(&gs_wav_handle);
+                (void)wm8978_deinit(&gs_handle);
+                
+                return 1;
+            }
+            if (primed == WAV_BOOL_FALSE)
+            {
+                wav_delay_ms(1);
+            }
+        }
+        
+        /* print start time after the buffer is primed */
+        (void)wav_player_get_start_time(&gs_wav_handle, &first_us, &primed_us);
+        wm8978_interface_debug_print("wm8978: fast start %s first sample %dus primed %dus.\n", 
+                                     (i == 0) ? "off" : "on", first_us, primed_us);
+        
+        /* stop the first run */
+        if (i == 0)
+        {
+            res = wav_player_stop(&gs_wav_handle);
+            if (res != 0)
+            {
+                wm8978_interface_debug_print("wm8978: wav player stop failed.\n");
+                (void)wav_deinit(&gs_wav_handle);
+                (void)wm8978_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+    }
+    
+    /* pause and resume */
+    res = a_wm8978_play_service(1500);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: wav player service failed.\n");
+        (void)wav_player_stop(&gs_wav_handle);
         (void)wav_deinit(&gs_wav_handle);
         (void)wm8978_deinit(&gs_handle);
         
         return 1;
     }
+    (void)wav_player_get_status(&gs_wav_handle, &status);
+    if (status == WAV_STATUS_PLAY)
+    {
+        res = wav_player_pause(&gs_wav_handle);
+        if (res != 0)
+        {
+            wm8978_interface_debug_print("wm8978: wav player pause failed.\n");
+            (void)wav_player_stop(&gs_wav_handle);
+            (void)wav_deinit(&gs_wav_handle);
+            (void)wm8978_deinit(&gs_handle);
+            
+            return 1;
+        }
+        wm8978_interface_debug_print("wm8978: pause.\n");
+        wav_delay_ms(1000);
+        res = wav_player_resume(&gs_wav_handle);
+        if (res != 0)
+        {
+            wm8978_interface_debug_print("wm8978: wav player resume failed.\n");
+            (void)wav_player_stop(&gs_wav_handle);
+            (void)wav_deinit(&gs_wav_handle);
+            (void)wm8978_deinit(&gs_handle);
+            
+            return 1;
+        }
+        wm8978_interface_debug_print("wm8978: resume.\n");
+    }
     
     /* loop */
     while (1)
@@ -1737,8 +2160,36 @@ uint8_t wm8978_play_test(char *path)
             break;
         }
         
-        wav_delay_ms(1000);
-        wav_debug_print("wav: playing %d/%d.\n", gs_wav_handle.pos, gs_wav_handle.size);
+        /* service the player so the end comes right after the last sample */
+        res = a_wm8978_play_service(1000);
+        if (res != 0)
+        {
+            wm8978_interface_debug_print("wm8978: wav player service failed.\n");
+            (void)wav_player_stop(&gs_wav_handle);
+            (void)wav_deinit(&gs_wav_handle);
+            (void)wm8978_deinit(&gs_handle);
+            
+            return 1;
+        }
+        wav_debug_print("wav: playing %dKB/%dKB.\n", (uint32_t)(gs_wav_handle.pos / 1024), (uint32_t)(gs_wav_handle.size / 1024));
+    }
+    
+    /* print health */
+    (void)wav_get_health(&gs_wav_handle, &health);
+    wm8978_interface_debug_print("wm8978: fill %d underrun %d overrun %d late %d.\n", 
+                                 health.fill, health.underrun, health.overrun, health.late);
+    wm8978_interface_debug_print("wm8978: max fill %dus min slack %dus.\n", 
+                                 health.max_fill_us, health.min_slack_us);
+    
+    /* print end callback */
+    if (gs_end_flag != 0)
+    {
+        wm8978_interface_debug_print("wm8978: end callback fired %dms before the stop was polled.\n", 
+                                     (wav_timestamp_us() - gs_end_us) / 1000);
+    }
+    else
+    {
+        wm8978_interface_debug_print("wm8978: end callback not fired.\n");
     }
     
     /* finish play */
@@ -1748,3 +2199,441 @@ uint8_t wm8978_play_test(char *path)
     
     return 0;
 }
+
+/**
+ * @brief     play stream test
+ * @param[in] second stream second
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      a 1khz tone is pushed in 10ms packets, the first five packets of every 25 arrive in one burst,
+ *            every 50th packet is missing and every 40th packet arrives after the next one
+ */
+uint8_t wm8978_play_stream_test(uint32_t second)
+{
+    uint8_t res;
+    uint8_t *buf;
+    uint32_t size;
+    uint8_t segment;
+    uint32_t i;
+    uint32_t n;
+    uint32_t count;
+    uint32_t start;
+    wav_jitter_t jitter;
+    wav_health_t health;
+    
+    /* init */
+    res = a_wm8978_play_init("stream");
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* the first quarter is the dma buffer and the rest is the jitter ring */
+    res = wav_buffer_get(&buf, &size, &segment);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: wav buffer get failed.\n");
+        (void)wav_deinit(&gs_wav_handle);
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = wav_set_buffer(&gs_wav_handle, buf, size / 4, segment);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: wav set buffer failed.\n");
+        (void)wav_deinit(&gs_wav_handle);
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* wav stream init */
+    res = wav_stream_init(&gs_wav_handle, buf + size / 4, size - size / 4, 
+                          WM8978_STREAM_RATE, 2, WM8978_STREAM_TARGET_MS);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: wav stream init failed.\n");
+        (void)wav_deinit(&gs_wav_handle);
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* set the format */
+    res = a_wm8978_play_format();
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* make a 1khz tone, one packet holds whole periods */
+    for (i = 0; i < WM8978_STREAM_FRAME; i++)
+    {
+        int16_t v = a_wm8978_triangle(i, WM8978_STREAM_RATE / 1000);
+        
+        gs_packet[i * 2 + 0] = v;
+        gs_packet[i * 2 + 1] = v;
+    }
+    
+    /* wav player start */
+    res = wav_player_start(&gs_wav_handle);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: wav player start failed.\n");
+        (void)wav_deinit(&gs_wav_handle);
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* push the packets */
+    count = second * (1000 / WM8978_STREAM_PACKET_MS);
+    start = wav_timestamp_us();
+    for (n = 0; n < count; n++)
+    {
+        uint32_t due = n;
+        
+        /* the first five packets of every 25 arrive together */
+        if ((n % 25) < 4)
+        {
+            due = n - (n % 25) + 4;
+        }
+        while ((wav_timestamp_us() - start) < due * WM8978_STREAM_PACKET_MS * 1000)
+        {
+            wav_delay_ms(1);
+        }
+        
+        /* print the counters every second */
+        if ((n != 0) && ((n % (1000 / WM8978_STREAM_PACKET_MS)) == 0))
+        {
+            (void)wav_stream_get_jitter(&gs_wav_handle, &jitter);
+            wm8978_interface_debug_print("wm8978: stream %d/%ds depth %d target %d.\n", 
+                                         n / (1000 / WM8978_STREAM_PACKET_MS), second, jitter.depth, jitter.target);
+        }
+        
+        /* missing packet */
+        if ((n % 50) == 49)
+        {
+            continue;
+        }
+        
+        /* out of order, the older packet is late and dropped */
+        if (((n % 40) == 20) && (n + 1 < count))
+        {
+            (void)wav_stream_push(&gs_wav_handle, (uint16_t)(n + 1), (uint8_t *)gs_packet, sizeof(gs_packet));
+            (void)wav_stream_push(&gs_wav_handle, (uint16_t)n, (uint8_t *)gs_packet, sizeof(gs_packet));
+            n++;
+            
+            continue;
+        }
+        
+        (void)wav_stream_push(&gs_wav_handle, (uint16_t)n, (uint8_t *)gs_packet, sizeof(gs_packet));
+    }
+    
+    /* play the rest out */
+    wav_delay_ms(WM8978_STREAM_TARGET_MS * 4);
+    
+    /* print jitter */
+    (void)wav_stream_get_jitter(&gs_wav_handle, &jitter);
+    wm8978_interface_debug_print("wm8978: packet %d late %d lost %d overflow %d.\n", 
+                                 jitter.packet, jitter.late, jitter.lost, jitter.overflow);
+    wm8978_interface_debug_print("wm8978: underrun %d drop %d depth %d target %d.\n", 
+                                 jitter.underrun, jitter.drop, jitter.depth, jitter.target);
+    
+    /* print health */
+    (void)wav_get_health(&gs_wav_handle, &health);
+    wm8978_interface_debug_print("wm8978: fill %d underrun %d overrun %d late %d.\n", 
+                                 health.fill, health.underrun, health.overrun, health.late);
+    
+    /* stop */
+    res = wav_player_stop(&gs_wav_handle);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: wav player stop failed.\n");
+        (void)wav_deinit(&gs_wav_handle);
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* finish stream test */
+    wm8978_interface_debug_print("wm8978: finish stream test.\n");
+    (void)wav_deinit(&gs_wav_handle);
+    (void)wm8978_deinit(&gs_handle);
+    
+    return 0;
+}
+
+/**
+ * @brief  play source test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   plays a wav clip from memory and then a pulled tone, a clip which replays its head
+ *         or drops its tail shows a play time different from the expected one
+ */
+uint8_t wm8978_play_source_test(void)
+{
+    uint8_t res;
+    uint8_t *buf;
+    uint32_t size;
+    uint8_t segment;
+    uint32_t len;
+    uint32_t ms;
+    
+    /* init */
+    res = a_wm8978_play_init("source");
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* the first quarter is the dma buffer and the rest holds the clip */
+    res = wav_buffer_get(&buf, &size, &segment);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: wav buffer get failed.\n");
+        (void)wav_deinit(&gs_wav_handle);
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = wav_set_buffer(&gs_wav_handle, buf, size / 4, segment);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: wav set buffer failed.\n");
+        (void)wav_deinit(&gs_wav_handle);
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* play the clip from memory */
+    len = a_wm8978_make_clip(buf + size / 4, size - size / 4, WM8978_SOURCE_PERIOD);
+    res = wav_player_init_memory(&gs_wav_handle, buf + size / 4, len);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: wav player init memory failed.\n");
+        (void)wav_deinit(&gs_wav_handle);
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = a_wm8978_play_format();
+    if (res != 0)
+    {
+        return 1;
+    }
+    res = wav_player_start(&gs_wav_handle);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: wav player start failed.\n");
+        (void)wav_deinit(&gs_wav_handle);
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = a_wm8978_play_wait(&ms);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: memory play timeout.\n");
+        (void)wav_player_stop(&gs_wav_handle);
+        (void)wav_deinit(&gs_wav_handle);
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    wm8978_interface_debug_print("wm8978: memory clip %d bytes played in %dms, expected %dms.\n", 
+                                 len - 44, ms, (len - 44) * 1000 / (WM8978_SOURCE_RATE * 2));
+    
+    /* play the pulled tone */
+    gs_pull_frame = 0;
+    res = wav_player_init_pull(&gs_wav_handle, a_wav_pull, WM8978_SOURCE_RATE, 1, 16);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: wav player init pull failed.\n");
+        (void)wav_deinit(&gs_wav_handle);
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = a_wm8978_play_format();
+    if (res != 0)
+    {
+        return 1;
+    }
+    res = wav_player_start(&gs_wav_handle);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: wav player start failed.\n");
+        (void)wav_deinit(&gs_wav_handle);
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = a_wm8978_play_wait(&ms);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: pull play timeout.\n");
+        (void)wav_player_stop(&gs_wav_handle);
+        (void)wav_deinit(&gs_wav_handle);
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    wm8978_interface_debug_print("wm8978: pulled %d frames played in %dms, expected %dms.\n", 
+                                 gs_pull_frame, ms, gs_pull_frame * 1000 / WM8978_SOURCE_RATE);
+    
+    /* finish source test */
+    wm8978_interface_debug_print("wm8978: finish source test.\n");
+    (void)wav_deinit(&gs_wav_handle);
+    (void)wm8978_deinit(&gs_handle);
+    
+    return 0;
+}
+
+/**
+ * @brief  play cache test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   writes two clips to the sd card, only one of them fits the arena,
+ *         so playing a, a, b, a gives one hit, three misses and two evictions
+ */
+uint8_t wm8978_play_cache_test(void)
+{
+    uint8_t res;
+    uint8_t *buf;
+    uint32_t size;
+    uint8_t segment;
+    uint8_t *arena;
+    uint32_t arena_size;
+    uint32_t len;
+    uint32_t i;
+    uint32_t ms;
+    uint32_t t0;
+    uint32_t load_us;
+    wav_cache_stat_t stat;
+    char path_a[] = WM8978_CACHE_CLIP_A;
+    char path_b[] = WM8978_CACHE_CLIP_B;
+    char *path[4] = {path_a, path_a, path_b, path_a};
+    
+    /* init */
+    res = a_wm8978_play_init("cache");
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* the first quarter is the dma buffer and the rest is the cache arena */
+    res = wav_buffer_get(&buf, &size, &segment);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: wav buffer get failed.\n");
+        (void)wav_deinit(&gs_wav_handle);
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = wav_set_buffer(&gs_wav_handle, buf, size / 4, segment);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: wav set buffer failed.\n");
+        (void)wav_deinit(&gs_wav_handle);
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    arena = buf + size / 4;
+    arena_size = size - size / 4;
+    
+    /* write the clips, each one is larger than half the arena */
+    len = a_wm8978_make_clip(arena, arena_size * 3 / 5, WM8978_SOURCE_PERIOD);
+    res = a_wm8978_write_file(path_a, arena, len);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: write %s failed.\n", path_a);
+        (void)wav_deinit(&gs_wav_handle);
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    len = a_wm8978_make_clip(arena, arena_size * 3 / 5, WM8978_SOURCE_PERIOD * 2);
+    res = a_wm8978_write_file(path_b, arena, len);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: write %s failed.\n", path_b);
+        (void)wav_deinit(&gs_wav_handle);
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* set cache */
+    res = wav_set_cache(&gs_wav_handle, &gs_cache, arena, arena_size);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: wav set cache failed.\n");
+        (void)wav_deinit(&gs_wav_handle);
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    for (i = 0; i < 4; i++)
+    {
+        /* load the clip */
+        t0 = wav_timestamp_us();
+        res = wav_player_init_cached(&gs_wav_handle, path[i]);
+        if (res != 0)
+        {
+            wm8978_interface_debug_print("wm8978: wav player init cached failed.\n");
+            (void)wav_deinit(&gs_wav_handle);
+            (void)wm8978_deinit(&gs_handle);
+            
+            return 1;
+        }
+        load_us = wav_timestamp_us() - t0;
+        
+        /* play */
+        res = a_wm8978_play_format();
+        if (res != 0)
+        {
+            return 1;
+        }
+        res = wav_player_start(&gs_wav_handle);
+        if (res != 0)
+        {
+            wm8978_interface_debug_print("wm8978: wav player start failed.\n");
+            (void)wav_deinit(&gs_wav_handle);
+            (void)wm8978_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = a_wm8978_play_wait(&ms);
+        if (res != 0)
+        {
+            wm8978_interface_debug_print("wm8978: cache play timeout.\n");
+            (void)wav_player_stop(&gs_wav_handle);
+            (void)wav_deinit(&gs_wav_handle);
+            (void)wm8978_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* print the counters */
+        (void)wav_cache_get_stat(&gs_wav_handle, &stat);
+        wm8978_interface_debug_print("wm8978: %s loaded in %dus played in %dms.\n", path[i], load_us, ms);
+        wm8978_interface_debug_print("wm8978: hit %d miss %d evict %d entry %d used %d.\n", 
+                                     stat.hit, stat.miss, stat.evict, stat.entry, stat.used);
+    }
+    
+    /* finish cache test */
+    wm8978_interface_debug_print("wm8978: finish cache test.\n");
+    (void)wav_deinit(&gs_wav_handle);
+    (void)wm8978_deinit(&gs_handle);
+    
+    return 0;
+}
@@ -71,6 +71,34 @@ uint8_t wm8978_play_buffer_fill(uint8_t index);
  */
 uint8_t wm8978_play_test(char *path);
 
+/**
+ * @brief     play stream test
+ * @param[in] second stream second
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      pushes packets with bursts, missing and out of order sequence numbers into the jitter buffer
+ */
+uint8_t wm8978_play_stream_test(uint32_t second);
+
+/**
+ * @brief  play source test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   plays a wav clip from memory and then a pulled tone
+ */
+uint8_t wm8978_play_source_test(void);
+
+/**
+ * @brief  play cache test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   writes two clips to the sd card and plays them through the clip cache
+ */
+uint8_t wm8978_play_cache_test(void);
+
 /**
  * @brief  play get handle
  * @return pointer to a wav handle
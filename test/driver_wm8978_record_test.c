@@ -37,8 +37,9 @@
 #include "driver_wm8978_record_test.h"
 #include <stdlib.h>
 
-static wav_handle_t gs_wav_handle;       /**< wav handle */
-static wm8978_handle_t gs_handle;        /**< wm8978 handle */
+static wav_handle_t gs_wav_handle;                       /**< wav handle */
+static wm8978_handle_t gs_handle;                        /**< wm8978 handle */
+static uint32_t gs_ring[WAV_BUFFER_SIZE / 4];            /**< pre trigger ring */
 
 /**
  * @brief  wm8978 config
@@ -419,7 +420,7 @@ static uint8_t a_wm8978_config(void)
     }
     
     /* -10db */
-    res = wm8978_volume_convert_to_register(&gs_handle, -10, &reg);
+    res = wm8978_volume_cdb_convert_to_register(&gs_handle, -1000, &reg);
     if (res != 0)
     {
         return 1;
@@ -1520,6 +1521,13 @@ uint8_t wm8978_record_test(char *path, uint32_t second)
     uint8_t res;
     uint32_t timeout;
     wm8978_info_t info;
+    wav_health_t health;
+    uint8_t *buf;
+    uint32_t size;
+    uint8_t segment;
+    wav_meter_t meter;
+    wav_bool_t meter_on = WAV_BOOL_FALSE;
+    uint32_t meter_off_us = 0;
     
     /* link interface function */
     WAV_LINK_INIT(&gs_wav_handle, wav_handle_t);
@@ -1527,6 +1535,7 @@ uint8_t wm8978_record_test(char *path, uint32_t second)
     WAV_LINK_AUDIO_DEINIT(&gs_wav_handle, wav_audio_deinit);
     WAV_LINK_AUDIO_READ(&gs_wav_handle, wav_audio_read);
     WAV_LINK_AUDIO_WRITE(&gs_wav_handle, wav_audio_write);
+    WAV_LINK_AUDIO_TRUNCATE(&gs_wav_handle, wav_audio_truncate);
     WAV_LINK_IIS_INIT(&gs_wav_handle, wav_iis_init);
     WAV_LINK_IIS_DEINIT(&gs_wav_handle, wav_iis_deinit);
     WAV_LINK_IIS_STOP(&gs_wav_handle, wav_iis_stop);
@@ -1537,6 +1546,8 @@ uint8_t wm8978_record_test(char *path, uint32_t second)
     WAV_LINK_IIS_READ(&gs_wav_handle, wav_iis_read);
     WAV_LINK_DELAY_MS(&gs_wav_handle, wav_delay_ms);
     WAV_LINK_DEBUG_PRINT(&gs_wav_handle, wav_debug_print);
+    WAV_LINK_TIMESTAMP_US(&gs_wav_handle, wav_timestamp_us);
+    WAV_LINK_IIS_GET_REMAIN(&gs_wav_handle, wav_iis_get_remain);
     
     /* link interface function */
     DRIVER_WM8978_LINK_INIT(&gs_handle, wm8978_handle_t); 
@@ -1600,6 +1611,26 @@ uint8_t wm8978_record_test(char *path, uint32_t second)
         return 1;
     }
     
+    /* set buffer */
+    res = wav_buffer_get(&buf, &size, &segment);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: wav buffer get failed.\n");
+        (void)wav_deinit(&gs_wav_handle);
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = wav_set_buffer(&gs_wav_handle, buf, size, segment);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: wav set buffer failed.\n");
+        (void)wav_deinit(&gs_wav_handle);
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
     /* 2 channels */
     res = wm8978_set_channel(&gs_handle, WM8978_CHANNEL_STEREO);
     if (res != 0)
@@ -1635,6 +1666,50 @@ uint8_t wm8978_record_test(char *path, uint32_t second)
         return 1;
     }
     
+    /* meter off for the first half */
+    res = wav_set_meter(&gs_wav_handle, WAV_BOOL_FALSE);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: wav set meter failed.\n");
+        (void)wav_deinit(&gs_wav_handle);
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* pre allocate the record file */
+    res = wav_record_set_preallocate(&gs_wav_handle, second + 1);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: wav set preallocate failed.\n");
+        (void)wav_deinit(&gs_wav_handle);
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* update the header every 5s */
+    res = wav_record_set_checkpoint(&gs_wav_handle, 5);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: wav set checkpoint failed.\n");
+        (void)wav_deinit(&gs_wav_handle);
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* keep one buffer of pre roll */
+    res = wav_record_set_pretrigger(&gs_wav_handle, (uint8_t *)gs_ring, sizeof(gs_ring), 0);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: wav set pretrigger failed.\n");
+        (void)wav_deinit(&gs_wav_handle);
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
     /* record start */
     res = wav_record_start(&gs_wav_handle, 22050, path);
     if (res != 0)
@@ -1646,6 +1721,25 @@ uint8_t wm8978_record_test(char *path, uint32_t second)
         return 1;
     }
     
+    /* armed, only the ring is filled */
+    wav_delay_ms(1000);
+    wm8978_interface_debug_print("wm8978: armed with %d bytes pre roll.\n", (uint32_t)sizeof(gs_ring));
+    
+    /* fire the trigger */
+    res = wav_record_trigger(&gs_wav_handle);
+    if (res != 0)
+    {
+        wm8978_interface_debug_print("wm8978: wav record trigger failed.\n");
+        (void)wav_record_stop(&gs_wav_handle);
+        (void)wav_deinit(&gs_wav_handle);
+        (void)wm8978_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* measure the fills from the trigger on */
+    (void)wav_clear_health(&gs_wav_handle);
+    
     /* set timeout */
     timeout = second;
     
@@ -1654,7 +1748,34 @@ uint8_t wm8978_record_test(char *path, uint32_t second)
     {
         wav_delay_ms(1000);
         timeout--;
-        wav_debug_print("wav: record %d bytes time %d/%ds.\n", gs_wav_handle.pos, second - timeout, second);
+        wav_debug_print("wav: record %dKB time %d/%ds.\n", (uint32_t)(gs_wav_handle.pos / 1024), second - timeout, second);
+        
+        /* print meter */
+        if (meter_on == WAV_BOOL_TRUE)
+        {
+            (void)wav_get_meter(&gs_wav_handle, &meter);
+            wav_debug_print("wav: peak %d/%d rms %d/%d clip %d/%d.\n", meter.peak[0], meter.peak[1], 
+                            meter.rms[0], meter.rms[1], meter.clip[0], meter.clip[1]);
+        }
+        
+        /* save the fill time without the meter and enable it for the second half */
+        if ((meter_on == WAV_BOOL_FALSE) && (second - timeout >= (second + 1) / 2))
+        {
+            (void)wav_get_health(&gs_wav_handle, &health);
+            meter_off_us = health.max_fill_us;
+            (void)wav_clear_health(&gs_wav_handle);
+            res = wav_set_meter(&gs_wav_handle, WAV_BOOL_TRUE);
+            if (res != 0)
+            {
+                wm8978_interface_debug_print("wm8978: wav set meter failed.\n");
+                (void)wav_record_stop(&gs_wav_handle);
+                (void)wav_deinit(&gs_wav_handle);
+                (void)wm8978_deinit(&gs_handle);
+                
+                return 1;
+            }
+            meter_on = WAV_BOOL_TRUE;
+        }
     }
     
     /* record stop */
@@ -1668,6 +1789,15 @@ uint8_t wm8978_record_test(char *path, uint32_t second)
         return 1;
     }
     
+    /* print health */
+    (void)wav_get_health(&gs_wav_handle, &health);
+    wm8978_interface_debug_print("wm8978: fill %d underrun %d overrun %d late %d.\n", 
+                                 health.fill, health.underrun, health.overrun, health.late);
+    wm8978_interface_debug_print("wm8978: max fill %dus min slack %dus.\n", 
+                                 health.max_fill_us, health.min_slack_us);
+    wm8978_interface_debug_print("wm8978: max fill meter off %dus meter on %dus.\n", 
+                                 meter_off_us, health.max_fill_us);
+    
     /* finish record */
     wm8978_interface_debug_print("wm8978: finish record test.\n");
     (void)wav_deinit(&gs_wav_handle);
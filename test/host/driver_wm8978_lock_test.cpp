@@ -0,0 +1,279 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_wm8978_lock_test.cpp
+ * @brief     driver wm8978 register lock host stress test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ *
+ * @note      build and run on a posix host from the repository root:
+ *            gcc -std=c99 -O2 -Isrc -c src/driver_wm8978.c -o driver_wm8978.o
+ *            g++ -std=c++17 -O2 -Isrc test/host/driver_wm8978_lock_test.cpp driver_wm8978.o -lpthread -o wm8978_lock_test
+ *            ./wm8978_lock_test
+ */
+
+#include "driver_wm8978.hpp"
+#include <pthread.h>
+#include <sched.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief lock test definition
+ */
+#define WM8978_LOCK_REG_NUM           58         /**< register number */
+#define WM8978_LOCK_THREAD_NUM        11         /**< thread number */
+#define WM8978_LOCK_RUN               50         /**< stress runs */
+#define WM8978_LOCK_ITERATION         2000       /**< updates per thread and run */
+#define WM8978_LOCK_BENCH             2000000    /**< single thread benchmark updates */
+#define WM8978_LOCK_BENCH_THREAD      200000     /**< contended benchmark updates per thread */
+
+static wm8978_handle_t gs_handle;                                        /**< wm8978 handle */
+static pthread_mutex_t gs_mutex[WM8978_LOCK_REG_NUM];                    /**< per register mutex */
+static volatile uint16_t gs_bus[WM8978_LOCK_REG_NUM];                    /**< last value written on the bus */
+static volatile uint8_t gs_yield;                                        /**< yield inside the bus write */
+static uint32_t gs_iteration;                                            /**< updates per thread */
+static const wm8978_field_t gsc_power_manage_2[8] =                      /**< power manage 2 fields set by the c api */
+{
+    WM8978_FIELD_LEFT_CHANNEL_ADC, WM8978_FIELD_RIGHT_CHANNEL_ADC,
+    WM8978_FIELD_LEFT_CHANNEL_INPUT_PGA, WM8978_FIELD_RIGHT_CHANNEL_INPUT_PGA,
+    WM8978_FIELD_LEFT_CHANNEL_INPUT_BOOST, WM8978_FIELD_RIGHT_CHANNEL_INPUT_BOOST,
+    WM8978_FIELD_SLEEP, WM8978_FIELD_LEFT_OUT1,
+};
+
+/**
+ * @brief mock iic bus
+ */
+static uint8_t a_iic_init(void)
+{
+    return 0;
+}
+
+static uint8_t a_iic_deinit(void)
+{
+    return 0;
+}
+
+static uint8_t a_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    (void)addr;
+    (void)len;
+
+    if (gs_yield != 0)
+    {
+        (void)sched_yield();
+    }
+    gs_bus[reg >> 1] = (uint16_t)(((reg & 0x01) << 8) | buf[0]);
+
+    return 0;
+}
+
+static void a_delay_ms(uint32_t ms)
+{
+    (void)ms;
+}
+
+static void a_debug_print(const char *const fmt, ...)
+{
+    (void)fmt;
+}
+
+/**
+ * @brief per register lock hooks
+ */
+static void a_lock(void *ctx, uint8_t reg)
+{
+    (void)ctx;
+
+    (void)pthread_mutex_lock(&gs_mutex[reg]);
+}
+
+static void a_unlock(void *ctx, uint8_t reg)
+{
+    (void)ctx;
+
+    (void)pthread_mutex_unlock(&gs_mutex[reg]);
+}
+
+/**
+ * @brief     stress thread
+ * @param[in] *arg thread index
+ * @return    NULL
+ * @note      threads 0 - 7 toggle one power manage 2 bit each through the c api,
+ *            thread 8 toggles the ninth bit through wm8978::modify,
+ *            threads 9 and 10 update other registers and must never block the rest,
+ *            the power manage 2 bits are all left set, so any lost update shows in the shadow
+ */
+static void *a_stress_thread(void *arg)
+{
+    long index = (long)arg;
+    uint32_t i;
+
+    for (i = 0; i < gs_iteration; i++)
+    {
+        if (index < 8)
+        {
+            (void)wm8978_set_field(&gs_handle, gsc_power_manage_2[index], (uint16_t)((i + 1) & 0x01));
+        }
+        else if (index == 8)
+        {
+            (void)wm8978::modify(&gs_handle, wm8978::field::right_out1::set(static_cast<wm8978_bool_t>((i + 1) & 0x01)));
+        }
+        else if (index == 9)
+        {
+            (void)wm8978_set_dac_left_volume(&gs_handle, WM8978_BOOL_TRUE, (uint8_t)i);
+        }
+        else
+        {
+            (void)wm8978_set_eq1_gain(&gs_handle, (uint8_t)(i % 25));
+        }
+    }
+    if (index < 8)
+    {
+        (void)wm8978_set_field(&gs_handle, gsc_power_manage_2[index], 1);
+    }
+    else if (index == 8)
+    {
+        (void)wm8978::modify(&gs_handle, wm8978::field::right_out1::set<WM8978_BOOL_TRUE>());
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief     run one trial
+ * @param[in] locked 1 links the lock hooks
+ * @param[in] thread thread number
+ * @return    status code
+ *            - 0 no update lost
+ *            - 1 an update was lost
+ * @note      none
+ */
+static uint8_t a_trial(uint8_t locked, long thread)
+{
+    pthread_t tid[WM8978_LOCK_THREAD_NUM];
+    long i;
+
+    DRIVER_WM8978_LINK_INIT(&gs_handle, wm8978_handle_t);
+    DRIVER_WM8978_LINK_IIC_INIT(&gs_handle, a_iic_init);
+    DRIVER_WM8978_LINK_IIC_DEINIT(&gs_handle, a_iic_deinit);
+    DRIVER_WM8978_LINK_IIC_WRITE(&gs_handle, a_iic_write);
+    DRIVER_WM8978_LINK_DELAY_MS(&gs_handle, a_delay_ms);
+    DRIVER_WM8978_LINK_DEBUG_PRINT(&gs_handle, a_debug_print);
+    if (locked != 0)
+    {
+        DRIVER_WM8978_LINK_LOCK(&gs_handle, a_lock);
+        DRIVER_WM8978_LINK_UNLOCK(&gs_handle, a_unlock);
+    }
+    if (wm8978_init(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    (void)wm8978_set_reg(&gs_handle, 0x02, 0x000);
+
+    for (i = 0; i < thread; i++)
+    {
+        (void)pthread_create(&tid[i], NULL, a_stress_thread, (void *)i);
+    }
+    for (i = 0; i < thread; i++)
+    {
+        (void)pthread_join(tid[i], NULL);
+    }
+
+    return ((gs_handle.reg[0x02] == 0x1FF) && (gs_bus[0x02] == gs_handle.reg[0x02])) ? 0 : 1;
+}
+
+/**
+ * @brief  get the monotonic time
+ * @return time in seconds
+ * @note   none
+ */
+static double a_now(void)
+{
+    struct timespec t;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &t);
+
+    return (double)t.tv_sec + (double)t.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief  main function
+ * @return status code
+ *         - 0 success
+ *         - 1 an update was lost with the lock hooks linked
+ * @note   none
+ */
+int main(void)
+{
+    uint32_t lost_unlocked = 0;
+    uint32_t lost_locked = 0;
+    double t0;
+    double t1;
+    double t2;
+    int i;
+
+    for (i = 0; i < WM8978_LOCK_REG_NUM; i++)
+    {
+        (void)pthread_mutex_init(&gs_mutex[i], NULL);
+    }
+
+    /* lost update stress */
+    gs_yield = 1;
+    gs_iteration = WM8978_LOCK_ITERATION;
+    for (i = 0; i < WM8978_LOCK_RUN; i++)
+    {
+        lost_unlocked += a_trial(0, WM8978_LOCK_THREAD_NUM);
+        lost_locked += a_trial(1, WM8978_LOCK_THREAD_NUM);
+    }
+    printf("wm8978: runs with lost updates, no hooks %u/%d, lock hooks %u/%d.\n",
+           lost_unlocked, WM8978_LOCK_RUN, lost_locked, WM8978_LOCK_RUN);
+
+    /* overhead */
+    gs_yield = 0;
+    gs_iteration = WM8978_LOCK_BENCH;
+    t0 = a_now();
+    (void)a_trial(0, 1);
+    t1 = a_now();
+    (void)a_trial(1, 1);
+    t2 = a_now();
+    printf("wm8978: single thread %.1f ns/op no hooks, %.1f ns/op lock hooks.\n",
+           (t1 - t0) / WM8978_LOCK_BENCH * 1e9, (t2 - t1) / WM8978_LOCK_BENCH * 1e9);
+    gs_iteration = WM8978_LOCK_BENCH_THREAD;
+    t0 = a_now();
+    (void)a_trial(1, WM8978_LOCK_THREAD_NUM);
+    t1 = a_now();
+    printf("wm8978: %d contending threads %.1f ns/op lock hooks.\n",
+           WM8978_LOCK_THREAD_NUM, (t1 - t0) / ((double)WM8978_LOCK_BENCH_THREAD * WM8978_LOCK_THREAD_NUM) * 1e9);
+
+    return (lost_locked == 0) ? 0 : 1;
+}
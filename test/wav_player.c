@@ -37,18 +37,13 @@
 #include "wav_player.h"
 
 /**
- * @brief     write wav header
- * @param[in] *handle pointer to a wav handle structure
- * @return    status code
- *            - 0 success
- *            - 1 write failed
- * @note      none
+ * @brief      build the wav header
+ * @param[in]  *handle pointer to a wav handle structure
+ * @param[out] *buf pointer to a 44 bytes buffer
+ * @note       none
  */
-static uint8_t a_wav_write_wav_header(wav_handle_t *handle)
+static void a_wav_build_wav_header(wav_handle_t *handle, uint8_t *buf)
 {
-    uint8_t res;
-    uint8_t buf[44];
-
     buf[0] = handle->wav.chunk_id[0];                                     /* R */
     buf[1] = handle->wav.chunk_id[1];                                     /* I */
     buf[2] = handle->wav.chunk_id[2];                                     /* F */
@@ -93,633 +88,3112 @@ static uint8_t a_wav_write_wav_header(wav_handle_t *handle)
     buf[41] = (handle->wav.sub_chunk2_size >> 8) & 0xFF;                  /* init 0 */
     buf[42] = (handle->wav.sub_chunk2_size >> 16) & 0xFF;                 /* init 0 */
     buf[43] = (handle->wav.sub_chunk2_size >> 24) & 0xFF;                 /* init 0 */
-    res = handle->audio_write(0, 44, buf);                                /* write buffer */
-    if (res != 0)                                                         /* check result */
+}
+
+/**
+ * @brief     get a little endian 32 bits value
+ * @param[in] *buf pointer to a 4 bytes buffer
+ * @return    value
+ * @note      none
+ */
+static uint32_t a_wav_get_le32(const uint8_t *buf)
+{
+    return (uint32_t)buf[0] | ((uint32_t)buf[1] << 8) | 
+           ((uint32_t)buf[2] << 16) | ((uint32_t)buf[3] << 24);        /* get value */
+}
+
+/**
+ * @brief     put a little endian 64 bits value
+ * @param[in] *buf pointer to an 8 bytes buffer
+ * @param[in] value put value
+ * @note      none
+ */
+static void a_wav_put_le64(uint8_t *buf, uint64_t value)
+{
+    uint8_t i;
+    
+    for (i = 0; i < 8; i++)                          /* 8 bytes */
     {
-        handle->debug_print("wav: audio write failed.\n");                /* audio write failed */
+        buf[i] = (uint8_t)(value >> (i * 8));        /* set byte */
+    }
+}
 
-        return 1;                                                         /* return error */
+/**
+ * @brief     integer square root
+ * @param[in] v input value
+ * @return    floor of the square root
+ * @note      none
+ */
+static uint32_t a_wav_isqrt(uint32_t v)
+{
+    uint32_t res = 0;
+    uint32_t bit = 1UL << 30;
+    
+    while (bit > v)                          /* find the highest bit */
+    {
+        bit >>= 2;                           /* next bit */
+    }
+    while (bit != 0)                         /* loop all bits */
+    {
+        if (v >= res + bit)                  /* check the bit */
+        {
+            v -= res + bit;                  /* sub */
+            res = (res >> 1) + bit;          /* set the bit */
+        }
+        else
+        {
+            res >>= 1;                       /* clear the bit */
+        }
+        bit >>= 2;                           /* next bit */
+    }
+    
+    return res;                              /* return the result */
+}
+
+/**
+ * @brief     meter one 16 bits pcm block
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] *buf pointer to a block buffer
+ * @param[in] len block length in bytes
+ * @note      buf must be 4 bytes aligned and len must be a multiple of 4,
+ *            every word holds two samples, left and right for stereo or
+ *            two continuous samples for mono
+ */
+static void a_wav_meter_block(wav_handle_t *handle, const uint8_t *buf, uint32_t len)
+{
+    const uint32_t *p = (const uint32_t *)buf;
+    uint32_t n = len / 4;
+    uint32_t i;
+    uint32_t peak_l = 0;
+    uint32_t peak_r = 0;
+    uint32_t clip_l = 0;
+    uint32_t clip_r = 0;
+    uint64_t sum_l = 0;
+    uint64_t sum_r = 0;
+    
+    if (n == 0)                                                           /* check length */
+    {
+        return;                                                           /* return */
+    }
+    for (i = 0; i < n; i++)                                               /* loop all words */
+    {
+        uint32_t w = p[i];                                                /* get two samples */
+        int32_t l = (int16_t)(w & 0xFFFF);                                /* low half */
+        int32_t r = (int16_t)(w >> 16);                                   /* high half */
+        uint32_t al = (uint32_t)((l < 0) ? -l : l);                       /* left abs */
+        uint32_t ar = (uint32_t)((r < 0) ? -r : r);                       /* right abs */
+        
+        peak_l = (al > peak_l) ? al : peak_l;                             /* left peak */
+        peak_r = (ar > peak_r) ? ar : peak_r;                             /* right peak */
+        clip_l += (al >= WAV_METER_CLIP_LEVEL) ? 1 : 0;                   /* left clip */
+        clip_r += (ar >= WAV_METER_CLIP_LEVEL) ? 1 : 0;                   /* right clip */
+        sum_l += al * al;                                                 /* left power */
+        sum_r += ar * ar;                                                 /* right power */
+    }
+    if (handle->wav.num_channel == 1)                                     /* mono */
+    {
+        peak_l = (peak_r > peak_l) ? peak_r : peak_l;                     /* fold peak */
+        peak_r = peak_l;                                                  /* copy peak */
+        clip_l += clip_r;                                                 /* fold clip */
+        clip_r = clip_l;                                                  /* copy clip */
+        sum_l = (sum_l + sum_r) / 2;                                      /* fold power */
+        sum_r = sum_l;                                                    /* copy power */
+    }
+    
+    handle->meter_sequence++;                                             /* odd, writing */
+    handle->meter.peak[0] = (uint16_t)peak_l;                             /* set left peak */
+    handle->meter.peak[1] = (uint16_t)peak_r;                             /* set right peak */
+    handle->meter.rms[0] = (uint16_t)a_wav_isqrt((uint32_t)(sum_l / n));  /* set left rms */
+    handle->meter.rms[1] = (uint16_t)a_wav_isqrt((uint32_t)(sum_r / n));  /* set right rms */
+    handle->meter.clip[0] = clip_l;                                       /* set left clip */
+    handle->meter.clip[1] = clip_r;                                       /* set right clip */
+    handle->meter.block++;                                                /* block++ */
+    handle->meter_sequence++;                                             /* even, done */
+}
+
+/**
+ * @brief     reset the meter snapshot
+ * @param[in] *handle pointer to a wav handle structure
+ * @note      none
+ */
+static void a_wav_meter_reset(wav_handle_t *handle)
+{
+    handle->meter_sequence++;                  /* odd, writing */
+    handle->meter.block = 0;                   /* init 0 */
+    handle->meter.peak[0] = 0;                 /* init 0 */
+    handle->meter.peak[1] = 0;                 /* init 0 */
+    handle->meter.rms[0] = 0;                  /* init 0 */
+    handle->meter.rms[1] = 0;                  /* init 0 */
+    handle->meter.clip[0] = 0;                 /* init 0 */
+    handle->meter.clip[1] = 0;                 /* init 0 */
+    handle->meter_sequence++;                  /* even, done */
+}
+
+/**
+ * @brief     rewrite the record header with the current sizes
+ * @param[in] *handle pointer to a wav handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the junk chunk becomes a ds64 chunk and the header is marked rf64 once
+ *            the riff size passes 32 bits, handle->pos is not changed
+ */
+static uint8_t a_wav_record_update_header(wav_handle_t *handle)
+{
+    uint8_t buf[WAV_RECORD_HEADER_SIZE];
+    uint64_t riff;
+    uint64_t data;
+    
+    riff = handle->pos - 8;                                                                   /* riff size */
+    data = handle->pos - WAV_RECORD_HEADER_SIZE;                                              /* data size */
+    memcpy(handle->wav.chunk_id, (riff > 0xFFFFFFFFU) ? "RF64" : "RIFF", 4);                  /* set chunk id */
+    handle->wav.chunk_size = (riff > 0xFFFFFFFFU) ? 0xFFFFFFFFU : (uint32_t)riff;             /* set chunk size */
+    handle->wav.sub_chunk2_size = (riff > 0xFFFFFFFFU) ? 0xFFFFFFFFU : (uint32_t)data;        /* set sub chunk2 size */
+    a_wav_build_wav_header(handle, buf);                                                      /* build header */
+    memmove(buf + 48, buf + 12, 32);                                                          /* fmt and data after the junk */
+    memset(buf + 12, 0, 36);                                                                  /* clear the junk */
+    memcpy(buf + 12, (riff > 0xFFFFFFFFU) ? "ds64" : "JUNK", 4);                              /* set junk id */
+    buf[16] = 28;                                                                             /* 28 bytes */
+    if (riff > 0xFFFFFFFFU)                                                                   /* rf64 */
+    {
+        a_wav_put_le64(buf + 20, riff);                                                       /* set riff size */
+        a_wav_put_le64(buf + 28, data);                                                       /* set data size */
+        a_wav_put_le64(buf + 36, data / handle->wav.block_align);                             /* set sample count */
+    }
+    if (handle->audio_write(0, WAV_RECORD_HEADER_SIZE, buf) != 0)                             /* write header */
+    {
+        handle->debug_print("wav: write header failed.\n");                                   /* write header failed */
+
+        return 1;                                                                             /* return error */
+    }
+    handle->checkpoint_pos = handle->pos;                                                     /* checkpoint done */
+    
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     open the record file and write the header
+ * @param[in] *handle pointer to a wav handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      handle->size carries the pre allocation hint to audio_init and returns the opened file size
+ */
+static uint8_t a_wav_record_open(wav_handle_t *handle)
+{
+    handle->pos = 0;                                                          /* init 0 */
+    handle->size = 0;                                                         /* no size hint */
+    if (handle->prealloc_second != 0)                                         /* check pre allocation */
+    {
+        handle->size = (uint64_t)handle->prealloc_second * 
+                       handle->wav.byte_rate + WAV_RECORD_HEADER_SIZE;        /* size hint */
+    }
+    if (handle->audio_init(1, handle->record_path, &handle->size) != 0)       /* audio init */
+    {
+        handle->debug_print("wav: record failed.\n");                         /* record failed */
+
+        return 1;                                                             /* return error */
+    }
+    handle->pos = WAV_RECORD_HEADER_SIZE;                                     /* data start */
+    if (a_wav_record_update_header(handle) != 0)                              /* write header */
+    {
+        (void)handle->audio_deinit();                                         /* audio deinit */
+
+        return 1;                                                             /* return error */
+    }
+    
+    return 0;                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     push one segment into the pre trigger ring
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] *seg pointer to a segment buffer
+ * @note      the oldest segment is overwritten when the ring is full
+ */
+static void a_wav_ring_push(wav_handle_t *handle, uint8_t *seg)
+{
+    memcpy(handle->ring + handle->segment_size * handle->ring_head, 
+           seg, handle->segment_size);                                    /* copy the segment */
+    handle->ring_head++;                                                  /* next segment */
+    if (handle->ring_head >= handle->ring_count)                          /* check the end */
+    {
+        handle->ring_head = 0;                                            /* wrap */
     }
-    handle->pos += 44;                                                    /* add 44 offset */
+    if (handle->ring_fill < handle->ring_count)                           /* check full */
+    {
+        handle->ring_fill++;                                              /* fill++ */
+    }
+}
+
+/**
+ * @brief     write the oldest segment of the pre trigger ring
+ * @param[in] *handle pointer to a wav handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_wav_ring_pop(wav_handle_t *handle)
+{
+    uint32_t tail;
+    
+    tail = (handle->ring_head + handle->ring_count - handle->ring_fill) % 
+            handle->ring_count;                                           /* get the oldest segment */
+    if (handle->audio_write(handle->pos, (uint16_t)handle->segment_size, 
+                            handle->ring + handle->segment_size * tail) != 0)    /* write data */
+    {
+        handle->debug_print("wav: write failed\n");                       /* write failed */
 
+        return 1;                                                         /* return error */
+    }
+    handle->pos += handle->segment_size;                                  /* add pos */
+    handle->ring_fill--;                                                  /* fill-- */
+    
     return 0;                                                             /* success return 0 */
 }
 
 /**
- * @brief     initialize the wav
+ * @brief     write the received part of the current segment
  * @param[in] *handle pointer to a wav handle structure
  * @return    status code
  *            - 0 success
- *            - 2 handle is NULL
- *            - 3 linked functions is NULL
+ *            - 1 write failed
+ * @note      the dma must be stopped, data not yet handed to the fill is written up to the dma position
+ */
+static uint8_t a_wav_record_tail(wav_handle_t *handle)
+{
+    uint16_t remain;
+    uint32_t start;
+    uint32_t len;
+    uint32_t n;
+    
+    if ((handle->iis_get_remain == NULL) || 
+        (handle->iis_get_remain(&remain) != 0))                           /* get the dma position */
+    {
+        return 0;                                                         /* whole segments only */
+    }
+    start = handle->segment_size * handle->record_next;                   /* first unwritten byte */
+    len = (handle->buf_size - (uint32_t)remain * 2 + 
+           handle->buf_size - start) % handle->buf_size;                  /* bytes received */
+    len -= len % handle->wav.block_align;                                 /* whole frames */
+    while (len != 0)                                                      /* write the tail */
+    {
+        n = handle->segment_size - (start % handle->segment_size);        /* bytes left in the segment */
+        if (n > len)                                                      /* check the length */
+        {
+            n = len;                                                      /* the rest */
+        }
+        if (handle->audio_write(handle->pos, (uint16_t)n, 
+                                handle->buf + start) != 0)                /* write data */
+        {
+            handle->debug_print("wav: write failed\n");                   /* write failed */
+
+            return 1;                                                     /* return error */
+        }
+        handle->pos += n;                                                 /* add pos */
+        start = (start + n) % handle->buf_size;                           /* next part */
+        len -= n;                                                         /* len - n */
+    }
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief     reset the health counters
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] block_align bytes of one frame
+ * @param[in] sample_rate sample rate
  * @note      none
  */
-uint8_t wav_init(wav_handle_t *handle)
+static void a_wav_health_reset(wav_handle_t *handle, uint16_t block_align, uint32_t sample_rate)
+{
+    handle->health_sequence++;                                                /* odd, writing */
+    handle->health.fill = 0;                                                  /* init 0 */
+    handle->health.underrun = 0;                                              /* init 0 */
+    handle->health.overrun = 0;                                               /* init 0 */
+    handle->health.late = 0;                                                  /* init 0 */
+    handle->health.max_fill_us = 0;                                           /* init 0 */
+    handle->health.min_slack_us = INT32_MAX;                                  /* init max */
+    handle->health_sequence++;                                                /* even, done */
+    handle->health_clear = 0;                                                 /* no clear request */
+    handle->health_next = 0;                                                  /* dma starts with segment 0 */
+    if ((block_align != 0) && (sample_rate != 0))                             /* check params */
+    {
+        handle->health_period_us = (uint32_t)((uint64_t)handle->segment_size / 
+                                   block_align * 1000000 / sample_rate);      /* segment period */
+    }
+    else
+    {
+        handle->health_period_us = 0;                                         /* unknown */
+    }
+}
+
+/**
+ * @brief     health check before a fill
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] index fill index
+ * @param[in] record 0 is play and 1 is record
+ * @return    fill start timestamp
+ * @note      a skipped segment index means the dma replayed stale data or
+ *            overwrote samples which were not stored yet
+ */
+static uint32_t a_wav_health_begin(wav_handle_t *handle, uint8_t index, uint8_t record)
+{
+    uint32_t t0 = 0;
+    uint8_t gap;
+    
+    if (handle->timestamp_us != NULL)                                         /* check timestamp */
+    {
+        t0 = handle->timestamp_us();                                          /* get the start time */
+    }
+    handle->health_sequence++;                                                /* odd, writing */
+    if (handle->health_clear != 0)                                            /* clear request */
+    {
+        handle->health.fill = 0;                                              /* init 0 */
+        handle->health.underrun = 0;                                          /* init 0 */
+        handle->health.overrun = 0;                                           /* init 0 */
+        handle->health.late = 0;                                              /* init 0 */
+        handle->health.max_fill_us = 0;                                       /* init 0 */
+        handle->health.min_slack_us = INT32_MAX;                              /* init max */
+        handle->health_clear = 0;                                             /* clear done */
+    }
+    gap = (uint8_t)((index + handle->segment - handle->health_next) % 
+                     handle->segment);                                        /* skipped segments */
+    if (gap != 0)                                                             /* check gap */
+    {
+        if (record != 0)                                                      /* record */
+        {
+            handle->health.overrun += gap;                                    /* overrun */
+        }
+        else                                                                  /* play */
+        {
+            handle->health.underrun += gap;                                   /* underrun */
+        }
+    }
+    handle->health_next = (uint8_t)((index + 1) % handle->segment);           /* next expected index */
+    handle->health.fill++;                                                    /* fill++ */
+    handle->health_sequence++;                                                /* even, done */
+    
+    return t0;                                                                /* return the start time */
+}
+
+/**
+ * @brief     health check after a fill
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] t0 fill start timestamp
+ * @param[in] record 0 is play and 1 is record
+ * @note      the dma comes back to the segment after segment - 1 periods,
+ *            a fill ending later than that is late and counted as underrun or overrun
+ */
+static void a_wav_health_end(wav_handle_t *handle, uint32_t t0, uint8_t record)
+{
+    uint32_t duration;
+    int32_t slack;
+    
+    if ((handle->timestamp_us == NULL) || (handle->health_period_us == 0))    /* check timestamp */
+    {
+        return;                                                               /* return */
+    }
+    
+    duration = handle->timestamp_us() - t0;                                   /* get the duration */
+    slack = (int32_t)(handle->health_period_us * 
+                      (uint32_t)(handle->segment - 1)) - (int32_t)duration;   /* get the slack */
+    handle->health_sequence++;                                                /* odd, writing */
+    if (duration > handle->health.max_fill_us)                                /* check max */
+    {
+        handle->health.max_fill_us = duration;                                /* set max */
+    }
+    if (slack < handle->health.min_slack_us)                                  /* check min */
+    {
+        handle->health.min_slack_us = slack;                                  /* set min */
+    }
+    if (slack < 0)                                                            /* missed the deadline */
+    {
+        handle->health.late++;                                                /* late++ */
+        if (record != 0)                                                      /* record */
+        {
+            handle->health.overrun++;                                         /* overrun */
+        }
+        else                                                                  /* play */
+        {
+            handle->health.underrun++;                                        /* underrun */
+        }
+    }
+    handle->health_sequence++;                                                /* even, done */
+}
+
+/**
+ * @brief     fade 16 bits pcm frames
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] *buf pointer to a pcm buffer
+ * @param[in] frames frame number
+ * @param[in] up 1 is fade in and 0 is fade out
+ * @note      linear gain from 0 to 1 or from 1 to 0 over the frames
+ */
+static void a_wav_stream_fade(wav_handle_t *handle, uint8_t *buf, uint32_t frames, uint8_t up)
+{
+    int16_t *p = (int16_t *)buf;
+    uint32_t ch = handle->wav.num_channel;
+    uint32_t i;
+    uint32_t j;
+    
+    for (i = 0; i < frames; i++)                                           /* loop all frames */
+    {
+        int32_t gain = (int32_t)((up != 0) ? i : (frames - 1 - i));        /* get the gain */
+        
+        for (j = 0; j < ch; j++)                                           /* loop all channels */
+        {
+            p[i * ch + j] = (int16_t)((int32_t)p[i * ch + j] * gain / 
+                                      (int32_t)frames);                    /* scale */
+        }
+    }
+}
+
+/**
+ * @brief     read bytes from the stream ring
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len read length in bytes
+ * @note      buf can be NULL to skip bytes
+ */
+static void a_wav_stream_read(wav_handle_t *handle, uint8_t *buf, uint32_t len)
+{
+    uint32_t first;
+    
+    first = handle->stream_size - handle->stream_rd;                            /* bytes before the end */
+    if (first > len)                                                            /* check the wrap */
+    {
+        first = len;                                                            /* no wrap */
+    }
+    if (buf != NULL)                                                            /* copy */
+    {
+        memcpy(buf, handle->stream + handle->stream_rd, first);                 /* copy the first part */
+        memcpy(buf + first, handle->stream, len - first);                       /* copy the wrapped part */
+    }
+    handle->stream_rd = (handle->stream_rd + len) % handle->stream_size;        /* next read index */
+    handle->stream_out += len;                                                  /* release the bytes */
+}
+
+/**
+ * @brief     fill one segment from the stream
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] *seg pointer to a segment buffer
+ * @note      the stream starts once the target depth is buffered, a segment is only
+ *            played in full when the fade frames stay behind it, otherwise the rest
+ *            is faded out, the target grows one segment and buffering starts again,
+ *            the jitter sequence is odd while the counters and the depth change
+ */
+static void a_wav_stream_fill(wav_handle_t *handle, uint8_t *seg)
+{
+    uint32_t len = handle->segment_size;
+    uint32_t fade = WAV_STREAM_FADE_FRAMES * handle->wav.block_align;
+    uint32_t avail;
+    uint32_t n;
+    
+    handle->jitter_sequence++;                                                      /* odd, writing */
+    avail = handle->stream_in - handle->stream_out;                                 /* get the depth */
+    if (handle->stream_run == 0)                                                    /* buffering */
+    {
+        if (avail < handle->stream_target)                                          /* check the target */
+        {
+            memset(seg, 0, len);                                                    /* silence */
+            handle->jitter_sequence++;                                              /* even, done */
+            
+            return;                                                                 /* return */
+        }
+        handle->stream_run = 1;                                                     /* run */
+        handle->stream_fade_in = 1;                                                 /* fade in */
+        handle->stream_good = 0;                                                    /* init 0 */
+    }
+    if (avail > handle->stream_target + len * 2)                                    /* too deep */
+    {
+        n = avail - handle->stream_target;                                          /* excess bytes */
+        n -= n % handle->wav.block_align;                                           /* whole frames */
+        a_wav_stream_read(handle, NULL, n);                                         /* skip */
+        handle->jitter.drop += n;                                                   /* drop */
+        avail -= n;                                                                 /* new depth */
+    }
+    if (avail >= len + fade)                                                        /* full segment */
+    {
+        a_wav_stream_read(handle, seg, len);                                        /* read the segment */
+        if (handle->stream_fade_in != 0)                                            /* fade in pending */
+        {
+            n = (fade < len) ? fade : len;                                          /* fade length */
+            a_wav_stream_fade(handle, seg, n / handle->wav.block_align, 1);         /* fade in */
+            handle->stream_fade_in = 0;                                             /* fade done */
+        }
+        handle->stream_good++;                                                      /* good++ */
+        if ((handle->stream_good >= WAV_STREAM_SHRINK_FILLS) && 
+            (handle->stream_target >= handle->stream_target_min + len))             /* stable long enough */
+        {
+            handle->stream_target -= len;                                           /* shrink the target */
+            handle->stream_good = 0;                                                /* init 0 */
+        }
+        handle->jitter_sequence++;                                                  /* even, done */
+        
+        return;                                                                     /* return */
+    }
+    
+    n = (avail < len) ? avail : len;                                                /* what is left */
+    n -= n % handle->wav.block_align;                                               /* whole frames */
+    a_wav_stream_read(handle, seg, n);                                              /* read the rest */
+    a_wav_stream_fade(handle, seg + n - ((n < fade) ? n : fade), 
+                      ((n < fade) ? n : fade) / handle->wav.block_align, 0);        /* fade out */
+    memset(seg + n, 0, len - n);                                                    /* silence */
+    handle->jitter.underrun++;                                                      /* underrun++ */
+    if (handle->stream_target + len * 2 <= handle->stream_size)                     /* check the room */
+    {
+        handle->stream_target += len;                                               /* grow the target */
+    }
+    handle->stream_run = 0;                                                         /* buffer again */
+    handle->jitter_sequence++;                                                      /* even, done */
+}
+
+/**
+ * @brief     cut the size to the data end
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] data data chunk size, 0 is unknown
+ * @note      trailing chunks and a partial last frame are not played
+ */
+static void a_wav_data_end(wav_handle_t *handle, uint64_t data)
+{
+    uint64_t len;
+    
+    if (handle->size <= handle->pos)                 /* check size */
+    {
+        return;                                      /* nothing to cut */
+    }
+    len = handle->size - handle->pos;                /* bytes after the header */
+    if ((data != 0) && (data < len))                 /* trailing chunks */
+    {
+        len = data;                                  /* data chunk only */
+    }
+    if (handle->wav.block_align != 0)                /* check block align */
+    {
+        len -= len % handle->wav.block_align;        /* whole frames */
+    }
+    handle->size = handle->pos + len;                /* set the data end */
+}
+
+/**
+ * @brief     read bytes from the player source
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] addr source address
+ * @param[in] *seg pointer to a data buffer
+ * @param[in] len read length in bytes
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ * @note      the source is zero padded after its end, a short pull read sets the source size
+ */
+static uint8_t a_wav_source_read(wav_handle_t *handle, uint64_t addr, uint8_t *seg, uint32_t len)
+{
+    uint32_t got = 0;
+    
+    if (addr < handle->size)                                              /* data left */
+    {
+        got = len;                                                        /* one segment */
+        if (handle->size - addr < len)                                    /* check the length */
+        {
+            got = (uint32_t)(handle->size - addr);                        /* bytes left */
+        }
+        if (handle->source == WAV_SOURCE_FILE)                            /* file source */
+        {
+            if (handle->audio_read(addr, (uint16_t)got, seg) != 0)        /* read data */
+            {
+                handle->debug_print("wav: read failed\n");                /* read failed */
+
+                return 1;                                                 /* return error */
+            }
+        }
+        else if (handle->source == WAV_SOURCE_MEMORY)                     /* memory source */
+        {
+            memcpy(seg, handle->mem + addr, got);                         /* copy data */
+        }
+        else                                                              /* pull source */
+        {
+            if (handle->pull(seg, len, &got) != 0)                        /* pull data */
+            {
+                handle->debug_print("wav: pull failed\n");                /* pull failed */
+
+                return 1;                                                 /* return error */
+            }
+            if (got > len)                                                /* check the length */
+            {
+                got = len;                                                /* one segment */
+            }
+            if (got < len)                                                /* short read */
+            {
+                handle->size = addr + got;                                /* source end */
+            }
+        }
+    }
+    memset(seg + got, 0, len - got);                                      /* pad with 0 */
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief     parse the wav header
+ * @param[in] *handle pointer to a wav handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ *            - 4 format is invalid
+ * @note      the chunks are walked from the source start up to the data chunk, riff and rf64
+ *            with a ds64 chunk are supported, handle->pos is moved to the first data byte
+ */
+static uint8_t a_wav_parse_header(wav_handle_t *handle)
+{
+    uint8_t i;
+    uint8_t fmt = 0;
+    uint8_t buf[24];
+    uint32_t len;
+    uint64_t addr;
+    uint64_t data64 = 0;
+    
+    memset(&handle->wav, 0, sizeof(wav_header_t));                                        /* clear the header */
+    if (a_wav_source_read(handle, 0, buf, 12) != 0)                                       /* read riff header */
+    {
+        return 1;                                                                         /* return error */
+    }
+    memcpy(handle->wav.chunk_id, buf, 4);                                                 /* set chunk id */
+    handle->wav.chunk_size = a_wav_get_le32(buf + 4);                                     /* set chunk size */
+    memcpy(handle->wav.format, buf + 8, 4);                                               /* set format */
+    if (((memcmp(buf, "RIFF", 4) != 0) && (memcmp(buf, "RF64", 4) != 0)) || 
+        (memcmp(buf + 8, "WAVE", 4) != 0))                                                /* check riff */
+    {
+        handle->debug_print("wav: format is invalid.\n");                                 /* format is invalid */
+
+        return 4;                                                                         /* return error */
+    }
+    addr = 12;                                                                            /* first chunk */
+    for (i = 0; (i < WAV_CHUNK_MAX) && (addr + 8 <= handle->size); i++)                   /* walk the chunks */
+    {
+        if (a_wav_source_read(handle, addr, buf, 8) != 0)                                 /* read chunk header */
+        {
+            return 1;                                                                     /* return error */
+        }
+        len = a_wav_get_le32(buf + 4);                                                    /* chunk size */
+        if (memcmp(buf, "fmt ", 4) == 0)                                                  /* fmt chunk */
+        {
+            memcpy(handle->wav.sub_chunk1_id, buf, 4);                                    /* set sub chunk1 id */
+            handle->wav.sub_chunk1_size = len;                                            /* set sub chunk1 size */
+            if ((len < 16) || (a_wav_source_read(handle, addr + 8, buf, 16) != 0))        /* read fmt */
+            {
+                handle->debug_print("wav: format is invalid.\n");                         /* format is invalid */
+
+                return 4;                                                                 /* return error */
+            }
+            handle->wav.audio_format = (uint16_t)(buf[0] | (buf[1] << 8));                /* set audio format */
+            handle->wav.num_channel = (uint16_t)(buf[2] | (buf[3] << 8));                 /* set num channel */
+            handle->wav.sample_rate = a_wav_get_le32(buf + 4);                            /* set sample rate */
+            handle->wav.byte_rate = a_wav_get_le32(buf + 8);                              /* set byte rate */
+            handle->wav.block_align = (uint16_t)(buf[12] | (buf[13] << 8));               /* set block align */
+            handle->wav.bit_per_sample = (uint16_t)(buf[14] | (buf[15] << 8));            /* set bit per sample */
+            fmt = 1;                                                                      /* fmt found */
+        }
+        else if ((memcmp(buf, "ds64", 4) == 0) && (len >= 24))                            /* ds64 chunk */
+        {
+            if (a_wav_source_read(handle, addr + 8, buf, 24) != 0)                        /* read ds64 */
+            {
+                return 1;                                                                 /* return error */
+            }
+            data64 = a_wav_get_le32(buf + 8) | 
+                     ((uint64_t)a_wav_get_le32(buf + 12) << 32);                          /* 64 bits data size */
+        }
+        else if (memcmp(buf, "data", 4) == 0)                                             /* data chunk */
+        {
+            if (fmt == 0)                                                                 /* check fmt */
+            {
+                handle->debug_print("wav: format is invalid.\n");                         /* format is invalid */
+
+                return 4;                                                                 /* return error */
+            }
+            memcpy(handle->wav.sub_chunk2_id, buf, 4);                                    /* set sub chunk2 id */
+            handle->wav.sub_chunk2_size = len;                                            /* set sub chunk2 size */
+            handle->pos = addr + 8;                                                       /* first data byte */
+            if ((len == 0xFFFFFFFFU) && 
+                (memcmp(handle->wav.chunk_id, "RF64", 4) == 0))                           /* size in ds64 */
+            {
+                a_wav_data_end(handle, data64);                                           /* cut to the data end */
+            }
+            else
+            {
+                a_wav_data_end(handle, len);                                              /* cut to the data end */
+            }
+            
+            return 0;                                                                     /* success return 0 */
+        }
+        addr += 8 + (uint64_t)len + (len & 1);                                            /* next chunk, word aligned */
+    }
+    handle->debug_print("wav: format is invalid.\n");                                     /* format is invalid */
+    
+    return 4;                                                                             /* return error */
+}
+
+/**
+ * @brief     end the play
+ * @param[in] *handle pointer to a wav handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 end failed
+ * @note      none
+ */
+static uint8_t a_wav_player_end(wav_handle_t *handle)
+{
+    if (handle->iis_stop() != 0)                                          /* iis stop */
+    {
+        handle->debug_print("wav: iis stop failed.\n");                   /* iis stop failed */
+
+        return 1;                                                         /* return error */
+    }
+    if ((handle->source == WAV_SOURCE_FILE) && 
+        (handle->audio_deinit() != 0))                                    /* audio deinit */
+    {
+        handle->debug_print("wav: audio deinit failed.\n");               /* audio deinit failed */
+
+        return 1;                                                         /* return error */
+    }
+    if ((handle->pause_phase == 2) || (handle->unmute_count != 0))        /* codec muted */
+    {
+        if (handle->mute(0) != 0)                                         /* unmute */
+        {
+            handle->debug_print("wav: mute failed.\n");                   /* mute failed */
+
+            return 1;                                                     /* return error */
+        }
+    }
+    handle->pause_phase = 0;                                              /* init 0 */
+    handle->unmute_count = 0;                                             /* init 0 */
+    handle->status = 0;                                                   /* stop */
+    handle->debug_print("wav: play end.\n");                              /* play end */
+    if (handle->end_callback != NULL)                                     /* check the callback */
+    {
+        handle->end_callback();                                           /* end of play */
+    }
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief     mark the end of the data
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] index segment holding the last sample
+ * @param[in] len data bytes in that segment
+ * @param[in] live 1 when the dma is already playing that segment
+ * @note      none
+ */
+static void a_wav_player_drain(wav_handle_t *handle, uint8_t index, uint32_t len, uint8_t live)
+{
+    handle->drain_index = index;                                          /* segment of the last sample */
+    handle->drain_end = handle->segment_size * index + len;               /* buffer offset after the last sample */
+    handle->drain_live = live;                                            /* set live */
+    handle->drain = 1;                                                    /* drain */
+}
+
+/**
+ * @brief     end the play right after the last sample
+ * @param[in] *handle pointer to a wav handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 end failed
+ * @note      runs in the main loop, the tx dma position is compared with the end of the last sample,
+ *            the fill of the last segment still ends the play if this is not polled in time
+ */
+static uint8_t a_wav_player_drain_check(wav_handle_t *handle)
+{
+    uint16_t remain;
+    uint32_t at;
+    
+    if ((handle->drain != 1) || (handle->drain_live == 0) || 
+        (handle->iis_get_remain == NULL))                                 /* check the drain */
+    {
+        return 0;                                                         /* success return 0 */
+    }
+    if (handle->iis_get_remain(&remain) != 0)                             /* get the dma position */
+    {
+        handle->debug_print("wav: get remain failed.\n");                 /* get remain failed */
+
+        return 1;                                                         /* return error */
+    }
+    at = handle->buf_size - (uint32_t)remain * 2;                         /* dma byte position */
+    if ((at < handle->drain_end) && 
+        (at >= handle->segment_size * handle->drain_index))               /* last sample not played */
+    {
+        return 0;                                                         /* success return 0 */
+    }
+    handle->drain = 2;                                                    /* keep the fills off */
+    if (handle->status != WAV_STATUS_PLAY)                                /* the fill ended it first */
+    {
+        return 0;                                                         /* success return 0 */
+    }
+    
+    return a_wav_player_end(handle);                                      /* end */
+}
+
+/**
+ * @brief     evict the least recently used clip
+ * @param[in] *cache pointer to a wav cache structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 cache is empty
+ * @note      none
+ */
+static uint8_t a_wav_cache_evict(wav_cache_t *cache)
+{
+    uint32_t i;
+    uint32_t lru = WAV_CACHE_ENTRY;
+    
+    for (i = 0; i < WAV_CACHE_ENTRY; i++)                                            /* loop all entries */
+    {
+        if ((cache->entry[i].used != 0) && 
+            ((lru == WAV_CACHE_ENTRY) || 
+             ((int32_t)(cache->entry[i].stamp - cache->entry[lru].stamp) < 0)))      /* older */
+        {
+            lru = i;                                                                 /* set lru */
+        }
+    }
+    if (lru == WAV_CACHE_ENTRY)                                                      /* check empty */
+    {
+        return 1;                                                                    /* return error */
+    }
+    cache->entry[lru].used = 0;                                                      /* free */
+    cache->evict++;                                                                  /* evict++ */
+    
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief      allocate arena space, evicting clips when needed
+ * @param[in]  *cache pointer to a wav cache structure
+ * @param[in]  need bytes to allocate, a multiple of 4
+ * @param[out] *slot pointer to an entry index buffer
+ * @param[out] *offset pointer to an arena offset buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no space
+ * @note       first fit over the gaps between the cached clips
+ */
+static uint8_t a_wav_cache_alloc(wav_cache_t *cache, uint32_t need, uint32_t *slot, uint32_t *offset)
+{
+    uint32_t i;
+    uint32_t j;
+    
+    if (need > cache->arena_size)                                                    /* check size */
+    {
+        return 1;                                                                    /* return error */
+    }
+    while (1)                                                                        /* evict until it fits */
+    {
+        *slot = WAV_CACHE_ENTRY;                                                     /* no slot */
+        for (i = 0; i < WAV_CACHE_ENTRY; i++)                                        /* find a free entry */
+        {
+            if (cache->entry[i].used == 0)                                           /* free */
+            {
+                *slot = i;                                                           /* set slot */
+                
+                break;                                                               /* break */
+            }
+        }
+        for (i = 0; (*slot != WAV_CACHE_ENTRY) && (i <= WAV_CACHE_ENTRY); i++)       /* loop all candidates */
+        {
+            uint32_t start;
+            
+            if (i == WAV_CACHE_ENTRY)                                                /* arena start */
+            {
+                start = 0;                                                           /* first byte */
+            }
+            else if (cache->entry[i].used != 0)                                      /* after a clip */
+            {
+                start = cache->entry[i].offset + cache->entry[i].size;               /* clip end */
+            }
+            else
+            {
+                continue;                                                            /* next */
+            }
+            if (start + need > cache->arena_size)                                    /* check the end */
+            {
+                continue;                                                            /* next */
+            }
+            for (j = 0; j < WAV_CACHE_ENTRY; j++)                                    /* check overlap */
+            {
+                if ((cache->entry[j].used != 0) && 
+                    (cache->entry[j].offset < start + need) && 
+                    (start < cache->entry[j].offset + cache->entry[j].size))         /* overlap */
+                {
+                    break;                                                           /* break */
+                }
+            }
+            if (j == WAV_CACHE_ENTRY)                                                /* gap found */
+            {
+                *offset = start;                                                     /* set offset */
+                
+                return 0;                                                            /* success return 0 */
+            }
+        }
+        if (a_wav_cache_evict(cache) != 0)                                           /* evict the lru */
+        {
+            return 1;                                                                /* return error */
+        }
+    }
+}
+
+/**
+ * @brief     initialize the wav
+ * @param[in] *handle pointer to a wav handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ * @note      none
+ */
+uint8_t wav_init(wav_handle_t *handle)
+{
+    if (handle == NULL)                                             /* check handle */
+    {
+        return 2;                                                   /* return error */
+    }
+    if (handle->debug_print == NULL)                                /* check debug_print */
+    {
+        return 3;                                                   /* return error */
+    }
+    if (handle->iis_init == NULL)                                   /* check iis_init */
+    {
+        handle->debug_print("wav: iis_init is null.\n");            /* iis_init is null */
+        
+        return 3;                                                   /* return error */
+    }
+    if (handle->iis_deinit == NULL)                                 /* check iis_deinit */
+    {
+        handle->debug_print("wav: iis_deinit is null.\n");          /* iis_deinit is null */
+        
+        return 3;                                                   /* return error */
+    }
+    if (handle->iis_stop == NULL)                                   /* check iis_stop */
+    {
+        handle->debug_print("wav: iis_stop is null.\n");            /* iis_stop is null */
+        
+        return 3;                                                   /* return error */
+    }
+    if (handle->iis_pause == NULL)                                  /* check iis_pause */
+    {
+        handle->debug_print("wav: iis_pause is null.\n");           /* iis_pause is null */
+        
+        return 3;                                                   /* return error */
+    }
+    if (handle->iis_resume == NULL)                                 /* check iis_resume */
+    {
+        handle->debug_print("wav: iis_resume is null.\n");          /* iis_resume is null */
+        
+        return 3;                                                   /* return error */
+    }
+    if (handle->iis_set_freq == NULL)                               /* check iis_set_freq */
+    {
+        handle->debug_print("wav: iis_set_freq is null.\n");        /* iis_set_freq is null */
+        
+        return 3;                                                   /* return error */
+    }
+    if (handle->iis_write == NULL)                                  /* check iis_write */
+    {
+        handle->debug_print("wav: iis_write is null.\n");           /* iis_write is null */
+        
+        return 3;                                                   /* return error */
+    }
+    if (handle->iis_read == NULL)                                   /* check iis_read */
+    {
+        handle->debug_print("wav: iis_read is null.\n");            /* iis_read is null */
+        
+        return 3;                                                   /* return error */
+    }
+    if (handle->audio_init == NULL)                                 /* check audio_init */
+    {
+        handle->debug_print("wav: audio_init is null.\n");          /* audio_init is null */
+        
+        return 3;                                                   /* return error */
+    }
+    if (handle->audio_deinit == NULL)                               /* check audio_deinit */
+    {
+        handle->debug_print("wav: audio_deinit is null.\n");        /* audio_deinit is null */
+        
+        return 3;                                                   /* return error */
+    }
+    if (handle->audio_read == NULL)                                 /* check audio_read */
+    {
+        handle->debug_print("wav: audio_read is null.\n");          /* audio_read is null */
+        
+        return 3;                                                   /* return error */
+    }
+    if (handle->audio_write == NULL)                                /* check audio_write */
+    {
+        handle->debug_print("wav: audio_write is null.\n");         /* audio_write is null */
+        
+        return 3;                                                   /* return error */
+    }
+    if (handle->delay_ms == NULL)                                   /* check delay_ms */
+    {
+        handle->debug_print("wav: delay_ms is null.\n");            /* delay_ms is null */
+        
+        return 3;                                                   /* return error */
+    }
+    
+    handle->inited = 1;                                             /* flag inited */
+    
+    return 0;                                                       /* success return 0 */
+}
+
+/**
+ * @brief     wav deinit
+ * @param[in] *handle pointer to a wav handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wav_deinit(wav_handle_t *handle)
+{
+    if (handle == NULL)             /* check handle */
+    {
+        return 2;                   /* return error */
+    }
+    if (handle->inited != 1)        /* check handle initialization */
+    {
+        return 3;                   /* return error */
+    }
+    
+    handle->inited = 0;             /* flag closed */
+    
+    return 0;                       /* success return 0 */
+}
+
+/**
+ * @brief     initialize the wav player
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] *path pointer to a path buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 play failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 format is invalid
+ * @note      none
+ */
+uint8_t wav_player_init(wav_handle_t *handle, char *path)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                         /* check handle */
+    {
+        return 2;                                               /* return error */
+    }
+    if (handle->inited != 1)                                    /* check handle initialization */
+    {
+        return 3;                                               /* return error */
+    }
+    
+    handle->source = WAV_SOURCE_FILE;                           /* file source */
+    handle->pos = 0;                                            /* init 0 */
+    if (handle->audio_init(0, path, &handle->size) != 0)        /* audio init */
+    {
+        handle->debug_print("wav: player failed.\n");           /* player failed */
+
+        return 1;                                               /* return error */
+    }
+    res = a_wav_parse_header(handle);                           /* parse header */
+    if (res != 0)                                               /* check result */
+    {
+        (void)handle->audio_deinit();                           /* audio deinit */
+        
+        return res;                                             /* return error */
+    }
+    
+    return 0;                                                   /* success return 0 */
+}
+
+/**
+ * @brief     initialize the wav player with a memory resident wav file
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] *data pointer to the wav file data
+ * @param[in] len data length in bytes
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 format is invalid
+ *            - 5 data is invalid
+ * @note      when iis_write_once is linked and the pcm data is 4 bytes aligned, dma capable and not longer
+ *            than 131070 bytes wav_player_start hands it to the dma in place as one non circular transfer,
+ *            otherwise it is copied segment by segment,
+ *            data must stay valid until the play ends
+ */
+uint8_t wav_player_init_memory(wav_handle_t *handle, const uint8_t *data, uint32_t len)
+{
+    if (handle == NULL)                                                          /* check handle */
+    {
+        return 2;                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                     /* check handle initialization */
+    {
+        return 3;                                                                /* return error */
+    }
+    if ((data == NULL) || (len < 44))                                            /* check data */
+    {
+        handle->debug_print("wav: data is invalid.\n");                          /* data is invalid */
+
+        return 5;                                                                /* return error */
+    }
+    
+    handle->source = WAV_SOURCE_MEMORY;                                          /* memory source */
+    handle->mem = data;                                                          /* set data */
+    handle->size = len;                                                          /* set size */
+    handle->pos = 0;                                                             /* init 0 */
+    if (a_wav_parse_header(handle) != 0)                                         /* parse header */
+    {
+        return 4;                                                                /* return error */
+    }
+    if ((handle->wav.block_align == 0) || (handle->wav.sample_rate == 0))        /* check format */
+    {
+        handle->debug_print("wav: format is invalid.\n");                        /* format is invalid */
+
+        return 4;                                                                /* return error */
+    }
+    
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     initialize the wav player with a pull callback
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] *pull pointer to a pull callback
+ * @param[in] sample_rate sample rate
+ * @param[in] num_channel channel number
+ * @param[in] bit_per_sample bits per sample
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 pull is NULL
+ *            - 5 format is invalid
+ * @note      pull fills buf with up to len bytes of pcm from the dma callback context,
+ *            returns 0 on success and sets *got, a short read marks the end of the source
+ */
+uint8_t wav_player_init_pull(wav_handle_t *handle, uint8_t (*pull)(uint8_t *buf, uint32_t len, uint32_t *got), 
+                             uint32_t sample_rate, uint16_t num_channel, uint16_t bit_per_sample)
+{
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    if (pull == NULL)                                                              /* check pull */
+    {
+        handle->debug_print("wav: pull is null.\n");                               /* pull is null */
+
+        return 4;                                                                  /* return error */
+    }
+    if ((sample_rate == 0) || (num_channel == 0) || (num_channel > 2) || 
+        ((bit_per_sample != 8) && (bit_per_sample != 16) && 
+         (bit_per_sample != 24) && (bit_per_sample != 32)))                        /* check format */
+    {
+        handle->debug_print("wav: format is invalid.\n");                          /* format is invalid */
+
+        return 5;                                                                  /* return error */
+    }
+    
+    memset(&handle->wav, 0, sizeof(wav_header_t));                                 /* clear the header */
+    handle->wav.audio_format = 0x01;                                               /* pcm */
+    handle->wav.num_channel = num_channel;                                         /* set num channel */
+    handle->wav.sample_rate = sample_rate;                                         /* set sample rate */
+    handle->wav.block_align = (uint16_t)(num_channel * bit_per_sample / 8);        /* set block align */
+    handle->wav.byte_rate = sample_rate * handle->wav.block_align;                 /* set byte rate */
+    handle->wav.bit_per_sample = bit_per_sample;                                   /* set bit per sample */
+    handle->source = WAV_SOURCE_PULL;                                              /* pull source */
+    handle->pull = pull;                                                           /* set pull */
+    handle->size = 0xFFFFFFFFFFFFFFFFULL;                                          /* unknown end */
+    handle->pos = 0;                                                               /* init 0 */
+    
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     attach a clip cache to the player
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] *cache pointer to a wav cache structure, NULL detaches the cache
+ * @param[in] *arena pointer to an arena buffer
+ * @param[in] size arena size in bytes
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 arena is invalid
+ *            - 5 be playing
+ * @note      arena must be 4 bytes aligned and dma capable, the cache starts empty
+ */
+uint8_t wav_set_cache(wav_handle_t *handle, wav_cache_t *cache, uint8_t *arena, uint32_t size)
+{
+    if (handle == NULL)                                                        /* check handle */
+    {
+        return 2;                                                              /* return error */
+    }
+    if (handle->inited != 1)                                                   /* check handle initialization */
+    {
+        return 3;                                                              /* return error */
+    }
+    if (handle->status != 0)                                                   /* check status */
+    {
+        handle->debug_print("wav: be playing.\n");                             /* be playing */
+
+        return 5;                                                              /* return error */
+    }
+    if (cache == NULL)                                                         /* detach */
+    {
+        handle->cache = NULL;                                                  /* clear cache */
+        
+        return 0;                                                              /* success return 0 */
+    }
+    if ((arena == NULL) || (((size_t)arena & 0x3) != 0) || (size < 48))        /* check arena */
+    {
+        handle->debug_print("wav: arena is invalid.\n");                       /* arena is invalid */
+
+        return 4;                                                              /* return error */
+    }
+    
+    memset(cache, 0, sizeof(wav_cache_t));                                     /* clear the cache */
+    cache->arena = arena;                                                      /* set arena */
+    cache->arena_size = size & ~0x3U;                                          /* set arena size */
+    handle->cache = cache;                                                     /* set cache */
+    
+    return 0;                                                                  /* success return 0 */
+}
+
+/**
+ * @brief     initialize the wav player through the clip cache
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] *path pointer to a path buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 play failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 format is invalid
+ *            - 5 cache is not set
+ *            - 6 be playing
+ * @note      a hit plays the cached clip from memory, a miss loads the whole clip into the arena
+ *            evicting the least recently used clips, a clip larger than the arena is played from the file
+ */
+uint8_t wav_player_init_cached(wav_handle_t *handle, char *path)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t len;
+    uint32_t slot;
+    uint32_t offset;
+    wav_cache_t *cache;
+    
+    if (handle == NULL)                                                               /* check handle */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (handle->inited != 1)                                                          /* check handle initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    if (handle->cache == NULL)                                                        /* check cache */
+    {
+        handle->debug_print("wav: cache is not set.\n");                              /* cache is not set */
+
+        return 5;                                                                     /* return error */
+    }
+    if (handle->status != 0)                                                          /* check status */
+    {
+        handle->debug_print("wav: be playing.\n");                                    /* be playing */
+
+        return 6;                                                                     /* return error */
+    }
+    
+    cache = handle->cache;                                                            /* get cache */
+    cache->stamp++;                                                                   /* stamp++ */
+    for (i = 0; i < WAV_CACHE_ENTRY; i++)                                             /* look up the path */
+    {
+        if ((cache->entry[i].used != 0) && 
+            (strncmp(cache->entry[i].path, path, WAV_CACHE_PATH_SIZE) == 0))          /* hit */
+        {
+            cache->entry[i].stamp = cache->stamp;                                     /* most recently used */
+            cache->hit++;                                                             /* hit++ */
+            
+            return wav_player_init_memory(handle, cache->arena + cache->entry[i].offset, 
+                                          cache->entry[i].size);                      /* play from memory */
+        }
+    }
+    cache->miss++;                                                                    /* miss++ */
+    res = wav_player_init(handle, path);                                              /* open the file */
+    if (res != 0)                                                                     /* check result */
+    {
+        return res;                                                                   /* return error */
+    }
+    if (strlen(path) >= WAV_CACHE_PATH_SIZE)                                          /* check the key */
+    {
+        return 0;                                                                     /* play from the file */
+    }
+    if ((handle->size > handle->pos) && 
+        (handle->size - handle->pos > cache->arena_size))                             /* larger than the arena */
+    {
+        return 0;                                                                     /* play from the file */
+    }
+    len = (handle->size > handle->pos) ? (uint32_t)(handle->size - handle->pos) : 0;  /* pcm in the data chunk */
+    if (a_wav_cache_alloc(cache, (44 + len + 3) & ~0x3U, &slot, &offset) != 0)        /* allocate */
+    {
+        return 0;                                                                     /* play from the file */
+    }
+    for (i = 0; i < len; i += 32768)                                                  /* load the pcm */
+    {
+        if (handle->audio_read(handle->pos + i, (uint16_t)((len - i > 32768) ? 32768 : (len - i)), 
+                               cache->arena + offset + 44 + i) != 0)                  /* read data */
+        {
+            handle->debug_print("wav: read failed\n");                                /* read failed */
+            (void)handle->audio_deinit();                                             /* audio deinit */
+
+            return 1;                                                                 /* return error */
+        }
+    }
+    memcpy(handle->wav.chunk_id, "RIFF", 4);                                          /* riff */
+    handle->wav.chunk_size = 36 + len;                                                /* canonical chunk size */
+    handle->wav.sub_chunk1_size = 16;                                                 /* 16 bytes */
+    handle->wav.sub_chunk2_size = len;                                                /* set sub chunk2 size */
+    a_wav_build_wav_header(handle, cache->arena + offset);                            /* build header */
+    if (handle->audio_deinit() != 0)                                                  /* audio deinit */
+    {
+        handle->debug_print("wav: audio deinit failed.\n");                           /* audio deinit failed */
+
+        return 1;                                                                     /* return error */
+    }
+    strncpy(cache->entry[slot].path, path, WAV_CACHE_PATH_SIZE);                      /* set key */
+    cache->entry[slot].offset = offset;                                               /* set offset */
+    cache->entry[slot].size = 44 + len;                                               /* set size */
+    cache->entry[slot].stamp = cache->stamp;                                          /* most recently used */
+    cache->entry[slot].used = 1;                                                      /* used */
+    
+    return wav_player_init_memory(handle, cache->arena + offset, 44 + len);           /* play from memory */
+}
+
+/**
+ * @brief      get the clip cache counters
+ * @param[in]  *handle pointer to a wav handle structure
+ * @param[out] *stat pointer to a wav cache stat structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 cache is not set
+ * @note       none
+ */
+uint8_t wav_cache_get_stat(wav_handle_t *handle, wav_cache_stat_t *stat)
+{
+    uint32_t i;
+    
+    if (handle == NULL)                                                      /* check handle */
+    {
+        return 2;                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                 /* check handle initialization */
+    {
+        return 3;                                                            /* return error */
+    }
+    if (handle->cache == NULL)                                               /* check cache */
+    {
+        handle->debug_print("wav: cache is not set.\n");                     /* cache is not set */
+
+        return 4;                                                            /* return error */
+    }
+    
+    stat->hit = handle->cache->hit;                                          /* get hit */
+    stat->miss = handle->cache->miss;                                        /* get miss */
+    stat->evict = handle->cache->evict;                                      /* get evict */
+    stat->entry = 0;                                                         /* init 0 */
+    stat->used = 0;                                                          /* init 0 */
+    for (i = 0; i < WAV_CACHE_ENTRY; i++)                                    /* loop all entries */
+    {
+        if (handle->cache->entry[i].used != 0)                               /* used */
+        {
+            stat->entry++;                                                   /* entry++ */
+            stat->used += (handle->cache->entry[i].size + 3) & ~0x3U;        /* add size */
+        }
+    }
+    
+    return 0;                                                                /* success return 0 */
+}
+
+/**
+ * @brief     wav player config
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] standard iis standard
+ * @param[in] mode iis mode
+ * @param[in] polarity iis polarity
+ * @param[in] format iis format
+ * @param[in] enable mclk output
+ * @param[in] freq set freq
+ * @return    status code
+ *            - 0 success
+ *            - 1 config failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t wav_player_config(wav_handle_t *handle, uint32_t standard, 
+                          uint32_t mode, uint32_t polarity, 
+                          uint32_t format, uint32_t enable, uint32_t freq)
+{
+    if (handle == NULL)                                                         /* check handle */
+    {
+        return 2;                                                               /* return error */
+    }
+    if (handle->inited != 1)                                                    /* check handle initialization */
+    {
+        return 3;                                                               /* return error */
+    }
+    
+    if (handle->iis_set_freq(freq) != 0)                                        /* set freq */
+    {
+        handle->debug_print("wav: set freq failed.\n");                         /* set freq failed */
+
+        return 1;                                                               /* return error */
+    }
+    if (handle->iis_init(standard, mode, polarity, format, enable, freq) != 0)  /* iis init */
+    {
+        handle->debug_print("wav: config failed.\n");                           /* config failed */
+
+        return 1;                                                               /* return error */
+    }
+    
+    return 0;                                                                   /* success return 0 */
+}
+
+/**
+ * @brief     wav player start
+ * @param[in] *handle pointer to a wav handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 be playing
+ *            - 5 buffer is not set
+ * @note      with fast start only WAV_FAST_START_SIZE bytes are read before the dma starts,
+ *            the rest of the buffer is read by wav_player_service while the head is playing
+ */
+uint8_t wav_player_start(wav_handle_t *handle)
+{
+    uint8_t i;
+    uint32_t t0 = 0;
+    uint32_t prime;
+    uint64_t last;
+    
+    if (handle == NULL)                                                                   /* check handle */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (handle->inited != 1)                                                              /* check handle initialization */
+    {
+        return 3;                                                                         /* return error */
+    }
+    if (handle->status != 0)                                                              /* check status */
+    {
+        handle->debug_print("wav: be playing.\n");                                        /* be playing */
+
+        return 4;                                                                         /* return error */
+    }
+    if (handle->buf == NULL)                                                              /* check buffer */
+    {
+        handle->debug_print("wav: buffer is not set.\n");                                 /* buffer is not set */
+
+        return 5;                                                                         /* return error */
+    }
+    
+    if (handle->timestamp_us != NULL)                                                     /* check timestamp */
+    {
+        t0 = handle->timestamp_us();                                                      /* get the start time */
+    }
+    handle->start_first_us = 0;                                                           /* init 0 */
+    handle->start_primed_us = 0;                                                          /* init 0 */
+    handle->mem_direct = 0;                                                               /* init 0 */
+    handle->drain = 0;                                                                    /* init 0 */
+    handle->drain_live = 0;                                                               /* init 0 */
+    handle->pause_phase = 0;                                                              /* init 0 */
+    handle->unmute_count = 0;                                                             /* init 0 */
+    if (handle->source == WAV_SOURCE_MEMORY)                                              /* memory source */
+    {
+        uint64_t window = handle->size - handle->pos;                                     /* pcm bytes with the tail */
+        
+        if ((handle->iis_write_once != NULL) && 
+            (((size_t)(handle->mem + handle->pos) & 0x3) == 0) && 
+            (window >= (uint64_t)handle->segment * 4) && 
+            (window <= 131070) && ((window % 2) == 0))                                    /* check in place */
+        {
+            handle->mem_direct = 1;                                                       /* play in place */
+            handle->mem_window = (uint32_t)window;                                        /* set window */
+        }
+    }
+    if (handle->mem_direct != 0)                                                          /* zero copy */
+    {
+        a_wav_meter_reset(handle);                                                        /* reset meter */
+        a_wav_health_reset(handle, handle->wav.block_align, 
+                           handle->wav.sample_rate);                                      /* reset health */
+        handle->health_period_us = (uint32_t)((uint64_t)handle->mem_window / 
+                                   handle->segment / handle->wav.block_align * 
+                                   1000000 / handle->wav.sample_rate);                    /* window segment period */
+        handle->pos += handle->mem_window;                                                /* add pos */
+        handle->status = 1;                                                               /* set status before the dma */
+        if (handle->iis_write_once((uint16_t *)(handle->mem + handle->pos - handle->mem_window), 
+                                   (uint16_t)(handle->mem_window / 2)) != 0)              /* write data once */
+        {
+            handle->debug_print("wav: iis write failed\n");                               /* iis write failed */
+            handle->pos -= handle->mem_window;                                            /* restore pos */
+            handle->status = 0;                                                           /* stop */
+
+            return 1;                                                                     /* return error */
+        }
+        if (handle->timestamp_us != NULL)                                                 /* check timestamp */
+        {
+            handle->start_first_us = handle->timestamp_us() - t0;                         /* time to the first sample */
+            handle->start_primed_us = handle->start_first_us;                             /* nothing to prime */
+        }
+        
+        return 0;                                                                         /* success return 0 */
+    }
+    a_wav_meter_reset(handle);                                                            /* reset meter */
+    a_wav_health_reset(handle, handle->wav.block_align, 
+                       handle->wav.sample_rate);                                          /* reset health */
+    handle->seg_data = 0;                                                                 /* init 0 */
+    handle->prime_active = 0;                                                             /* init 0 */
+    if ((handle->fast_start != 0) && (handle->source != WAV_SOURCE_STREAM))               /* fast start */
+    {
+        prime = WAV_FAST_START_SIZE & ~0x3U;                                              /* whole words */
+        if ((prime == 0) || (prime > handle->segment_size))                               /* check the size */
+        {
+            prime = handle->segment_size;                                                 /* whole segment */
+        }
+        if (a_wav_source_read(handle, handle->pos, handle->buf, prime) != 0)              /* read the head */
+        {
+            return 1;                                                                     /* return error */
+        }
+        memset(handle->buf + prime, 0, handle->buf_size - prime);                         /* silence until primed */
+        handle->prime_base = handle->pos;                                                 /* source position of segment 0 */
+        handle->prime_seg = (prime == handle->segment_size) ? 1 : 0;                      /* whole segments primed */
+        handle->prime_head = prime % handle->segment_size;                                /* head of the next segment */
+        handle->prime_played = 0;                                                         /* init 0 */
+        handle->prime_busy = 0;                                                           /* init 0 */
+        handle->prime_t0 = t0;                                                            /* save the start time */
+        handle->prime_active = 1;                                                         /* prime while playing */
+    }
+    else
+    {
+        for (i = 0; i < handle->segment; i++)                                             /* read all segments */
+        {
+            if (handle->source == WAV_SOURCE_STREAM)                                      /* stream source */
+            {
+                a_wav_stream_fill(handle, handle->buf + handle->segment_size * i);        /* fill from the stream */
+                
+                continue;                                                                 /* next segment */
+            }
+            if (a_wav_source_read(handle, handle->pos + handle->segment_size * i, 
+                                  handle->buf + handle->segment_size * i, 
+                                  handle->segment_size) != 0)                             /* read data */
+            {
+                return 1;                                                                 /* return error */
+            }
+            handle->seg_pos[i] = handle->pos + handle->segment_size * i;                  /* segment position */
+            if (handle->seg_pos[i] < handle->size)                                        /* segment holds data */
+            {
+                handle->seg_data |= (uint64_t)1 << i;                                     /* set the data bit */
+            }
+        }
+        if ((handle->source != WAV_SOURCE_STREAM) && 
+            (handle->pos + handle->buf_size >= handle->size))                             /* data ends in the buffer */
+        {
+            last = (handle->size > handle->pos) ? 
+                   (handle->size - 1 - handle->pos) / handle->segment_size : 0;           /* segment of the last sample */
+            a_wav_player_drain(handle, (uint8_t)last, 
+                               (uint32_t)(handle->size - handle->pos - 
+                               last * handle->segment_size), (last == 0) ? 1 : 0);        /* drain */
+        }
+        handle->pos += handle->buf_size;                                                  /* add pos */
+    }
+    handle->status = 1;                                                                   /* set status before the dma */
+    if (handle->iis_write((uint16_t *)handle->buf, 
+                          (uint16_t)(handle->buf_size / 2)) != 0)                         /* write data */
+    {
+        handle->debug_print("wav: iis write failed\n");                                   /* iis write failed */
+        handle->prime_active = 0;                                                         /* stop priming */
+        handle->status = 0;                                                               /* stop */
+
+        return 1;                                                                         /* return error */
+    }
+    if (handle->timestamp_us != NULL)                                                     /* check timestamp */
+    {
+        handle->start_first_us = handle->timestamp_us() - t0;                             /* time to the first sample */
+        if (handle->fast_start == 0)                                                      /* read before the dma */
+        {
+            handle->start_primed_us = handle->start_first_us;                             /* already primed */
+        }
+    }
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief      wav player service
+ * @param[in]  *handle pointer to a wav handle structure
+ * @param[out] *primed pointer to a primed buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 service failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       call it from the main loop, after a fast start each call reads the next segment ahead of the dma,
+ *             primed is true once the fills took over, underruns while priming are counted in the health,
+ *             with the iis_get_remain link it ends the play as soon as the dma passes the last sample
+ */
+uint8_t wav_player_service(wav_handle_t *handle, wav_bool_t *primed)
+{
+    uint32_t n;
+    uint32_t played;
+    uint64_t addr;
+    uint64_t last;
+    
+    if (handle == NULL)                                                                   /* check handle */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (handle->inited != 1)                                                              /* check handle initialization */
+    {
+        return 3;                                                                         /* return error */
+    }
+    
+    *primed = (handle->prime_active == 0) ? WAV_BOOL_TRUE : WAV_BOOL_FALSE;              /* get the state */
+    if (handle->status != WAV_STATUS_PLAY)                                                /* not playing */
+    {
+        return 0;                                                                         /* success return 0 */
+    }
+    if (handle->prime_active == 0)                                                        /* nothing to prime */
+    {
+        return a_wav_player_drain_check(handle);                                          /* check the end */
+    }
+    played = handle->prime_played;                                                        /* released segments */
+    n = handle->prime_seg;                                                                /* next segment */
+    if (n < played)                                                                       /* the dma overtook */
+    {
+        n = played;                                                                       /* skip the played ones */
+        handle->prime_head = 0;                                                           /* whole segment */
+        handle->prime_seg = n;                                                            /* nothing left behind */
+    }
+    addr = handle->prime_base + (uint64_t)n * handle->segment_size + handle->prime_head;  /* source position */
+    if (addr >= handle->size)                                                             /* all data primed */
+    {
+        last = (handle->size > handle->prime_base) ? 
+               (handle->size - 1 - handle->prime_base) / handle->segment_size : 0;        /* segment of the last sample */
+        if (last != played)                                                               /* not the playing segment */
+        {
+            return 0;                                                                     /* success return 0 */
+        }
+        handle->prime_busy = 1;                                                           /* keep the fills off */
+        if ((handle->prime_active != 0) && (handle->drain == 0))                          /* still priming */
+        {
+            a_wav_player_drain(handle, (uint8_t)(last % handle->segment), 
+                               (uint32_t)(handle->size - handle->prime_base - 
+                               last * handle->segment_size), 1);                          /* drain */
+        }
+        handle->prime_busy = 0;                                                           /* release */
+        
+        return a_wav_player_drain_check(handle);                                          /* check the end */
+    }
+    if (n >= played + handle->segment)                                                    /* slot busy */
+    {
+        return 0;                                                                         /* success return 0 */
+    }
+    handle->prime_busy = 1;                                                               /* keep the fills off */
+    if (handle->prime_active == 0)                                                        /* taken over meanwhile */
+    {
+        handle->prime_busy = 0;                                                           /* release */
+        *primed = WAV_BOOL_TRUE;                                                          /* primed */
+        
+        return 0;                                                                         /* success return 0 */
+    }
+    if (a_wav_source_read(handle, addr, 
+                          handle->buf + handle->segment_size * (n % handle->segment) + handle->prime_head, 
+                          handle->segment_size - handle->prime_head) != 0)                /* read data */
+    {
+        handle->prime_busy = 0;                                                           /* release */
+        
+        return 1;                                                                         /* return error */
+    }
+    handle->prime_head = 0;                                                               /* init 0 */
+    handle->prime_seg = n + 1;                                                            /* one more primed */
+    handle->prime_busy = 0;                                                               /* release */
+    if ((handle->timestamp_us != NULL) && (handle->start_primed_us == 0) && 
+        ((n + 2 >= played + handle->segment) || 
+         (handle->prime_base + (uint64_t)(n + 1) * handle->segment_size >= handle->size)))  /* queue primed */
+    {
+        handle->start_primed_us = handle->timestamp_us() - handle->prime_t0;              /* time to the full buffer */
+    }
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief     wav record start
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] sample_rate sample rate
+ * @param[in] *path pointer to a path buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 be recording
+ *            - 5 buffer is not set
+ * @note      the file is opened, pre allocated and its header written before the dma starts
+ */
+uint8_t wav_record_start(wav_handle_t *handle, uint32_t sample_rate, char *path)
+{
+    if (handle == NULL)                                                /* check handle */
+    {
+        return 2;                                                      /* return error */
+    }
+    if (handle->inited != 1)                                           /* check handle initialization */
+    {
+        return 3;                                                      /* return error */
+    }
+    if (handle->status != 0)                                           /* check status */
+    {
+        handle->debug_print("wav: be recording.\n");                   /* be recording */
+
+        return 4;                                                      /* return error */
+    }
+    if (handle->buf == NULL)                                           /* check buffer */
+    {
+        handle->debug_print("wav: buffer is not set.\n");              /* buffer is not set */
+
+        return 5;                                                      /* return error */
+    }
+    
+    handle->pos = 0;                                                   /* init 0 */
+    handle->wav.chunk_id[0] = 'R';                                     /* R */
+    handle->wav.chunk_id[1] = 'I';                                     /* I */
+    handle->wav.chunk_id[2] = 'F';                                     /* F */
+    handle->wav.chunk_id[3] = 'F';                                     /* F */
+    handle->wav.chunk_size = 0x00000000;                               /* init 0 */
+    handle->wav.format[0] = 'W';                                       /* W */
+    handle->wav.format[1] = 'A';                                       /* A */
+    handle->wav.format[2] = 'V';                                       /* V */
+    handle->wav.format[3] = 'E';                                       /* E */
+    handle->wav.sub_chunk1_id[0] = 'f';                                /* f */
+    handle->wav.sub_chunk1_id[1] = 'm';                                /* m */
+    handle->wav.sub_chunk1_id[2] = 't';                                /* t */
+    handle->wav.sub_chunk1_id[3] = 0x20;                               /* 0x20 */
+    handle->wav.sub_chunk1_size = 16;                                  /* 16 bytes */
+    handle->wav.audio_format = 0x01;                                   /* pcm */
+    handle->wav.num_channel = 2;                                       /* 2 channel */
+    handle->wav.sample_rate = sample_rate;                             /* set sample rate */
+    handle->wav.byte_rate = handle->wav.sample_rate * 4;               /* 4 times */
+    handle->wav.block_align = 4;                                       /* 4 bytes */
+    handle->wav.bit_per_sample = 16;                                   /* 16 bits */
+    handle->wav.sub_chunk2_id[0] = 'd';                                /* d */
+    handle->wav.sub_chunk2_id[1] = 'a';                                /* a */
+    handle->wav.sub_chunk2_id[2] = 't';                                /* t */
+    handle->wav.sub_chunk2_id[3] = 'a';                                /* a */
+    handle->wav.sub_chunk2_size = 0x00000000;                          /* init 0 */
+    handle->record_path = path;                                        /* save path */
+    handle->ring_head = 0;                                             /* init 0 */
+    handle->ring_fill = 0;                                             /* init 0 */
+    handle->triggered = 0;                                             /* not triggered */
+    handle->record_next = 0;                                           /* first segment */
+    if (a_wav_record_open(handle) != 0)                                /* open the file */
+    {
+        return 1;                                                      /* return error */
+    }
+    a_wav_meter_reset(handle);                                         /* reset meter */
+    a_wav_health_reset(handle, handle->wav.block_align, 
+                       handle->wav.sample_rate);                       /* reset health */
+    if (handle->iis_read((uint16_t *)handle->buf, 
+                         (uint16_t)(handle->buf_size / 2)) != 0)       /* read data */
+    {
+        handle->debug_print("wav: iis read failed\n");                 /* iis read failed */
+        (void)handle->audio_deinit();                                  /* audio deinit */
+
+        return 1;                                                      /* return error */
+    }
+    handle->status = 1;                                                /* set status */
+    
+    return 0;                                                          /* success return 0 */
+}
+
+/**
+ * @brief     write one segment
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] index fill index
+ * @return    status code
+ *            - 0 success
+ *            - 1 fill failed
+ * @note      none
+ */
+static uint8_t a_wav_record_file_fill(wav_handle_t *handle, uint8_t index)
+{
+    uint8_t *seg;
+    
+    seg = handle->buf + handle->segment_size * index;                                    /* get segment */
+    handle->record_next = (uint8_t)((index + 1) % handle->segment);                      /* next segment */
+    if ((handle->meter_enable != 0) || 
+        ((handle->ring != NULL) && (handle->trigger_level != 0)))                        /* check meter */
+    {
+        a_wav_meter_block(handle, seg, handle->segment_size);                            /* meter the block */
+    }
+    if (handle->ring != NULL)                                                            /* pre trigger mode */
+    {
+        if ((handle->triggered == 0) && (handle->trigger_level != 0) && 
+            ((handle->meter.peak[0] >= handle->trigger_level) || 
+             (handle->meter.peak[1] >= handle->trigger_level)))                          /* check level */
+        {
+            handle->triggered = 1;                                                       /* level trigger */
+        }
+        if (handle->triggered == 0)                                                      /* armed */
+        {
+            a_wav_ring_push(handle, seg);                                                /* keep the pre roll */
+            
+            return 0;                                                                    /* success return 0 */
+        }
+        if (handle->ring_fill != 0)                                                      /* pre roll left */
+        {
+            if (a_wav_ring_pop(handle) != 0)                                             /* free the oldest first */
+            {
+                return 1;                                                                /* return error */
+            }
+            a_wav_ring_push(handle, seg);                                                /* queue the live data */
+            if (a_wav_ring_pop(handle) != 0)                                             /* drain one more */
+            {
+                return 1;                                                                /* return error */
+            }
+            
+            return 0;                                                                    /* success return 0 */
+        }
+    }
+    if (handle->audio_write(handle->pos, (uint16_t)handle->segment_size, seg) != 0)      /* write data */
+    {
+        handle->debug_print("wav: write failed\n");                                      /* write failed */
+
+        return 1;                                                                        /* return error */
+    }
+    handle->pos += handle->segment_size;                                                 /* add pos */
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief     wav record file fill
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] index fill index
+ * @return    status code
+ *            - 0 success
+ *            - 1 fill failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 not recording
+ *            - 5 index is invalid
+ * @note      index is the segment just filled by the dma, from 0 to segment - 1
+ */
+uint8_t wav_record_file_fill(wav_handle_t *handle, uint8_t index)
+{
+    uint8_t res;
+    uint32_t t0;
+    
+    if (handle == NULL)                                                                  /* check handle */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if (handle->inited != 1)                                                             /* check handle initialization */
+    {
+        return 3;                                                                        /* return error */
+    }
+    if (handle->status != 1)                                                             /* check status */
+    {
+        handle->debug_print("wav: not recording.\n");                                    /* not recording */
+
+        return 4;                                                                        /* return error */
+    }
+    if (index >= handle->segment)                                                        /* check index */
+    {
+        handle->debug_print("wav: index is invalid.\n");                                 /* index is invalid */
+
+        return 5;                                                                        /* return error */
+    }
+    
+    t0 = a_wav_health_begin(handle, index, 1);                                           /* health begin */
+    res = a_wav_record_file_fill(handle, index);                                         /* fill */
+    if ((res == 0) && (handle->checkpoint_second != 0) && 
+        (handle->pos - handle->checkpoint_pos >= 
+         (uint64_t)handle->checkpoint_second * handle->wav.byte_rate))                   /* checkpoint due */
+    {
+        res = a_wav_record_update_header(handle);                                        /* rewrite the sizes */
+    }
+    a_wav_health_end(handle, t0, 1);                                                     /* health end */
+    
+    return res;                                                                          /* return the result */
+}
+
+/**
+ * @brief     wav record stop
+ * @param[in] *handle pointer to a wav handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 not recording
+ * @note      with the iis_get_remain link the samples received after the last filled segment
+ *            are written up to the dma position at the stop,
+ *            a record that was never triggered is closed with no data
+ */
+uint8_t wav_record_stop(wav_handle_t *handle)
+{
+    if (handle == NULL)                                            /* check handle */
+    {
+        return 2;                                                  /* return error */
+    }
+    if (handle->inited != 1)                                       /* check handle initialization */
+    {
+        return 3;                                                  /* return error */
+    }
+    if (handle->status != 1)                                       /* check status */
+    {
+        handle->debug_print("wav: not recording.\n");              /* not recording */
+
+        return 4;                                                  /* return error */
+    }
+    
+    if (handle->iis_stop() != 0)                                   /* iis stop */
+    {
+        handle->debug_print("wav: iis stop failed.\n");            /* iis stop failed */
+
+        return 1;                                                  /* return error */
+    }
+    if ((handle->ring != NULL) && (handle->triggered == 0))        /* never triggered */
+    {
+        handle->debug_print("wav: not triggered.\n");              /* not triggered */
+        handle->ring_fill = 0;                                     /* drop the pre roll */
+    }
+    else
+    {
+        while ((handle->ring != NULL) && (handle->ring_fill != 0)) /* flush the ring */
+        {
+            if (a_wav_ring_pop(handle) != 0)                       /* write the oldest */
+            {
+                return 1;                                          /* return error */
+            }
+        }
+        if (a_wav_record_tail(handle) != 0)                        /* write the tail */
+        {
+            return 1;                                              /* return error */
+        }
+    }
+    if ((handle->audio_truncate != NULL) && 
+        (handle->size > handle->pos))                              /* pre allocated tail */
+    {
+        if (handle->audio_truncate(handle->pos) != 0)              /* cut the file */
+        {
+            handle->debug_print("wav: truncate failed.\n");        /* truncate failed */
+
+            return 1;                                              /* return error */
+        }
+    }
+    if (a_wav_record_update_header(handle) != 0)                   /* write header */
+    {
+        return 1;                                                  /* return error */
+    }
+    if (handle->iis_deinit() != 0)                                 /* iis deinit */
+    {
+        handle->debug_print("wav: iis deinit failed.\n");          /* iis deinit failed */
+
+        return 1;                                                  /* return error */
+    }
+    if (handle->audio_deinit() != 0)                               /* audio deinit */
+    {
+        handle->debug_print("wav: audio deinit failed.\n");        /* audio deinit failed */
+
+        return 1;                                                  /* return error */
+    }
+    handle->status = 0;                                            /* stop */
+    
+    return 0;                                                      /* success return 0 */
+}
+
+/**
+ * @brief     wav player stop
+ * @param[in] *handle pointer to a wav handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 not playing
+ * @note      none
+ */
+uint8_t wav_player_stop(wav_handle_t *handle)
+{
+    if (handle == NULL)                                                   /* check handle */
+    {
+        return 2;                                                         /* return error */
+    }
+    if (handle->inited != 1)                                              /* check handle initialization */
+    {
+        return 3;                                                         /* return error */
+    }
+    if ((handle->status != WAV_STATUS_PLAY) && 
+        (handle->status != WAV_STATUS_PAUSE))                             /* check status */
+    {
+        handle->debug_print("wav: not playing.\n");                       /* not playing */
+
+        return 4;                                                         /* return error */
+    }
+    
+    if (handle->iis_stop() != 0)                                          /* iis stop */
+    {
+        handle->debug_print("wav: iis stop failed.\n");                   /* iis stop failed */
+
+        return 1;                                                         /* return error */
+    }
+    if (handle->iis_deinit() != 0)                                        /* iis deinit */
+    {
+        handle->debug_print("wav: iis deinit failed.\n");                 /* iis deinit failed */
+
+        return 1;                                                         /* return error */
+    }
+    if ((handle->source == WAV_SOURCE_FILE) && 
+        (handle->audio_deinit() != 0))                                    /* audio deinit */
+    {
+        handle->debug_print("wav: audio deinit failed.\n");               /* audio deinit failed */
+
+        return 1;                                                         /* return error */
+    }
+    if ((handle->pause_phase == 2) || (handle->unmute_count != 0))        /* codec muted */
+    {
+        if (handle->mute(0) != 0)                                         /* unmute */
+        {
+            handle->debug_print("wav: mute failed.\n");                   /* mute failed */
+
+            return 1;                                                     /* return error */
+        }
+    }
+    handle->pause_phase = 0;                                              /* init 0 */
+    handle->unmute_count = 0;                                             /* init 0 */
+    handle->prime_active = 0;                                             /* init 0 */
+    handle->status = 0;                                                   /* stop */
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief     wav player pause
+ * @param[in] *handle pointer to a wav handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 pause failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 not playing
+ *            - 5 start is priming
+ * @note      with the mute link the dma keeps running, the codec soft mute starts at the next
+ *            segment boundary, silence is fed from then on and file and memory sources are moved
+ *            back to the first muted sample, without the link or for in place memory clips iis_pause is used
+ */
+uint8_t wav_player_pause(wav_handle_t *handle)
+{
+    if (handle == NULL)                                             /* check handle */
+    {
+        return 2;                                                   /* return error */
+    }
+    if (handle->inited != 1)                                        /* check handle initialization */
+    {
+        return 3;                                                   /* return error */
+    }
+    if (handle->status != WAV_STATUS_PLAY)                          /* check status */
+    {
+        handle->debug_print("wav: not playing.\n");                 /* not playing */
+
+        return 4;                                                   /* return error */
+    }
+    if (handle->prime_active != 0)                                  /* check priming */
+    {
+        handle->debug_print("wav: start is priming.\n");            /* start is priming */
+
+        return 5;                                                   /* return error */
+    }
+    
+    if ((handle->mute != NULL) && (handle->mem_direct == 0))        /* soft pause */
+    {
+        handle->pause_phase = 1;                                    /* mute at the next boundary */
+        handle->status = WAV_STATUS_PAUSE;                          /* pause */
+        
+        return 0;                                                   /* success return 0 */
+    }
+    if (handle->iis_pause() != 0)                                   /* iis pause */
+    {
+        handle->debug_print("wav: iis pause failed.\n");            /* iis pause failed */
+
+        return 1;                                                   /* return error */
+    }
+    handle->pause_phase = 0;                                        /* hard pause */
+    handle->status = WAV_STATUS_PAUSE;                              /* pause */
+    
+    return 0;                                                       /* success return 0 */
+}
+
+/**
+ * @brief     wav player resume
+ * @param[in] *handle pointer to a wav handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 resume failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 not paused
+ * @note      after a soft pause the next fill restarts the source from the first muted sample
+ *            and the codec is unmuted when the dma reaches it, within one dma buffer period
+ */
+uint8_t wav_player_resume(wav_handle_t *handle)
+{
+    if (handle == NULL)                                          /* check handle */
+    {
+        return 2;                                                /* return error */
+    }
+    if (handle->inited != 1)                                     /* check handle initialization */
+    {
+        return 3;                                                /* return error */
+    }
+    if (handle->status != WAV_STATUS_PAUSE)                      /* check status */
+    {
+        handle->debug_print("wav: not paused.\n");               /* not paused */
+
+        return 4;                                                /* return error */
+    }
+    
+    if (handle->pause_phase == 1)                                /* not muted yet */
+    {
+        handle->pause_phase = 0;                                 /* cancel */
+        handle->status = WAV_STATUS_PLAY;                        /* play */
+        
+        return 0;                                                /* success return 0 */
+    }
+    if (handle->pause_phase == 2)                                /* soft paused */
+    {
+        handle->pause_phase = 0;                                 /* init 0 */
+        handle->unmute_count = handle->segment;                  /* unmute when the dma gets there */
+        handle->status = WAV_STATUS_PLAY;                        /* play */
+        
+        return 0;                                                /* success return 0 */
+    }
+    if (handle->iis_resume() != 0)                               /* iis resume */
+    {
+        handle->debug_print("wav: iis resume failed.\n");        /* iis resume failed */
+
+        return 1;                                                /* return error */
+    }
+    handle->status = WAV_STATUS_PLAY;                            /* play */
+    
+    return 0;                                                    /* success return 0 */
+}
+
+/**
+ * @brief      wav get status
+ * @param[in]  *handle pointer to a wav handle structure
+ * @param[out] *status pointer to a status buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get status failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wav_player_get_status(wav_handle_t *handle, wav_status_t *status)
+{
+    if (handle == NULL)                              /* check handle */
+    {
+        return 2;                                    /* return error */
+    }
+    if (handle->inited != 1)                         /* check handle initialization */
+    {
+        return 3;                                    /* return error */
+    }
+    
+    *status = (wav_status_t)(handle->status);        /* get status */
+    
+    return 0;                                        /* success return 0 */
+}
+
+/**
+ * @brief     count a fill while the fast start is priming
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] index fill index
+ * @return    status code
+ *            - 0 the fills took over
+ *            - 1 still priming
+ * @note      a segment released before it was primed played silence and counts as an underrun,
+ *            the fills take over once every queued segment is primed and no priming read is running
+ */
+static uint8_t a_wav_player_prime_check(wav_handle_t *handle, uint8_t index)
 {
-    if (handle == NULL)                                             /* check handle */
+    uint32_t played;
+    uint32_t next;
+    uint32_t a;
+    uint64_t primed;
+    uint64_t end;
+    uint64_t last;
+    uint8_t i;
+    
+    played = handle->prime_played + 1;                                                      /* released segments */
+    handle->prime_played = played;                                                          /* save */
+    primed = handle->prime_base + (uint64_t)handle->prime_seg * handle->segment_size + 
+             handle->prime_head;                                                            /* end of the primed data */
+    end = handle->prime_base + (uint64_t)played * handle->segment_size;                     /* end of the released data */
+    if (end > handle->size)                                                                 /* check the end */
     {
-        return 2;                                                   /* return error */
+        end = handle->size;                                                                 /* data end */
     }
-    if (handle->debug_print == NULL)                                /* check debug_print */
+    if ((primed < end) && 
+        (handle->prime_base + (uint64_t)(played - 1) * handle->segment_size < end))         /* played before primed */
     {
-        return 3;                                                   /* return error */
+        handle->health_sequence++;                                                          /* odd, writing */
+        handle->health.underrun++;                                                          /* underrun */
+        handle->health_sequence++;                                                          /* even, done */
     }
-    if (handle->iis_init == NULL)                                   /* check iis_init */
+    next = played + handle->segment - 1;                                                    /* segment for the released slot */
+    if ((handle->prime_busy != 0) || 
+        ((handle->prime_seg < next) && (primed < handle->size)))                            /* still priming */
     {
-        handle->debug_print("wav: iis_init is null.\n");            /* iis_init is null */
+        if (handle->prime_busy == 0)                                                        /* slot not being read */
+        {
+            memset(handle->buf + handle->segment_size * index, 0, handle->segment_size);    /* no stale replay */
+        }
         
-        return 3;                                                   /* return error */
+        return 1;                                                                           /* priming */
     }
-    if (handle->iis_deinit == NULL)                                 /* check iis_deinit */
+    
+    handle->prime_active = 0;                                                               /* the fills take over */
+    if ((handle->timestamp_us != NULL) && (handle->start_primed_us == 0))                   /* check timestamp */
     {
-        handle->debug_print("wav: iis_deinit is null.\n");          /* iis_deinit is null */
-        
-        return 3;                                                   /* return error */
+        handle->start_primed_us = handle->timestamp_us() - handle->prime_t0;                /* time to the full buffer */
     }
-    if (handle->iis_stop == NULL)                                   /* check iis_stop */
+    handle->seg_data = 0;                                                                   /* init 0 */
+    for (i = 0; i < handle->segment - 1; i++)                                               /* queued segments */
     {
-        handle->debug_print("wav: iis_stop is null.\n");            /* iis_stop is null */
-        
-        return 3;                                                   /* return error */
+        a = played + i;                                                                     /* segment number */
+        handle->seg_pos[a % handle->segment] = handle->prime_base + 
+                                               (uint64_t)a * handle->segment_size;          /* segment position */
+        if ((handle->seg_pos[a % handle->segment] < primed) && 
+            (handle->seg_pos[a % handle->segment] < handle->size))                          /* segment holds data */
+        {
+            handle->seg_data |= (uint64_t)1 << (a % handle->segment);                       /* set the data bit */
+        }
     }
-    if (handle->iis_pause == NULL)                                  /* check iis_pause */
+    handle->pos = handle->prime_base + (uint64_t)next * handle->segment_size;               /* next read position */
+    if (handle->pos >= handle->size)                                                        /* data ends in the queue */
     {
-        handle->debug_print("wav: iis_pause is null.\n");           /* iis_pause is null */
-        
-        return 3;                                                   /* return error */
+        last = (handle->size > handle->prime_base) ? 
+               (handle->size - 1 - handle->prime_base) / handle->segment_size : 0;          /* segment of the last sample */
+        if (last < played)                                                                  /* already played */
+        {
+            a_wav_player_drain(handle, index, 0, 0);                                        /* end at this fill */
+        }
+        else
+        {
+            a_wav_player_drain(handle, (uint8_t)(last % handle->segment), 
+                               (uint32_t)(handle->size - handle->prime_base - 
+                               last * handle->segment_size), (last == played) ? 1 : 0);     /* drain */
+        }
     }
-    if (handle->iis_resume == NULL)                                 /* check iis_resume */
+    
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     read one segment
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] index fill index
+ * @return    status code
+ *            - 0 success
+ *            - 1 fill failed
+ * @note      once the data ends silence is fed until the dma releases the segment
+ *            holding the last sample, then the play ends
+ */
+static uint8_t a_wav_player_buffer_fill(wav_handle_t *handle, uint8_t index)
+{
+    uint8_t *seg;
+    uint64_t first;
+    uint8_t i;
+    uint8_t j;
+    
+    if ((handle->prime_active != 0) && (a_wav_player_prime_check(handle, index) != 0))      /* fast start priming */
     {
-        handle->debug_print("wav: iis_resume is null.\n");          /* iis_resume is null */
-        
-        return 3;                                                   /* return error */
+        return 0;                                                                           /* success return 0 */
     }
-    if (handle->iis_set_freq == NULL)                               /* check iis_set_freq */
+    if (handle->status == WAV_STATUS_PAUSE)                                                 /* soft paused */
     {
-        handle->debug_print("wav: iis_set_freq is null.\n");        /* iis_set_freq is null */
+        if (handle->pause_phase == 1)                                                       /* first boundary */
+        {
+            first = handle->pos;                                                            /* nothing queued */
+            if (handle->unmute_count != 0)                                                  /* still muted */
+            {
+                handle->unmute_count = 0;                                                   /* cancel the unmute */
+                first = handle->pause_pos;                                                  /* nothing heard since */
+            }
+            else
+            {
+                if (handle->mute(1) != 0)                                                   /* soft mute */
+                {
+                    handle->debug_print("wav: mute failed.\n");                             /* mute failed */
+
+                    return 1;                                                               /* return error */
+                }
+                for (i = 1; i < handle->segment; i++)                                       /* queued segments */
+                {
+                    j = (uint8_t)((index + i) % handle->segment);                           /* next played */
+                    if ((handle->seg_data & ((uint64_t)1 << j)) != 0)                       /* first muted data */
+                    {
+                        first = handle->seg_pos[j];                                         /* get the position */
+                        
+                        break;                                                              /* break */
+                    }
+                }
+            }
+            if ((handle->source == WAV_SOURCE_FILE) || 
+                (handle->source == WAV_SOURCE_MEMORY))                                      /* seekable source */
+            {
+                handle->pos = first;                                                        /* back to the muted sample */
+                handle->pause_pos = first;                                                  /* save the position */
+                if (handle->pos < handle->size)                                             /* data left */
+                {
+                    handle->drain = 0;                                                      /* read again */
+                    handle->drain_live = 0;                                                 /* init 0 */
+                }
+            }
+            handle->seg_data = 0;                                                           /* all queued data is muted */
+            handle->pause_phase = 2;                                                        /* paused */
+        }
+        memset(handle->buf + handle->segment_size * index, 0, handle->segment_size);        /* silence */
         
-        return 3;                                                   /* return error */
+        return 0;                                                                           /* success return 0 */
     }
-    if (handle->iis_write == NULL)                                  /* check iis_write */
+    if (handle->unmute_count != 0)                                                          /* resuming */
     {
-        handle->debug_print("wav: iis_write is null.\n");           /* iis_write is null */
-        
-        return 3;                                                   /* return error */
+        handle->unmute_count--;                                                             /* count-- */
+        if ((handle->unmute_count == 0) && (handle->mute(0) != 0))                          /* unmute */
+        {
+            handle->debug_print("wav: mute failed.\n");                                     /* mute failed */
+
+            return 1;                                                                       /* return error */
+        }
     }
-    if (handle->iis_read == NULL)                                   /* check iis_read */
+    if (handle->source == WAV_SOURCE_STREAM)                                                /* stream source */
     {
-        handle->debug_print("wav: iis_read is null.\n");            /* iis_read is null */
+        seg = handle->buf + handle->segment_size * index;                                   /* get segment */
+        a_wav_stream_fill(handle, seg);                                                     /* fill from the stream */
+        if (handle->meter_enable != 0)                                                      /* check meter */
+        {
+            a_wav_meter_block(handle, seg, handle->segment_size);                           /* meter the block */
+        }
         
-        return 3;                                                   /* return error */
+        return 0;                                                                           /* success return 0 */
     }
-    if (handle->audio_init == NULL)                                 /* check audio_init */
+    if (handle->mem_direct != 0)                                                            /* memory played in place */
     {
-        handle->debug_print("wav: audio_init is null.\n");          /* audio_init is null */
+        uint32_t len = handle->mem_window / handle->segment;                                /* window segment size */
+        uint32_t start;
         
-        return 3;                                                   /* return error */
+        len -= len % handle->wav.block_align;                                               /* whole frames */
+        start = len * index;                                                                /* segment start */
+        if (index == handle->segment - 1)                                                   /* last segment */
+        {
+            len = handle->mem_window - start;                                               /* with the tail */
+        }
+        if ((handle->meter_enable != 0) && (handle->wav.bit_per_sample == 16))              /* check meter */
+        {
+            a_wav_meter_block(handle, handle->mem + handle->pos - 
+                              handle->mem_window + start, len);                             /* meter the block */
+        }
+        if (index == handle->segment - 1)                                                   /* transfer done */
+        {
+            return a_wav_player_end(handle);                                                /* end */
+        }
+        
+        return 0;                                                                           /* success return 0 */
     }
-    if (handle->audio_deinit == NULL)                               /* check audio_deinit */
+    seg = handle->buf + handle->segment_size * index;                                       /* get segment */
+    if (handle->drain != 0)                                                                 /* draining */
     {
-        handle->debug_print("wav: audio_deinit is null.\n");        /* audio_deinit is null */
+        if (handle->drain == 2)                                                             /* the service is ending */
+        {
+            return 0;                                                                       /* success return 0 */
+        }
+        if (index == handle->drain_index)                                                   /* last sample played */
+        {
+            return a_wav_player_end(handle);                                                /* end */
+        }
+        if (index == (uint8_t)((handle->drain_index + handle->segment - 1) % 
+                               handle->segment))                                            /* last segment next */
+        {
+            handle->drain_live = 1;                                                         /* the dma plays it */
+        }
+        memset(seg, 0, handle->segment_size);                                               /* silence */
+        handle->seg_data &= ~((uint64_t)1 << index);                                        /* clear the data bit */
         
-        return 3;                                                   /* return error */
+        return 0;                                                                           /* success return 0 */
     }
-    if (handle->audio_read == NULL)                                 /* check audio_read */
+    if (a_wav_source_read(handle, handle->pos, seg, handle->segment_size) != 0)             /* read data */
     {
-        handle->debug_print("wav: audio_read is null.\n");          /* audio_read is null */
-        
-        return 3;                                                   /* return error */
+        return 1;                                                                           /* return error */
     }
-    if (handle->audio_write == NULL)                                /* check audio_write */
+    handle->seg_pos[index] = handle->pos;                                                   /* segment position */
+    handle->seg_data |= (uint64_t)1 << index;                                               /* set the data bit */
+    handle->pos += handle->segment_size;                                                    /* add pos */
+    if (handle->pos >= handle->size)                                                        /* data ends */
     {
-        handle->debug_print("wav: audio_write is null.\n");         /* audio_write is null */
-        
-        return 3;                                                   /* return error */
+        a_wav_player_drain(handle, index, 
+                           (uint32_t)(handle->size - (handle->pos - handle->segment_size)), 0);  /* drain */
     }
-    if (handle->delay_ms == NULL)                                   /* check delay_ms */
+    if ((handle->meter_enable != 0) && (handle->wav.bit_per_sample == 16))                  /* check meter */
     {
-        handle->debug_print("wav: delay_ms is null.\n");            /* delay_ms is null */
-        
-        return 3;                                                   /* return error */
+        a_wav_meter_block(handle, seg, handle->segment_size);                               /* meter the block */
     }
     
-    handle->inited = 1;                                             /* flag inited */
-    
-    return 0;                                                       /* success return 0 */
+    return 0;                                                                               /* success return 0 */
 }
 
 /**
- * @brief     wav deinit
+ * @brief     wav player buffer fill
  * @param[in] *handle pointer to a wav handle structure
+ * @param[in] index fill index
  * @return    status code
  *            - 0 success
- *            - 1 deinit failed
+ *            - 1 fill failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 not playing
+ *            - 5 index is invalid
+ * @note      index is the segment just released by the dma, from 0 to segment - 1
  */
-uint8_t wav_deinit(wav_handle_t *handle)
+uint8_t wav_player_buffer_fill(wav_handle_t *handle, uint8_t index)
 {
-    if (handle == NULL)             /* check handle */
+    uint8_t res;
+    uint32_t t0;
+    
+    if (handle == NULL)                                         /* check handle */
     {
-        return 2;                   /* return error */
+        return 2;                                               /* return error */
     }
-    if (handle->inited != 1)        /* check handle initialization */
+    if (handle->inited != 1)                                    /* check handle initialization */
     {
-        return 3;                   /* return error */
+        return 3;                                               /* return error */
+    }
+    if ((handle->status != WAV_STATUS_PLAY) && 
+        (handle->status != WAV_STATUS_PAUSE))                   /* check status */
+    {
+        handle->debug_print("wav: not playing.\n");             /* not playing */
+
+        return 4;                                               /* return error */
+    }
+    if (index >= handle->segment)                               /* check index */
+    {
+        handle->debug_print("wav: index is invalid.\n");        /* index is invalid */
+
+        return 5;                                               /* return error */
     }
     
-    handle->inited = 0;             /* flag closed */
+    t0 = a_wav_health_begin(handle, index, 0);                  /* health begin */
+    res = a_wav_player_buffer_fill(handle, index);              /* fill */
+    a_wav_health_end(handle, t0, 0);                            /* health end */
     
-    return 0;                       /* success return 0 */
+    return res;                                                 /* return the result */
 }
 
 /**
- * @brief     initialize the wav player
+ * @brief     set the audio buffer
  * @param[in] *handle pointer to a wav handle structure
- * @param[in] *path pointer to a path buffer
+ * @param[in] *buf pointer to a buffer
+ * @param[in] size buffer size in bytes
+ * @param[in] segment number of dma callbacks per buffer cycle
  * @return    status code
  *            - 0 success
- *            - 1 play failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 format is invalid
- * @note      none
+ *            - 4 buf is invalid
+ *            - 5 size is invalid
+ *            - 6 segment is invalid
+ *            - 7 be playing or recording
+ * @note      buf must be 4 bytes aligned and dma capable, size must be a multiple of segment * 4
+ *            and not larger than 131070, segment must match the iis layer, 2 for half and complete
  */
-uint8_t wav_player_init(wav_handle_t *handle, char *path)
+uint8_t wav_set_buffer(wav_handle_t *handle, uint8_t *buf, uint32_t size, uint8_t segment)
 {
-    uint8_t buf[72];
-    
-    if (handle == NULL)                                         /* check handle */
+    if (handle == NULL)                                                   /* check handle */
     {
-        return 2;                                               /* return error */
+        return 2;                                                         /* return error */
     }
-    if (handle->inited != 1)                                    /* check handle initialization */
+    if (handle->inited != 1)                                              /* check handle initialization */
     {
-        return 3;                                               /* return error */
+        return 3;                                                         /* return error */
     }
-    
-    handle->pos = 0;                                            /* init 0 */
-    if (handle->audio_init(0, path, &handle->size) != 0)        /* audio init */
+    if ((buf == NULL) || (((size_t)buf & 0x3) != 0))                      /* check buf */
     {
-        handle->debug_print("wav: player failed.\n");           /* player failed */
+        handle->debug_print("wav: buf is invalid.\n");                    /* buf is invalid */
 
-        return 1;                                               /* return error */
+        return 4;                                                         /* return error */
     }
-    if (handle->audio_read(handle->pos, 72, buf) != 0)          /* read header */
+    if ((segment < 2) || (segment > WAV_SEGMENT_MAX))                     /* check segment */
     {
-        handle->debug_print("wav: read failed.\n");             /* read failed */
+        handle->debug_print("wav: segment is invalid.\n");                /* segment is invalid */
 
-        return 1;                                               /* return error */
+        return 6;                                                         /* return error */
     }
-    handle->wav.chunk_id[0] = buf[0];                           /* set chunk id 0 */
-    handle->wav.chunk_id[1] = buf[1];                           /* set chunk id 1 */
-    handle->wav.chunk_id[2] = buf[2];                           /* set chunk id 2 */
-    handle->wav.chunk_id[3] = buf[3];                           /* set chunk id 3 */
-    handle->wav.chunk_size = buf[4] | 
-                             ((uint32_t)(buf[5]) << 8) |
-                             ((uint32_t)(buf[6]) << 16) |
-                             ((uint32_t)(buf[7]) << 24);        /* set chunk size */
-    handle->wav.format[0] = buf[8];                             /* set format 0 */
-    handle->wav.format[1] = buf[9];                             /* set format 1 */
-    handle->wav.format[2] = buf[10];                            /* set format 2 */
-    handle->wav.format[3] = buf[11];                            /* set format 3 */
-    handle->wav.sub_chunk1_id[0] = buf[12];                     /* set sub chunk1 id 0 */
-    handle->wav.sub_chunk1_id[1] = buf[13];                     /* set sub chunk1 id 1 */
-    handle->wav.sub_chunk1_id[2] = buf[14];                     /* set sub chunk1 id 2 */
-    handle->wav.sub_chunk1_id[3] = buf[15];                     /* set sub chunk1 id 3 */
-    handle->wav.sub_chunk1_size = buf[16] | 
-                                 ((uint32_t)(buf[17]) << 8) |
-                                 ((uint32_t)(buf[18]) << 16) |
-                                 ((uint32_t)(buf[19]) << 24);   /* set sub chunk1 size */
-    handle->wav.audio_format = buf[20] | 
-                               ((uint16_t)(buf[21]) << 8);      /* set audio format */
-    handle->wav.num_channel = buf[22] | 
-                               ((uint16_t)(buf[23]) << 8);      /* set num channel */
-    handle->wav.sample_rate = buf[24] | 
-                              ((uint32_t)(buf[25]) << 8) |
-                              ((uint32_t)(buf[26]) << 16) |
-                              ((uint32_t)(buf[27]) << 24);      /* set sample rate */
-    handle->wav.byte_rate = buf[28] | 
-                              ((uint32_t)(buf[29]) << 8) |
-                              ((uint32_t)(buf[30]) << 16) |
-                              ((uint32_t)(buf[31]) << 24);      /* set byte rate */
-    handle->wav.block_align = buf[32] | 
-                              ((uint16_t)(buf[33]) << 8);       /* set block align */
-    handle->wav.bit_per_sample = buf[34] | 
-                                 ((uint16_t)(buf[35]) << 8);    /* set bit per sample */
-    if (buf[36] != 'd')
-    {
-        handle->wav.sub_chunk2_id[0] = buf[38];                 /* set sub chunk2 id 0 */
-        handle->wav.sub_chunk2_id[1] = buf[39];                 /* set sub chunk2 id 1 */
-        handle->wav.sub_chunk2_id[2] = buf[40];                 /* set sub chunk2 id 2 */
-        handle->wav.sub_chunk2_id[3] = buf[41];                 /* set sub chunk2 id 3 */
-        handle->wav.sub_chunk2_size = buf[42] | 
-                               ((uint32_t)(buf[43]) << 8) |
-                               ((uint32_t)(buf[44]) << 16) |
-                               ((uint32_t)(buf[45]) << 24);     /* set sub chunk _size */
-        handle->pos += 44;                                      /* add 44 offset */
-    }
-    else
+    if ((size == 0) || (size > 131070) || 
+        ((size % ((uint32_t)segment * 4)) != 0))                          /* check size */
     {
-        handle->wav.sub_chunk2_id[0] = buf[36];                 /* set sub chunk2 id 0 */
-        handle->wav.sub_chunk2_id[1] = buf[37];                 /* set sub chunk2 id 1 */
-        handle->wav.sub_chunk2_id[2] = buf[38];                 /* set sub chunk2 id 2 */
-        handle->wav.sub_chunk2_id[3] = buf[39];                 /* set sub chunk2 id 3 */
-        handle->wav.sub_chunk2_size = buf[40] | 
-                               ((uint32_t)(buf[41]) << 8) |
-                               ((uint32_t)(buf[42]) << 16) |
-                               ((uint32_t)(buf[43]) << 24);     /* set sub chunk _size */
-        handle->pos += 44;                                      /* add 44 offset */
+        handle->debug_print("wav: size is invalid.\n");                   /* size is invalid */
+
+        return 5;                                                         /* return error */
     }
-    if (handle->wav.chunk_id[0] != 'R' ||
-        handle->wav.chunk_id[1] != 'I' ||
-        handle->wav.chunk_id[2] != 'F' ||
-        handle->wav.chunk_id[3] != 'F')                         /* check chunk id */
+    if (handle->status != 0)                                              /* check status */
     {
-        handle->debug_print("wav: format is invalid.\n");       /* format is invalid */
+        handle->debug_print("wav: be playing or recording.\n");           /* be playing or recording */
 
-        return 4;                                               /* return error */
+        return 7;                                                         /* return error */
+    }
+    
+    handle->buf = buf;                                                    /* set buffer */
+    handle->buf_size = size;                                              /* set buffer size */
+    handle->segment = segment;                                            /* set segment number */
+    handle->segment_size = size / segment;                                /* set segment size */
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief     set the record pre trigger ring
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] *ring pointer to a ring buffer, NULL disables the pre trigger mode
+ * @param[in] size ring size in bytes
+ * @param[in] level trigger peak level, 0 means only wav_record_trigger fires
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 buffer is not set
+ *            - 5 size is invalid
+ *            - 6 be recording
+ * @note      size must be a multiple of the segment size and sets the pre roll,
+ *            e.g. 2s at 22050Hz stereo 16 bits is 2 * 88200 bytes rounded to segments,
+ *            the file is opened by wav_record_start and no audio data is written until the trigger fires
+ */
+uint8_t wav_record_set_pretrigger(wav_handle_t *handle, uint8_t *ring, uint32_t size, uint16_t level)
+{
+    if (handle == NULL)                                                   /* check handle */
+    {
+        return 2;                                                         /* return error */
+    }
+    if (handle->inited != 1)                                              /* check handle initialization */
+    {
+        return 3;                                                         /* return error */
     }
-    if (handle->wav.format[0] != 'W' ||
-        handle->wav.format[1] != 'A' ||
-        handle->wav.format[2] != 'V' ||
-        handle->wav.format[3] != 'E')                           /* check format */
+    if (handle->buf == NULL)                                              /* check buffer */
     {
-        handle->debug_print("wav: format is invalid.\n");       /* format is invalid */
+        handle->debug_print("wav: buffer is not set.\n");                 /* buffer is not set */
 
-        return 4;                                               /* return error */
+        return 4;                                                         /* return error */
     }
-    if (handle->wav.sub_chunk1_id[0] != 'f' ||
-        handle->wav.sub_chunk1_id[1] != 'm' ||
-        handle->wav.sub_chunk1_id[2] != 't' ||
-        handle->wav.sub_chunk1_id[3] != ' ')                    /* check sub chunk1 id */
+    if (handle->status != 0)                                              /* check status */
     {
-        handle->debug_print("wav: format is invalid.\n");       /* format is invalid */
+        handle->debug_print("wav: be recording.\n");                      /* be recording */
 
-        return 4;                                               /* return error */
+        return 6;                                                         /* return error */
+    }
+    if (ring == NULL)                                                     /* disable */
+    {
+        handle->ring = NULL;                                              /* clear ring */
+        handle->ring_count = 0;                                           /* init 0 */
+        handle->trigger_level = 0;                                        /* init 0 */
+        
+        return 0;                                                         /* success return 0 */
     }
-    if (handle->wav.sub_chunk2_id[0] != 'd' ||
-        handle->wav.sub_chunk2_id[1] != 'a' ||
-        handle->wav.sub_chunk2_id[2] != 't' ||
-        handle->wav.sub_chunk2_id[3] != 'a')                    /* check sub chunk2 id */
+    if ((size < handle->segment_size) || 
+        ((size % handle->segment_size) != 0))                             /* check size */
     {
-        handle->debug_print("wav: format is invalid.\n");       /* format is invalid */
+        handle->debug_print("wav: size is invalid.\n");                   /* size is invalid */
 
-        return 4;                                               /* return error */
+        return 5;                                                         /* return error */
     }
     
-    return 0;                                                   /* success return 0 */
+    handle->ring = ring;                                                  /* set ring */
+    handle->ring_count = size / handle->segment_size;                     /* set segment number */
+    handle->trigger_level = level;                                        /* set level */
+    
+    return 0;                                                             /* success return 0 */
 }
 
 /**
- * @brief     wav player config
+ * @brief     fire the record trigger
  * @param[in] *handle pointer to a wav handle structure
- * @param[in] standard iis standard
- * @param[in] mode iis mode
- * @param[in] polarity iis polarity
- * @param[in] format iis format
- * @param[in] enable mclk output
- * @param[in] freq set freq
  * @return    status code
  *            - 0 success
- *            - 1 config failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 not recording
+ *            - 5 pre trigger is not set
+ * @note      the pre roll is written first, then the live data
  */
-uint8_t wav_player_config(wav_handle_t *handle, uint32_t standard, 
-                          uint32_t mode, uint32_t polarity, 
-                          uint32_t format, uint32_t enable, uint32_t freq)
+uint8_t wav_record_trigger(wav_handle_t *handle)
 {
-    if (handle == NULL)                                                         /* check handle */
+    if (handle == NULL)                                                   /* check handle */
     {
-        return 2;                                                               /* return error */
+        return 2;                                                         /* return error */
     }
-    if (handle->inited != 1)                                                    /* check handle initialization */
+    if (handle->inited != 1)                                              /* check handle initialization */
     {
-        return 3;                                                               /* return error */
+        return 3;                                                         /* return error */
     }
-    
-    if (handle->iis_set_freq(freq) != 0)                                        /* set freq */
+    if (handle->status != 1)                                              /* check status */
     {
-        handle->debug_print("wav: set freq failed.\n");                         /* set freq failed */
+        handle->debug_print("wav: not recording.\n");                     /* not recording */
 
-        return 1;                                                               /* return error */
+        return 4;                                                         /* return error */
     }
-    if (handle->iis_init(standard, mode, polarity, format, enable, freq) != 0)  /* iis init */
+    if (handle->ring == NULL)                                             /* check ring */
     {
-        handle->debug_print("wav: config failed.\n");                           /* config failed */
+        handle->debug_print("wav: pre trigger is not set.\n");            /* pre trigger is not set */
 
-        return 1;                                                               /* return error */
+        return 5;                                                         /* return error */
     }
     
-    return 0;                                                                   /* success return 0 */
+    handle->triggered = 1;                                                /* fire */
+    
+    return 0;                                                             /* success return 0 */
 }
 
 /**
- * @brief     wav player start
+ * @brief      get the record trigger status
+ * @param[in]  *handle pointer to a wav handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wav_record_get_trigger(wav_handle_t *handle, wav_bool_t *enable)
+{
+    if (handle == NULL)                                   /* check handle */
+    {
+        return 2;                                         /* return error */
+    }
+    if (handle->inited != 1)                              /* check handle initialization */
+    {
+        return 3;                                         /* return error */
+    }
+    
+    *enable = (wav_bool_t)(handle->triggered);            /* get triggered */
+    
+    return 0;                                             /* success return 0 */
+}
+
+/**
+ * @brief     set the record header checkpoint
  * @param[in] *handle pointer to a wav handle structure
+ * @param[in] second checkpoint period in seconds, 0 disables it
  * @return    status code
  *            - 0 success
- *            - 1 start failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 be playing
- * @note      none
+ * @note      every period the riff and data sizes are rewritten with one 80 bytes header write
+ *            from the fill, so a file cut by a power loss opens with at most one period missing,
+ *            the audio_write interface should commit the header write to the medium
  */
-uint8_t wav_player_start(wav_handle_t *handle)
+uint8_t wav_record_set_checkpoint(wav_handle_t *handle, uint32_t second)
 {
-    if (handle == NULL)                                                              /* check handle */
+    if (handle == NULL)                        /* check handle */
     {
-        return 2;                                                                    /* return error */
+        return 2;                              /* return error */
     }
-    if (handle->inited != 1)                                                         /* check handle initialization */
+    if (handle->inited != 1)                   /* check handle initialization */
     {
-        return 3;                                                                    /* return error */
+        return 3;                              /* return error */
     }
-    if (handle->status != 0)                                                         /* check status */
-    {
-        handle->debug_print("wav: be playing.\n");                                   /* be playing */
+    
+    handle->checkpoint_second = second;        /* set checkpoint period */
+    
+    return 0;                                  /* success return 0 */
+}
 
-        return 4;                                                                    /* return error */
+/**
+ * @brief     set the record file pre allocation
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] second expected record length in seconds, 0 disables it
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the size is passed to audio_init as a hint when the record file is opened,
+ *            the file is cut to its real length at the stop with the audio_truncate link
+ */
+uint8_t wav_record_set_preallocate(wav_handle_t *handle, uint32_t second)
+{
+    if (handle == NULL)                              /* check handle */
+    {
+        return 2;                                    /* return error */
     }
-    
-    if (handle->audio_read(handle->pos, WAV_BUFFER_SIZE, handle->buf) != 0)          /* read data */
+    if (handle->inited != 1)                         /* check handle initialization */
     {
-        handle->debug_print("wav: read failed\n");                                   /* read failed */
+        return 3;                                    /* return error */
+    }
+    
+    handle->prealloc_second = second;                /* set pre allocation */
+    
+    return 0;                                        /* success return 0 */
+}
 
-        return 1;                                                                    /* return error */
+/**
+ * @brief      get the streaming health counters
+ * @param[in]  *handle pointer to a wav handle structure
+ * @param[out] *health pointer to a wav health structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       max_fill_us and min_slack_us need the timestamp_us link
+ */
+uint8_t wav_get_health(wav_handle_t *handle, wav_health_t *health)
+{
+    uint32_t seq;
+    
+    if (handle == NULL)                                                   /* check handle */
+    {
+        return 2;                                                         /* return error */
     }
-    if (handle->iis_write((uint16_t *)handle->buf, WAV_BUFFER_SIZE / 2) != 0)        /* write data */
+    if (handle->inited != 1)                                              /* check handle initialization */
     {
-        handle->debug_print("wav: iis write failed\n");                              /* iis write failed */
-
-        return 1;                                                                    /* return error */
+        return 3;                                                         /* return error */
     }
-    handle->pos += WAV_BUFFER_SIZE;                                                  /* add pos */
-    handle->status = 1;                                                              /* set status */
     
-    return 0;                                                                        /* success return 0 */
+    do
+    {
+        seq = handle->health_sequence;                                    /* get sequence */
+        health->fill = handle->health.fill;                               /* get fill */
+        health->underrun = handle->health.underrun;                       /* get underrun */
+        health->overrun = handle->health.overrun;                         /* get overrun */
+        health->late = handle->health.late;                               /* get late */
+        health->max_fill_us = handle->health.max_fill_us;                 /* get max fill time */
+        health->min_slack_us = handle->health.min_slack_us;               /* get min slack */
+    } while (((seq & 1) != 0) || (seq != handle->health_sequence));       /* retry if updated */
+    
+    return 0;                                                             /* success return 0 */
 }
 
 /**
- * @brief     wav record start
+ * @brief     clear the streaming health counters
  * @param[in] *handle pointer to a wav handle structure
- * @param[in] sample_rate sample rate
- * @param[in] *path pointer to a path buffer
  * @return    status code
  *            - 0 success
- *            - 1 start failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 be recording
- * @note      none
+ * @note      while streaming the counters are cleared by the next fill
  */
-uint8_t wav_record_start(wav_handle_t *handle, uint32_t sample_rate, char *path)
+uint8_t wav_clear_health(wav_handle_t *handle)
 {
-    if (handle == NULL)                                                /* check handle */
-    {
-        return 2;                                                      /* return error */
-    }
-    if (handle->inited != 1)                                           /* check handle initialization */
+    if (handle == NULL)                                                   /* check handle */
     {
-        return 3;                                                      /* return error */
+        return 2;                                                         /* return error */
     }
-    if (handle->status != 0)                                           /* check status */
+    if (handle->inited != 1)                                              /* check handle initialization */
     {
-        handle->debug_print("wav: be recording.\n");                   /* be recording */
-
-        return 4;                                                      /* return error */
+        return 3;                                                         /* return error */
     }
     
-    handle->pos = 0;                                                   /* init 0 */
-    if (handle->audio_init(1, path, &handle->size) != 0)               /* audio init */
-    {
-        handle->debug_print("wav: record failed.\n");                  /* record failed */
-
-        return 1;                                                      /* return error */
-    }
-    handle->wav.chunk_id[0] = 'R';                                     /* R */
-    handle->wav.chunk_id[1] = 'I';                                     /* I */
-    handle->wav.chunk_id[2] = 'F';                                     /* F */
-    handle->wav.chunk_id[3] = 'F';                                     /* F */
-    handle->wav.chunk_size = 0x00000000;                               /* init 0 */
-    handle->wav.format[0] = 'W';                                       /* W */
-    handle->wav.format[1] = 'A';                                       /* A */
-    handle->wav.format[2] = 'V';                                       /* V */
-    handle->wav.format[3] = 'E';                                       /* E */
-    handle->wav.sub_chunk1_id[0] = 'f';                                /* f */
-    handle->wav.sub_chunk1_id[1] = 'm';                                /* m */
-    handle->wav.sub_chunk1_id[2] = 't';                                /* t */
-    handle->wav.sub_chunk1_id[3] = 0x20;                               /* 0x20 */
-    handle->wav.sub_chunk1_size = 16;                                  /* 16 bytes */
-    handle->wav.audio_format = 0x01;                                   /* pcm */
-    handle->wav.num_channel = 2;                                       /* 2 channel */
-    handle->wav.sample_rate = sample_rate;                             /* set sample rate */
-    handle->wav.byte_rate = handle->wav.sample_rate * 4;               /* 4 times */
-    handle->wav.block_align = 4;                                       /* 4 bytes */
-    handle->wav.bit_per_sample = 16;                                   /* 16 bits */
-    handle->wav.sub_chunk2_id[0] = 'd';                                /* d */
-    handle->wav.sub_chunk2_id[1] = 'a';                                /* a */
-    handle->wav.sub_chunk2_id[2] = 't';                                /* t */
-    handle->wav.sub_chunk2_id[3] = 'a';                                /* a */
-    handle->wav.sub_chunk2_size = 0x00000000;                          /* init 0 */
-    if (a_wav_write_wav_header(handle) != 0)                           /* write header */
+    if (handle->status != 0)                                              /* streaming */
     {
-        handle->debug_print("wav: write header failed.\n");            /* write header failed */
-
-        return 1;                                                      /* return error */
+        handle->health_clear = 1;                                         /* request clear */
     }
-    if (handle->iis_read((uint16_t *)handle->buf, 
-                         WAV_BUFFER_SIZE / 2) != 0)                    /* read data */
+    else
     {
-        handle->debug_print("wav: iis read failed\n");                 /* iis read failed */
-
-        return 1;                                                      /* return error */
+        a_wav_health_reset(handle, 0, 0);                                 /* clear now */
     }
-    handle->status = 1;                                                /* set status */
     
-    return 0;                                                          /* success return 0 */
+    return 0;                                                             /* success return 0 */
 }
 
 /**
- * @brief     wav record file fill
+ * @brief     enable or disable the level meter
  * @param[in] *handle pointer to a wav handle structure
- * @param[in] index fill index
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 fill failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 not recording
- * @note      none
+ * @note      the meter works on 16 bits pcm blocks in wav_player_buffer_fill and wav_record_file_fill
  */
-uint8_t wav_record_file_fill(wav_handle_t *handle, uint8_t index)
+uint8_t wav_set_meter(wav_handle_t *handle, wav_bool_t enable)
 {
-    if (handle == NULL)                                                                  /* check handle */
+    if (handle == NULL)                             /* check handle */
     {
-        return 2;                                                                        /* return error */
+        return 2;                                   /* return error */
     }
-    if (handle->inited != 1)                                                             /* check handle initialization */
+    if (handle->inited != 1)                        /* check handle initialization */
     {
-        return 3;                                                                        /* return error */
+        return 3;                                   /* return error */
     }
-    if (handle->status != 1)                                                             /* check status */
-    {
-        handle->debug_print("wav: not recording.\n");                                    /* not recording */
+    
+    handle->meter_enable = (uint8_t)enable;         /* set meter */
+    
+    return 0;                                       /* success return 0 */
+}
 
-        return 4;                                                                        /* return error */
-    }
+/**
+ * @brief      get the latest level meter snapshot
+ * @param[in]  *handle pointer to a wav handle structure
+ * @param[out] *meter pointer to a wav meter structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       lock free, it can be called from the main loop while the dma callback updates the meter
+ */
+uint8_t wav_get_meter(wav_handle_t *handle, wav_meter_t *meter)
+{
+    uint32_t seq;
     
-    if (index != 0)                                                                      /* buffer 1 */
+    if (handle == NULL)                                         /* check handle */
     {
-        if (handle->audio_write(handle->pos, WAV_BUFFER_SIZE / 2, 
-                                handle->buf + WAV_BUFFER_SIZE / 2) != 0)                 /* write data */
-        {
-            handle->debug_print("wav: write failed\n");                                  /* write failed */
-
-            return 1;                                                                    /* return error */
-        }
-        handle->pos += WAV_BUFFER_SIZE / 2;                                              /* add pos */
+        return 2;                                               /* return error */
     }
-    else                                                                                 /* buffer 0 */
+    if (handle->inited != 1)                                    /* check handle initialization */
     {
-        if (handle->audio_write(handle->pos, WAV_BUFFER_SIZE / 2, handle->buf) != 0)     /* write data */
-        {
-            handle->debug_print("wav: write failed\n");                                  /* write failed */
-
-            return 1;                                                                    /* return error */
-        }
-        handle->pos += WAV_BUFFER_SIZE / 2;                                              /* add pos */
+        return 3;                                               /* return error */
     }
     
-    return 0;                                                                            /* success return 0 */
+    do
+    {
+        seq = handle->meter_sequence;                           /* get sequence */
+        meter->block = handle->meter.block;                     /* get block */
+        meter->peak[0] = handle->meter.peak[0];                 /* get left peak */
+        meter->peak[1] = handle->meter.peak[1];                 /* get right peak */
+        meter->rms[0] = handle->meter.rms[0];                   /* get left rms */
+        meter->rms[1] = handle->meter.rms[1];                   /* get right rms */
+        meter->clip[0] = handle->meter.clip[0];                 /* get left clip */
+        meter->clip[1] = handle->meter.clip[1];                 /* get right clip */
+    } while (((seq & 1) != 0) || (seq != handle->meter_sequence));      /* retry if updated */
+    
+    return 0;                                                   /* success return 0 */
 }
 
 /**
- * @brief     wav record stop
+ * @brief     set a pushed pcm stream as the player source
  * @param[in] *handle pointer to a wav handle structure
+ * @param[in] *ring pointer to a jitter ring buffer
+ * @param[in] size ring size in bytes
+ * @param[in] sample_rate sample rate
+ * @param[in] num_channel channel number, 1 or 2
+ * @param[in] target_ms target depth in ms
  * @return    status code
  *            - 0 success
- *            - 1 stop failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 not recording
- * @note      none
+ *            - 4 buffer is not set
+ *            - 5 ring is invalid
+ *            - 6 format is invalid
+ *            - 7 target is invalid
+ *            - 8 be playing
+ * @note      the stream is 16 bits little endian pcm and replaces wav_player_init,
+ *            ring must be 4 bytes aligned with a size of a multiple of 4,
+ *            the target is raised to one segment plus the fade if it is smaller,
+ *            it must leave at least one segment free in the ring
  */
-uint8_t wav_record_stop(wav_handle_t *handle)
+uint8_t wav_stream_init(wav_handle_t *handle, uint8_t *ring, uint32_t size, 
+                        uint32_t sample_rate, uint16_t num_channel, uint16_t target_ms)
 {
-    if (handle == NULL)                                            /* check handle */
+    uint32_t target;
+    uint32_t block_align;
+    
+    if (handle == NULL)                                                                 /* check handle */
     {
-        return 2;                                                  /* return error */
+        return 2;                                                                       /* return error */
     }
-    if (handle->inited != 1)                                       /* check handle initialization */
+    if (handle->inited != 1)                                                            /* check handle initialization */
     {
-        return 3;                                                  /* return error */
+        return 3;                                                                       /* return error */
     }
-    if (handle->status != 1)                                       /* check status */
+    if (handle->buf == NULL)                                                            /* check buffer */
     {
-        handle->debug_print("wav: not recording.\n");              /* not recording */
+        handle->debug_print("wav: buffer is not set.\n");                               /* buffer is not set */
 
-        return 4;                                                  /* return error */
+        return 4;                                                                       /* return error */
     }
-    
-    if (handle->iis_stop() != 0)                                   /* iis stop */
+    if ((ring == NULL) || (((size_t)ring & 0x3) != 0) || 
+        (size == 0) || ((size % 4) != 0))                                               /* check ring */
     {
-        handle->debug_print("wav: iis stop failed.\n");            /* iis stop failed */
+        handle->debug_print("wav: ring is invalid.\n");                                 /* ring is invalid */
 
-        return 1;                                                  /* return error */
+        return 5;                                                                       /* return error */
     }
-    handle->wav.chunk_size = handle->pos - 44 + 36;                /* set chunk size */
-    handle->wav.sub_chunk2_size = handle->pos - 44;                /* set sub chunk2 size */
-    if (a_wav_write_wav_header(handle) != 0)                       /* write header */
+    if ((sample_rate == 0) || (num_channel == 0) || (num_channel > 2))                  /* check format */
     {
-        handle->debug_print("wav: write header failed.\n");        /* write header failed */
+        handle->debug_print("wav: format is invalid.\n");                               /* format is invalid */
 
-        return 1;                                                  /* return error */
+        return 6;                                                                       /* return error */
     }
-    if (handle->iis_deinit() != 0)                                 /* iis deinit */
+    block_align = (uint32_t)num_channel * 2;                                            /* 16 bits frames */
+    target = (uint32_t)((uint64_t)sample_rate * target_ms / 1000) * block_align;        /* target in bytes */
+    if (target < handle->segment_size + WAV_STREAM_FADE_FRAMES * block_align)           /* check the min */
     {
-        handle->debug_print("wav: iis deinit failed.\n");          /* iis deinit failed */
+        target = handle->segment_size + WAV_STREAM_FADE_FRAMES * block_align;           /* raise the target */
+    }
+    if (target + handle->segment_size > size)                                           /* check the room */
+    {
+        handle->debug_print("wav: target is invalid.\n");                               /* target is invalid */
 
-        return 1;                                                  /* return error */
+        return 7;                                                                       /* return error */
     }
-    if (handle->audio_deinit() != 0)                               /* audio deinit */
+    if (handle->status != 0)                                                            /* check status */
     {
-        handle->debug_print("wav: audio deinit failed.\n");        /* audio deinit failed */
+        handle->debug_print("wav: be playing.\n");                                      /* be playing */
 
-        return 1;                                                  /* return error */
+        return 8;                                                                       /* return error */
     }
-    handle->status = 0;                                            /* stop */
     
-    return 0;                                                      /* success return 0 */
+    memset(&handle->wav, 0, sizeof(wav_header_t));                                      /* clear the header */
+    handle->wav.audio_format = 0x01;                                                    /* pcm */
+    handle->wav.num_channel = num_channel;                                              /* set num channel */
+    handle->wav.sample_rate = sample_rate;                                              /* set sample rate */
+    handle->wav.byte_rate = sample_rate * block_align;                                  /* set byte rate */
+    handle->wav.block_align = (uint16_t)block_align;                                    /* set block align */
+    handle->wav.bit_per_sample = 16;                                                    /* 16 bits */
+    handle->pos = 0;                                                                    /* init 0 */
+    handle->size = 0;                                                                   /* init 0 */
+    handle->source = WAV_SOURCE_STREAM;                                                 /* stream source */
+    handle->stream = ring;                                                              /* set ring */
+    handle->stream_size = size;                                                         /* set ring size */
+    handle->stream_wr = 0;                                                              /* init 0 */
+    handle->stream_rd = 0;                                                              /* init 0 */
+    handle->stream_in = 0;                                                              /* init 0 */
+    handle->stream_out = 0;                                                             /* init 0 */
+    handle->stream_target = target;                                                     /* set target */
+    handle->stream_target_min = target;                                                 /* set min target */
+    handle->stream_good = 0;                                                            /* init 0 */
+    handle->stream_seq = 0;                                                             /* init 0 */
+    handle->stream_seq_valid = 0;                                                       /* no packet yet */
+    handle->stream_run = 0;                                                             /* buffering */
+    handle->stream_fade_in = 0;                                                         /* init 0 */
+    memset((void *)&handle->jitter, 0, sizeof(wav_jitter_t));                           /* clear the counters */
+    
+    return 0;                                                                           /* success return 0 */
 }
 
 /**
- * @brief     wav player stop
+ * @brief     push one pcm packet into the stream
  * @param[in] *handle pointer to a wav handle structure
+ * @param[in] seq packet sequence number
+ * @param[in] *buf pointer to a pcm buffer
+ * @param[in] len buffer length in bytes
  * @return    status code
  *            - 0 success
- *            - 1 stop failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 not playing
- * @note      none
+ *            - 4 stream is not set
+ *            - 5 len is invalid
+ *            - 6 packet is late
+ *            - 7 ring is full
+ * @note      len must be a multiple of the frame size, a sequence gap is counted as lost,
+ *            a sequence older than the last one is late and dropped,
+ *            push runs in one context and wav_player_buffer_fill in another without a lock
  */
-uint8_t wav_player_stop(wav_handle_t *handle)
+uint8_t wav_stream_push(wav_handle_t *handle, uint16_t seq, const uint8_t *buf, uint32_t len)
 {
-    if (handle == NULL)                                            /* check handle */
+    uint32_t first;
+    int16_t gap;
+    
+    if (handle == NULL)                                                               /* check handle */
     {
-        return 2;                                                  /* return error */
+        return 2;                                                                     /* return error */
     }
-    if (handle->inited != 1)                                       /* check handle initialization */
+    if (handle->inited != 1)                                                          /* check handle initialization */
     {
-        return 3;                                                  /* return error */
+        return 3;                                                                     /* return error */
     }
-    if (handle->status != 1)                                       /* check status */
+    if (handle->source != WAV_SOURCE_STREAM)                                          /* check stream */
     {
-        handle->debug_print("wav: not playing.\n");                /* not playing */
+        handle->debug_print("wav: stream is not set.\n");                             /* stream is not set */
 
-        return 4;                                                  /* return error */
+        return 4;                                                                     /* return error */
     }
-    
-    if (handle->iis_stop() != 0)                                   /* iis stop */
+    if ((buf == NULL) || (len == 0) || ((len % handle->wav.block_align) != 0))        /* check len */
     {
-        handle->debug_print("wav: iis stop failed.\n");            /* iis stop failed */
+        handle->debug_print("wav: len is invalid.\n");                                /* len is invalid */
 
-        return 1;                                                  /* return error */
+        return 5;                                                                     /* return error */
     }
-    if (handle->iis_deinit() != 0)                                 /* iis deinit */
+    
+    handle->jitter_sequence++;                                                        /* odd, writing */
+    if (handle->stream_seq_valid != 0)                                                /* check sequence */
     {
-        handle->debug_print("wav: iis deinit failed.\n");          /* iis deinit failed */
-
-        return 1;                                                  /* return error */
+        gap = (int16_t)(uint16_t)(seq - handle->stream_seq);                          /* sequence gap */
+        if (gap < 0)                                                                  /* older packet */
+        {
+            handle->jitter.late++;                                                    /* late++ */
+            handle->jitter_sequence++;                                                /* even, done */
+            
+            return 6;                                                                 /* return error */
+        }
+        handle->jitter.lost += (uint32_t)gap;                                         /* missing packets */
     }
-    if (handle->audio_deinit() != 0)                               /* audio deinit */
+    handle->stream_seq = (uint16_t)(seq + 1);                                         /* next expected */
+    handle->stream_seq_valid = 1;                                                     /* sequence valid */
+    if (len > handle->stream_size - (handle->stream_in - handle->stream_out))         /* check free */
     {
-        handle->debug_print("wav: audio deinit failed.\n");        /* audio deinit failed */
-
-        return 1;                                                  /* return error */
+        handle->jitter.overflow++;                                                    /* overflow++ */
+        handle->jitter_sequence++;                                                    /* even, done */
+        
+        return 7;                                                                     /* return error */
     }
-    handle->status = 0;                                            /* stop */
+    first = handle->stream_size - handle->stream_wr;                                  /* bytes before the end */
+    if (first > len)                                                                  /* check the wrap */
+    {
+        first = len;                                                                  /* no wrap */
+    }
+    memcpy(handle->stream + handle->stream_wr, buf, first);                           /* copy the first part */
+    memcpy(handle->stream, buf + first, len - first);                                 /* copy the wrapped part */
+    handle->stream_wr = (handle->stream_wr + len) % handle->stream_size;              /* next write index */
+    handle->stream_in += len;                                                         /* publish the bytes */
+    handle->jitter.packet++;                                                          /* packet++ */
+    handle->jitter_sequence++;                                                        /* even, done */
     
-    return 0;                                                      /* success return 0 */
+    return 0;                                                                         /* success return 0 */
 }
 
 /**
- * @brief     wav player pause
- * @param[in] *handle pointer to a wav handle structure
- * @return    status code
- *            - 0 success
- *            - 1 pause failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- *            - 4 not playing
- * @note      none
+ * @brief      get the jitter buffer counters
+ * @param[in]  *handle pointer to a wav handle structure
+ * @param[out] *jitter pointer to a wav jitter structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 stream is not set
+ * @note       depth is the fill level, it can feed a clock drift estimator,
+ *             the read is retried while the push or a fill updates the counters
  */
-uint8_t wav_player_pause(wav_handle_t *handle)
+uint8_t wav_stream_get_jitter(wav_handle_t *handle, wav_jitter_t *jitter)
 {
+    uint32_t seq;
+    
     if (handle == NULL)                                            /* check handle */
     {
         return 2;                                                  /* return error */
@@ -728,169 +3202,110 @@ uint8_t wav_player_pause(wav_handle_t *handle)
     {
         return 3;                                                  /* return error */
     }
-    if (handle->status != 1)                                       /* check status */
+    if (handle->source != WAV_SOURCE_STREAM)                       /* check stream */
     {
-        handle->debug_print("wav: not playing.\n");                /* not playing */
+        handle->debug_print("wav: stream is not set.\n");          /* stream is not set */
 
         return 4;                                                  /* return error */
     }
     
-    if (handle->iis_pause() != 0)                                  /* iis pause */
-    {
-        handle->debug_print("wav: iis pause failed.\n");           /* iis pause failed */
-
-        return 1;                                                  /* return error */
-    }
+    do
+    {
+        seq = handle->jitter_sequence;                                 /* get sequence */
+        jitter->packet = handle->jitter.packet;                        /* get packet */
+        jitter->late = handle->jitter.late;                            /* get late */
+        jitter->lost = handle->jitter.lost;                            /* get lost */
+        jitter->overflow = handle->jitter.overflow;                    /* get overflow */
+        jitter->underrun = handle->jitter.underrun;                    /* get underrun */
+        jitter->drop = handle->jitter.drop;                            /* get drop */
+        jitter->depth = handle->stream_in - handle->stream_out;        /* get depth */
+        jitter->target = handle->stream_target;                        /* get target */
+    } while (((seq & 1) != 0) || (seq != handle->jitter_sequence));    /* retry if updated */
     
     return 0;                                                      /* success return 0 */
 }
 
 /**
- * @brief     wav player resume
+ * @brief     enable or disable the fast start
  * @param[in] *handle pointer to a wav handle structure
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 resume failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 be playing
- * @note      none
+ * @note      the main loop must call wav_player_service until it reports primed,
+ *            each segment must be read faster than the dma plays one
  */
-uint8_t wav_player_resume(wav_handle_t *handle)
+uint8_t wav_player_set_fast_start(wav_handle_t *handle, wav_bool_t enable)
 {
-    if (handle == NULL)                                            /* check handle */
+    if (handle == NULL)                             /* check handle */
     {
-        return 2;                                                  /* return error */
-    }
-    if (handle->inited != 1)                                       /* check handle initialization */
-    {
-        return 3;                                                  /* return error */
+        return 2;                                   /* return error */
     }
-    if (handle->status != 0)                                       /* check status */
+    if (handle->inited != 1)                        /* check handle initialization */
     {
-        handle->debug_print("wav: be playing.\n");                 /* be playing */
-
-        return 4;                                                  /* return error */
+        return 3;                                   /* return error */
     }
     
-    if (handle->iis_pause() != 0)                                  /* iis pause */
-    {
-        handle->debug_print("wav: iis pause failed.\n");           /* iis pause failed */
-
-        return 1;                                                  /* return error */
-    }
+    handle->fast_start = (uint8_t)enable;           /* set fast start */
     
-    return 0;                                                      /* success return 0 */
+    return 0;                                       /* success return 0 */
 }
 
 /**
- * @brief      wav get status
+ * @brief      get the start timing of the last wav_player_start
  * @param[in]  *handle pointer to a wav handle structure
- * @param[out] *status pointer to a status buffer
+ * @param[out] *first_us pointer to a first sample time buffer
+ * @param[out] *primed_us pointer to a primed time buffer
  * @return     status code
  *             - 0 success
- *             - 1 get status failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       first_us is from the call to the dma start, primed_us until the whole buffer is read,
+ *             with fast start until the fills take over, both need the timestamp_us link
  */
-uint8_t wav_player_get_status(wav_handle_t *handle, wav_status_t *status)
+uint8_t wav_player_get_start_time(wav_handle_t *handle, uint32_t *first_us, uint32_t *primed_us)
 {
-    if (handle == NULL)                              /* check handle */
+    if (handle == NULL)                                   /* check handle */
     {
-        return 2;                                    /* return error */
+        return 2;                                         /* return error */
     }
-    if (handle->inited != 1)                         /* check handle initialization */
+    if (handle->inited != 1)                              /* check handle initialization */
     {
-        return 3;                                    /* return error */
+        return 3;                                         /* return error */
     }
     
-    *status = (wav_status_t)(handle->status);        /* get status */
+    *first_us = handle->start_first_us;                   /* get first sample time */
+    *primed_us = handle->start_primed_us;                 /* get primed time */
     
-    return 0;                                        /* success return 0 */
+    return 0;                                             /* success return 0 */
 }
 
 /**
- * @brief     wav player buffer fill
+ * @brief     set the end of play callback
  * @param[in] *handle pointer to a wav handle structure
- * @param[in] index fill index
+ * @param[in] *end_callback pointer to an end callback, NULL disables it
  * @return    status code
  *            - 0 success
- *            - 1 fill failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 not playing
- * @note      none
+ * @note      the callback runs after the last valid sample has been played and the iis is stopped,
+ *            from wav_player_service within one poll when the iis_get_remain link is set,
+ *            otherwise from the dma callback once the segment holding it is released,
+ *            up to one segment period later, it is not called by wav_player_stop
  */
-uint8_t wav_player_buffer_fill(wav_handle_t *handle, uint8_t index)
+uint8_t wav_player_set_end_callback(wav_handle_t *handle, void (*end_callback)(void))
 {
-    if (handle == NULL)                                                                  /* check handle */
-    {
-        return 2;                                                                        /* return error */
-    }
-    if (handle->inited != 1)                                                             /* check handle initialization */
+    if (handle == NULL)                         /* check handle */
     {
-        return 3;                                                                        /* return error */
+        return 2;                               /* return error */
     }
-    if (handle->status != 1)                                                             /* check status */
+    if (handle->inited != 1)                    /* check handle initialization */
     {
-        handle->debug_print("wav: not playing.\n");                                      /* not playing */
-
-        return 4;                                                                        /* return error */
+        return 3;                               /* return error */
     }
     
-    if (handle->pos > handle->size)                                                      /* check pos */
-    {
-        if (handle->iis_stop() != 0)                                                     /* iis stop */
-        {
-            handle->debug_print("wav: iis stop failed.\n");                              /* iis stop failed */
-
-            return 1;                                                                    /* return error */
-        }
-        if (handle->audio_deinit() != 0)                                                 /* audio deinit */
-        {
-            handle->debug_print("wav: audio deinit failed.\n");                          /* audio deinit failed */
-
-            return 1;                                                                    /* return error */
-        }
-        handle->status = 0;                                                              /* stop */
-        handle->debug_print("wav: play end.\n");                                         /* play end */
-        
-        return 0;                                                                        /* success return 0 */
-    }
-    if (index != 0)                                                                      /* buffer 1 */
-    {
-        if (handle->audio_read(handle->pos, WAV_BUFFER_SIZE / 2, 
-                               handle->buf + WAV_BUFFER_SIZE / 2) != 0)                  /* read data */
-        {
-            handle->debug_print("wav: read failed\n");                                   /* read failed */
-
-            return 1;                                                                    /* return error */
-        }
-        handle->pos += WAV_BUFFER_SIZE / 2;                                              /* add pos */
-        if (handle->pos > handle->size)                                                  /* if oversize */
-        {
-            uint32_t diff = handle->pos - handle->size;                                  /* get over part */
-            
-            memset(handle->buf + WAV_BUFFER_SIZE - diff, 0, diff);                       /* set all 0 */
-        }
-    }
-    else                                                                                 /* buffer 0 */
-    {
-        if (handle->audio_read(handle->pos, WAV_BUFFER_SIZE / 2, handle->buf) != 0)      /* read data */
-        {
-            handle->debug_print("wav: read failed\n");                                   /* read failed */
-
-            return 1;                                                                    /* return error */
-        }
-        handle->pos += WAV_BUFFER_SIZE / 2;                                              /* add pos */
-        if (handle->pos > handle->size)                                                  /* if oversize */
-        {
-            uint32_t diff = handle->pos - handle->size;                                  /* get over part */
-            
-            memset(handle->buf + WAV_BUFFER_SIZE / 2 - diff, 0, diff);                   /* set all 0 */
-        }
-    }
+    handle->end_callback = end_callback;        /* set end callback */
     
-    return 0;                                                                            /* success return 0 */
+    return 0;                                   /* success return 0 */
 }
@@ -54,20 +54,117 @@ extern "C"{
 
 /**
  * @brief wav buffer size definition
+ * @note  default size of the caller supplied buffer
  */
 #ifndef WAV_BUFFER_SIZE
     #define WAV_BUFFER_SIZE  (1024 * 32)
 #endif
 
+/**
+ * @brief wav buffer segment definition
+ * @note  default number of dma callbacks per buffer cycle, half and complete
+ */
+#ifndef WAV_BUFFER_SEGMENT
+    #define WAV_BUFFER_SEGMENT  2
+#endif
+
+/**
+ * @brief wav meter clip level definition
+ */
+#ifndef WAV_METER_CLIP_LEVEL
+    #define WAV_METER_CLIP_LEVEL  32767
+#endif
+
+/**
+ * @brief wav stream fade frames definition
+ * @note  length of the fade out before a stream underrun and the fade in after it
+ */
+#ifndef WAV_STREAM_FADE_FRAMES
+    #define WAV_STREAM_FADE_FRAMES  64
+#endif
+
+/**
+ * @brief wav stream shrink fills definition
+ * @note  fills without underrun before the stream target depth shrinks by one segment
+ */
+#ifndef WAV_STREAM_SHRINK_FILLS
+    #define WAV_STREAM_SHRINK_FILLS  500
+#endif
+
+/**
+ * @brief wav fast start size definition
+ * @note  bytes read before the dma starts in the fast start mode
+ */
+#ifndef WAV_FAST_START_SIZE
+    #define WAV_FAST_START_SIZE  512
+#endif
+
+/**
+ * @brief wav cache entry definition
+ * @note  max number of clips kept in the cache
+ */
+#ifndef WAV_CACHE_ENTRY
+    #define WAV_CACHE_ENTRY  32
+#endif
+
+/**
+ * @brief wav cache path size definition
+ * @note  longer paths are played from the file without caching
+ */
+#ifndef WAV_CACHE_PATH_SIZE
+    #define WAV_CACHE_PATH_SIZE  32
+#endif
+
+/**
+ * @brief wav chunk max definition
+ * @note  max number of chunks walked to find the data chunk
+ */
+#ifndef WAV_CHUNK_MAX
+    #define WAV_CHUNK_MAX  16
+#endif
+
+/**
+ * @brief wav record header size definition
+ * @note  riff header with a 36 bytes junk chunk that becomes the rf64 ds64 chunk
+ */
+#define WAV_RECORD_HEADER_SIZE  80
+
+/**
+ * @brief wav segment max definition
+ * @note  max number of dma callbacks per buffer cycle
+ */
+#define WAV_SEGMENT_MAX  64
+
+/**
+ * @brief wav bool enumeration definition
+ */
+typedef enum
+{
+    WAV_BOOL_FALSE = 0x00,        /**< disable */
+    WAV_BOOL_TRUE  = 0x01,        /**< enable */
+} wav_bool_t;
+
 /**
  * @brief wav status enumeration definition
  */
 typedef enum
 {
-    WAV_STATUS_STOP = 0x00,        /**< stop status */
-    WAV_STATUS_PLAY = 0x01,        /**< play status */
+    WAV_STATUS_STOP  = 0x00,        /**< stop status */
+    WAV_STATUS_PLAY  = 0x01,        /**< play status */
+    WAV_STATUS_PAUSE = 0x02,        /**< pause status */
 } wav_status_t;
 
+/**
+ * @brief wav source enumeration definition
+ */
+typedef enum
+{
+    WAV_SOURCE_FILE   = 0x00,        /**< file read through audio_read */
+    WAV_SOURCE_MEMORY = 0x01,        /**< memory resident wav file */
+    WAV_SOURCE_PULL   = 0x02,        /**< pcm pulled from a user callback */
+    WAV_SOURCE_STREAM = 0x03,        /**< pcm pushed into the jitter ring */
+} wav_source_t;
+
 /**
  * @brief wav header structure definition
  */
@@ -88,6 +185,83 @@ typedef struct wav_header_s
     uint32_t sub_chunk2_size;        /**< sub chunk2 size */
 } wav_header_t;
 
+/**
+ * @brief wav meter structure definition
+ */
+typedef struct wav_meter_s
+{
+    uint32_t block;            /**< metered block counter */
+    uint16_t peak[2];          /**< left and right peak level */
+    uint16_t rms[2];           /**< left and right rms level */
+    uint32_t clip[2];          /**< left and right clipped samples in the block */
+} wav_meter_t;
+
+/**
+ * @brief wav health structure definition
+ */
+typedef struct wav_health_s
+{
+    uint32_t fill;             /**< fill count */
+    uint32_t underrun;         /**< play segments with stale data */
+    uint32_t overrun;          /**< record segments overwritten before stored */
+    uint32_t late;             /**< fills finished after the deadline */
+    uint32_t max_fill_us;      /**< max fill duration in us */
+    int32_t min_slack_us;      /**< min time left before the deadline in us */
+} wav_health_t;
+
+/**
+ * @brief wav jitter structure definition
+ */
+typedef struct wav_jitter_s
+{
+    uint32_t packet;           /**< accepted packets */
+    uint32_t late;             /**< packets dropped because they arrived after a newer one */
+    uint32_t lost;             /**< packets missing in the sequence */
+    uint32_t overflow;         /**< packets dropped because the ring was full */
+    uint32_t underrun;         /**< segments concealed by a fade out */
+    uint32_t drop;             /**< bytes skipped to bring the depth back to the target */
+    uint32_t depth;            /**< buffered bytes */
+    uint32_t target;           /**< current target depth in bytes */
+} wav_jitter_t;
+
+/**
+ * @brief wav cache entry structure definition
+ */
+typedef struct wav_cache_entry_s
+{
+    char path[WAV_CACHE_PATH_SIZE];        /**< file path key */
+    uint32_t offset;                       /**< arena offset */
+    uint32_t size;                         /**< cached wav image size */
+    uint32_t stamp;                        /**< last use stamp */
+    uint8_t used;                          /**< used flag */
+} wav_cache_entry_t;
+
+/**
+ * @brief wav cache structure definition
+ */
+typedef struct wav_cache_s
+{
+    uint8_t *arena;                                 /**< clip arena */
+    uint32_t arena_size;                            /**< arena size */
+    uint32_t stamp;                                 /**< use stamp counter */
+    uint32_t hit;                                   /**< cache hits */
+    uint32_t miss;                                  /**< cache misses */
+    uint32_t evict;                                 /**< evicted clips */
+    wav_cache_entry_t entry[WAV_CACHE_ENTRY];       /**< cache entries */
+} wav_cache_t;
+
+/**
+ * @brief wav cache stat structure definition
+ */
+typedef struct wav_cache_stat_s
+{
+    uint32_t hit;              /**< cache hits */
+    uint32_t miss;             /**< cache misses */
+    uint32_t evict;            /**< evicted clips */
+    uint32_t entry;            /**< cached clips */
+    uint32_t used;             /**< used arena bytes */
+} wav_cache_stat_t;
+
 /**
  * @brief wav handle structure definition
  */
@@ -102,18 +276,86 @@ typedef struct wav_handle_s
     uint8_t (*iis_set_freq)(uint32_t freq);                                          /**< point to an iis_set_freq function address */
     uint8_t (*iis_write)(uint16_t *buf, uint16_t len);                               /**< point to an iis_write function address */
     uint8_t (*iis_read)(uint16_t *buf, uint16_t len);                                /**< point to an iis_read function address */
-    uint8_t (*audio_init)(uint8_t type, char *name, uint32_t *size);                 /**< point to an audio_init function address */
+    uint8_t (*audio_init)(uint8_t type, char *name, uint64_t *size);                 /**< point to an audio_init function address */
     uint8_t (*audio_deinit)(void);                                                   /**< point to an audio_deinit function address */
-    uint8_t (*audio_read)(uint32_t addr, uint16_t size, uint8_t *buffer);            /**< point to an audio_read function address */
-    uint8_t (*audio_write)(uint32_t addr, uint16_t size, uint8_t *buffer);           /**< point to an audio_write function address */
+    uint8_t (*audio_read)(uint64_t addr, uint16_t size, uint8_t *buffer);            /**< point to an audio_read function address */
+    uint8_t (*audio_write)(uint64_t addr, uint16_t size, uint8_t *buffer);           /**< point to an audio_write function address */
+    uint8_t (*audio_truncate)(uint64_t size);                                        /**< point to an audio_truncate function address */
     void (*delay_ms)(uint32_t ms);                                                   /**< point to a delay_ms function address */
     void (*debug_print)(const char *const fmt, ...);                                 /**< point to a debug_print function address */ 
+    uint32_t (*timestamp_us)(void);                                                  /**< point to a timestamp_us function address */
+    uint8_t (*mute)(uint8_t enable);                                                 /**< point to a mute function address */
+    uint8_t (*iis_get_remain)(uint16_t *remain);                                     /**< point to an iis_get_remain function address */
+    uint8_t (*iis_write_once)(uint16_t *buf, uint16_t len);                          /**< point to an iis_write_once function address */
     uint8_t inited;                                                                  /**< inited flag */
     uint8_t status;                                                                  /**< status */
     wav_header_t wav;                                                                /**< wav header */
-    uint32_t size;                                                                   /**< audio size */
-    uint32_t pos;                                                                    /**< buffer pos */
-    uint8_t buf[WAV_BUFFER_SIZE];                                                    /**< buffer size */
+    uint64_t size;                                                                   /**< audio size */
+    uint64_t pos;                                                                    /**< buffer pos */
+    uint8_t *buf;                                                                    /**< buffer */
+    uint32_t buf_size;                                                               /**< buffer size */
+    uint32_t segment_size;                                                           /**< segment size */
+    uint8_t segment;                                                                 /**< segment number */
+    uint8_t meter_enable;                                                            /**< meter enable flag */
+    volatile uint32_t meter_sequence;                                                /**< meter snapshot sequence */
+    volatile wav_meter_t meter;                                                      /**< meter snapshot */
+    uint8_t *ring;                                                                   /**< pre trigger ring */
+    uint32_t ring_count;                                                             /**< ring segment number */
+    uint32_t ring_head;                                                              /**< ring write segment */
+    uint32_t ring_fill;                                                              /**< ring filled segments */
+    uint16_t trigger_level;                                                          /**< trigger peak level */
+    volatile uint8_t triggered;                                                      /**< triggered flag */
+    uint8_t record_next;                                                             /**< next segment to be written */
+    uint32_t checkpoint_second;                                                      /**< header checkpoint period in seconds */
+    uint64_t checkpoint_pos;                                                         /**< file position of the last checkpoint */
+    uint32_t prealloc_second;                                                        /**< record pre allocation in seconds */
+    char *record_path;                                                               /**< record file path */
+    volatile uint32_t health_sequence;                                               /**< health snapshot sequence */
+    volatile wav_health_t health;                                                    /**< health counters */
+    volatile uint8_t health_clear;                                                   /**< health clear request */
+    uint8_t health_next;                                                             /**< next expected segment */
+    uint32_t health_period_us;                                                       /**< segment period in us */
+    uint8_t source;                                                                  /**< player source */
+    const uint8_t *mem;                                                              /**< memory source data */
+    uint8_t mem_direct;                                                              /**< memory played in place flag */
+    uint32_t mem_window;                                                             /**< bytes played in place */
+    uint8_t (*pull)(uint8_t *buf, uint32_t len, uint32_t *got);                      /**< pull source callback */
+    wav_cache_t *cache;                                                              /**< clip cache */
+    uint8_t fast_start;                                                              /**< fast start flag */
+    volatile uint8_t prime_active;                                                   /**< fast start priming flag */
+    volatile uint8_t prime_busy;                                                     /**< priming read in progress flag */
+    volatile uint32_t prime_seg;                                                     /**< segments primed since the start */
+    volatile uint32_t prime_played;                                                  /**< segments released since the start */
+    uint32_t prime_head;                                                             /**< bytes of the next segment already read */
+    uint64_t prime_base;                                                             /**< source position of the first segment */
+    uint32_t prime_t0;                                                               /**< start timestamp in us */
+    uint32_t start_first_us;                                                         /**< time to the first sample in us */
+    uint32_t start_primed_us;                                                        /**< time to the full buffer in us */
+    uint8_t pause_phase;                                                             /**< soft pause phase */
+    uint8_t unmute_count;                                                            /**< fills left before the unmute */
+    volatile uint8_t drain;                                                          /**< end of data reached flag */
+    uint8_t drain_index;                                                             /**< segment holding the last sample */
+    volatile uint8_t drain_live;                                                     /**< dma plays the last segment flag */
+    uint32_t drain_end;                                                              /**< buffer offset after the last sample */
+    uint64_t seg_pos[WAV_SEGMENT_MAX];                                               /**< source position of each segment */
+    uint64_t seg_data;                                                               /**< segments holding source data mask */
+    uint64_t pause_pos;                                                              /**< source position of the first muted sample */
+    void (*end_callback)(void);                                                      /**< end of play callback */
+    uint8_t *stream;                                                                 /**< stream jitter ring */
+    uint32_t stream_size;                                                            /**< stream ring size */
+    uint32_t stream_wr;                                                              /**< stream ring write index */
+    uint32_t stream_rd;                                                              /**< stream ring read index */
+    volatile uint32_t stream_in;                                                     /**< stream pushed bytes */
+    volatile uint32_t stream_out;                                                    /**< stream played bytes */
+    uint32_t stream_target;                                                          /**< current target depth in bytes */
+    uint32_t stream_target_min;                                                      /**< configured target depth in bytes */
+    uint32_t stream_good;                                                            /**< fills since the last underrun */
+    uint16_t stream_seq;                                                             /**< next expected sequence */
+    uint8_t stream_seq_valid;                                                        /**< sequence valid flag */
+    uint8_t stream_run;                                                              /**< stream running flag */
+    uint8_t stream_fade_in;                                                          /**< fade in pending flag */
+    volatile uint32_t jitter_sequence;                                               /**< jitter snapshot sequence */
+    volatile wav_jitter_t jitter;                                                    /**< jitter buffer counters */
 } wav_handle_t;
 
 /**
@@ -156,6 +398,14 @@ typedef struct wav_handle_s
  */
 #define WAV_LINK_AUDIO_WRITE(HANDLE, FUC)    (HANDLE)->audio_write = FUC
 
+/**
+ * @brief     link audio_truncate function
+ * @param[in] HANDLE pointer to a wav handle structure
+ * @param[in] FUC pointer to an audio_truncate function address
+ * @note      optional, cuts a pre allocated record file to its real length at the stop
+ */
+#define WAV_LINK_AUDIO_TRUNCATE(HANDLE, FUC) (HANDLE)->audio_truncate = FUC
+
 /**
  * @brief     link iis_init function
  * @param[in] HANDLE pointer to a wav handle structure
@@ -236,6 +486,40 @@ typedef struct wav_handle_s
  */
 #define WAV_LINK_DEBUG_PRINT(HANDLE, FUC)    (HANDLE)->debug_print = FUC
 
+/**
+ * @brief     link timestamp_us function
+ * @param[in] HANDLE pointer to a wav handle structure
+ * @param[in] FUC pointer to a timestamp_us function address
+ * @note      optional, it enables the fill duration and slack measurement
+ */
+#define WAV_LINK_TIMESTAMP_US(HANDLE, FUC)   (HANDLE)->timestamp_us = FUC
+
+/**
+ * @brief     link mute function
+ * @param[in] HANDLE pointer to a wav handle structure
+ * @param[in] FUC pointer to a mute function address
+ * @note      optional, a codec soft mute enables the click free pause
+ */
+#define WAV_LINK_MUTE(HANDLE, FUC)           (HANDLE)->mute = FUC
+
+/**
+ * @brief     link iis_get_remain function
+ * @param[in] HANDLE pointer to a wav handle structure
+ * @param[in] FUC pointer to an iis_get_remain function address
+ * @note      optional, the remaining dma count in half words of the running transfer,
+ *            rx lets the record stop keep the partial segment,
+ *            tx lets wav_player_service end the play right after the last sample
+ */
+#define WAV_LINK_IIS_GET_REMAIN(HANDLE, FUC) (HANDLE)->iis_get_remain = FUC
+
+/**
+ * @brief     link iis_write_once function
+ * @param[in] HANDLE pointer to a wav handle structure
+ * @param[in] FUC pointer to an iis_write_once function address
+ * @note      optional, a single non circular transfer lets the memory source play in place
+ */
+#define WAV_LINK_IIS_WRITE_ONCE(HANDLE, FUC) (HANDLE)->iis_write_once = FUC
+
 /**
  * @brief     initialize the wav
  * @param[in] *handle pointer to a wav handle structure
@@ -273,6 +557,89 @@ uint8_t wav_deinit(wav_handle_t *handle);
  */
 uint8_t wav_player_init(wav_handle_t *handle, char *path);
 
+/**
+ * @brief     initialize the wav player with a memory resident wav file
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] *data pointer to the wav file data
+ * @param[in] len data length in bytes
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 format is invalid
+ *            - 5 data is invalid
+ * @note      when iis_write_once is linked and the pcm data is 4 bytes aligned, dma capable and not longer
+ *            than 131070 bytes wav_player_start hands it to the dma in place as one non circular transfer,
+ *            otherwise it is copied segment by segment,
+ *            data must stay valid until the play ends
+ */
+uint8_t wav_player_init_memory(wav_handle_t *handle, const uint8_t *data, uint32_t len);
+
+/**
+ * @brief     initialize the wav player with a pull callback
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] *pull pointer to a pull callback
+ * @param[in] sample_rate sample rate
+ * @param[in] num_channel channel number
+ * @param[in] bit_per_sample bits per sample
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 pull is NULL
+ *            - 5 format is invalid
+ * @note      pull fills buf with up to len bytes of pcm from the dma callback context,
+ *            returns 0 on success and sets *got, a short read marks the end of the source
+ */
+uint8_t wav_player_init_pull(wav_handle_t *handle, uint8_t (*pull)(uint8_t *buf, uint32_t len, uint32_t *got), 
+                             uint32_t sample_rate, uint16_t num_channel, uint16_t bit_per_sample);
+
+/**
+ * @brief     attach a clip cache to the player
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] *cache pointer to a wav cache structure, NULL detaches the cache
+ * @param[in] *arena pointer to an arena buffer
+ * @param[in] size arena size in bytes
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 arena is invalid
+ *            - 5 be playing
+ * @note      arena must be 4 bytes aligned and dma capable, the cache starts empty
+ */
+uint8_t wav_set_cache(wav_handle_t *handle, wav_cache_t *cache, uint8_t *arena, uint32_t size);
+
+/**
+ * @brief     initialize the wav player through the clip cache
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] *path pointer to a path buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 play failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 format is invalid
+ *            - 5 cache is not set
+ *            - 6 be playing
+ * @note      a hit plays the cached clip from memory, a miss loads the whole clip into the arena
+ *            evicting the least recently used clips, a clip larger than the arena is played from the file
+ */
+uint8_t wav_player_init_cached(wav_handle_t *handle, char *path);
+
+/**
+ * @brief      get the clip cache counters
+ * @param[in]  *handle pointer to a wav handle structure
+ * @param[out] *stat pointer to a wav cache stat structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 cache is not set
+ * @note       none
+ */
+uint8_t wav_cache_get_stat(wav_handle_t *handle, wav_cache_stat_t *stat);
+
 /**
  * @brief     wav player buffer fill
  * @param[in] *handle pointer to a wav handle structure
@@ -283,7 +650,8 @@ uint8_t wav_player_init(wav_handle_t *handle, char *path);
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  *            - 4 not playing
- * @note      none
+ *            - 5 index is invalid
+ * @note      index is the segment just released by the dma, from 0 to segment - 1
  */
 uint8_t wav_player_buffer_fill(wav_handle_t *handle, uint8_t index);
 
@@ -297,7 +665,8 @@ uint8_t wav_player_buffer_fill(wav_handle_t *handle, uint8_t index);
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  *            - 4 not recording
- * @note      none
+ *            - 5 index is invalid
+ * @note      index is the segment just filled by the dma, from 0 to segment - 1
  */
 uint8_t wav_record_file_fill(wav_handle_t *handle, uint8_t index);
 
@@ -345,7 +714,8 @@ uint8_t wav_player_config(wav_handle_t *handle, uint32_t standard,
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  *            - 4 be recording
- * @note      none
+ *            - 5 buffer is not set
+ * @note      the file is opened, pre allocated and its header written before the dma starts
  */
 uint8_t wav_record_start(wav_handle_t *handle, uint32_t sample_rate, char *path);
 
@@ -358,7 +728,9 @@ uint8_t wav_record_start(wav_handle_t *handle, uint32_t sample_rate, char *path)
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  *            - 4 not recording
- * @note      none
+ * @note      with the iis_get_remain link the samples received after the last filled segment
+ *            are written up to the dma position at the stop,
+ *            a record that was never triggered is closed with no data
  */
 uint8_t wav_record_stop(wav_handle_t *handle);
 
@@ -371,10 +743,69 @@ uint8_t wav_record_stop(wav_handle_t *handle);
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  *            - 4 be playing
- * @note      none
+ *            - 5 buffer is not set
+ * @note      with fast start only WAV_FAST_START_SIZE bytes are read before the dma starts,
+ *            the rest of the buffer is read by wav_player_service while the head is playing
  */
 uint8_t wav_player_start(wav_handle_t *handle);
 
+/**
+ * @brief      wav player service
+ * @param[in]  *handle pointer to a wav handle structure
+ * @param[out] *primed pointer to a primed buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 service failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       call it from the main loop, after a fast start each call reads the next segment ahead of the dma,
+ *             primed is true once the fills took over, underruns while priming are counted in the health,
+ *             with the iis_get_remain link it ends the play as soon as the dma passes the last sample
+ */
+uint8_t wav_player_service(wav_handle_t *handle, wav_bool_t *primed);
+
+/**
+ * @brief     enable or disable the fast start
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the main loop must call wav_player_service until it reports primed,
+ *            each segment must be read faster than the dma plays one
+ */
+uint8_t wav_player_set_fast_start(wav_handle_t *handle, wav_bool_t enable);
+
+/**
+ * @brief      get the start timing of the last wav_player_start
+ * @param[in]  *handle pointer to a wav handle structure
+ * @param[out] *first_us pointer to a first sample time buffer
+ * @param[out] *primed_us pointer to a primed time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       first_us is from the call to the dma start, primed_us until the whole buffer is read,
+ *             with fast start until the fills take over, both need the timestamp_us link
+ */
+uint8_t wav_player_get_start_time(wav_handle_t *handle, uint32_t *first_us, uint32_t *primed_us);
+
+/**
+ * @brief     set the end of play callback
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] *end_callback pointer to an end callback, NULL disables it
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the callback runs after the last valid sample has been played and the iis is stopped,
+ *            from wav_player_service within one poll when the iis_get_remain link is set,
+ *            otherwise from the dma callback once the segment holding it is released,
+ *            up to one segment period later, it is not called by wav_player_stop
+ */
+uint8_t wav_player_set_end_callback(wav_handle_t *handle, void (*end_callback)(void));
+
 /**
  * @brief     wav player stop
  * @param[in] *handle pointer to a wav handle structure
@@ -397,7 +828,10 @@ uint8_t wav_player_stop(wav_handle_t *handle);
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  *            - 4 not playing
- * @note      none
+ *            - 5 start is priming
+ * @note      with the mute link the dma keeps running, the codec soft mute starts at the next
+ *            segment boundary, silence is fed from then on and file and memory sources are moved
+ *            back to the first muted sample, without the link or for in place memory clips iis_pause is used
  */
 uint8_t wav_player_pause(wav_handle_t *handle);
 
@@ -409,11 +843,208 @@ uint8_t wav_player_pause(wav_handle_t *handle);
  *            - 1 resume failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 be playing
- * @note      none
+ *            - 4 not paused
+ * @note      after a soft pause the next fill restarts the source from the first muted sample
+ *            and the codec is unmuted when the dma reaches it, within one dma buffer period
  */
 uint8_t wav_player_resume(wav_handle_t *handle);
 
+/**
+ * @brief     set the audio buffer
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] *buf pointer to a buffer
+ * @param[in] size buffer size in bytes
+ * @param[in] segment number of dma callbacks per buffer cycle
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 buf is invalid
+ *            - 5 size is invalid
+ *            - 6 segment is invalid
+ *            - 7 be playing or recording
+ * @note      buf must be 4 bytes aligned and dma capable, size must be a multiple of segment * 4
+ *            and not larger than 131070, segment must match the iis layer, 2 for half and complete
+ */
+uint8_t wav_set_buffer(wav_handle_t *handle, uint8_t *buf, uint32_t size, uint8_t segment);
+
+/**
+ * @brief     set the record pre trigger ring
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] *ring pointer to a ring buffer, NULL disables the pre trigger mode
+ * @param[in] size ring size in bytes
+ * @param[in] level trigger peak level, 0 means only wav_record_trigger fires
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 buffer is not set
+ *            - 5 size is invalid
+ *            - 6 be recording
+ * @note      size must be a multiple of the segment size and sets the pre roll,
+ *            e.g. 2s at 22050Hz stereo 16 bits is 2 * 88200 bytes rounded to segments,
+ *            the file is opened by wav_record_start and no audio data is written until the trigger fires
+ */
+uint8_t wav_record_set_pretrigger(wav_handle_t *handle, uint8_t *ring, uint32_t size, uint16_t level);
+
+/**
+ * @brief     fire the record trigger
+ * @param[in] *handle pointer to a wav handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 not recording
+ *            - 5 pre trigger is not set
+ * @note      the pre roll is written first, then the live data
+ */
+uint8_t wav_record_trigger(wav_handle_t *handle);
+
+/**
+ * @brief      get the record trigger status
+ * @param[in]  *handle pointer to a wav handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t wav_record_get_trigger(wav_handle_t *handle, wav_bool_t *enable);
+
+/**
+ * @brief     set the record header checkpoint
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] second checkpoint period in seconds, 0 disables it
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      every period the riff and data sizes are rewritten with one 80 bytes header write
+ *            from the fill, so a file cut by a power loss opens with at most one period missing,
+ *            the audio_write interface should commit the header write to the medium
+ */
+uint8_t wav_record_set_checkpoint(wav_handle_t *handle, uint32_t second);
+
+/**
+ * @brief     set the record file pre allocation
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] second expected record length in seconds, 0 disables it
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the size is passed to audio_init as a hint when the record file is opened,
+ *            the file is cut to its real length at the stop with the audio_truncate link
+ */
+uint8_t wav_record_set_preallocate(wav_handle_t *handle, uint32_t second);
+
+/**
+ * @brief      get the streaming health counters
+ * @param[in]  *handle pointer to a wav handle structure
+ * @param[out] *health pointer to a wav health structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       max_fill_us and min_slack_us need the timestamp_us link
+ */
+uint8_t wav_get_health(wav_handle_t *handle, wav_health_t *health);
+
+/**
+ * @brief     clear the streaming health counters
+ * @param[in] *handle pointer to a wav handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      while streaming the counters are cleared by the next fill
+ */
+uint8_t wav_clear_health(wav_handle_t *handle);
+
+/**
+ * @brief     enable or disable the level meter
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the meter works on 16 bits pcm blocks in wav_player_buffer_fill and wav_record_file_fill
+ */
+uint8_t wav_set_meter(wav_handle_t *handle, wav_bool_t enable);
+
+/**
+ * @brief      get the latest level meter snapshot
+ * @param[in]  *handle pointer to a wav handle structure
+ * @param[out] *meter pointer to a wav meter structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       lock free, it can be called from the main loop while the dma callback updates the meter
+ */
+uint8_t wav_get_meter(wav_handle_t *handle, wav_meter_t *meter);
+
+/**
+ * @brief     set a pushed pcm stream as the player source
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] *ring pointer to a jitter ring buffer
+ * @param[in] size ring size in bytes
+ * @param[in] sample_rate sample rate
+ * @param[in] num_channel channel number, 1 or 2
+ * @param[in] target_ms target depth in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 buffer is not set
+ *            - 5 ring is invalid
+ *            - 6 format is invalid
+ *            - 7 target is invalid
+ *            - 8 be playing
+ * @note      the stream is 16 bits little endian pcm and replaces wav_player_init,
+ *            ring must be 4 bytes aligned with a size of a multiple of 4,
+ *            the target is raised to one segment plus the fade if it is smaller,
+ *            it must leave at least one segment free in the ring
+ */
+uint8_t wav_stream_init(wav_handle_t *handle, uint8_t *ring, uint32_t size, 
+                        uint32_t sample_rate, uint16_t num_channel, uint16_t target_ms);
+
+/**
+ * @brief     push one pcm packet into the stream
+ * @param[in] *handle pointer to a wav handle structure
+ * @param[in] seq packet sequence number
+ * @param[in] *buf pointer to a pcm buffer
+ * @param[in] len buffer length in bytes
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 stream is not set
+ *            - 5 len is invalid
+ *            - 6 packet is late
+ *            - 7 ring is full
+ * @note      len must be a multiple of the frame size, a sequence gap is counted as lost,
+ *            a sequence older than the last one is late and dropped,
+ *            push runs in one context and wav_player_buffer_fill in another without a lock
+ */
+uint8_t wav_stream_push(wav_handle_t *handle, uint16_t seq, const uint8_t *buf, uint32_t len);
+
+/**
+ * @brief      get the jitter buffer counters
+ * @param[in]  *handle pointer to a wav handle structure
+ * @param[out] *jitter pointer to a wav jitter structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 stream is not set
+ * @note       depth is the fill level, it can feed a clock drift estimator,
+ *             the read is retried while the push or a fill updates the counters
+ */
+uint8_t wav_stream_get_jitter(wav_handle_t *handle, wav_jitter_t *jitter);
+
 /**
  * @}
  */